@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     BenchUtil.hpp
+ * @brief    基准测试公共函数
+ * @author   Bwar
+ * @date:    2026年10月19日
+ * @note     各基准测试为独立的可执行程序，链接libnebula.so，只测量单线程内
+ *           被测函数的耗时，不依赖事件循环和配置文件。
+ * Modify history:
+ ******************************************************************************/
+#ifndef BENCH_BENCHUTIL_HPP_
+#define BENCH_BENCHUTIL_HPP_
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <time.h>
+
+namespace neb
+{
+namespace bench
+{
+
+inline double NowSeconds()
+{
+    struct timespec stTime;
+    clock_gettime(CLOCK_MONOTONIC, &stTime);
+    return((double)stTime.tv_sec + (double)stTime.tv_nsec / 1000000000.0);
+}
+
+/**
+ * @brief 输出一项测试结果
+ * @param szName 测试项名称
+ * @param ullOps 操作次数
+ * @param dSeconds 耗时（秒）
+ * @param ullBytes 处理的字节数，为0时不输出吞吐量
+ */
+inline void Report(const char* szName, uint64_t ullOps, double dSeconds, uint64_t ullBytes = 0)
+{
+    if (dSeconds <= 0.0)
+    {
+        dSeconds = 1e-9;
+    }
+    if (ullBytes > 0)
+    {
+        printf("%-40s %12llu ops %10.3f ms %12.0f ops/s %10.2f MB/s %10.1f ns/op\n",
+                szName, (unsigned long long)ullOps, dSeconds * 1000.0, (double)ullOps / dSeconds,
+                (double)ullBytes / dSeconds / 1048576.0, dSeconds * 1e9 / (double)ullOps);
+    }
+    else
+    {
+        printf("%-40s %12llu ops %10.3f ms %12.0f ops/s %10.1f ns/op\n",
+                szName, (unsigned long long)ullOps, dSeconds * 1000.0, (double)ullOps / dSeconds,
+                dSeconds * 1e9 / (double)ullOps);
+    }
+}
+
+/**
+ * @brief 校验失败时退出，避免测出错误路径的耗时
+ */
+inline void Check(bool bCondition, const char* szWhat)
+{
+    if (!bCondition)
+    {
+        fprintf(stderr, "check failed: %s\n", szWhat);
+        exit(1);
+    }
+}
+
+/**
+ * @brief 阻止编译器优化掉未使用的计算结果
+ */
+template <typename T>
+inline void DoNotOptimize(const T& oValue)
+{
+    asm volatile("" : : "r,m"(oValue) : "memory");
+}
+
+} /* namespace bench */
+} /* namespace neb */
+
+#endif /* BENCH_BENCHUTIL_HPP_ */
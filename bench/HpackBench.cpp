@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     HpackBench.cpp
+ * @brief    HPACK编解码基准测试
+ * @author   nebim
+ * @date:    2026-10-19
+ * @note     以gRPC请求和响应的典型header（含每个请求不同的x-trace-id）测试
+ *           CodecHttp2::PackHeader()和UnpackHeader()：客户端编解码器编码请求头、
+ *           服务端编解码器解码，再由服务端编码响应头和trailer、客户端解码，
+ *           编码端和解码端的动态表保持同步。分别测试使用和不使用Huffman编码。
+ * Modify history:
+ ******************************************************************************/
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include "codec/http2/CodecHttp2.hpp"
+#include "logger/NetLogger.hpp"
+#include "BenchUtil.hpp"
+
+using namespace neb;
+
+static void AddHeader(google::protobuf::RepeatedPtrField<HttpMsg::Header>* pHeaders,
+        const std::string& strName, const std::string& strValue)
+{
+    HttpMsg::Header* pHeader = pHeaders->Add();
+    pHeader->set_name(strName);
+    pHeader->set_value(strValue);
+}
+
+static void MakeGrpcRequest(uint32 uiRequestId, bool bWithHuffman, HttpMsg& oHttpMsg)
+{
+    char szTraceId[40];
+    snprintf(szTraceId, sizeof(szTraceId), "%08x%08x%08x", uiRequestId * 2654435761u, uiRequestId, 20261019u);
+    oHttpMsg.Clear();
+    oHttpMsg.set_with_huffman(bWithHuffman);
+    AddHeader(oHttpMsg.mutable_pseudo_header(), ":method", "POST");
+    AddHeader(oHttpMsg.mutable_pseudo_header(), ":scheme", "http");
+    AddHeader(oHttpMsg.mutable_pseudo_header(), ":path",
+            (uiRequestId & 1) ? "/helloworld.Greeter/SayHello" : "/routeguide.RouteGuide/GetFeature");
+    AddHeader(oHttpMsg.mutable_pseudo_header(), ":authority", "backend.nebula:50051");
+    auto& mapHeader = *oHttpMsg.mutable_headers();
+    mapHeader["content-type"] = "application/grpc";
+    mapHeader["te"] = "trailers";
+    mapHeader["grpc-accept-encoding"] = "identity,deflate,gzip";
+    mapHeader["user-agent"] = "grpc-c++/1.46.3 grpc-c/24.0.0 (linux; chttp2)";
+    mapHeader["grpc-timeout"] = "1S";
+    mapHeader["x-trace-id"] = szTraceId;
+}
+
+static void MakeGrpcResponse(bool bWithHuffman, HttpMsg& oHttpMsg)
+{
+    oHttpMsg.Clear();
+    oHttpMsg.set_with_huffman(bWithHuffman);
+    AddHeader(oHttpMsg.mutable_pseudo_header(), ":status", "200");
+    auto& mapHeader = *oHttpMsg.mutable_headers();
+    mapHeader["content-type"] = "application/grpc";
+    mapHeader["grpc-encoding"] = "identity";
+    mapHeader["grpc-accept-encoding"] = "identity,deflate,gzip";
+    AddHeader(oHttpMsg.mutable_trailer_header(), "grpc-status", "0");
+    AddHeader(oHttpMsg.mutable_trailer_header(), "grpc-message", "");
+}
+
+/**
+ * @brief 编码iBlocks个header block到同一缓冲区，再按顺序解码
+ */
+static void BenchHpack(const char* szName, CodecHttp2& oEncoder, CodecHttp2& oDecoder,
+        std::vector<HttpMsg>& vecHttpMsg, int iHeaderType)
+{
+    CBuffer oBuff;
+    std::vector<size_t> vecBlockEnd(vecHttpMsg.size());
+    char szItemName[64];
+
+    double dBegin = bench::NowSeconds();
+    for (size_t i = 0; i < vecHttpMsg.size(); ++i)
+    {
+        oEncoder.PackHeader(vecHttpMsg[i], iHeaderType, &oBuff);
+        vecBlockEnd[i] = oBuff.GetWriteIndex();
+    }
+    double dElapsed = bench::NowSeconds() - dBegin;
+    uint64_t ullBytes = oBuff.ReadableBytes();
+    snprintf(szItemName, sizeof(szItemName), "%s encode", szName);
+    bench::Report(szItemName, vecHttpMsg.size(), dElapsed);
+    printf("%-40s %12.1f bytes/block\n", "", (double)ullBytes / (double)vecHttpMsg.size());
+
+    HttpMsg oDecoded;
+    size_t uiHeaderNum = 0;
+    dBegin = bench::NowSeconds();
+    for (size_t i = 0; i < vecHttpMsg.size(); ++i)
+    {
+        oDecoded.Clear();
+        E_CODEC_STATUS eStatus = oDecoder.UnpackHeader(vecBlockEnd[i], &oBuff, oDecoded);
+        bench::Check(CODEC_STATUS_PART_OK == eStatus, "unpack header");
+        uiHeaderNum += oDecoded.headers_size() + oDecoded.trailer_header_size();
+    }
+    dElapsed = bench::NowSeconds() - dBegin;
+    bench::Check(0 == oBuff.ReadableBytes(), "all blocks decoded");
+    bench::Check(uiHeaderNum > 0, "headers decoded");
+    snprintf(szItemName, sizeof(szItemName), "%s decode", szName);
+    bench::Report(szItemName, vecHttpMsg.size(), dElapsed, ullBytes);
+}
+
+int main(int argc, char* argv[])
+{
+    int iBlocks = (argc > 1) ? atoi(argv[1]) : 200000;
+    auto pLogger = std::make_shared<NetLogger>("/tmp/nebula_bench.log", Logger::ERROR);
+    printf("%d header blocks per round\n", iBlocks);
+    for (int iHuffman = 0; iHuffman < 2; ++iHuffman)
+    {
+        bool bWithHuffman = (1 == iHuffman);
+        CodecHttp2 oClient(pLogger, CODEC_HTTP2, true);
+        CodecHttp2 oServer(pLogger, CODEC_HTTP2, false);
+        std::vector<HttpMsg> vecRequest(iBlocks);
+        std::vector<HttpMsg> vecResponse(iBlocks);
+        for (int i = 0; i < iBlocks; ++i)
+        {
+            MakeGrpcRequest(i, bWithHuffman, vecRequest[i]);
+            MakeGrpcResponse(bWithHuffman, vecResponse[i]);
+        }
+        BenchHpack(bWithHuffman ? "grpc request huffman" : "grpc request",
+                oClient, oServer, vecRequest, H2_HEADER_PSEUDO | H2_HEADER_NORMAL);
+        BenchHpack(bWithHuffman ? "grpc response huffman" : "grpc response",
+                oServer, oClient, vecResponse, H2_HEADER_PSEUDO | H2_HEADER_NORMAL | H2_HEADER_TRAILER);
+    }
+    return(0);
+}
@@ -0,0 +1,312 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     Http2PushBench.cpp
+ * @brief    HTTP2 server push基准测试
+ * @author   nebim
+ * @date:    2026-10-19
+ * @note     客户端和服务端两个CodecHttp2经内存缓冲区对接，模拟首次打开页面：客户端
+ *           请求/index.html，响应的link头以rel=preload列出页面引用的资源。
+ *           1. 不推送：客户端以SETTINGS_ENABLE_PUSH=0关闭推送，收到页面后按link头
+ *              再请求各资源；
+ *           2. 推送：资源预先放入推送缓存，服务端随页面推送。
+ *           每个页面使用新连接，统计每页的请求数、往返次数、字节数和编解码耗时，
+ *           延迟按“往返次数 * RTT + 编解码耗时”估算（不含传输时间），RTT由参数指定。
+ *           客户端的流控窗口为65535字节，超出窗口的响应数据等待WINDOW_UPDATE的往返
+ *           也计入往返次数。
+ *           参数：页面数 每页资源数 资源字节数 RTT(ms)
+ * Modify history:
+ ******************************************************************************/
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "codec/http2/CodecHttp2.hpp"
+#include "codec/http2/Http2Frame.hpp"
+#include "logger/NetLogger.hpp"
+#include "BenchUtil.hpp"
+
+using namespace neb;
+
+static const char* INDEX_PATH = "/index.html";
+
+struct tagPageStat
+{
+    uint64_t ullRequests = 0;
+    uint64_t ullPushed = 0;
+    uint64_t ullRoundTrips = 0;
+    uint64_t ullBytes = 0;
+};
+
+/**
+ * @brief 客户端加载一个页面的状态
+ */
+struct tagPageLoad
+{
+    uint32 uiIndexStreamId = 0;
+    uint32 uiPromised = 0;                      ///< 收到的PUSH_PROMISE数
+    bool bIndexHeaders = false;                 ///< 是否已收到页面响应的HEADERS帧
+    std::unordered_set<std::string> setReceived; ///< 已收到的资源（content-location）
+    tagPageStat stStat;
+};
+
+class PushBenchSite
+{
+public:
+    PushBenchSite(int iResources, size_t uiResourceSize)
+    {
+        std::string strLink;
+        for (int i = 0; i < iResources; ++i)
+        {
+            char szPath[32];
+            snprintf(szPath, sizeof(szPath), (i & 1) ? "/js/app%d.js" : "/css/app%d.css", i);
+            HttpMsg& oResource = m_mapResource[szPath];
+            oResource.set_status_code(200);
+            (*oResource.mutable_headers())["content-type"] = (i & 1) ? "application/javascript" : "text/css";
+            (*oResource.mutable_headers())["cache-control"] = "max-age=31536000, public";
+            (*oResource.mutable_headers())["content-location"] = szPath;   // 客户端据此识别推送的资源
+            oResource.set_body(std::string(uiResourceSize, (char)('a' + i % 26)));
+            if (!strLink.empty())
+            {
+                strLink.append(", ");
+            }
+            strLink.append("<").append(szPath).append((i & 1) ? ">; rel=preload; as=script" : ">; rel=preload; as=style");
+        }
+        m_oIndex.set_status_code(200);
+        (*m_oIndex.mutable_headers())["content-type"] = "text/html; charset=utf-8";
+        (*m_oIndex.mutable_headers())["link"] = strLink;
+        m_oIndex.set_body(std::string(8192, 'h'));
+    }
+
+    void EnablePush(bool bEnable)
+    {
+        for (auto& rResource : m_mapResource)
+        {
+            if (bEnable)
+            {
+                bench::Check(CodecHttp2::AddPushResource(rResource.first, rResource.second), "add push resource");
+            }
+            else
+            {
+                CodecHttp2::RemovePushResource(rResource.first);
+            }
+        }
+    }
+
+    size_t ResourceNum() const
+    {
+        return(m_mapResource.size());
+    }
+
+    const HttpMsg* Find(const std::string& strPath) const
+    {
+        if (strPath == INDEX_PATH)
+        {
+            return(&m_oIndex);
+        }
+        auto iter = m_mapResource.find(strPath);
+        return((iter == m_mapResource.end()) ? nullptr : &iter->second);
+    }
+
+private:
+    HttpMsg m_oIndex;
+    std::unordered_map<std::string, HttpMsg> m_mapResource;
+};
+
+/**
+ * @brief 服务端解码收到的数据，对每个请求发送响应
+ */
+static void ServerRead(const PushBenchSite& oSite, CodecHttp2& oServer, CBuffer& oIn, CBuffer& oOut)
+{
+    HttpMsg oRequest;
+    while (oIn.ReadableBytes() > 0)
+    {
+        oRequest.Clear();
+        E_CODEC_STATUS eStatus = oServer.Decode(&oIn, oRequest, &oOut);
+        bench::Check(CODEC_STATUS_OK == eStatus || CODEC_STATUS_PART_OK == eStatus, "server decode");
+        if (CODEC_STATUS_OK != eStatus || 0 == oRequest.stream_id())
+        {
+            continue;
+        }
+        const HttpMsg* pContent = oSite.Find(oRequest.path());
+        bench::Check(pContent != nullptr, "request path");
+        HttpMsg oResponse(*pContent);
+        oResponse.set_type(HTTP_RESPONSE);
+        oResponse.set_http_major(2);
+        oResponse.set_stream_id(oRequest.stream_id());
+        // 超出流控窗口的数据排队（CODEC_STATUS_PART_OK），收到WINDOW_UPDATE后发出
+        eStatus = oServer.Encode(oResponse, &oOut);
+        bench::Check(CODEC_STATUS_OK == eStatus || CODEC_STATUS_PART_OK == eStatus, "server encode");
+    }
+}
+
+/**
+ * @brief 客户端解码收到的数据，页面的响应按link头再请求资源
+ * @note PUSH_PROMISE先于页面的响应到达，推送资源的响应在页面的响应之后，推送按link头的顺序进行，客户端只请求
+ * 未被承诺推送的资源；收到的资源不重复由页面加载结束时的校验保证
+ * @return 本次发出的请求数
+ */
+static uint32 ClientRead(CodecHttp2& oClient, CBuffer& oIn, CBuffer& oOut, tagPageLoad& stPage)
+{
+    HttpMsg oResponse;
+    std::vector<std::string> vecPath;
+    while (oIn.ReadableBytes() > 0)
+    {
+        // 解码后的消息不含被承诺的请求，按帧头的帧类型统计PUSH_PROMISE，并校验推送资源的
+        // HEADERS、DATA帧排在页面响应的HEADERS帧之后
+        if (oIn.ReadableBytes() >= 9)
+        {
+            const unsigned char* pFrameHead = (const unsigned char*)oIn.GetRawReadBuffer();
+            uint8 ucType = pFrameHead[3];
+            uint32 uiStreamId = (((uint32)pFrameHead[5] << 24) | ((uint32)pFrameHead[6] << 16)
+                    | ((uint32)pFrameHead[7] << 8) | (uint32)pFrameHead[8]) & 0x7FFFFFFF;
+            if (H2_FRAME_PUSH_PROMISE == ucType)
+            {
+                ++stPage.uiPromised;
+            }
+            else if (H2_FRAME_HEADERS == ucType && uiStreamId == stPage.uiIndexStreamId)
+            {
+                stPage.bIndexHeaders = true;
+            }
+            else if ((H2_FRAME_HEADERS == ucType || H2_FRAME_DATA == ucType)
+                    && uiStreamId != 0 && 0 == (uiStreamId & 1))
+            {
+                bench::Check(stPage.bIndexHeaders, "pushed response before the page response");
+            }
+        }
+        oResponse.Clear();
+        E_CODEC_STATUS eStatus = oClient.Decode(&oIn, oResponse, &oOut);
+        bench::Check(CODEC_STATUS_OK == eStatus || CODEC_STATUS_PART_OK == eStatus, "client decode");
+        if (CODEC_STATUS_OK != eStatus || 0 == oResponse.stream_id())
+        {
+            continue;
+        }
+        bench::Check(200 == oResponse.status_code(), "response status");
+        if (oResponse.stream_id() == stPage.uiIndexStreamId)
+        {
+            auto iter = oResponse.headers().find("link");
+            bench::Check(iter != oResponse.headers().end(), "link header");
+            Http2PushCache::GetPreloadPath(iter->second, vecPath);
+            bench::Check(stPage.setReceived.insert(INDEX_PATH).second, "duplicate index");
+            continue;
+        }
+        auto iter = oResponse.headers().find("content-location");
+        bench::Check(iter != oResponse.headers().end(), "content-location header");
+        bench::Check(stPage.setReceived.insert(iter->second).second, "duplicate resource");
+        if (0 == (oResponse.stream_id() & 1))
+        {
+            ++stPage.stStat.ullPushed;      // 服务端发起的stream为偶数
+        }
+    }
+    uint32 uiRequests = 0;
+    for (size_t i = stPage.uiPromised; i < vecPath.size(); ++i)
+    {
+        HttpMsg oRequest;
+        oRequest.set_type(HTTP_REQUEST);
+        oRequest.set_http_major(2);
+        oRequest.set_method(HTTP_GET);
+        oRequest.set_url("http://bench.nebula" + vecPath[i]);
+        bench::Check(CODEC_STATUS_OK == oClient.Encode(oRequest, &oOut), "client encode");
+        ++uiRequests;
+    }
+    return(uiRequests);
+}
+
+static void Handshake(CodecHttp2& oClient, CodecHttp2& oServer, CBuffer& oC2S, CBuffer& oS2C, bool bEnablePush)
+{
+    oClient.ConnectionSetting(&oC2S);
+    if (!bEnablePush)
+    {
+        // SETTINGS帧：SETTINGS_ENABLE_PUSH(0x2) = 0
+        const unsigned char aucSetting[] = {0, 0, 6, 4, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0};
+        oC2S.Write((const char*)aucSetting, sizeof(aucSetting));
+    }
+    oServer.ConnectionSetting(&oS2C);
+    HttpMsg oMsg;
+    while (oC2S.ReadableBytes() > 0 || oS2C.ReadableBytes() > 0)
+    {
+        while (oC2S.ReadableBytes() > 0)
+        {
+            oMsg.Clear();
+            bench::Check(CODEC_STATUS_OK == oServer.Decode(&oC2S, oMsg, &oS2C), "server handshake");
+        }
+        while (oS2C.ReadableBytes() > 0)
+        {
+            oMsg.Clear();
+            bench::Check(CODEC_STATUS_OK == oClient.Decode(&oS2C, oMsg, &oC2S), "client handshake");
+        }
+    }
+}
+
+static void LoadPage(std::shared_ptr<NetLogger> pLogger, const PushBenchSite& oSite, bool bEnablePush,
+        tagPageStat& stStat)
+{
+    CodecHttp2 oClient(pLogger, CODEC_HTTP2, true);
+    CodecHttp2 oServer(pLogger, CODEC_HTTP2, false);
+    CBuffer oC2S;
+    CBuffer oS2C;
+    Handshake(oClient, oServer, oC2S, oS2C, bEnablePush);
+
+    HttpMsg oRequest;
+    oRequest.set_type(HTTP_REQUEST);
+    oRequest.set_http_major(2);
+    oRequest.set_method(HTTP_GET);
+    oRequest.set_url(std::string("http://bench.nebula") + INDEX_PATH);
+    bench::Check(CODEC_STATUS_OK == oClient.Encode(oRequest, &oC2S), "client encode index");
+    tagPageLoad stPage;
+    stPage.uiIndexStreamId = oRequest.stream_id();
+    stPage.stStat.ullRequests = 1;
+    // 每轮为一次往返：客户端发出的请求（及WINDOW_UPDATE）到达服务端，服务端的响应回到客户端
+    while (stPage.setReceived.size() < oSite.ResourceNum() + 1)
+    {
+        bench::Check(oC2S.ReadableBytes() > 0, "page load stalled");
+        ++stPage.stStat.ullRoundTrips;
+        stPage.stStat.ullBytes += oC2S.ReadableBytes();
+        ServerRead(oSite, oServer, oC2S, oS2C);
+        stPage.stStat.ullBytes += oS2C.ReadableBytes();
+        stPage.stStat.ullRequests += ClientRead(oClient, oS2C, oC2S, stPage);
+    }
+    bench::Check(stPage.stStat.ullPushed == stPage.uiPromised, "pushed resources");
+    stStat.ullRequests += stPage.stStat.ullRequests;
+    stStat.ullPushed += stPage.stStat.ullPushed;
+    stStat.ullRoundTrips += stPage.stStat.ullRoundTrips;
+    stStat.ullBytes += stPage.stStat.ullBytes;
+}
+
+static void BenchPush(std::shared_ptr<NetLogger> pLogger, PushBenchSite& oSite, bool bEnablePush,
+        int iPages, double dRttMs)
+{
+    const char* szName = bEnablePush ? "page load with push" : "page load without push";
+    oSite.EnablePush(bEnablePush);
+    tagPageStat stStat;
+    double dBegin = bench::NowSeconds();
+    for (int i = 0; i < iPages; ++i)
+    {
+        LoadPage(pLogger, oSite, bEnablePush, stStat);
+    }
+    double dElapsed = bench::NowSeconds() - dBegin;
+    bench::Report(szName, iPages, dElapsed, stStat.ullBytes);
+    double dPages = (double)iPages;
+    double dCpuMs = dElapsed * 1000.0 / dPages;
+    printf("%-40s %12.1f requests/page %8.1f pushed/page %6.1f round trips/page %10.0f bytes/page\n", "",
+            (double)stStat.ullRequests / dPages, (double)stStat.ullPushed / dPages,
+            (double)stStat.ullRoundTrips / dPages, (double)stStat.ullBytes / dPages);
+    printf("%-40s %12.3f ms latency/page (rtt %.1f ms)\n", "",
+            (double)stStat.ullRoundTrips / dPages * dRttMs + dCpuMs, dRttMs);
+}
+
+int main(int argc, char* argv[])
+{
+    int iPages = (argc > 1) ? atoi(argv[1]) : 2000;
+    int iResources = (argc > 2) ? atoi(argv[2]) : 8;
+    size_t uiResourceSize = (argc > 3) ? strtoul(argv[3], NULL, 10) : 16384;
+    double dRttMs = (argc > 4) ? atof(argv[4]) : 20.0;
+    auto pLogger = std::make_shared<NetLogger>("/tmp/nebula_bench.log", Logger::ERROR);
+    printf("%d pages, %d resources of %u bytes per page, rtt %.1f ms\n",
+            iPages, iResources, (uint32)uiResourceSize, dRttMs);
+    PushBenchSite oSite(iResources, uiResourceSize);
+    BenchPush(pLogger, oSite, false, iPages, dRttMs);
+    BenchPush(pLogger, oSite, true, iPages, dRttMs);
+    return(0);
+}
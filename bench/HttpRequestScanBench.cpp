@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     HttpRequestScanBench.cpp
+ * @brief    小GET请求解码基准测试
+ * @author   Bwar
+ * @date:    2026年10月19日
+ * @note     对比HttpRequestScanner快速解码与http_parser回调解码小GET请求的每秒请求数。
+ *           http_parser路径用HTTP/1.0请求（带Connection: keep-alive）触发，
+ *           CodecHttp对HTTP/1.0请求不走快速解码。
+ * Modify history:
+ ******************************************************************************/
+#include <cstring>
+#include <memory>
+#include <string>
+#include "codec/CodecHttp.hpp"
+#include "logger/NetLogger.hpp"
+#include "BenchUtil.hpp"
+
+using namespace neb;
+
+static std::string MakeGetRequest(const char* szVersion)
+{
+    return(std::string("GET /api/v1/user/profile?uid=10086&fields=name,avatar HTTP/") + szVersion + "\r\n"
+            "Host: bench.nebula\r\n"
+            "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko)\r\n"
+            "Accept: application/json, text/plain, */*\r\n"
+            "Accept-Encoding: gzip, deflate, br\r\n"
+            "Accept-Language: zh-CN,zh;q=0.9,en;q=0.8\r\n"
+            "Cookie: session=8f14e45fceea167a5a36dedd4bea2543; theme=dark\r\n"
+            "Connection: keep-alive\r\n"
+            "\r\n");
+}
+
+static void BenchScanner(const std::string& strRequest, int iRequests)
+{
+    HttpRequestScanner oScanner;
+    int iHeaderNum = 0;
+    double dBegin = bench::NowSeconds();
+    for (int i = 0; i < iRequests; ++i)
+    {
+        int iHeadLen = oScanner.Scan(strRequest.data(), strRequest.size());
+        bench::DoNotOptimize(iHeadLen);
+        iHeaderNum += oScanner.GetHeaderNum();
+    }
+    double dElapsed = bench::NowSeconds() - dBegin;
+    bench::Check(iHeaderNum == 7 * iRequests, "header num");
+    bench::Report("HttpRequestScanner::Scan", iRequests, dElapsed, (uint64_t)strRequest.size() * iRequests);
+}
+
+static void BenchParser(const std::string& strRequest, int iRequests)
+{
+    http_parser_settings stSettings;
+    memset(&stSettings, 0, sizeof(stSettings));
+    http_parser stParser;
+    size_t uiParsed = 0;
+    double dBegin = bench::NowSeconds();
+    for (int i = 0; i < iRequests; ++i)
+    {
+        http_parser_init(&stParser, HTTP_REQUEST);
+        uiParsed += http_parser_execute(&stParser, &stSettings, strRequest.data(), strRequest.size());
+    }
+    double dElapsed = bench::NowSeconds() - dBegin;
+    bench::Check(uiParsed == strRequest.size() * iRequests, "parsed size");
+    bench::Report("http_parser_execute (no callbacks)", iRequests, dElapsed, (uint64_t)strRequest.size() * iRequests);
+}
+
+/**
+ * @param bMaterialize 快速解码后是否再转换为HttpMsg（模拟业务访问全部字段）
+ */
+static void BenchCodec(CodecHttp& oCodec, const char* szName, const std::string& strRequest,
+        int iRequests, bool bExpectNative, bool bMaterialize)
+{
+    CBuffer oBuff;
+    HttpMsg oHttpMsg;
+    HttpMsg oMaterialized;
+    double dBegin = bench::NowSeconds();
+    for (int i = 0; i < iRequests; ++i)
+    {
+        oBuff.Clear();
+        oBuff.Write(strRequest.data(), strRequest.size());
+        E_CODEC_STATUS eStatus = oCodec.Decode(&oBuff, oHttpMsg);
+        bench::Check(CODEC_STATUS_OK == eStatus, "decode status");
+        const NativeHttpMsg* pNativeMsg = oCodec.TakeNativeHttpMsg();
+        bench::Check((pNativeMsg != nullptr) == bExpectNative, "decode path");
+        if (pNativeMsg != nullptr)
+        {
+            if (bMaterialize)
+            {
+                oMaterialized.Clear();
+                pNativeMsg->ToHttpMsg(oMaterialized);
+            }
+            bench::DoNotOptimize(pNativeMsg->stPath.uiLen);
+        }
+        else
+        {
+            bench::DoNotOptimize(oHttpMsg.path().size());
+        }
+    }
+    double dElapsed = bench::NowSeconds() - dBegin;
+    bench::Report(szName, iRequests, dElapsed, (uint64_t)strRequest.size() * iRequests);
+}
+
+int main(int argc, char* argv[])
+{
+    int iRequests = (argc > 1) ? atoi(argv[1]) : 1000000;
+    auto pLogger = std::make_shared<NetLogger>("/tmp/nebula_bench.log", Logger::ERROR);
+    CodecHttp oCodec(pLogger, CODEC_HTTP);
+    std::string strRequest11 = MakeGetRequest("1.1");
+    std::string strRequest10 = MakeGetRequest("1.0");
+#ifdef __SSE4_2__
+    printf("request size %zu bytes, %d requests, SSE4.2 enabled\n", strRequest11.size(), iRequests);
+#else
+    printf("request size %zu bytes, %d requests, SSE4.2 disabled\n", strRequest11.size(), iRequests);
+#endif
+
+    BenchScanner(strRequest11, iRequests);
+    BenchParser(strRequest11, iRequests);
+    BenchCodec(oCodec, "CodecHttp::Decode scanner", strRequest11, iRequests, true, false);
+    BenchCodec(oCodec, "CodecHttp::Decode scanner + ToHttpMsg", strRequest11, iRequests, true, true);
+    BenchCodec(oCodec, "CodecHttp::Decode http_parser", strRequest10, iRequests, false, false);
+    return(0);
+}
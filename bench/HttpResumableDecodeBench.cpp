@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     HttpResumableDecodeBench.cpp
+ * @brief    分片到达的大http请求解码基准测试
+ * @author   Bwar
+ * @date:    2026年10月19日
+ * @note     将1MB body的POST请求按不同分片大小逐片写入接收缓冲区，每写入一片调用
+ *           一次CodecHttp::Decode()，模拟慢速客户端的多次读事件。作为对照，另测
+ *           每次从头重新解析整个缓冲区（解析器不保留状态）的耗时。
+ * Modify history:
+ ******************************************************************************/
+#include <cstring>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include "codec/CodecHttp.hpp"
+#include "logger/NetLogger.hpp"
+#include "BenchUtil.hpp"
+
+using namespace neb;
+
+static std::string MakePostRequest(size_t uiBodySize)
+{
+    std::string strRequest = "POST /upload HTTP/1.1\r\n"
+            "Host: bench.nebula\r\n"
+            "Content-Type: application/octet-stream\r\n"
+            "Content-Length: " + std::to_string(uiBodySize) + "\r\n"
+            "\r\n";
+    strRequest.append(uiBodySize, 'x');
+    return(strRequest);
+}
+
+static void BenchResumableDecode(CodecHttp& oCodec, const std::string& strRequest,
+        size_t uiBodySize, size_t uiFragmentSize, int iRounds)
+{
+    CBuffer oBuff;
+    HttpMsg oHttpMsg;
+    uint32 uiDecodeCalls = 0;
+    double dBegin = bench::NowSeconds();
+    for (int i = 0; i < iRounds; ++i)
+    {
+        oBuff.Clear();
+        oHttpMsg.Clear();
+        E_CODEC_STATUS eStatus = CODEC_STATUS_PAUSE;
+        for (size_t uiPos = 0; uiPos < strRequest.size(); uiPos += uiFragmentSize)
+        {
+            size_t uiLen = std::min(uiFragmentSize, strRequest.size() - uiPos);
+            oBuff.Write(strRequest.data() + uiPos, uiLen);
+            eStatus = oCodec.Decode(&oBuff, oHttpMsg);
+            ++uiDecodeCalls;
+            bench::Check(CODEC_STATUS_PAUSE == eStatus || CODEC_STATUS_OK == eStatus, "decode status");
+        }
+        bench::Check(CODEC_STATUS_OK == eStatus, "request completed");
+        // 一次收齐的请求经HttpRequestScanner快速解码，结果不在HttpMsg中
+        const NativeHttpMsg* pNativeMsg = oCodec.TakeNativeHttpMsg();
+        size_t uiDecodedBodySize = (pNativeMsg == nullptr) ? oHttpMsg.body().size() : pNativeMsg->stBody.uiLen;
+        bench::Check(uiDecodedBodySize == uiBodySize, "body size");
+    }
+    double dElapsed = bench::NowSeconds() - dBegin;
+    char szName[64];
+    snprintf(szName, sizeof(szName), "resumable fragment=%zu", uiFragmentSize);
+    bench::Report(szName, iRounds, dElapsed, (uint64_t)strRequest.size() * iRounds);
+    printf("%-40s %12u decode calls\n", "", uiDecodeCalls);
+}
+
+struct tagReparseState
+{
+    bool bComplete = false;
+    std::string strBody;
+};
+
+static int OnBody(http_parser* pParser, const char* pAt, size_t uiLen)
+{
+    ((tagReparseState*)pParser->data)->strBody.append(pAt, uiLen);
+    return(0);
+}
+
+static int OnMessageComplete(http_parser* pParser)
+{
+    ((tagReparseState*)pParser->data)->bComplete = true;
+    return(0);
+}
+
+/**
+ * @brief 对照：每个读事件都重新初始化解析器，从头解析整个缓冲区并重新拷贝body
+ */
+static void BenchReparseDecode(const std::string& strRequest, size_t uiBodySize, size_t uiFragmentSize, int iRounds)
+{
+    http_parser_settings stSettings;
+    memset(&stSettings, 0, sizeof(stSettings));
+    stSettings.on_body = OnBody;
+    stSettings.on_message_complete = OnMessageComplete;
+    http_parser stParser;
+    tagReparseState stState;
+    uint64_t ullParsedBytes = 0;
+    double dBegin = bench::NowSeconds();
+    for (int i = 0; i < iRounds; ++i)
+    {
+        stState.bComplete = false;
+        for (size_t uiReceived = uiFragmentSize; !stState.bComplete; uiReceived += uiFragmentSize)
+        {
+            uiReceived = std::min(uiReceived, strRequest.size());
+            stState.strBody.clear();
+            http_parser_init(&stParser, HTTP_BOTH);
+            stParser.data = &stState;
+            ullParsedBytes += http_parser_execute(&stParser, &stSettings, strRequest.data(), uiReceived);
+        }
+        bench::Check(stState.strBody.size() == uiBodySize, "body size");
+    }
+    double dElapsed = bench::NowSeconds() - dBegin;
+    char szName[64];
+    snprintf(szName, sizeof(szName), "reparse fragment=%zu", uiFragmentSize);
+    bench::Report(szName, iRounds, dElapsed, (uint64_t)strRequest.size() * iRounds);
+    printf("%-40s %12llu bytes parsed\n", "", (unsigned long long)ullParsedBytes);
+}
+
+int main(int argc, char* argv[])
+{
+    size_t uiBodySize = (argc > 1) ? strtoul(argv[1], NULL, 10) : 1048576;
+    int iRounds = (argc > 2) ? atoi(argv[2]) : 50;
+    auto pLogger = std::make_shared<NetLogger>("/tmp/nebula_bench.log", Logger::ERROR);
+    CodecHttp oCodec(pLogger, CODEC_HTTP);
+    std::string strRequest = MakePostRequest(uiBodySize);
+    printf("request size %zu bytes, %d rounds\n", strRequest.size(), iRounds);
+
+    const size_t aFragmentSize[] = {1460, 4096, 16384, 65536, strRequest.size()};
+    for (size_t uiFragmentSize : aFragmentSize)
+    {
+        BenchResumableDecode(oCodec, strRequest, uiBodySize, uiFragmentSize, iRounds);
+    }
+    BenchReparseDecode(strRequest, uiBodySize, 1460, (iRounds > 5) ? 5 : iRounds);
+    BenchReparseDecode(strRequest, uiBodySize, 16384, iRounds);
+    return(0);
+}
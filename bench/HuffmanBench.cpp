@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     HuffmanBench.cpp
+ * @brief    HPACK Huffman编解码吞吐量基准测试
+ * @author   nebim
+ * @date:    2026-10-19
+ * @note     分别以典型http头的值（短文本、base64令牌、cookie）和随机字节（多为
+ *           长码字，最差情况）测试Huffman::Encode()和Huffman::Decode()的吞吐量，
+ *           解码结果与原文比对。
+ * Modify history:
+ ******************************************************************************/
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "codec/http2/Huffman.hpp"
+#include "BenchUtil.hpp"
+
+using namespace neb;
+
+static void BenchHuffman(const char* szName, const std::vector<std::string>& vecInput, int iRounds)
+{
+    Huffman* pHuffman = Huffman::Instance();
+    uint64_t ullInputBytes = 0;
+    for (auto& strInput : vecInput)
+    {
+        ullInputBytes += strInput.size();
+    }
+
+    std::vector<std::string> vecEncoded(vecInput.size());
+    CBuffer oBuff;
+    double dBegin = bench::NowSeconds();
+    for (int r = 0; r < iRounds; ++r)
+    {
+        for (size_t i = 0; i < vecInput.size(); ++i)
+        {
+            oBuff.Clear();
+            pHuffman->Encode(vecInput[i], &oBuff);
+            if (0 == r)
+            {
+                vecEncoded[i].assign(oBuff.GetRawReadBuffer(), oBuff.ReadableBytes());
+            }
+        }
+    }
+    double dElapsed = bench::NowSeconds() - dBegin;
+    char szItemName[64];
+    snprintf(szItemName, sizeof(szItemName), "%s encode", szName);
+    bench::Report(szItemName, (uint64_t)vecInput.size() * iRounds, dElapsed, ullInputBytes * iRounds);
+
+    uint64_t ullEncodedBytes = 0;
+    for (size_t i = 0; i < vecInput.size(); ++i)
+    {
+        bench::Check(vecEncoded[i].size() == pHuffman->EncodedLength(vecInput[i]), "encoded length");
+        ullEncodedBytes += vecEncoded[i].size();
+    }
+    printf("%-40s %12.3f compression ratio\n", "", (double)ullEncodedBytes / (double)ullInputBytes);
+
+    std::string strDecoded;
+    dBegin = bench::NowSeconds();
+    for (int r = 0; r < iRounds; ++r)
+    {
+        for (size_t i = 0; i < vecEncoded.size(); ++i)
+        {
+            strDecoded.clear();
+            bench::Check(pHuffman->Decode(vecEncoded[i].data(), vecEncoded[i].size(), strDecoded), "decode");
+            if (0 == r)
+            {
+                bench::Check(strDecoded == vecInput[i], "decoded data");
+            }
+        }
+    }
+    dElapsed = bench::NowSeconds() - dBegin;
+    snprintf(szItemName, sizeof(szItemName), "%s decode", szName);
+    bench::Report(szItemName, (uint64_t)vecEncoded.size() * iRounds, dElapsed, ullInputBytes * iRounds);
+}
+
+int main(int argc, char* argv[])
+{
+    int iRounds = (argc > 1) ? atoi(argv[1]) : 2000;
+    std::mt19937 oRandom(20261019);
+    printf("%d rounds\n", iRounds);
+
+    std::vector<std::string> vecHeaderValue = {
+        "application/grpc",
+        "identity,deflate,gzip",
+        "grpc-c++/1.46.3 grpc-c/24.0.0 (linux; chttp2)",
+        "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/118.0 Safari/537.36",
+        "text/html,application/xhtml+xml,application/xml;q=0.9,image/avif,image/webp,*/*;q=0.8",
+        "gzip, deflate, br",
+        "zh-CN,zh;q=0.9,en;q=0.8",
+        "/api/v1/user/profile?uid=10086&fields=name,avatar",
+        "Wed, 19 Oct 2026 08:00:00 GMT",
+        "max-age=31536000, public",
+    };
+    BenchHuffman("header values", vecHeaderValue, iRounds);
+
+    const char szBase64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::vector<std::string> vecToken(64);
+    for (auto& strToken : vecToken)
+    {
+        strToken = "Bearer ";
+        for (int i = 0; i < 160; ++i)
+        {
+            strToken.push_back(szBase64[oRandom() % 64]);
+        }
+    }
+    BenchHuffman("base64 tokens", vecToken, iRounds / 10);
+
+    std::vector<std::string> vecCookie(16);
+    for (auto& strCookie : vecCookie)
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            char szPair[64];
+            snprintf(szPair, sizeof(szPair), "%sk%d=%08x%08x", (i > 0) ? "; " : "", i,
+                    (uint32_t)oRandom(), (uint32_t)oRandom());
+            strCookie.append(szPair);
+        }
+    }
+    BenchHuffman("cookies", vecCookie, iRounds / 2);
+
+    std::vector<std::string> vecRandom(16);
+    for (auto& strRandom : vecRandom)
+    {
+        for (int i = 0; i < 1024; ++i)
+        {
+            strRandom.push_back((char)(oRandom() & 0xFF));
+        }
+    }
+    BenchHuffman("random bytes", vecRandom, iRounds / 20);
+    return(0);
+}
@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     StepSeqTableBench.cpp
+ * @brief    等待回调的Step表基准测试
+ * @author   Bwar
+ * @date:    2026年10月19日
+ * @note     保持100万个等待回调的Step，对比StepSeqTable与原先的
+ *           std::unordered_map<uint32, std::shared_ptr<Step> >：
+ *           1. 顺序插入100万个Sequence；
+ *           2. 按发出顺序完成（查找、删除最早的Step并插入一个新Step）；
+ *           3. 乱序完成（随机选取一个在途Step完成并插入一个新Step）。
+ *           Step不实际创建，以别名shared_ptr共享同一个控制块，引用计数开销与真实Step一致。
+ * Modify history:
+ ******************************************************************************/
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "actor/step/StepSeqTable.hpp"
+#include "BenchUtil.hpp"
+
+using namespace neb;
+
+typedef std::unordered_map<uint32, std::shared_ptr<Step> > StepMap;
+
+static std::shared_ptr<Step> MakeStep(const std::shared_ptr<char>& pOwner, uint32 uiSeq)
+{
+    // 指针值只作为非空标记，不会被解引用
+    return(std::shared_ptr<Step>(pOwner, reinterpret_cast<Step*>(pOwner.get() + (uiSeq & 0xFF))));
+}
+
+static bool TableInsert(StepSeqTable& oTable, uint32 uiSeq, std::shared_ptr<Step>&& pStep)
+{
+    return(oTable.Insert(uiSeq, std::move(pStep)));
+}
+
+static bool TableComplete(StepSeqTable& oTable, uint32 uiSeq)
+{
+    std::shared_ptr<Step> pStep = oTable.Get(uiSeq);
+    return(nullptr != pStep && oTable.Erase(uiSeq));
+}
+
+static bool TableInsert(StepMap& mapStep, uint32 uiSeq, std::shared_ptr<Step>&& pStep)
+{
+    return(mapStep.insert(std::make_pair(uiSeq, std::move(pStep))).second);
+}
+
+static bool TableComplete(StepMap& mapStep, uint32 uiSeq)
+{
+    auto iter = mapStep.find(uiSeq);
+    if (iter == mapStep.end())
+    {
+        return(false);
+    }
+    std::shared_ptr<Step> pStep = iter->second;
+    mapStep.erase(iter);
+    return(nullptr != pStep);
+}
+
+template <typename TABLE>
+static void BenchTable(const char* szTableName, uint32 uiInFlight, uint32 uiOps)
+{
+    std::shared_ptr<char> pOwner(new char[256], std::default_delete<char[]>());
+    TABLE oTable;
+    char szName[64];
+    uint32 uiSeq = 1;
+
+    double dBegin = bench::NowSeconds();
+    for (uint32 i = 0; i < uiInFlight; ++i, ++uiSeq)
+    {
+        bench::Check(TableInsert(oTable, uiSeq, MakeStep(pOwner, uiSeq)), "insert");
+    }
+    snprintf(szName, sizeof(szName), "%s fill", szTableName);
+    bench::Report(szName, uiInFlight, bench::NowSeconds() - dBegin);
+
+    uint32 uiOldestSeq = 1;
+    dBegin = bench::NowSeconds();
+    for (uint32 i = 0; i < uiOps; ++i, ++uiSeq, ++uiOldestSeq)
+    {
+        bench::Check(TableComplete(oTable, uiOldestSeq), "complete fifo");
+        bench::Check(TableInsert(oTable, uiSeq, MakeStep(pOwner, uiSeq)), "insert fifo");
+    }
+    snprintf(szName, sizeof(szName), "%s fifo complete+insert", szTableName);
+    bench::Report(szName, uiOps, bench::NowSeconds() - dBegin);
+
+    // 在途Sequence为[uiOldestSeq, uiSeq)，乱序完成时以数组记录在途Sequence
+    std::vector<uint32> vecInFlight;
+    vecInFlight.reserve(uiInFlight);
+    for (uint32 uiInFlightSeq = uiOldestSeq; uiInFlightSeq != uiSeq; ++uiInFlightSeq)
+    {
+        vecInFlight.push_back(uiInFlightSeq);
+    }
+    std::mt19937 oRandom(20261019);
+    std::vector<uint32> vecPick(uiOps);
+    for (uint32 i = 0; i < uiOps; ++i)
+    {
+        vecPick[i] = oRandom() % uiInFlight;
+    }
+    dBegin = bench::NowSeconds();
+    for (uint32 i = 0; i < uiOps; ++i, ++uiSeq)
+    {
+        uint32& uiPickSeq = vecInFlight[vecPick[i]];
+        bench::Check(TableComplete(oTable, uiPickSeq), "complete random");
+        bench::Check(TableInsert(oTable, uiSeq, MakeStep(pOwner, uiSeq)), "insert random");
+        uiPickSeq = uiSeq;
+    }
+    snprintf(szName, sizeof(szName), "%s random complete+insert", szTableName);
+    bench::Report(szName, uiOps, bench::NowSeconds() - dBegin);
+}
+
+int main(int argc, char* argv[])
+{
+    uint32 uiInFlight = (argc > 1) ? strtoul(argv[1], NULL, 10) : 1000000;
+    uint32 uiOps = (argc > 2) ? strtoul(argv[2], NULL, 10) : 5000000;
+    printf("%u in-flight steps, %u operations per round\n", uiInFlight, uiOps);
+    BenchTable<StepSeqTable>("StepSeqTable", uiInFlight, uiOps);
+    BenchTable<StepMap>("unordered_map", uiInFlight, uiOps);
+    return(0);
+}
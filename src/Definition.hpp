@@ -159,6 +159,9 @@ const int gc_iMaxBuffLen = 65535;
 /** @brief 错误信息缓冲区大小 */
 const int gc_iErrBuffLen = 256;
 
+/** @brief 收包处理所用protobuf Arena的初始内存块大小 */
+const int gc_iArenaBlockSize = 65536;
+
 /** @brief IP地址长度 */
 const int gc_iAddrLen = 64;
 
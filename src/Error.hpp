@@ -43,6 +43,9 @@ enum E_ERROR_NO
     ERR_SSL_SHUTDOWN                    = 10019,    ///< 关闭SSL连接错误
     ERR_FILE_NOT_EXIST                  = 10020,    ///< 文件不存在
     ERR_CONNECTION                      = 10021,    ///< 连接错误
+    ERR_STREAM_RESET                    = 10022,    ///< http2 stream被对端取消（RST_STREAM CANCEL）
+    ERR_STREAM_REFUSED                  = 10023,    ///< http2 stream被对端拒绝（RST_STREAM REFUSED_STREAM），可重试
+    ERR_STREAM_ERROR                    = 10024,    ///< http2 stream因其他错误被对端重置
 
     /* 存储代理错误码段  11000~11999 */
     ERR_INCOMPLET_DATAPROXY_DATA        = 11001,    ///< DataProxy请求数据包不完整
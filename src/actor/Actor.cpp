@@ -10,7 +10,10 @@
 
 #include "actor/Actor.hpp"
 #include <algorithm>
+#include <fcntl.h>
+#include <sys/stat.h>
 #include "ios/Dispatcher.hpp"
+#include "codec/CodecHttp.hpp"
 #include "actor/session/Session.hpp"
 #include "actor/step/Step.hpp"
 #include "labor/Worker.hpp"
@@ -21,7 +24,8 @@ namespace neb
 Actor::Actor(ACTOR_TYPE eActorType, ev_tstamp dTimeout)
     : m_eActorType(eActorType),
       m_uiSequence(0), m_dActiveTime(0.0), m_dTimeout(dTimeout),
-      m_pLabor(nullptr), m_pTimerWatcher(NULL), m_pContext(nullptr)
+      m_pLabor(nullptr), m_pTimerWatcher(NULL), m_pContext(nullptr),
+      m_pRecycle(nullptr)
 {
 }
 
@@ -123,6 +127,20 @@ std::shared_ptr<Session> Actor::GetSession(const std::string& strSessionId)
     return(pSession);
 }
 
+std::shared_ptr<Session> Actor::GetSession(const char* szSessionId, size_t uiSessionIdLen)
+{
+    auto pSession = m_pLabor->GetActorBuilder()->GetSession(szSessionId, uiSessionIdLen);
+    if (pSession == nullptr)
+    {
+        auto pActorBuilder = m_pLabor->GetLoaderActorBuilder();
+        if (pActorBuilder != nullptr)
+        {
+            return(pActorBuilder->GetSession(szSessionId, uiSessionIdLen));
+        }
+    }
+    return(pSession);
+}
+
 bool Actor::ExecStep(uint32 uiStepSeq, int iErrno, const std::string& strErrMsg, void* data)
 {
     return(m_pLabor->GetActorBuilder()->ExecStep(uiStepSeq, iErrno, strErrMsg, data));
@@ -143,11 +161,21 @@ void Actor::SetContext(std::shared_ptr<Context> pContext)
     m_pContext = pContext;
 }
 
+std::shared_ptr<Context> Actor::MakeStreamContext(std::shared_ptr<SocketChannel> pChannel, uint32 uiStreamId, ev_tstamp dTimeout)
+{
+    return(m_pLabor->GetActorBuilder()->MakeStreamContext(pChannel, uiStreamId, dTimeout));
+}
+
 void Actor::AddAssemblyLine(std::shared_ptr<Session> pSession)
 {
     m_pLabor->GetActorBuilder()->AddAssemblyLine(pSession);
 }
 
+google::protobuf::Arena* Actor::GetArena()
+{
+    return(m_pLabor->GetDispatcher()->GetArena());
+}
+
 bool Actor::SendTo(std::shared_ptr<SocketChannel> pChannel)
 {
     return(m_pLabor->GetDispatcher()->SendTo(pChannel));
@@ -161,10 +189,80 @@ bool Actor::SendTo(std::shared_ptr<SocketChannel> pChannel, int32 iCmd, uint32 u
 
 bool Actor::SendTo(std::shared_ptr<SocketChannel> pChannel, const HttpMsg& oHttpMsg)
 {
+    if (CODEC_HTTP == pChannel->GetCodecType())
+    {
+        CodecHttp::SetSendingTraceId(&m_strTraceId);    // 编码时直接写入http头
+        bool bResult = m_pLabor->GetDispatcher()->SendTo(pChannel, oHttpMsg, 0);
+        CodecHttp::SetSendingTraceId(nullptr);
+        return(bResult);
+    }
     (const_cast<HttpMsg&>(oHttpMsg)).mutable_headers()->insert({"x-trace-id", GetTraceId()});
     return(m_pLabor->GetDispatcher()->SendTo(pChannel, oHttpMsg, 0));
 }
 
+bool Actor::SendWithHeaderBlock(std::shared_ptr<SocketChannel> pChannel, const HttpMsg& oHttpMsg, uint32 uiHeaderBlockId)
+{
+    if (CODEC_HTTP == pChannel->GetCodecType())
+    {
+        CodecHttp::SetSendingTraceId(&m_strTraceId);
+        bool bResult = m_pLabor->GetDispatcher()->SendTo(pChannel, oHttpMsg, (uint32)0, uiHeaderBlockId);
+        CodecHttp::SetSendingTraceId(nullptr);
+        return(bResult);
+    }
+    (const_cast<HttpMsg&>(oHttpMsg)).mutable_headers()->insert({"x-trace-id", GetTraceId()});
+    return(m_pLabor->GetDispatcher()->SendTo(pChannel, oHttpMsg, (uint32)0, uiHeaderBlockId));
+}
+
+bool Actor::SendFileTo(std::shared_ptr<SocketChannel> pChannel, const HttpMsg& oHttpMsg,
+        const std::string& strFilePath, int64 llOffset, int64 llLength)
+{
+    int iFd = open(strFilePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (iFd < 0)
+    {
+        LOG4_ERROR("failed to open \"%s\", errno %d", strFilePath.c_str(), errno);
+        return(false);
+    }
+    bool bResult = SendFileTo(pChannel, oHttpMsg, iFd, llOffset, llLength);
+    close(iFd);
+    return(bResult);
+}
+
+bool Actor::SendFileTo(std::shared_ptr<SocketChannel> pChannel, const HttpMsg& oHttpMsg,
+        int iFd, int64 llOffset, int64 llLength)
+{
+    struct stat stFileStat;
+    if (fstat(iFd, &stFileStat) != 0)
+    {
+        LOG4_ERROR("fstat fd %d error %d", iFd, errno);
+        return(false);
+    }
+    if (llOffset < 0 || llOffset > (int64)stFileStat.st_size)
+    {
+        LOG4_ERROR("invalid file offset %lld, file size %lld", llOffset, (int64)stFileStat.st_size);
+        return(false);
+    }
+    if (llLength < 0 || llOffset + llLength > (int64)stFileStat.st_size)
+    {
+        llLength = (int64)stFileStat.st_size - llOffset;
+    }
+    int iDupFd = fcntl(iFd, F_DUPFD_CLOEXEC, 0);
+    if (iDupFd < 0)
+    {
+        LOG4_ERROR("dup fd %d error %d", iFd, errno);
+        return(false);
+    }
+    auto pFileRegion = std::make_shared<FileRegion>(iDupFd, llOffset, llLength, true);
+    if (CODEC_HTTP == pChannel->GetCodecType())
+    {
+        CodecHttp::SetSendingTraceId(&m_strTraceId);
+        bool bResult = m_pLabor->GetDispatcher()->SendTo(pChannel, oHttpMsg, pFileRegion, 0);
+        CodecHttp::SetSendingTraceId(nullptr);
+        return(bResult);
+    }
+    (const_cast<HttpMsg&>(oHttpMsg)).mutable_headers()->insert({"x-trace-id", GetTraceId()});
+    return(m_pLabor->GetDispatcher()->SendTo(pChannel, oHttpMsg, pFileRegion, 0));
+}
+
 bool Actor::SendTo(std::shared_ptr<SocketChannel> pChannel, const RedisReply& oRedisReply)
 {
     return(m_pLabor->GetDispatcher()->SendTo(pChannel, oRedisReply, 0));
@@ -189,16 +287,16 @@ bool Actor::SendTo(const std::string& strHost, int iPort, const HttpMsg& oHttpMs
     {
         (const_cast<HttpMsg&>(oHttpMsg)).mutable_headers()->insert({"x-trace-id", GetTraceId()});
     }
-    if (oHttpMsg.http_major() >= 2)
-    {
-        bPipeline = true;
-    }
     std::string strSchema = oHttpMsg.url().substr(0, oHttpMsg.url().find_first_of(":"));
     std::transform(strSchema.begin(), strSchema.end(), strSchema.begin(), [](unsigned char c)->unsigned char {return std::tolower(c);});
     if (strSchema == std::string("https"))
     {
         bWithSsl = true;
     }
+    if (oHttpMsg.http_major() >= 2)
+    {
+        return(m_pLabor->GetDispatcher()->SendMultiplex(strHost, iPort, bWithSsl, oHttpMsg, GetSequence()));
+    }
     return(m_pLabor->GetDispatcher()->SendTo(strHost, iPort, CODEC_HTTP, bWithSsl, bPipeline, oHttpMsg, GetSequence()));
 }
 
@@ -328,4 +426,9 @@ void Actor::SetTraceId(const std::string& strTraceId)
     m_strTraceId = strTraceId;
 }
 
+void Actor::SetTraceId(const char* szTraceId, size_t uiTraceIdLen)
+{
+    m_strTraceId.assign(szTraceId, uiTraceIdLen);     // 复用已有容量
+}
+
 } /* namespace neb */
@@ -12,6 +12,7 @@
 
 #include <memory>
 #include <string>
+#include <google/protobuf/arena.h>
 
 #ifdef __GNUC__
 #pragma GCC diagnostic push
@@ -124,12 +125,38 @@ protected:
 
     std::shared_ptr<Session> GetSession(uint32 uiSessionId);
     std::shared_ptr<Session> GetSession(const std::string& strSessionId);
+    std::shared_ptr<Session> GetSession(const char* szSessionId, size_t uiSessionIdLen);
     bool ExecStep(uint32 uiStepSeq, int iErrno = ERR_OK, const std::string& strErrMsg = "", void* data = NULL);
     std::shared_ptr<Operator> GetOperator(const std::string& strOperatorName);
     std::shared_ptr<Context> GetContext();
     void SetContext(std::shared_ptr<Context> pContext);
+
+    /**
+     * @brief 为收到的HTTP2请求创建绑定该stream的Context
+     * @param dTimeout 上游请求携带的超时（秒），不大于0表示不限
+     * @note 该stream被对端重置时Context被取消（Context::IsCancelled()）。
+     */
+    std::shared_ptr<Context> MakeStreamContext(std::shared_ptr<SocketChannel> pChannel, uint32 uiStreamId, ev_tstamp dTimeout);
     void AddAssemblyLine(std::shared_ptr<Session> pSession);
 
+    /**
+     * @brief 获取当前批次消息处理所用的Arena
+     * @note Arena在本批次消息处理完毕后（非读事件回调中则在本轮事件循环结束时）Reset，在其上分配的对象不可跨越异步回调持有。
+     */
+    google::protobuf::Arena* GetArena();
+
+    /**
+     * @brief 在当前批次消息处理的Arena上创建消息
+     * @note 适用于在OnMessage()内构造并立即发送的响应消息，消息随Arena统一释放，
+     *       无须也不可delete，不可保存为成员或在Step回调中使用。
+     * @return 消息指针
+     */
+    template <typename T>
+    T* NewArenaMessage()
+    {
+        return(google::protobuf::Arena::CreateMessage<T>(GetArena()));
+    }
+
 protected:
     /**
      * @brief 连接成功后发送
@@ -161,6 +188,42 @@ protected:
      */
     virtual bool SendTo(std::shared_ptr<SocketChannel> pChannel, const HttpMsg& oHttpMsg);
 
+    /**
+     * @brief 发送附加预编码http头块的HTTP响应
+     * @param pChannel 消息通道
+     * @param oHttpMsg http消息
+     * @param uiHeaderBlockId CodecHttp::RegisterHeaderBlock()返回的http头块编号
+     * @return 是否发送成功
+     */
+    virtual bool SendWithHeaderBlock(std::shared_ptr<SocketChannel> pChannel, const HttpMsg& oHttpMsg, uint32 uiHeaderBlockId);
+
+    /**
+     * @brief 发送以文件内容为body的HTTP响应
+     * @note 文件内容不读入内存，由框架使用sendfile()从内核直接发送（SSL连接则分块
+     * 读取后加密发送）。oHttpMsg的body须为空，Content-Length为文件区间长度。
+     * @param pChannel 消息通道
+     * @param oHttpMsg http消息（状态行和http头）
+     * @param strFilePath 文件路径
+     * @param llOffset 文件区间起始偏移
+     * @param llLength 文件区间长度，小于0表示从llOffset到文件末尾
+     * @return 是否发送成功
+     */
+    virtual bool SendFileTo(std::shared_ptr<SocketChannel> pChannel, const HttpMsg& oHttpMsg,
+            const std::string& strFilePath, int64 llOffset = 0, int64 llLength = -1);
+
+    /**
+     * @brief 发送以文件（或memfd）内容为body的HTTP响应
+     * @note 框架dup()文件描述符后发送，调用者仍持有并负责关闭iFd。
+     * @param pChannel 消息通道
+     * @param oHttpMsg http消息（状态行和http头）
+     * @param iFd 文件描述符
+     * @param llOffset 文件区间起始偏移
+     * @param llLength 文件区间长度，小于0表示从llOffset到文件末尾
+     * @return 是否发送成功
+     */
+    virtual bool SendFileTo(std::shared_ptr<SocketChannel> pChannel, const HttpMsg& oHttpMsg,
+            int iFd, int64 llOffset, int64 llLength);
+
     /**
      * @brief 发送redis响应
      * @param pChannel 消息通道
@@ -316,6 +379,7 @@ private:
     ev_timer* MutableTimerWatcher();
     void SetActorName(const std::string& strActorName);
     void SetTraceId(const std::string& strTraceId);
+    void SetTraceId(const char* szTraceId, size_t uiTraceIdLen);
 
 private:
     ACTOR_TYPE m_eActorType;
@@ -327,7 +391,9 @@ private:
     std::string m_strActorName;
     std::string m_strTraceId;       // for log trace
     std::shared_ptr<Context> m_pContext;
+    void (*m_pRecycle)(Actor*);     ///< 内存池回收函数，由DynamicCreator设置
 
+    template<typename T, typename ...Targs> friend class DynamicCreator;
     friend class Dispatcher;
     friend class ActorBuilder;
     friend class ActorSys;
@@ -16,6 +16,7 @@
 #include "cmd/Cmd.hpp"
 #include "cmd/Module.hpp"
 #include "session/Session.hpp"
+#include "context/Context.hpp"
 #include "step/HttpStep.hpp"
 #include "step/PbStep.hpp"
 #include "step/RedisStep.hpp"
@@ -32,16 +33,21 @@ namespace neb
 {
 
 ActorBuilder::ActorBuilder(Labor* pLabor, std::shared_ptr<NetLogger> pLogger)
-    : m_pErrBuff(nullptr), m_pLabor(pLabor), m_pLogger(pLogger)
+    : m_pErrBuff(nullptr), m_pLabor(pLabor), m_pLogger(pLogger), m_uiTraceSeq(0),
+      m_uiStreamContextSweepSize(STREAM_CONTEXT_SWEEP_MIN)
 {
     m_pErrBuff = (char*)malloc(gc_iErrBuffLen);
+    memset(m_szTraceId, 0, sizeof(m_szTraceId));
+    CodecHttp::SetModuleRouter(&m_oModuleRouter);
 }
 
 ActorBuilder::~ActorBuilder()
 {
+    CodecHttp::SetModuleRouter(nullptr);
+    m_vecCmdTable.clear();
     m_mapCmd.clear();
-    m_mapCallbackStep.clear();
-    m_mapCallbackSession.clear();
+    m_oCallbackStep.Clear();
+    m_oCallbackSession.Clear();
 
     for (auto so_iter = m_mapLoadedSo.begin();
                     so_iter != m_mapLoadedSo.end(); ++so_iter)
@@ -75,7 +81,7 @@ void ActorBuilder::StepTimeoutCallback(struct ev_loop* loop, ev_timer* watcher,
     if (watcher->data != NULL)
     {
         Step* pStep = (Step*)watcher->data;
-        pStep->m_pLabor->GetActorBuilder()->OnStepTimeout(std::dynamic_pointer_cast<Step>(pStep->shared_from_this()));
+        pStep->m_pLabor->GetActorBuilder()->OnStepTimeout(std::static_pointer_cast<Step>(pStep->shared_from_this()));
     }
 }
 
@@ -84,7 +90,7 @@ void ActorBuilder::SessionTimeoutCallback(struct ev_loop* loop, ev_timer* watche
     if (watcher->data != NULL)
     {
         Session* pSession = (Session*)watcher->data;
-        pSession->m_pLabor->GetActorBuilder()->OnSessionTimeout(std::dynamic_pointer_cast<Session>(pSession->shared_from_this()));
+        pSession->m_pLabor->GetActorBuilder()->OnSessionTimeout(std::static_pointer_cast<Session>(pSession->shared_from_this()));
     }
 }
 
@@ -93,7 +99,7 @@ void ActorBuilder::ChainTimeoutCallback(struct ev_loop* loop, ev_timer* watcher,
     if (watcher->data != NULL)
     {
         Chain* pChain = (Chain*)watcher->data;
-        pChain->m_pLabor->GetActorBuilder()->OnChainTimeout(std::dynamic_pointer_cast<Chain>(pChain->shared_from_this()));
+        pChain->m_pLabor->GetActorBuilder()->OnChainTimeout(std::static_pointer_cast<Chain>(pChain->shared_from_this()));
     }
 }
 
@@ -184,20 +190,11 @@ bool ActorBuilder::OnMessage(std::shared_ptr<SocketChannel> pChannel, const MsgH
     {
         MsgHead oOutMsgHead;
         MsgBody oOutMsgBody;
-        auto cmd_iter = m_mapCmd.find(gc_uiCmdBit & oMsgHead.cmd());
-        if (cmd_iter != m_mapCmd.end() && cmd_iter->second != nullptr)
+        Cmd* pCmd = FindCmd(gc_uiCmdBit & oMsgHead.cmd());
+        if (pCmd != nullptr)
         {
-            if (oMsgBody.trace_id().length() > 10)
-            {
-                cmd_iter->second->SetTraceId(oMsgBody.trace_id());
-            }
-            else
-            {
-                std::ostringstream oss;
-                oss << m_pLabor->GetNodeInfo().uiNodeId << "." << m_pLabor->GetNowTime() << "." << m_pLabor->GetSequence();
-                cmd_iter->second->SetTraceId(oss.str());
-            }
-            cmd_iter->second->AnyMessage(pChannel, oMsgHead, oMsgBody);
+            InheritTraceId(pCmd, oMsgBody.trace_id().data(), oMsgBody.trace_id().size());
+            pCmd->AnyMessage(pChannel, oMsgHead, oMsgBody);
         }
         else    // 没有对应的cmd，是需由接入层转发的请求
         {
@@ -226,20 +223,11 @@ bool ActorBuilder::OnMessage(std::shared_ptr<SocketChannel> pChannel, const MsgH
             {
                 if (CODEC_NEBULA == pChannel->GetCodecType())   // 内部服务往客户端发送  if (std::string("0.0.0.0") == strFromIp)
                 {
-                    cmd_iter = m_mapCmd.find(CMD_REQ_TO_CLIENT);
-                    if (cmd_iter != m_mapCmd.end())
+                    pCmd = FindCmd(CMD_REQ_TO_CLIENT);
+                    if (pCmd != nullptr)
                     {
-                        if (oMsgBody.trace_id().length() > 10)
-                        {
-                            cmd_iter->second->SetTraceId(oMsgBody.trace_id());
-                        }
-                        else
-                        {
-                            std::ostringstream oss;
-                            oss << m_pLabor->GetNodeInfo().uiNodeId << "." << m_pLabor->GetNowTime() << "." << m_pLabor->GetSequence();
-                            cmd_iter->second->SetTraceId(oss.str());
-                        }
-                        cmd_iter->second->AnyMessage(pChannel, oMsgHead, oMsgBody);
+                        InheritTraceId(pCmd, oMsgBody.trace_id().data(), oMsgBody.trace_id().size());
+                        pCmd->AnyMessage(pChannel, oMsgHead, oMsgBody);
                     }
                     else
                     {
@@ -253,20 +241,11 @@ bool ActorBuilder::OnMessage(std::shared_ptr<SocketChannel> pChannel, const MsgH
                 }
                 else
                 {
-                    cmd_iter = m_mapCmd.find(CMD_REQ_FROM_CLIENT);
-                    if (cmd_iter != m_mapCmd.end())
+                    pCmd = FindCmd(CMD_REQ_FROM_CLIENT);
+                    if (pCmd != nullptr)
                     {
-                        if (oMsgBody.trace_id().length() > 10)
-                        {
-                            cmd_iter->second->SetTraceId(oMsgBody.trace_id());
-                        }
-                        else
-                        {
-                            std::ostringstream oss;
-                            oss << m_pLabor->GetNodeInfo().uiNodeId << "." << m_pLabor->GetNowTime() << "." << m_pLabor->GetSequence();
-                            cmd_iter->second->SetTraceId(oss.str());
-                        }
-                        cmd_iter->second->AnyMessage(pChannel, oMsgHead, oMsgBody);
+                        InheritTraceId(pCmd, oMsgBody.trace_id().data(), oMsgBody.trace_id().size());
+                        pCmd->AnyMessage(pChannel, oMsgHead, oMsgBody);
                     }
                     else
                     {
@@ -284,34 +263,31 @@ bool ActorBuilder::OnMessage(std::shared_ptr<SocketChannel> pChannel, const MsgH
     else    // 回调
     {
         pChannel->m_pImpl->PopStepSeq();
-        auto step_iter = m_mapCallbackStep.find(oMsgHead.seq());
-        if (step_iter != m_mapCallbackStep.end())   // 步骤回调
+        std::shared_ptr<Step> pStep = m_oCallbackStep.Get(oMsgHead.seq());
+        if (nullptr != pStep)   // 步骤回调
         {
             LOG4_TRACE("receive message, cmd = %d",
                             oMsgHead.cmd());
-            if (step_iter->second != nullptr)
+            E_CMD_STATUS eResult;
+            pStep->SetActiveTime(m_pLabor->GetNowTime());
+            LOG4_TRACE("cmd %u, seq %u, step_seq %u, active_time %lf",
+                            oMsgHead.cmd(), oMsgHead.seq(), pStep->GetSequence(),
+                            pStep->GetActiveTime());
+            eResult = pStep->Callback(pChannel, oMsgHead, oMsgBody);
+            if (CMD_STATUS_RUNNING != eResult)
             {
-                E_CMD_STATUS eResult;
-                step_iter->second->SetActiveTime(m_pLabor->GetNowTime());
-                LOG4_TRACE("cmd %u, seq %u, step_seq %u, active_time %lf",
-                                oMsgHead.cmd(), oMsgHead.seq(), step_iter->second->GetSequence(),
-                                step_iter->second->GetActiveTime());
-                eResult = (std::dynamic_pointer_cast<PbStep>(step_iter->second))->Callback(pChannel, oMsgHead, oMsgBody);
-                if (CMD_STATUS_RUNNING != eResult)
+                uint32 uiChainId = pStep->GetChainId();
+                RemoveStep(pStep);
+                if (CMD_STATUS_FAULT != eResult && 0 != uiChainId)
                 {
-                    uint32 uiChainId = step_iter->second->GetChainId();
-                    RemoveStep(step_iter->second);
-                    if (CMD_STATUS_FAULT != eResult && 0 != uiChainId)
+                    auto chain_iter = m_mapChain.find(uiChainId);
+                    if (chain_iter != m_mapChain.end())
                     {
-                        auto chain_iter = m_mapChain.find(uiChainId);
-                        if (chain_iter != m_mapChain.end())
+                        chain_iter->second->SetActiveTime(m_pLabor->GetNowTime());
+                        eResult = chain_iter->second->Next();
+                        if (CMD_STATUS_RUNNING != eResult)
                         {
-                            chain_iter->second->SetActiveTime(m_pLabor->GetNowTime());
-                            eResult = chain_iter->second->Next();
-                            if (CMD_STATUS_RUNNING != eResult)
-                            {
-                                RemoveChain(uiChainId);
-                            }
+                            RemoveChain(uiChainId);
                         }
                     }
                 }
@@ -334,82 +310,98 @@ bool ActorBuilder::OnMessage(std::shared_ptr<SocketChannel> pChannel, const Http
     {
         LOG4_DEBUG("oInHttpMsg.type() = %d, oInHttpMsg.path() = %s",
                     oHttpMsg.type(), oHttpMsg.path().c_str());
+        RouteMatch stRouteMatch;
         if (oHttpMsg.has_upgrade() && oHttpMsg.upgrade().is_upgrade())
         {
-            auto module_iter = m_mapModule.find("http_upgrade");
-            if (module_iter != m_mapModule.end())
+            Module* pUpgradeModule = m_oModuleRouter.Match("http_upgrade", 12, oHttpMsg.method(), stRouteMatch);
+            if (nullptr != pUpgradeModule)
             {
-                std::ostringstream oss;
-                oss << m_pLabor->GetNodeInfo().uiNodeId << "." << m_pLabor->GetNowTime() << "." << m_pLabor->GetSequence();
-                module_iter->second->SetTraceId(oss.str());
-                if (module_iter->second->AnyMessage(pChannel, oHttpMsg))
+                InheritTraceId(pUpgradeModule, oHttpMsg);
+                if (pUpgradeModule->AnyMessage(pChannel, oHttpMsg))
                 {
                     return(true);
                 }
             }
         }
-        auto module_iter = m_mapModule.find(oHttpMsg.path());
-        if (module_iter == m_mapModule.end())
+        Module* pModule = m_oModuleRouter.Match(oHttpMsg.path().data(), oHttpMsg.path().size(),
+                        oHttpMsg.method(), stRouteMatch);
+        if (oHttpMsg.chunk_notice() && pModule != nullptr)
         {
-            module_iter = m_mapModule.find("/switch");
-            if (module_iter == m_mapModule.end())
+            pModule->m_stRouteMatch = stRouteMatch;     // 路径参数指向本次通知的oHttpMsg.path()
+            if (oHttpMsg.is_decoding())
             {
-                module_iter = m_mapModule.find("/route");
-                if (module_iter == m_mapModule.end())
+                if (0 == oHttpMsg.encoding())
                 {
-                    HttpMsg oOutHttpMsg;
-                    snprintf(m_pErrBuff, gc_iErrBuffLen, "no module to dispose %s!", oHttpMsg.path().c_str());
-                    LOG4_WARNING(m_pErrBuff);
-                    oOutHttpMsg.set_type(HTTP_RESPONSE);
-                    oOutHttpMsg.set_status_code(404);
-                    oOutHttpMsg.set_http_major(oHttpMsg.http_major());
-                    oOutHttpMsg.set_http_minor(oHttpMsg.http_minor());
-                    m_pLabor->GetDispatcher()->SendTo(pChannel, oOutHttpMsg, 0);
-                }
-                else
-                {
-                    std::ostringstream oss;
-                    oss << m_pLabor->GetNodeInfo().uiNodeId << "." << m_pLabor->GetNowTime() << "." << m_pLabor->GetSequence();
-                    module_iter->second->SetTraceId(oss.str());
-                    module_iter->second->AnyMessage(pChannel, oHttpMsg);
+                    InheritTraceId(pModule, oHttpMsg);
+                    return(pModule->OnHeaders(pChannel, oHttpMsg));
                 }
+                return(pModule->OnBodyChunk(pChannel, oHttpMsg));
             }
-            else
-            {
-                std::ostringstream oss;
-                oss << m_pLabor->GetNodeInfo().uiNodeId << "." << m_pLabor->GetNowTime() << "." << m_pLabor->GetSequence();
-                module_iter->second->SetTraceId(oss.str());
-                module_iter->second->AnyMessage(pChannel, oHttpMsg);
-            }
+            return(pModule->OnComplete(pChannel, oHttpMsg));
         }
-        else
+        if (nullptr == pModule)
         {
-            std::ostringstream oss;
-            oss << m_pLabor->GetNodeInfo().uiNodeId << "." << m_pLabor->GetNowTime() << "." << m_pLabor->GetSequence();
-            module_iter->second->SetTraceId(oss.str());
-            module_iter->second->AnyMessage(pChannel, oHttpMsg);
+            pModule = m_oModuleRouter.Match("/switch", 7, oHttpMsg.method(), stRouteMatch);
+            if (nullptr == pModule)
+            {
+                pModule = m_oModuleRouter.Match("/route", 6, oHttpMsg.method(), stRouteMatch);
+            }
+            if (nullptr == pModule)
+            {
+                HttpMsg oOutHttpMsg;
+                snprintf(m_pErrBuff, gc_iErrBuffLen, "no module to dispose %s!", oHttpMsg.path().c_str());
+                LOG4_WARNING(m_pErrBuff);
+                oOutHttpMsg.set_type(HTTP_RESPONSE);
+                oOutHttpMsg.set_status_code(404);
+                oOutHttpMsg.set_http_major(oHttpMsg.http_major());
+                oOutHttpMsg.set_http_minor(oHttpMsg.http_minor());
+                m_pLabor->GetDispatcher()->SendTo(pChannel, oOutHttpMsg, 0);
+                return(true);
+            }
         }
+        InheritTraceId(pModule, oHttpMsg);
+        pModule->m_stRouteMatch = stRouteMatch;
+        pModule->AnyMessage(pChannel, oHttpMsg);
     }
     else
     {
-        auto http_step_iter = m_mapCallbackStep.find(pChannel->m_pImpl->PopStepSeq());
+        // http2连接上各stream的响应不按请求顺序返回，按stream id找到对应的Step；
+        // 分块通知的响应在最后一个分块到达时才取出Step seq
+        uint32 uiStepSeq = 0;
+        if (oHttpMsg.http_major() > 1)
+        {
+            uiStepSeq = (oHttpMsg.chunk_notice() && oHttpMsg.is_decoding())
+                    ? pChannel->m_pImpl->GetStepSeq(oHttpMsg.stream_id())
+                    : pChannel->m_pImpl->PopStepSeq(oHttpMsg.stream_id());
+        }
+        else
+        {
+            uiStepSeq = pChannel->m_pImpl->PopStepSeq();
+        }
+        std::shared_ptr<Step> pStep = m_oCallbackStep.Get(uiStepSeq);
         if (!pChannel->IsPipeline() && pChannel->m_pImpl->GetPipelineStepSeq().empty())
         {
             m_pLabor->GetDispatcher()->AddNamedSocketChannel(pChannel->GetIdentify(), pChannel);
         }
-        if (http_step_iter == m_mapCallbackStep.end())
+        if (nullptr == pStep)
         {
             LOG4_TRACE("no callback for http response from %s!", oHttpMsg.url().c_str());
         }
         else
         {
             E_CMD_STATUS eResult;
-            http_step_iter->second->SetActiveTime(m_pLabor->GetNowTime());
-            eResult = (std::dynamic_pointer_cast<HttpStep>(http_step_iter->second))->Callback(pChannel, oHttpMsg);
+            pStep->SetActiveTime(m_pLabor->GetNowTime());
+            eResult = pStep->Callback(pChannel, oHttpMsg);
             if (CMD_STATUS_RUNNING != eResult)
             {
-                uint32 uiChainId = http_step_iter->second->GetChainId();
-                RemoveStep(http_step_iter->second);
+                if (oHttpMsg.http_major() > 1 && oHttpMsg.chunk_notice() && oHttpMsg.is_decoding())
+                {
+                    // 响应未接收完Step已结束（如流式响应提前停止读取），发送RST_STREAM(CANCEL)让对端停止发送
+                    pChannel->m_pImpl->CancelHttp2Stream(oHttpMsg.stream_id());
+                    m_pLabor->GetDispatcher()->SendTo(pChannel);
+                }
+                uint32 uiChainId = pStep->GetChainId();
+                RemoveStep(pStep);
                 if (CMD_STATUS_FAULT != eResult && 0 != uiChainId)
                 {
                     auto chain_iter = m_mapChain.find(uiChainId);
@@ -429,24 +421,52 @@ bool ActorBuilder::OnMessage(std::shared_ptr<SocketChannel> pChannel, const Http
     return(true);
 }
 
+bool ActorBuilder::OnMessage(std::shared_ptr<SocketChannel> pChannel, const NativeHttpMsg& oNativeMsg)
+{
+    LOG4_DEBUG("oNativeMsg.iType = %d, oNativeMsg.stPath = %.*s",
+                oNativeMsg.iType, (int)oNativeMsg.stPath.uiLen, oNativeMsg.stPath.pData);
+    RouteMatch stRouteMatch;
+    Module* pModule = m_oModuleRouter.Match(oNativeMsg.stPath.pData, oNativeMsg.stPath.uiLen,
+                    oNativeMsg.iMethod, stRouteMatch);
+    if (nullptr == pModule)
+    {
+        // /switch、/route和404处理与HttpMsg一致
+        HttpMsg* pHttpMsg = google::protobuf::Arena::CreateMessage<HttpMsg>(
+                        m_pLabor->GetDispatcher()->GetArena());
+        oNativeMsg.ToHttpMsg(*pHttpMsg);
+        return(OnMessage(pChannel, *pHttpMsg));
+    }
+    const HttpStringView* pTraceId = oNativeMsg.FindHeader("x-trace-id", 10);
+    if (nullptr == pTraceId)
+    {
+        NewTraceId(pModule);
+    }
+    else
+    {
+        InheritTraceId(pModule, pTraceId->pData, pTraceId->uiLen);
+    }
+    pModule->m_stRouteMatch = stRouteMatch;
+    return(pModule->AnyMessage(pChannel, oNativeMsg));
+}
+
 bool ActorBuilder::OnMessage(std::shared_ptr<SocketChannel> pChannel, const RedisMsg& oRedisMsg, uint32 uiFinalStepSeq)
 {
     if (pChannel->IsClient())
     {
-        std::unordered_map<uint32, std::shared_ptr<Step>>::iterator step_iter;
+        std::shared_ptr<Step> pStep;
         if (uiFinalStepSeq == 0) // callback from SocketChannel by redis msg
         {
-            step_iter = m_mapCallbackStep.find(pChannel->m_pImpl->PopStepSeq());
+            pStep = m_oCallbackStep.Get(pChannel->m_pImpl->PopStepSeq());
         }
         else // callback from StepRedisCluster
         {
-            step_iter = m_mapCallbackStep.find(uiFinalStepSeq);
+            pStep = m_oCallbackStep.Get(uiFinalStepSeq);
         }
         if (!pChannel->IsPipeline() && pChannel->m_pImpl->GetPipelineStepSeq().empty())
         {
             m_pLabor->GetDispatcher()->AddNamedSocketChannel(pChannel->GetIdentify(), pChannel); // push back to named socket channel pool.
         }
-        if (step_iter == m_mapCallbackStep.end())
+        if (nullptr == pStep)
         {
             LOG4_TRACE("no callback for redis reply from %s!", pChannel->GetIdentify().c_str());
             return(false);
@@ -454,12 +474,12 @@ bool ActorBuilder::OnMessage(std::shared_ptr<SocketChannel> pChannel, const Redi
         else
         {
             E_CMD_STATUS eResult;
-            step_iter->second->SetActiveTime(m_pLabor->GetNowTime());
-            eResult = step_iter->second->Callback(pChannel, oRedisMsg);
+            pStep->SetActiveTime(m_pLabor->GetNowTime());
+            eResult = pStep->Callback(pChannel, oRedisMsg);
             if (CMD_STATUS_RUNNING != eResult)
             {
-                uint32 uiChainId = step_iter->second->GetChainId();
-                RemoveStep(step_iter->second);
+                uint32 uiChainId = pStep->GetChainId();
+                RemoveStep(pStep);
                 if (CMD_STATUS_FAULT != eResult && 0 != uiChainId)
                 {
                     auto chain_iter = m_mapChain.find(uiChainId);
@@ -479,10 +499,10 @@ bool ActorBuilder::OnMessage(std::shared_ptr<SocketChannel> pChannel, const Redi
     }
     else
     {
-        auto cmd_iter = m_mapCmd.find(CMD_REQ_REDIS_PROXY);
-        if (cmd_iter != m_mapCmd.end() && cmd_iter->second != nullptr)
+        Cmd* pCmd = FindCmd(CMD_REQ_REDIS_PROXY);
+        if (pCmd != nullptr)
         {
-            auto pRedisCmd = std::dynamic_pointer_cast<RedisCmd>(cmd_iter->second);
+            RedisCmd* pRedisCmd = dynamic_cast<RedisCmd*>(pCmd);
             if (pRedisCmd == nullptr)
             {
                 LOG4_ERROR("cmd %d is not a RedisCmd instance!", CMD_REQ_REDIS_PROXY);
@@ -499,12 +519,12 @@ bool ActorBuilder::OnMessage(std::shared_ptr<SocketChannel> pChannel, const CBuf
 {
     if (pChannel->IsClient())
     {
-        auto step_iter = m_mapCallbackStep.find(pChannel->m_pImpl->PopStepSeq());
+        std::shared_ptr<Step> pStep = m_oCallbackStep.Get(pChannel->m_pImpl->PopStepSeq());
         if (!pChannel->IsPipeline() && pChannel->m_pImpl->GetPipelineStepSeq().empty())
         {
             m_pLabor->GetDispatcher()->AddNamedSocketChannel(pChannel->GetIdentify(), pChannel); // push back to named socket channel pool.
         }
-        if (step_iter == m_mapCallbackStep.end())
+        if (nullptr == pStep)
         {
             LOG4_TRACE("no callback for raw data reply from %s!", pChannel->GetIdentify().c_str());
             return(false);
@@ -512,12 +532,12 @@ bool ActorBuilder::OnMessage(std::shared_ptr<SocketChannel> pChannel, const CBuf
         else
         {
             E_CMD_STATUS eResult;
-            step_iter->second->SetActiveTime(m_pLabor->GetNowTime());
-            eResult = step_iter->second->Callback(pChannel, oBuffer.GetRawReadBuffer(), oBuffer.ReadableBytes());
+            pStep->SetActiveTime(m_pLabor->GetNowTime());
+            eResult = pStep->Callback(pChannel, oBuffer.GetRawReadBuffer(), oBuffer.ReadableBytes());
             if (CMD_STATUS_RUNNING != eResult)
             {
-                uint32 uiChainId = step_iter->second->GetChainId();
-                RemoveStep(step_iter->second);
+                uint32 uiChainId = pStep->GetChainId();
+                RemoveStep(pStep);
                 if (CMD_STATUS_FAULT != eResult && 0 != uiChainId)
                 {
                     auto chain_iter = m_mapChain.find(uiChainId);
@@ -537,10 +557,10 @@ bool ActorBuilder::OnMessage(std::shared_ptr<SocketChannel> pChannel, const CBuf
     }
     else
     {
-        auto cmd_iter = m_mapCmd.find(CMD_REQ_RAW_DATA);
-        if (cmd_iter != m_mapCmd.end() && cmd_iter->second != nullptr)
+        Cmd* pCmd = FindCmd(CMD_REQ_RAW_DATA);
+        if (pCmd != nullptr)
         {
-            auto pRawCmd = std::dynamic_pointer_cast<RawCmd>(cmd_iter->second);
+            RawCmd* pRawCmd = dynamic_cast<RawCmd*>(pCmd);
             if (pRawCmd == nullptr)
             {
                 LOG4_ERROR("cmd %d is not a RawCmd instance!", CMD_REQ_RAW_DATA);
@@ -555,29 +575,26 @@ bool ActorBuilder::OnMessage(std::shared_ptr<SocketChannel> pChannel, const CBuf
 
 bool ActorBuilder::OnError(std::shared_ptr<SocketChannel> pChannel, uint32 uiStepSeq, int iErrno, const std::string& strErrMsg)
 {
-    auto step_iter = m_mapCallbackStep.find(uiStepSeq);
-    if (step_iter != m_mapCallbackStep.end())
+    std::shared_ptr<Step> pStep = m_oCallbackStep.Get(uiStepSeq);
+    if (nullptr != pStep)
     {
-        if (step_iter->second != nullptr)
+        E_CMD_STATUS eResult;
+        pStep->SetActiveTime(m_pLabor->GetNowTime());
+        eResult = pStep->ErrBack(pChannel, iErrno, strErrMsg);
+        if (CMD_STATUS_RUNNING != eResult)
         {
-            E_CMD_STATUS eResult;
-            step_iter->second->SetActiveTime(m_pLabor->GetNowTime());
-            eResult = step_iter->second->ErrBack(pChannel, iErrno, strErrMsg);
-            if (CMD_STATUS_RUNNING != eResult)
+            uint32 uiChainId = pStep->GetChainId();
+            RemoveStep(pStep);
+            if (CMD_STATUS_FAULT != eResult && 0 != uiChainId)
             {
-                uint32 uiChainId = step_iter->second->GetChainId();
-                RemoveStep(step_iter->second);
-                if (CMD_STATUS_FAULT != eResult && 0 != uiChainId)
+                auto chain_iter = m_mapChain.find(uiChainId);
+                if (chain_iter != m_mapChain.end())
                 {
-                    auto chain_iter = m_mapChain.find(uiChainId);
-                    if (chain_iter != m_mapChain.end())
+                    chain_iter->second->SetActiveTime(m_pLabor->GetNowTime());
+                    eResult = chain_iter->second->Next();
+                    if (CMD_STATUS_RUNNING != eResult)
                     {
-                        chain_iter->second->SetActiveTime(m_pLabor->GetNowTime());
-                        eResult = chain_iter->second->Next();
-                        if (CMD_STATUS_RUNNING != eResult)
-                        {
-                            RemoveChain(uiChainId);
-                        }
+                        RemoveChain(uiChainId);
                     }
                 }
             }
@@ -593,9 +610,144 @@ bool ActorBuilder::OnError(std::shared_ptr<SocketChannel> pChannel, uint32 uiSte
     }
 }
 
+std::shared_ptr<Context> ActorBuilder::MakeStreamContext(std::shared_ptr<SocketChannel> pChannel, uint32 uiStreamId, ev_tstamp dTimeout)
+{
+    std::shared_ptr<Actor> pSharedActor(new Context(pChannel), ReleaseActor, ActorPoolAllocator<Actor>());
+    std::shared_ptr<Context> pContext = ActorCast<Context>(InitializeSharedActor(nullptr, pSharedActor, "neb::Context"));
+    if (nullptr == pContext)
+    {
+        return(nullptr);
+    }
+    pContext->m_uiStreamId = uiStreamId;
+    if (dTimeout > 0.0)
+    {
+        pContext->SetDeadline((ev_tstamp)m_pLabor->GetNowTimeMs() / 1000.0 + dTimeout);
+    }
+    if (m_mapStreamContext.size() >= m_uiStreamContextSweepSize)
+    {
+        for (auto iter = m_mapStreamContext.begin(); iter != m_mapStreamContext.end(); )
+        {
+            if (iter->second.expired())
+            {
+                iter = m_mapStreamContext.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+        m_uiStreamContextSweepSize = std::max(m_mapStreamContext.size() * 2, (size_t)STREAM_CONTEXT_SWEEP_MIN);
+    }
+    uint64 ullKey = ((uint64)pChannel->m_pImpl->GetSequence() << 32) | uiStreamId;
+    m_mapStreamContext[ullKey] = pContext;
+    return(pContext);
+}
+
+void ActorBuilder::AddDownstream(int32 iFd, uint32 uiChannelSeq, uint32 uiStreamId, uint32 uiStepSeq)
+{
+    std::shared_ptr<Step> pStep = m_oCallbackStep.Get(uiStepSeq);
+    if (nullptr == pStep || nullptr == pStep->GetContext())
+    {
+        return;
+    }
+    std::shared_ptr<Context> pUpstreamContext = pStep->GetContext()->GetUpstreamContext();
+    if (nullptr != pUpstreamContext)
+    {
+        pUpstreamContext->m_vecDownstream.push_back({iFd, uiChannelSeq, uiStreamId, uiStepSeq});
+    }
+}
+
+void ActorBuilder::OnStreamReset(std::shared_ptr<SocketChannel> pChannel, uint32 uiStreamId)
+{
+    uint64 ullKey = ((uint64)pChannel->m_pImpl->GetSequence() << 32) | uiStreamId;
+    m_mapStreamWritableWatcher.erase(ullKey);
+    for (auto& rModule : m_mapModule)
+    {
+        if (rModule.second->WithChunkNotice())
+        {
+            rModule.second->OnStreamReset(pChannel, uiStreamId);
+        }
+    }
+    auto context_iter = m_mapStreamContext.find(ullKey);
+    if (context_iter == m_mapStreamContext.end())
+    {
+        return;
+    }
+    std::shared_ptr<Context> pContext = context_iter->second.lock();
+    m_mapStreamContext.erase(context_iter);
+    if (nullptr == pContext)
+    {
+        return;
+    }
+    LOG4_DEBUG("stream %u cancelled by peer, %u downstream stream(s) to cancel.",
+            uiStreamId, (uint32)pContext->m_vecDownstream.size());
+    pContext->m_bCancelled = true;
+    // 回调中可能发起新的下游请求，先取出已登记的下游stream
+    auto vecDownstream = std::move(pContext->m_vecDownstream);
+    pContext->m_vecDownstream.clear();
+    for (auto& stDownstream : vecDownstream)
+    {
+        std::shared_ptr<SocketChannel> pDownstreamChannel = m_pLabor->GetDispatcher()->GetChannel(stDownstream.iFd);
+        if (nullptr == pDownstreamChannel
+                || pDownstreamChannel->m_pImpl->GetSequence() != stDownstream.uiChannelSeq)
+        {
+            continue;       // 下游连接已关闭，其上的Step已由连接关闭流程回调
+        }
+        uint32 uiStepSeq = pDownstreamChannel->m_pImpl->CancelHttp2Stream(stDownstream.uiStreamId);
+        if (0 != uiStepSeq)
+        {
+            m_pLabor->GetDispatcher()->SendTo(pDownstreamChannel);
+            // 与下游出错相同处理：回调ErrBack()，所属Chain继续执行
+            OnError(pDownstreamChannel, uiStepSeq, ERR_STREAM_RESET, "upstream stream cancelled by peer");
+        }
+    }
+}
+
+void ActorBuilder::WatchStreamWritable(std::shared_ptr<SocketChannel> pChannel, uint32 uiStreamId, Module* pModule)
+{
+    uint64 ullKey = ((uint64)pChannel->m_pImpl->GetSequence() << 32) | uiStreamId;
+    m_mapStreamWritableWatcher[ullKey] = pModule->m_strModulePath;
+}
+
+void ActorBuilder::OnStreamWritable(std::shared_ptr<SocketChannel> pChannel, uint32 uiStreamId)
+{
+    uint64 ullKey = ((uint64)pChannel->m_pImpl->GetSequence() << 32) | uiStreamId;
+    auto watcher_iter = m_mapStreamWritableWatcher.find(ullKey);
+    if (watcher_iter == m_mapStreamWritableWatcher.end())
+    {
+        return;
+    }
+    std::string strModulePath = std::move(watcher_iter->second);
+    m_mapStreamWritableWatcher.erase(watcher_iter);
+    auto module_iter = m_mapModule.find(strModulePath);
+    if (module_iter == m_mapModule.end())
+    {
+        return;     // Module已卸载
+    }
+    module_iter->second->OnStreamWritable(pChannel, uiStreamId);
+}
+
+void ActorBuilder::OnHttp2ChannelClosed(std::shared_ptr<SocketChannel> pChannel)
+{
+    uint64 ullChannelKey = (uint64)pChannel->m_pImpl->GetSequence() << 32;
+    m_mapStreamWritableWatcher.erase(m_mapStreamWritableWatcher.lower_bound(ullChannelKey),
+            m_mapStreamWritableWatcher.lower_bound(ullChannelKey + 0x100000000ULL));
+    for (auto& rModule : m_mapModule)
+    {
+        if (rModule.second->WithChunkNotice())
+        {
+            rModule.second->OnChannelClosed(pChannel);
+        }
+    }
+}
+
 void ActorBuilder::AddAssemblyLine(std::shared_ptr<Session> pSession)
 {
-    m_setAssemblyLine.insert(pSession);
+    if (!pSession->m_bInAssemblyLine)
+    {
+        pSession->m_bInAssemblyLine = true;
+        m_vecAssemblyLine.push_back(pSession);
+    }
 }
 
 void ActorBuilder::RemoveStep(std::shared_ptr<Step> pStep)
@@ -604,37 +756,61 @@ void ActorBuilder::RemoveStep(std::shared_ptr<Step> pStep)
     {
         return;
     }
-    std::unordered_map<uint32, std::shared_ptr<Step> >::iterator callback_iter;
     for (auto step_seq_iter = pStep->m_setPreStepSeq.begin();
                     step_seq_iter != pStep->m_setPreStepSeq.end(); )
     {
-        callback_iter = m_mapCallbackStep.find(*step_seq_iter);
-        if (callback_iter == m_mapCallbackStep.end())
+        if (!m_oCallbackStep.Exist(*step_seq_iter))
         {
             pStep->m_setPreStepSeq.erase(step_seq_iter++);
         }
         else
         {
             LOG4_DEBUG("step %u had pre step %u running, delay delete callback.", pStep->GetSequence(), *step_seq_iter);
-            ResetTimeout(std::dynamic_pointer_cast<Actor>(pStep));
+            ResetTimeout(pStep);
             return;
         }
     }
-    auto class_iter = m_mapLoadedStep.find(pStep->GetActorName());
-    if (class_iter != m_mapLoadedStep.end())
+    if (!m_mapLoadedStep.empty())   // 没有动态加载的Step时不必按类名查找
     {
-        auto id_iter = class_iter->second.find(pStep->GetSequence());
-        if (id_iter != class_iter->second.end())
+        auto class_iter = m_mapLoadedStep.find(pStep->GetActorName());
+        if (class_iter != m_mapLoadedStep.end())
         {
-            class_iter->second.erase(id_iter);
+            auto id_iter = class_iter->second.find(pStep->GetSequence());
+            if (id_iter != class_iter->second.end())
+            {
+                class_iter->second.erase(id_iter);
+            }
         }
     }
     m_pLabor->GetDispatcher()->DelEvent(pStep->MutableTimerWatcher());
-    callback_iter = m_mapCallbackStep.find(pStep->GetSequence());
-    if (callback_iter != m_mapCallbackStep.end())
+    if (m_oCallbackStep.Erase(pStep->GetSequence()))
     {
         LOG4_TRACE("erase step(seq %u)", pStep->GetSequence());
-        m_mapCallbackStep.erase(callback_iter);
+        RemoveDownstream(pStep);
+    }
+}
+
+void ActorBuilder::RemoveDownstream(std::shared_ptr<Step> pStep)
+{
+    // 已完成的下游stream无须再取消，从上游Context的登记中删除，避免长连接上的流式请求中登记无限增长
+    if (nullptr == pStep->GetContext())
+    {
+        return;
+    }
+    std::shared_ptr<Context> pUpstreamContext = pStep->GetContext()->GetUpstreamContext();
+    if (nullptr == pUpstreamContext)
+    {
+        return;
+    }
+    auto& vecDownstream = pUpstreamContext->m_vecDownstream;
+    for (size_t i = 0; i < vecDownstream.size(); ++i)
+    {
+        if (vecDownstream[i].uiStepSeq == pStep->GetSequence())
+        {
+            vecDownstream[i] = vecDownstream.back();
+            vecDownstream.pop_back();
+            return;
+        }
     }
 }
 
@@ -654,11 +830,9 @@ void ActorBuilder::RemoveSession(std::shared_ptr<Session> pSession)
         }
     }
     m_pLabor->GetDispatcher()->DelEvent(pSession->MutableTimerWatcher());
-    auto iter = m_mapCallbackSession.find(pSession->GetSessionId());
-    if (iter != m_mapCallbackSession.end())
+    if (m_oCallbackSession.Erase(pSession->GetSessionId()))
     {
         LOG4_TRACE("erase session(session_id %s)", pSession->GetSessionId().c_str());
-        m_mapCallbackSession.erase(iter);
     }
 }
 
@@ -673,11 +847,51 @@ void ActorBuilder::RemoveChain(uint32 uiChainId)
     }
 }
 
+void ActorBuilder::NewTraceId(Actor* pActor)
+{
+    static const char s_szHexDigit[] = "0123456789abcdef";
+    uint32 auiTraceField[3] = {m_pLabor->GetNodeInfo().uiNodeId, (uint32)m_pLabor->GetNowTime(), ++m_uiTraceSeq};
+    char* pPos = m_szTraceId;
+    for (int i = 0; i < 3; ++i)
+    {
+        for (int iShift = 28; iShift >= 0; iShift -= 4)
+        {
+            *pPos++ = s_szHexDigit[(auiTraceField[i] >> iShift) & 0xF];
+        }
+    }
+    pActor->SetTraceId(m_szTraceId, TRACE_ID_LEN);
+}
+
+void ActorBuilder::InheritTraceId(Actor* pActor, const char* szTraceId, size_t uiTraceIdLen)
+{
+    if (uiTraceIdLen > 10)
+    {
+        pActor->SetTraceId(szTraceId, uiTraceIdLen);
+    }
+    else
+    {
+        NewTraceId(pActor);
+    }
+}
+
+void ActorBuilder::InheritTraceId(Actor* pActor, const HttpMsg& oHttpMsg)
+{
+    auto trace_iter = oHttpMsg.headers().find("x-trace-id");
+    if (trace_iter == oHttpMsg.headers().end())
+    {
+        NewTraceId(pActor);
+    }
+    else
+    {
+        InheritTraceId(pActor, trace_iter->second.data(), trace_iter->second.size());
+    }
+}
+
 void ActorBuilder::ChannelNotice(std::shared_ptr<SocketChannel> pChannel, const std::string& strIdentify, const std::string& strClientData)
 {
     LOG4_TRACE(" ");
-    auto cmd_iter = m_mapCmd.find(CMD_REQ_DISCONNECT);
-    if (cmd_iter != m_mapCmd.end() && cmd_iter->second != nullptr)
+    Cmd* pCmd = FindCmd(CMD_REQ_DISCONNECT);
+    if (pCmd != nullptr)
     {
         MsgHead oMsgHead;
         MsgBody oMsgBody;
@@ -687,31 +901,32 @@ void ActorBuilder::ChannelNotice(std::shared_ptr<SocketChannel> pChannel, const
         oMsgHead.set_cmd(CMD_REQ_DISCONNECT);
         oMsgHead.set_seq(m_pLabor->GetSequence());
         oMsgHead.set_len(oMsgBody.ByteSize());
-        std::ostringstream oss;
-        oss << m_pLabor->GetNodeInfo().uiNodeId << "." << m_pLabor->GetNowTime() << "." << m_pLabor->GetSequence();
-        cmd_iter->second->SetTraceId(oss.str());
-        cmd_iter->second->AnyMessage(pChannel, oMsgHead, oMsgBody);
+        NewTraceId(pCmd);
+        pCmd->AnyMessage(pChannel, oMsgHead, oMsgBody);
     }
 }
 
 void ActorBuilder::ExecAssemblyLine(std::shared_ptr<SocketChannel> pChannel, const MsgHead& oMsgHead, const MsgBody& oMsgBody)
 {
-    for (auto session_iter = m_setAssemblyLine.begin(); session_iter != m_setAssemblyLine.end(); ++session_iter)
+    // 按下标遍历：Step回调中就绪的Session追加到队尾，在本轮中一并执行
+    for (size_t i = 0; i < m_vecAssemblyLine.size(); ++i)
     {
+        std::shared_ptr<Session> pSession = m_vecAssemblyLine[i];
+        pSession->m_bInAssemblyLine = false;
         uint32 uiStepSeq = 0;
         do
         {
-            uiStepSeq = (*session_iter)->PopWaitingStep();
-            auto step_iter = m_mapCallbackStep.find(uiStepSeq);
-            if (step_iter != m_mapCallbackStep.end())
+            uiStepSeq = pSession->PopWaitingStep();
+            std::shared_ptr<Step> pStep = m_oCallbackStep.Get(uiStepSeq);
+            if (nullptr != pStep)
             {
                 E_CMD_STATUS eResult;
-                step_iter->second->SetActiveTime(m_pLabor->GetNowTime());
-                eResult = (std::dynamic_pointer_cast<PbStep>(step_iter->second))->Callback(pChannel, oMsgHead, oMsgBody);
+                pStep->SetActiveTime(m_pLabor->GetNowTime());
+                eResult = pStep->Callback(pChannel, oMsgHead, oMsgBody);
                 if (CMD_STATUS_RUNNING != eResult)
                 {
-                    uint32 uiChainId = step_iter->second->GetChainId();
-                    RemoveStep(step_iter->second);
+                    uint32 uiChainId = pStep->GetChainId();
+                    RemoveStep(pStep);
                     if (CMD_STATUS_FAULT != eResult && 0 != uiChainId)
                     {
                         auto chain_iter = m_mapChain.find(uiChainId);
@@ -730,27 +945,30 @@ void ActorBuilder::ExecAssemblyLine(std::shared_ptr<SocketChannel> pChannel, con
         }
         while(uiStepSeq > 0);
     }
-    m_setAssemblyLine.clear();
+    m_vecAssemblyLine.clear();
 }
 
 void ActorBuilder::ExecAssemblyLine(std::shared_ptr<SocketChannel> pChannel, int iErrno, const std::string& strErrMsg)
 {
-    for (auto session_iter = m_setAssemblyLine.begin(); session_iter != m_setAssemblyLine.end(); ++session_iter)
+    // 按下标遍历：Step回调中就绪的Session追加到队尾，在本轮中一并执行
+    for (size_t i = 0; i < m_vecAssemblyLine.size(); ++i)
     {
+        std::shared_ptr<Session> pSession = m_vecAssemblyLine[i];
+        pSession->m_bInAssemblyLine = false;
         uint32 uiStepSeq = 0;
         do
         {
-            uiStepSeq = (*session_iter)->PopWaitingStep();
-            auto step_iter = m_mapCallbackStep.find(uiStepSeq);
-            if (step_iter != m_mapCallbackStep.end())
+            uiStepSeq = pSession->PopWaitingStep();
+            std::shared_ptr<Step> pStep = m_oCallbackStep.Get(uiStepSeq);
+            if (nullptr != pStep)
             {
                 E_CMD_STATUS eResult;
-                step_iter->second->SetActiveTime(m_pLabor->GetNowTime());
-                eResult = (std::dynamic_pointer_cast<PbStep>(step_iter->second))->ErrBack(pChannel, iErrno, strErrMsg);
+                pStep->SetActiveTime(m_pLabor->GetNowTime());
+                eResult = pStep->ErrBack(pChannel, iErrno, strErrMsg);
                 if (CMD_STATUS_RUNNING != eResult)
                 {
-                    uint32 uiChainId = step_iter->second->GetChainId();
-                    RemoveStep(step_iter->second);
+                    uint32 uiChainId = pStep->GetChainId();
+                    RemoveStep(pStep);
                     if (CMD_STATUS_FAULT != eResult && 0 != uiChainId)
                     {
                         auto chain_iter = m_mapChain.find(uiChainId);
@@ -769,7 +987,7 @@ void ActorBuilder::ExecAssemblyLine(std::shared_ptr<SocketChannel> pChannel, int
         }
         while(uiStepSeq > 0);
     }
-    m_setAssemblyLine.clear();
+    m_vecAssemblyLine.clear();
 }
 
 void ActorBuilder::AddChainConf(const std::string& strChainKey, std::queue<std::vector<std::string> >&& queChainBlocks)
@@ -824,6 +1042,90 @@ void ActorBuilder::LoadSysCmd()
     m_pSessionLogger = std::dynamic_pointer_cast<SessionLogger>(MakeSharedSession(nullptr, "neb::SessionLogger"));
 }
 
+template <>
+std::shared_ptr<Cmd> ActorBuilder::ActorCast<Cmd>(const std::shared_ptr<Actor>& pSharedActor)
+{
+    if (nullptr == pSharedActor || Actor::ACT_CMD != pSharedActor->GetActorType())
+    {
+        return(nullptr);
+    }
+    return(std::static_pointer_cast<Cmd>(pSharedActor));
+}
+
+template <>
+std::shared_ptr<Module> ActorBuilder::ActorCast<Module>(const std::shared_ptr<Actor>& pSharedActor)
+{
+    if (nullptr == pSharedActor || Actor::ACT_MODULE != pSharedActor->GetActorType())
+    {
+        return(nullptr);
+    }
+    return(std::static_pointer_cast<Module>(pSharedActor));
+}
+
+template <>
+std::shared_ptr<Step> ActorBuilder::ActorCast<Step>(const std::shared_ptr<Actor>& pSharedActor)
+{
+    if (nullptr == pSharedActor || pSharedActor->GetActorType() < Actor::ACT_PB_STEP
+            || pSharedActor->GetActorType() > Actor::ACT_RAW_STEP)
+    {
+        return(nullptr);
+    }
+    return(std::static_pointer_cast<Step>(pSharedActor));
+}
+
+template <>
+std::shared_ptr<Session> ActorBuilder::ActorCast<Session>(const std::shared_ptr<Actor>& pSharedActor)
+{
+    if (nullptr == pSharedActor || pSharedActor->GetActorType() < Actor::ACT_SESSION
+            || pSharedActor->GetActorType() > Actor::ACT_TIMER)
+    {
+        return(nullptr);
+    }
+    return(std::static_pointer_cast<Session>(pSharedActor));
+}
+
+template <>
+std::shared_ptr<Context> ActorBuilder::ActorCast<Context>(const std::shared_ptr<Actor>& pSharedActor)
+{
+    if (nullptr == pSharedActor || Actor::ACT_CONTEXT != pSharedActor->GetActorType())
+    {
+        return(nullptr);
+    }
+    return(std::static_pointer_cast<Context>(pSharedActor));
+}
+
+template <>
+std::shared_ptr<Operator> ActorBuilder::ActorCast<Operator>(const std::shared_ptr<Actor>& pSharedActor)
+{
+    if (nullptr == pSharedActor || Actor::ACT_OPERATOR != pSharedActor->GetActorType())
+    {
+        return(nullptr);
+    }
+    return(std::static_pointer_cast<Operator>(pSharedActor));
+}
+
+template <>
+std::shared_ptr<Chain> ActorBuilder::ActorCast<Chain>(const std::shared_ptr<Actor>& pSharedActor)
+{
+    if (nullptr == pSharedActor || Actor::ACT_CHAIN != pSharedActor->GetActorType())
+    {
+        return(nullptr);
+    }
+    return(std::static_pointer_cast<Chain>(pSharedActor));
+}
+
+void ActorBuilder::ReleaseActor(Actor* pActor)
+{
+    if (nullptr == pActor->m_pRecycle)
+    {
+        delete pActor;
+    }
+    else
+    {
+        pActor->m_pRecycle(pActor);
+    }
+}
+
 std::shared_ptr<Actor> ActorBuilder::InitializeSharedActor(Actor* pCreator, std::shared_ptr<Actor> pSharedActor, const std::string& strActorName)
 {
     pSharedActor->SetLabor(m_pLabor);
@@ -852,6 +1154,10 @@ std::shared_ptr<Actor> ActorBuilder::InitializeSharedActor(Actor* pCreator, std:
             }
             break;
         case Actor::ACT_CONTEXT:
+            if (nullptr != pCreator && nullptr != pCreator->GetContext())
+            {
+                std::static_pointer_cast<Context>(pSharedActor)->InheritUpstream(pCreator->GetContext());
+            }
             return(pSharedActor);
             break;
         case Actor::ACT_CMD:
@@ -890,6 +1196,20 @@ bool ActorBuilder::TransformToSharedStep(Actor* pCreator, std::shared_ptr<Actor>
 {
     pSharedActor->m_dTimeout = (gc_dDefaultTimeout == pSharedActor->m_dTimeout)
             ? m_pLabor->GetNodeInfo().dStepTimeout : pSharedActor->m_dTimeout;
+    if (nullptr != pSharedActor->GetContext())
+    {
+        // Step不等待超过上游请求的截止时间
+        ev_tstamp dRemaining = pSharedActor->GetContext()->GetRemainingTime();
+        if (gc_dNoTimeout != dRemaining
+                && (gc_dNoTimeout == pSharedActor->m_dTimeout || dRemaining < pSharedActor->m_dTimeout))
+        {
+            pSharedActor->m_dTimeout = dRemaining;
+            if (pSharedActor->m_dTimeout < MIN_STEP_TIMEOUT)
+            {
+                pSharedActor->m_dTimeout = MIN_STEP_TIMEOUT;
+            }
+        }
+    }
     ev_timer* timer_watcher = pSharedActor->MutableTimerWatcher();
     if (NULL == timer_watcher)
     {
@@ -901,22 +1221,21 @@ bool ActorBuilder::TransformToSharedStep(Actor* pCreator, std::shared_ptr<Actor>
         pSharedActor->SetTraceId(pCreator->GetTraceId());
     }
 
-    while (m_mapCallbackStep.find(pSharedActor->GetSequence()) != m_mapCallbackStep.end())
+    while (m_oCallbackStep.Exist(pSharedActor->GetSequence()))
     {
         pSharedActor->ForceNewSequence();
     }
-    std::shared_ptr<Step> pSharedStep = std::dynamic_pointer_cast<Step>(pSharedActor);
+    std::shared_ptr<Step> pSharedStep = std::static_pointer_cast<Step>(pSharedActor);
     for (auto iter = pSharedStep->m_setNextStepSeq.begin(); iter != pSharedStep->m_setNextStepSeq.end(); ++iter)
     {
-        auto callback_iter = m_mapCallbackStep.find(*iter);
-        if (callback_iter != m_mapCallbackStep.end())
+        std::shared_ptr<Step> pNextStep = m_oCallbackStep.Get(*iter);
+        if (nullptr != pNextStep)
         {
-            callback_iter->second->m_setPreStepSeq.insert(pSharedStep->GetSequence());
+            pNextStep->m_setPreStepSeq.insert(pSharedStep->GetSequence());
         }
     }
 
-    auto ret = m_mapCallbackStep.insert(std::make_pair(pSharedStep->GetSequence(), pSharedStep));
-    if (ret.second)
+    if (m_oCallbackStep.Insert(pSharedStep->GetSequence(), pSharedStep))
     {
         if (gc_dNoTimeout != pSharedStep->m_dTimeout)
         {
@@ -948,13 +1267,10 @@ bool ActorBuilder::TransformToSharedSession(Actor* pCreator, std::shared_ptr<Act
 
     if (nullptr != pCreator)
     {
-        std::ostringstream oss;
-        oss << m_pLabor->GetNodeInfo().uiNodeId << "." << m_pLabor->GetNowTime() << "." << pSharedActor->GetSequence();
-        pSharedActor->SetTraceId(oss.str());
+        NewTraceId(pSharedActor.get());
     }
-    std::shared_ptr<Session> pSharedSession = std::dynamic_pointer_cast<Session>(pSharedActor);
-    auto ret = m_mapCallbackSession.insert(std::make_pair(pSharedSession->GetSessionId(), pSharedSession));
-    if (ret.second)
+    std::shared_ptr<Session> pSharedSession = std::static_pointer_cast<Session>(pSharedActor);
+    if (m_oCallbackSession.Insert(pSharedSession))
     {
         if (pSharedSession->m_dTimeout > 0)
         {
@@ -980,10 +1296,11 @@ bool ActorBuilder::TransformToSharedCmd(Actor* pCreator, std::shared_ptr<Actor>
     {
         pSharedActor->SetTraceId(pCreator->GetTraceId());
     }
-    std::shared_ptr<Cmd> pSharedCmd = std::dynamic_pointer_cast<Cmd>(pSharedActor);
+    std::shared_ptr<Cmd> pSharedCmd = std::static_pointer_cast<Cmd>(pSharedActor);
     auto ret = m_mapCmd.insert(std::make_pair(pSharedCmd->GetCmd(), pSharedCmd));
     if (ret.second)
     {
+        RebuildCmdTable();
         if (pSharedCmd->Init())
         {
             auto cmd_class_iter = m_mapLoadedCmd.find(pSharedCmd->GetActorName());
@@ -1001,6 +1318,27 @@ bool ActorBuilder::TransformToSharedCmd(Actor* pCreator, std::shared_ptr<Actor>
     return(false);
 }
 
+void ActorBuilder::RebuildCmdTable()
+{
+    uint32 uiTableSize = 0;
+    for (auto cmd_iter = m_mapCmd.begin(); cmd_iter != m_mapCmd.end(); ++cmd_iter)
+    {
+        if ((uint32)cmd_iter->first < CMD_TABLE_MAX_SIZE && (uint32)cmd_iter->first >= uiTableSize)
+        {
+            uiTableSize = (uint32)cmd_iter->first + 1;
+        }
+    }
+    std::vector<Cmd*> vecCmdTable(uiTableSize, nullptr);
+    for (auto cmd_iter = m_mapCmd.begin(); cmd_iter != m_mapCmd.end(); ++cmd_iter)
+    {
+        if ((uint32)cmd_iter->first < uiTableSize)
+        {
+            vecCmdTable[cmd_iter->first] = cmd_iter->second.get();
+        }
+    }
+    m_vecCmdTable.swap(vecCmdTable);    // 新表构建完成后整体替换
+}
+
 bool ActorBuilder::TransformToSharedModule(Actor* pCreator, std::shared_ptr<Actor> pSharedActor)
 {
     if (nullptr != pCreator)
@@ -1008,17 +1346,28 @@ bool ActorBuilder::TransformToSharedModule(Actor* pCreator, std::shared_ptr<Acto
         pSharedActor->SetTraceId(pCreator->GetTraceId());
     }
 
-    std::shared_ptr<Module> pSharedModule = std::dynamic_pointer_cast<Module>(pSharedActor);
+    std::shared_ptr<Module> pSharedModule = std::static_pointer_cast<Module>(pSharedActor);
     auto ret = m_mapModule.insert(std::make_pair(pSharedModule->GetModulePath(), pSharedModule));
     if (ret.second)
     {
         if (pSharedModule->Init())
         {
+            if (!m_oModuleRouter.AddRoute(pSharedModule->GetModulePath(), pSharedModule))
+            {
+                LOG4_ERROR("module path \"%s\" is invalid or conflicts with an existing route.",
+                        pSharedModule->GetModulePath().c_str());
+                m_mapModule.erase(ret.first);
+                return(false);
+            }
             auto module_class_iter = m_mapLoadedModule.find(pSharedModule->GetActorName());
             if (module_class_iter != m_mapLoadedModule.end())
             {
                 module_class_iter->second.insert(pSharedModule->GetModulePath());
             }
+            if (pSharedModule->WithChunkNotice())
+            {
+                CodecHttp::AddChunkNoticeModule();
+            }
             return(true);
         }
     }
@@ -1031,7 +1380,7 @@ bool ActorBuilder::TransformToSharedModule(Actor* pCreator, std::shared_ptr<Acto
 
 bool ActorBuilder::TransformToSharedOperator(Actor* pCreator, std::shared_ptr<Actor> pSharedActor)
 {
-    std::shared_ptr<Operator> pSharedOperator = std::dynamic_pointer_cast<Operator>(pSharedActor);
+    std::shared_ptr<Operator> pSharedOperator = std::static_pointer_cast<Operator>(pSharedActor);
     auto ret = m_mapOperator.insert(std::make_pair(pSharedOperator->GetActorName(), pSharedOperator));
     if (ret.second)
     {
@@ -1060,7 +1409,7 @@ bool ActorBuilder::TransformToSharedChain(Actor* pCreator, std::shared_ptr<Actor
         pSharedActor->SetTraceId(pCreator->GetTraceId());
     }
 
-    std::shared_ptr<Chain> pSharedChain = std::dynamic_pointer_cast<Chain>(pSharedActor);
+    std::shared_ptr<Chain> pSharedChain = std::static_pointer_cast<Chain>(pSharedActor);
     auto chain_conf_iter = m_mapChainConf.find(pSharedChain->GetChainFlag());
     if (chain_conf_iter == m_mapChainConf.end())
     {
@@ -1125,44 +1474,44 @@ bool ActorBuilder::SendToCluster(const std::string& strIdentify, bool bWithSsl,
 
 std::shared_ptr<Session> ActorBuilder::GetSession(uint32 uiSessionId)
 {
-    std::ostringstream oss;
-    oss << uiSessionId;
-    auto id_iter = m_mapCallbackSession.find(oss.str());
-    if (id_iter == m_mapCallbackSession.end())
+    std::shared_ptr<Session> pSession = m_oCallbackSession.Get(uiSessionId);
+    if (nullptr != pSession)
     {
-        return(nullptr);
-    }
-    else
-    {
-        id_iter->second->SetActiveTime(m_pLabor->GetNowTime());
-        return(id_iter->second);
+        pSession->SetActiveTime(m_pLabor->GetNowTime());
     }
+    return(pSession);
 }
 
 std::shared_ptr<Session> ActorBuilder::GetSession(const std::string& strSessionId)
 {
-    auto id_iter = m_mapCallbackSession.find(strSessionId);
-    if (id_iter == m_mapCallbackSession.end())
-    {
-        return(nullptr);
-    }
-    else
+    return(GetSession(strSessionId.data(), strSessionId.size()));
+}
+
+std::shared_ptr<Session> ActorBuilder::GetSession(const char* szSessionId, size_t uiSessionIdLen)
+{
+    std::shared_ptr<Session> pSession = m_oCallbackSession.Get(szSessionId, uiSessionIdLen);
+    if (nullptr != pSession)
     {
-        id_iter->second->SetActiveTime(m_pLabor->GetNowTime());
-        return(id_iter->second);
+        pSession->SetActiveTime(m_pLabor->GetNowTime());
     }
+    return(pSession);
+}
+
+std::shared_ptr<Step> ActorBuilder::GetStep(uint32 uiStepSeq)
+{
+    return(m_oCallbackStep.Get(uiStepSeq));
 }
 
 bool ActorBuilder::ExecStep(uint32 uiStepSeq, int iErrno, const std::string& strErrMsg, void* data)
 {
-    auto iter = m_mapCallbackStep.find(uiStepSeq);
-    if (iter == m_mapCallbackStep.end())
+    std::shared_ptr<Step> pStep = m_oCallbackStep.Get(uiStepSeq);
+    if (nullptr == pStep)
     {
         return(false);
     }
     else
     {
-        iter->second->Emit(iErrno, strErrMsg, data);
+        pStep->Emit(iErrno, strErrMsg, data);
         return(true);
     }
 }
@@ -1190,7 +1539,7 @@ bool ActorBuilder::ResetTimeout(std::shared_ptr<Actor> pSharedActor)
 
 int32 ActorBuilder::GetStepNum()
 {
-    return((int32)m_mapCallbackStep.size());
+    return((int32)m_oCallbackStep.Size());
 }
 
 bool ActorBuilder::ReloadCmdConf()
@@ -1199,6 +1548,7 @@ bool ActorBuilder::ReloadCmdConf()
     {
         cmd_iter->second->Init();
     }
+    RebuildCmdTable();
     for (auto module_iter = m_mapModule.begin(); module_iter != m_mapModule.end(); ++module_iter)
     {
         module_iter->second->Init();
@@ -1424,6 +1774,7 @@ void ActorBuilder::UnloadDynamicSymbol(CJsonObject& oOneSoConf)
             m_mapLoadedCmd.erase(class_iter);
         }
     }
+    RebuildCmdTable();
     for (int j = 0; j < oOneSoConf["module"].GetArraySize(); ++j)
     {
         auto class_iter = m_mapLoadedModule.find(oOneSoConf["module"][j]("class"));
@@ -1434,6 +1785,11 @@ void ActorBuilder::UnloadDynamicSymbol(CJsonObject& oOneSoConf)
                 auto module_iter = m_mapModule.find(*id_iter);
                 if (module_iter != m_mapModule.end())
                 {
+                    if (module_iter->second->WithChunkNotice())
+                    {
+                        CodecHttp::DelChunkNoticeModule();
+                    }
+                    m_oModuleRouter.DelRoute(module_iter->first);
                     m_mapModule.erase(module_iter);
                 }
             }
@@ -1448,11 +1804,7 @@ void ActorBuilder::UnloadDynamicSymbol(CJsonObject& oOneSoConf)
         {
             for (auto id_iter = class_iter->second.begin(); id_iter != class_iter->second.end(); ++id_iter)
             {
-                auto session_iter = m_mapCallbackSession.find(*id_iter);
-                if (session_iter != m_mapCallbackSession.end())
-                {
-                    m_mapCallbackSession.erase(session_iter);
-                }
+                m_oCallbackSession.Erase(*id_iter);
             }
             class_iter->second.clear();
             m_mapLoadedSession.erase(class_iter);
@@ -1465,11 +1817,11 @@ void ActorBuilder::UnloadDynamicSymbol(CJsonObject& oOneSoConf)
         {
             for (auto id_iter = class_iter->second.begin(); id_iter != class_iter->second.end(); ++id_iter)
             {
-                auto step_iter = m_mapCallbackStep.find(*id_iter);
-                if (step_iter != m_mapCallbackStep.end())
+                std::shared_ptr<Step> pStep = m_oCallbackStep.Get(*id_iter);
+                if (nullptr != pStep)
                 {
-                    step_iter->second->Timeout();
-                    m_mapCallbackStep.erase(step_iter);
+                    pStep->Timeout();
+                    m_oCallbackStep.Erase(pStep->GetSequence());
                 }
             }
             class_iter->second.clear();
@@ -14,6 +14,7 @@
 #include <string>
 #include <vector>
 #include <list>
+#include <map>
 #include <queue>
 #include <unordered_map>
 #include <unordered_set>
@@ -39,6 +40,10 @@
 #include "Error.hpp"
 #include "util/CBuffer.hpp"
 #include "ActorFactory.hpp"
+#include "ActorPool.hpp"
+#include "cmd/ModuleRouter.hpp"
+#include "step/StepSeqTable.hpp"
+#include "session/SessionIndex.hpp"
 #include "logger/NetLogger.hpp"
 
 namespace neb
@@ -64,6 +69,7 @@ class SessionLogger;
 
 class SocketChannel;
 class RedisChannel;
+class NativeHttpMsg;
 class Dispatcher;
 
 class CJsonObject;
@@ -95,10 +101,44 @@ public:
     bool OnChainTimeout(std::shared_ptr<Chain> pChain);
     bool OnMessage(std::shared_ptr<SocketChannel> pChannel, const MsgHead& oMsgHead, const MsgBody& oMsgBody);
     bool OnMessage(std::shared_ptr<SocketChannel> pChannel, const HttpMsg& oHttpMsg);
+    bool OnMessage(std::shared_ptr<SocketChannel> pChannel, const NativeHttpMsg& oNativeMsg);
     bool OnMessage(std::shared_ptr<SocketChannel> pChannel, const RedisMsg& oRedisMsg, uint32 uiFinalStepSeq = 0);
     bool OnMessage(std::shared_ptr<SocketChannel> pChannel, const CBuffer& oBuffer);
     bool OnError(std::shared_ptr<SocketChannel> pChannel, uint32 uiStepSeq, int iErrno, const std::string& strErrMsg);
 
+    /**
+     * @brief 为收到的HTTP2请求创建绑定该stream的Context
+     * @param dTimeout 上游请求携带的超时（秒），不大于0表示不限
+     * @note 由该Context派生的Context和Step继承截止时间；stream被对端重置时Context被取消。
+     */
+    std::shared_ptr<Context> MakeStreamContext(std::shared_ptr<SocketChannel> pChannel, uint32 uiStreamId, ev_tstamp dTimeout);
+
+    /**
+     * @brief 记录Step发往下游的HTTP2 stream，Step所属上游stream被重置时一并取消
+     */
+    void AddDownstream(int32 iFd, uint32 uiChannelSeq, uint32 uiStreamId, uint32 uiStepSeq);
+
+    /**
+     * @brief 作为服务端的HTTP2 stream被对端重置，通知启用分块通知的Module，取消绑定该stream的
+     * Context及其下游stream，下游stream的Step以ERR_STREAM_RESET回调ErrBack()
+     */
+    void OnStreamReset(std::shared_ptr<SocketChannel> pChannel, uint32 uiStreamId);
+
+    /**
+     * @brief Module在HTTP2 stream上发送时数据因流控积压，待发送数据全部发出后回调其OnStreamWritable()
+     */
+    void WatchStreamWritable(std::shared_ptr<SocketChannel> pChannel, uint32 uiStreamId, Module* pModule);
+
+    /**
+     * @brief 作为服务端的HTTP2 stream待发送数据已全部发出
+     */
+    void OnStreamWritable(std::shared_ptr<SocketChannel> pChannel, uint32 uiStreamId);
+
+    /**
+     * @brief 作为服务端的HTTP2连接关闭，清理该连接上各stream的登记并通知启用分块通知的Module
+     */
+    void OnHttp2ChannelClosed(std::shared_ptr<SocketChannel> pChannel);
+
 public:
     template <typename ...Targs>
         void Logger(int iLogLevel, const char* szFileName, unsigned int uiFileLine, const char* szFunction, Targs&&... args);
@@ -129,6 +169,14 @@ public:
     template <typename ...Targs>
     std::shared_ptr<Chain> MakeSharedChain(Actor* pCreator, const std::string& strChainName, Targs&&... args);
 
+    /**
+     * @brief 按Actor类型标签转换
+     * @note 类型标签（Actor::GetActorType()）决定了Actor的框架基类，以static_pointer_cast
+     * 代替dynamic_pointer_cast。只对Cmd、Module、Step、Session、Context、Operator、Chain
+     * 做了特化，标签不匹配返回nullptr。
+     */
+    template <typename T> static std::shared_ptr<T> ActorCast(const std::shared_ptr<Actor>& pSharedActor);
+
     template <typename ...Targs> Actor* NewActor(const std::string& strActorName, Targs... args);
     std::shared_ptr<Actor> InitializeSharedActor(Actor* pCreator, std::shared_ptr<Actor> pSharedActor, const std::string& strActorName);
     bool TransformToSharedCmd(Actor* pCreator, std::shared_ptr<Actor> pSharedActor);
@@ -142,7 +190,16 @@ public:
     bool SendToCluster(const std::string& strIdentify, bool bWithSsl, bool bPipeline, const RedisMsg& oRedisMsg, uint32 uiStepSeq, bool bEnableReadOnly);
     virtual std::shared_ptr<Session> GetSession(uint32 uiSessionId);
     virtual std::shared_ptr<Session> GetSession(const std::string& strSessionId);
+    /**
+     * @brief 按会话ID查找Session，会话ID不必是std::string（可以指向接收缓冲区等）
+     */
+    std::shared_ptr<Session> GetSession(const char* szSessionId, size_t uiSessionIdLen);
     virtual bool ExecStep(uint32 uiStepSeq, int iErrno = ERR_OK, const std::string& strErrMsg = "", void* data = NULL);
+    /**
+     * @brief 按Sequence查找等待回调的Step
+     * @return Step，已回调完成、超时或被删除返回nullptr
+     */
+    std::shared_ptr<Step> GetStep(uint32 uiStepSeq);
     virtual std::shared_ptr<Operator> GetOperator(const std::string& strOperatorName);
     virtual bool ResetTimeout(std::shared_ptr<Actor> pSharedActor);
     int32 GetStepNum();
@@ -152,12 +209,43 @@ public:
 protected:
     void AddAssemblyLine(std::shared_ptr<Session> pSession);
     void RemoveStep(std::shared_ptr<Step> pStep);
+    void RemoveDownstream(std::shared_ptr<Step> pStep);
     void RemoveSession(std::shared_ptr<Session> pSession);
     void RemoveChain(uint32 uiChainId);
     void ChannelNotice(std::shared_ptr<SocketChannel> pChannel, const std::string& strIdentify, const std::string& strClientData);
     void ExecAssemblyLine(std::shared_ptr<SocketChannel> pChannel, const MsgHead& oMsgHead, const MsgBody& oMsgBody);
     void ExecAssemblyLine(std::shared_ptr<SocketChannel> pChannel, int iErrno, const std::string& strErrMsg);
 
+    /**
+     * @brief 为新请求生成trace id
+     * @note 节点ID、事件循环缓存的当前时间（秒）和本Worker的trace序号各编码为8位十六进制，
+     * 定长TRACE_ID_LEN字节，在m_szTraceId中生成后赋给pActor，稳态下不分配内存。
+     */
+    void NewTraceId(Actor* pActor);
+    /**
+     * @brief 沿用上游传入的trace id（MsgBody.trace_id或http头x-trace-id），无效时生成新的trace id
+     */
+    void InheritTraceId(Actor* pActor, const char* szTraceId, size_t uiTraceIdLen);
+    void InheritTraceId(Actor* pActor, const HttpMsg& oHttpMsg);
+
+    /**
+     * @brief 查找Cmd
+     * @note 小于CMD_TABLE_MAX_SIZE的命令字（绝大多数）直接按下标取m_vecCmdTable，稀疏的大命令字查m_mapCmd。
+     */
+    Cmd* FindCmd(int32 iCmd) const
+    {
+        if ((uint32)iCmd < m_vecCmdTable.size())
+        {
+            return(m_vecCmdTable[iCmd]);
+        }
+        auto cmd_iter = m_mapCmd.find(iCmd);
+        return((cmd_iter == m_mapCmd.end()) ? nullptr : cmd_iter->second.get());
+    }
+    /**
+     * @brief 由m_mapCmd重建命令字下标表，m_mapCmd有增删时调用
+     */
+    void RebuildCmdTable();
+
     void AddChainConf(const std::string& strChainKey, std::queue<std::vector<std::string> >&& queChainBlocks);
     void LoadSysCmd();
     void BootLoadCmd(CJsonObject& oCmdConf);
@@ -166,11 +254,23 @@ protected:
     void LoadDynamicSymbol(CJsonObject& oOneSoConf);
     void UnloadDynamicSymbol(CJsonObject& oOneSoConf);
 
+    /**
+     * @brief shared_ptr<Actor>的删除器
+     * @note 由DynamicCreator创建的Actor析构后归还所在线程的内存池，其他Actor直接delete。
+     */
+    static void ReleaseActor(Actor* pActor);
+
 private:
+    static const int TRACE_ID_LEN = 24;
+    static const uint32 CMD_TABLE_MAX_SIZE = 8192;  ///< 命令字下标表的最大长度
+    static const size_t STREAM_CONTEXT_SWEEP_MIN = 1024;
+    static constexpr ev_tstamp MIN_STEP_TIMEOUT = 0.001;    ///< 截止时间将至时Step的最小超时时间
     char* m_pErrBuff;
     Labor* m_pLabor;
     std::shared_ptr<NetLogger> m_pLogger;
     std::shared_ptr<SessionLogger> m_pSessionLogger;
+    uint32 m_uiTraceSeq;
+    char m_szTraceId[TRACE_ID_LEN + 1];
 
     // dynamic load，use for load and unload.
     std::unordered_map<std::string, tagSo*> m_mapLoadedSo;
@@ -181,7 +281,9 @@ private:
 
     // Cmd and Module
     std::unordered_map<int32, std::shared_ptr<Cmd> > m_mapCmd;
+    std::vector<Cmd*> m_vecCmdTable;                   ///< 下标为命令字，元素指向m_mapCmd中的Cmd
     std::unordered_map<std::string, std::shared_ptr<Module> > m_mapModule;
+    ModuleRouter m_oModuleRouter;                       ///< 由m_mapModule的Module路径构建，用于http请求路由
 
     // Chain and Operator
     std::unordered_map<std::string, std::queue<std::vector<std::string> > > m_mapChainConf; //key为Chain的配置名(ChainFlag)，value为由Operator类名和Step类名构成的ChainBlock链
@@ -189,10 +291,13 @@ private:
     std::unordered_map<std::string, std::shared_ptr<Operator> > m_mapOperator;                  //key为Operator类名
 
     // Step and Session
-    std::unordered_map<uint32, std::shared_ptr<Step> > m_mapCallbackStep;
+    StepSeqTable m_oCallbackStep;                      ///< 等待回调的Step，key为Step的Sequence
     std::unordered_map<std::string, std::shared_ptr<Step> > m_mapClusterChannelStep;    //集群回调，发往集群的请求和响应都会经由ClusterChannelStep截获再收发
-    std::unordered_map<std::string, std::shared_ptr<Session> > m_mapCallbackSession;
-    std::unordered_set<std::shared_ptr<Session> > m_setAssemblyLine;   ///< 资源就绪后执行队列
+    SessionIndex m_oCallbackSession;                   ///< 按字符串和整型会话ID索引的Session
+    std::unordered_map<uint64, std::weak_ptr<Context> > m_mapStreamContext;    ///< 绑定上游HTTP2 stream的Context，key为channel seq << 32 | stream id
+    size_t m_uiStreamContextSweepSize;                 ///< m_mapStreamContext达到该大小时清理已释放的Context
+    std::map<uint64, std::string> m_mapStreamWritableWatcher;      ///< 等待可写通知的HTTP2 stream（key同m_mapStreamContext），value为Module路径
+    std::vector<std::shared_ptr<Session> > m_vecAssemblyLine;          ///< 资源就绪后执行队列，由Session::SetReady()加入
 
     friend class Manager;
     friend class Worker;
@@ -212,6 +317,14 @@ void ActorBuilder::Logger(const std::string& strTraceId, int iLogLevel, const ch
     m_pLogger->WriteLog(strTraceId, iLogLevel, szFileName, uiFileLine, szFunction, std::forward<Targs>(args)...);
 }
 
+template <> std::shared_ptr<Cmd> ActorBuilder::ActorCast<Cmd>(const std::shared_ptr<Actor>& pSharedActor);
+template <> std::shared_ptr<Module> ActorBuilder::ActorCast<Module>(const std::shared_ptr<Actor>& pSharedActor);
+template <> std::shared_ptr<Step> ActorBuilder::ActorCast<Step>(const std::shared_ptr<Actor>& pSharedActor);
+template <> std::shared_ptr<Session> ActorBuilder::ActorCast<Session>(const std::shared_ptr<Actor>& pSharedActor);
+template <> std::shared_ptr<Context> ActorBuilder::ActorCast<Context>(const std::shared_ptr<Actor>& pSharedActor);
+template <> std::shared_ptr<Operator> ActorBuilder::ActorCast<Operator>(const std::shared_ptr<Actor>& pSharedActor);
+template <> std::shared_ptr<Chain> ActorBuilder::ActorCast<Chain>(const std::shared_ptr<Actor>& pSharedActor);
+
 template <typename ...Targs>
 std::shared_ptr<Actor> ActorBuilder::MakeSharedActor(Actor* pCreator, const std::string& strActorName, Targs&&... args)
 {
@@ -233,8 +346,7 @@ std::shared_ptr<Actor> ActorBuilder::MakeSharedActor(Actor* pCreator, const std:
             return(nullptr);
         }
     }
-    std::shared_ptr<Actor> pSharedActor;
-    pSharedActor.reset(pActor);
+    std::shared_ptr<Actor> pSharedActor(pActor, ReleaseActor, ActorPoolAllocator<Actor>());
     pActor = nullptr;
     return(InitializeSharedActor(pCreator, pSharedActor, strActorName));
 }
@@ -242,43 +354,43 @@ std::shared_ptr<Actor> ActorBuilder::MakeSharedActor(Actor* pCreator, const std:
 template <typename ...Targs>
 std::shared_ptr<Cmd> ActorBuilder::MakeSharedCmd(Actor* pCreator, const std::string& strCmdName, Targs&&... args)
 {
-    return(std::dynamic_pointer_cast<Cmd>(MakeSharedActor(pCreator, strCmdName, std::forward<Targs>(args)...)));
+    return(ActorCast<Cmd>(MakeSharedActor(pCreator, strCmdName, std::forward<Targs>(args)...)));
 }
 
 template <typename ...Targs>
 std::shared_ptr<Module> ActorBuilder::MakeSharedModule(Actor* pCreator, const std::string& strModuleName, Targs&&... args)
 {
-    return(std::dynamic_pointer_cast<Module>(MakeSharedActor(pCreator, strModuleName, std::forward<Targs>(args)...)));
+    return(ActorCast<Module>(MakeSharedActor(pCreator, strModuleName, std::forward<Targs>(args)...)));
 }
 
 template <typename ...Targs>
 std::shared_ptr<Step> ActorBuilder::MakeSharedStep(Actor* pCreator, const std::string& strStepName, Targs&&... args)
 {
-    return(std::dynamic_pointer_cast<Step>(MakeSharedActor(pCreator, strStepName, std::forward<Targs>(args)...)));
+    return(ActorCast<Step>(MakeSharedActor(pCreator, strStepName, std::forward<Targs>(args)...)));
 }
 
 template <typename ...Targs>
 std::shared_ptr<Session> ActorBuilder::MakeSharedSession(Actor* pCreator, const std::string& strSessionName, Targs&&... args)
 {
-    return(std::dynamic_pointer_cast<Session>(MakeSharedActor(pCreator, strSessionName, std::forward<Targs>(args)...)));
+    return(ActorCast<Session>(MakeSharedActor(pCreator, strSessionName, std::forward<Targs>(args)...)));
 }
 
 template <typename ...Targs>
 std::shared_ptr<Context> ActorBuilder::MakeSharedContext(Actor* pCreator, const std::string& strContextName, Targs&&... args)
 {
-    return(std::dynamic_pointer_cast<Context>(MakeSharedActor(pCreator, strContextName, std::forward<Targs>(args)...)));
+    return(ActorCast<Context>(MakeSharedActor(pCreator, strContextName, std::forward<Targs>(args)...)));
 }
 
 template <typename ...Targs>
 std::shared_ptr<Operator> ActorBuilder::MakeSharedOperator(Actor* pCreator, const std::string& strOperatorName, Targs&&... args)
 {
-    return(std::dynamic_pointer_cast<Operator>(MakeSharedActor(pCreator, strOperatorName, std::forward<Targs>(args)...)));
+    return(ActorCast<Operator>(MakeSharedActor(pCreator, strOperatorName, std::forward<Targs>(args)...)));
 }
 
 template <typename ...Targs>
 std::shared_ptr<Chain> ActorBuilder::MakeSharedChain(Actor* pCreator, const std::string& strChainName, Targs&&... args)
 {
-    return(std::dynamic_pointer_cast<Chain>(MakeSharedActor(pCreator, strChainName, std::forward<Targs>(args)...)));
+    return(ActorCast<Chain>(MakeSharedActor(pCreator, strChainName, std::forward<Targs>(args)...)));
 }
 
 template <typename ...Targs>
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     ActorPool.cpp
+ * @brief    Actor内存池
+ * @author   Bwar
+ * @date:    2026年10月19日
+ * @note
+ * Modify history:
+ ******************************************************************************/
+#include "ActorPool.hpp"
+
+namespace neb
+{
+
+struct tagFreeNode
+{
+    tagFreeNode* pNext;
+};
+
+struct tagFreeList
+{
+    tagFreeNode* pHead      = nullptr;
+    unsigned int uiFreeNum  = 0;
+};
+
+struct tagSizeClassFreeList
+{
+    static const std::size_t SIZE_CLASS_NUM = ActorBlockPool::MAX_BLOCK_SIZE / ActorBlockPool::SIZE_CLASS_ALIGN;
+
+    tagFreeList astFreeList[SIZE_CLASS_NUM];
+    bool bDestroyed         = false;    ///< 线程退出后释放的内存块直接归还系统
+
+    ~tagSizeClassFreeList()
+    {
+        for (std::size_t i = 0; i < SIZE_CLASS_NUM; ++i)
+        {
+            while (nullptr != astFreeList[i].pHead)
+            {
+                tagFreeNode* pNode = astFreeList[i].pHead;
+                astFreeList[i].pHead = pNode->pNext;
+                ::operator delete(pNode);
+            }
+            astFreeList[i].uiFreeNum = 0;
+        }
+        bDestroyed = true;
+    }
+};
+
+static thread_local tagSizeClassFreeList s_stSizeClassFreeList;
+
+void* ActorBlockPool::Allocate(std::size_t uiSize)
+{
+    if (uiSize > MAX_BLOCK_SIZE)
+    {
+        return(::operator new(uiSize));
+    }
+    std::size_t uiClass = (uiSize > 0) ? (uiSize - 1) / SIZE_CLASS_ALIGN : 0;
+    tagFreeList& stFreeList = s_stSizeClassFreeList.astFreeList[uiClass];
+    if (nullptr != stFreeList.pHead)
+    {
+        tagFreeNode* pNode = stFreeList.pHead;
+        stFreeList.pHead = pNode->pNext;
+        --stFreeList.uiFreeNum;
+        return(pNode);
+    }
+    return(::operator new((uiClass + 1) * SIZE_CLASS_ALIGN));
+}
+
+void ActorBlockPool::Deallocate(void* pBlock, std::size_t uiSize)
+{
+    if (nullptr == pBlock)
+    {
+        return;
+    }
+    if (uiSize > MAX_BLOCK_SIZE || s_stSizeClassFreeList.bDestroyed)
+    {
+        ::operator delete(pBlock);
+        return;
+    }
+    std::size_t uiClass = (uiSize > 0) ? (uiSize - 1) / SIZE_CLASS_ALIGN : 0;
+    tagFreeList& stFreeList = s_stSizeClassFreeList.astFreeList[uiClass];
+    if (stFreeList.uiFreeNum >= MAX_FREE_NUM)
+    {
+        ::operator delete(pBlock);
+        return;
+    }
+    tagFreeNode* pNode = static_cast<tagFreeNode*>(pBlock);
+    pNode->pNext = stFreeList.pHead;
+    stFreeList.pHead = pNode;
+    ++stFreeList.uiFreeNum;
+}
+
+} /* namespace neb */
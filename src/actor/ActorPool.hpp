@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     ActorPool.hpp
+ * @brief    Actor内存池
+ * @author   Bwar
+ * @date:    2026年10月18日
+ * @note     每个Worker线程按内存块大小分级维护空闲链表，Step、Session等频繁创建销毁的
+ *           Actor及其shared_ptr控制块从空闲链表分配，释放时归还空闲链表，避免每次
+ *           请求都经过malloc。内存块均由::operator new()分配，即使未归还内存池而是
+ *           直接delete也是安全的。
+ *           空闲链表（线程局部变量）定义在libnebula中而非各业务so中，业务so里的模板
+ *           代码不含有析构函数的线程局部变量，不会因__cxa_thread_atexit()而无法卸载。
+ * Modify history:
+ ******************************************************************************/
+#ifndef SRC_ACTOR_ACTORPOOL_HPP_
+#define SRC_ACTOR_ACTORPOOL_HPP_
+
+#include <cstddef>
+#include <new>
+
+namespace neb
+{
+
+/**
+ * @brief 按大小分级的内存块池
+ * @note 大小按SIZE_CLASS_ALIGN向上取整分级，大于MAX_BLOCK_SIZE的内存块不缓存。
+ */
+class ActorBlockPool
+{
+public:
+    static const std::size_t SIZE_CLASS_ALIGN = 16;
+    static const std::size_t MAX_BLOCK_SIZE = 1024;         ///< 超过此大小的内存块直接由系统分配和释放
+    static const unsigned int MAX_FREE_NUM = 1024;          ///< 每线程每级最多缓存的空闲内存块数量
+
+    static void* Allocate(std::size_t uiSize);
+    static void Deallocate(void* pBlock, std::size_t uiSize);
+};
+
+template<typename T>
+class ActorPool
+{
+public:
+    static void* Allocate()
+    {
+        return(ActorBlockPool::Allocate(sizeof(T)));
+    }
+
+    static void Deallocate(void* pBlock)
+    {
+        ActorBlockPool::Deallocate(pBlock, sizeof(T));
+    }
+};
+
+/**
+ * @brief shared_ptr控制块分配器
+ * @note 用于std::shared_ptr<Actor>(pActor, deleter, ActorPoolAllocator<Actor>())，
+ * 控制块与Actor一样从所在线程的内存池分配。
+ */
+template<typename T>
+class ActorPoolAllocator
+{
+public:
+    typedef T value_type;
+
+    ActorPoolAllocator() noexcept
+    {
+    }
+
+    template<typename U>
+    ActorPoolAllocator(const ActorPoolAllocator<U>&) noexcept
+    {
+    }
+
+    T* allocate(std::size_t uiNum)
+    {
+        if (1 == uiNum)
+        {
+            return(static_cast<T*>(ActorPool<T>::Allocate()));
+        }
+        return(static_cast<T*>(::operator new(uiNum * sizeof(T))));
+    }
+
+    void deallocate(T* pBlock, std::size_t uiNum) noexcept
+    {
+        if (1 == uiNum)
+        {
+            ActorPool<T>::Deallocate(pBlock);
+            return;
+        }
+        ::operator delete(pBlock);
+    }
+};
+
+template<typename T, typename U>
+inline bool operator==(const ActorPoolAllocator<T>&, const ActorPoolAllocator<U>&) noexcept
+{
+    return(true);
+}
+
+template<typename T, typename U>
+inline bool operator!=(const ActorPoolAllocator<T>&, const ActorPoolAllocator<U>&) noexcept
+{
+    return(false);
+}
+
+} /* namespace neb */
+
+#endif /* SRC_ACTOR_ACTORPOOL_HPP_ */
@@ -12,6 +12,10 @@
 #include "Actor.hpp"
 #include "ios/Dispatcher.hpp"
 #include "codec/CodecHttp.hpp"
+#include "codec/grpc/GrpcMessage.hpp"
+#include "codec/http2/H2Comm.hpp"
+#include "actor/context/Context.hpp"
+#include "actor/cmd/Module.hpp"
 //#include "actor/session/Session.hpp"
 //#include "actor/step/Step.hpp"
 //#include "labor/Worker.hpp"
@@ -40,6 +44,13 @@ bool ActorSender::SendTo(Actor* pActor, std::shared_ptr<SocketChannel> pChannel,
 
 bool ActorSender::SendTo(Actor* pActor, std::shared_ptr<SocketChannel> pChannel, const HttpMsg& oHttpMsg)
 {
+    if (CODEC_HTTP == pChannel->GetCodecType())
+    {
+        CodecHttp::SetSendingTraceId(&pActor->m_strTraceId);    // 编码时直接写入http头
+        bool bResult = pActor->m_pLabor->GetDispatcher()->SendTo(pChannel, oHttpMsg, 0);
+        CodecHttp::SetSendingTraceId(nullptr);
+        return(bResult);
+    }
     (const_cast<HttpMsg&>(oHttpMsg)).mutable_headers()->insert({"x-trace-id", pActor->GetTraceId()});
     return(pActor->m_pLabor->GetDispatcher()->SendTo(pChannel, oHttpMsg, 0));
 }
@@ -68,16 +79,16 @@ bool ActorSender::SendTo(Actor* pActor, const std::string& strHost, int iPort, c
     {
         (const_cast<HttpMsg&>(oHttpMsg)).mutable_headers()->insert({"x-trace-id", pActor->GetTraceId()});
     }
-    if (oHttpMsg.http_major() >= 2)
-    {
-        bPipeline = true;
-    }
     std::string strSchema = oHttpMsg.url().substr(0, oHttpMsg.url().find_first_of(":"));
     std::transform(strSchema.begin(), strSchema.end(), strSchema.begin(), [](unsigned char c)->unsigned char {return std::tolower(c);});
     if (strSchema == std::string("https"))
     {
         bWithSsl = true;
     }
+    if (oHttpMsg.http_major() >= 2)
+    {
+        return(pActor->m_pLabor->GetDispatcher()->SendMultiplex(strHost, iPort, bWithSsl, oHttpMsg, pActor->GetSequence()));
+    }
     return(pActor->m_pLabor->GetDispatcher()->SendTo(strHost, iPort, CODEC_HTTP, bWithSsl, bPipeline, oHttpMsg, pActor->GetSequence()));
 }
 
@@ -155,47 +166,14 @@ bool ActorSender::SendTo(Actor* pActor, std::shared_ptr<SocketChannel> pChannel,
     oHttpMsg.set_status_code(200);
     oHttpMsg.set_stream_id(uiStreamId);
     oHttpMsg.mutable_headers()->insert({"content-type", "application/grpc"});
+    oHttpMsg.mutable_headers()->insert({"grpc-accept-encoding", GrpcMessage::ACCEPT_ENCODING});
     oHttpMsg.add_adding_never_index_headers(":status");
     oHttpMsg.add_adding_never_index_headers("content-type");
     if (eStatus == GRPC_OK)
     {
-        uint8 ucCompressedFlag = 0;
-        uint32 uiMessageLength = 0;
-        std::string strResponseData;
-        switch (eCompression)
+        if (GrpcMessage::Encode(strGrpcResponse, eCompression, *oHttpMsg.mutable_body()))
         {
-            case COMPRESS_GZIP:
-                if (CodecUtil::Gzip(strGrpcResponse, strResponseData))
-                {
-                    oHttpMsg.mutable_headers()->insert({"grpc-encoding", "gzip"});
-                    ucCompressedFlag = 1;
-                    uiMessageLength = strResponseData.size();
-                    oHttpMsg.mutable_body()->append(1, ucCompressedFlag);
-                    oHttpMsg.mutable_body()->append(1, ((uiMessageLength >> 24) & 0xFF));
-                    oHttpMsg.mutable_body()->append(1, ((uiMessageLength >> 16) & 0xFF));
-                    oHttpMsg.mutable_body()->append(1, ((uiMessageLength >> 8) & 0xFF));
-                    oHttpMsg.mutable_body()->append(1, (uiMessageLength & 0xFF));
-                    oHttpMsg.mutable_body()->append(strResponseData);
-                }
-                else
-                {
-                    uiMessageLength = strGrpcResponse.size();
-                    oHttpMsg.mutable_body()->append(1, ucCompressedFlag);
-                    oHttpMsg.mutable_body()->append(1, ((uiMessageLength >> 24) & 0xFF));
-                    oHttpMsg.mutable_body()->append(1, ((uiMessageLength >> 16) & 0xFF));
-                    oHttpMsg.mutable_body()->append(1, ((uiMessageLength >> 8) & 0xFF));
-                    oHttpMsg.mutable_body()->append(1, (uiMessageLength & 0xFF));
-                    oHttpMsg.mutable_body()->append(strGrpcResponse);
-                }
-                break;
-            default:
-                uiMessageLength = strGrpcResponse.size();
-                oHttpMsg.mutable_body()->append(1, ucCompressedFlag);
-                oHttpMsg.mutable_body()->append(1, ((uiMessageLength >> 24) & 0xFF));
-                oHttpMsg.mutable_body()->append(1, ((uiMessageLength >> 16) & 0xFF));
-                oHttpMsg.mutable_body()->append(1, ((uiMessageLength >> 8) & 0xFF));
-                oHttpMsg.mutable_body()->append(1, (uiMessageLength & 0xFF));
-                oHttpMsg.mutable_body()->append(strGrpcResponse);
+            oHttpMsg.mutable_headers()->insert({"grpc-encoding", GrpcMessage::GetEncoding(eCompression)});
         }
     }
     auto pHeader = oHttpMsg.add_trailer_header();
@@ -207,7 +185,90 @@ bool ActorSender::SendTo(Actor* pActor, std::shared_ptr<SocketChannel> pChannel,
     return(SendTo(pActor, pChannel, oHttpMsg));
 }
 
-bool ActorSender::SendTo(Actor* pActor, const std::string& strUrl, const std::string& strGrpcRequest, E_COMPRESSION eCompression)
+bool ActorSender::SendStreamMessage(Actor* pActor, std::shared_ptr<SocketChannel> pChannel,
+            uint32 uiStreamId, const std::string& strGrpcMessage, bool bWithHeaders,
+            E_COMPRESSION eCompression)
+{
+    if (!bWithHeaders && pChannel->GetWaittingBytes(uiStreamId) >= H2_STREAM_MAX_WAITTING_BYTES)
+    {
+        WatchStreamWritable(pActor, pChannel, uiStreamId);
+        return(false);
+    }
+    HttpMsg oHttpMsg;
+    oHttpMsg.set_type(HTTP_RESPONSE);
+    oHttpMsg.set_http_major(2);
+    oHttpMsg.set_http_minor(0);
+    oHttpMsg.set_stream_id(uiStreamId);
+    oHttpMsg.set_chunk_notice(true);
+    oHttpMsg.set_is_decoding(true);
+    GrpcMessage::Encode(strGrpcMessage, eCompression, *oHttpMsg.mutable_body());
+    bool bResult = false;
+    if (bWithHeaders)
+    {
+        oHttpMsg.set_encoding(0);
+        oHttpMsg.set_status_code(200);
+        oHttpMsg.mutable_headers()->insert({"content-type", "application/grpc"});
+        oHttpMsg.mutable_headers()->insert({"grpc-accept-encoding", GrpcMessage::ACCEPT_ENCODING});
+        if (COMPRESS_NA != eCompression)
+        {
+            // 短消息不压缩（Compressed-Flag为0），grpc-encoding声明的是整个stream的压缩算法
+            oHttpMsg.mutable_headers()->insert({"grpc-encoding", GrpcMessage::GetEncoding(eCompression)});
+        }
+        oHttpMsg.add_adding_never_index_headers(":status");
+        oHttpMsg.add_adding_never_index_headers("content-type");
+        bResult = SendTo(pActor, pChannel, oHttpMsg);
+    }
+    else
+    {
+        oHttpMsg.set_encoding(1);
+        bResult = pActor->m_pLabor->GetDispatcher()->SendTo(pChannel, oHttpMsg, 0);
+    }
+    if (bResult && pChannel->GetWaittingBytes(uiStreamId) > 0)
+    {
+        WatchStreamWritable(pActor, pChannel, uiStreamId);
+    }
+    return(bResult);
+}
+
+void ActorSender::WatchStreamWritable(Actor* pActor, std::shared_ptr<SocketChannel> pChannel, uint32 uiStreamId)
+{
+    if (Actor::ACT_MODULE == pActor->GetActorType())
+    {
+        pActor->m_pLabor->GetActorBuilder()->WatchStreamWritable(pChannel, uiStreamId, (Module*)pActor);
+    }
+}
+
+bool ActorSender::SendStreamStatus(Actor* pActor, std::shared_ptr<SocketChannel> pChannel,
+            uint32 uiStreamId, E_GRPC_STATUS_CODE eStatus, const std::string& strStatusMessage,
+            bool bTrailersOnly)
+{
+    HttpMsg oHttpMsg;
+    oHttpMsg.set_type(HTTP_RESPONSE);
+    oHttpMsg.set_http_major(2);
+    oHttpMsg.set_http_minor(0);
+    oHttpMsg.set_stream_id(uiStreamId);
+    oHttpMsg.set_chunk_notice(true);
+    oHttpMsg.set_is_decoding(false);
+    auto pHeader = oHttpMsg.add_trailer_header();
+    pHeader->set_name("grpc-status");
+    pHeader->set_value(std::to_string(eStatus));
+    pHeader = oHttpMsg.add_trailer_header();
+    pHeader->set_name("grpc-message");
+    pHeader->set_value(strStatusMessage);
+    if (bTrailersOnly)
+    {
+        oHttpMsg.set_encoding(0);
+        oHttpMsg.set_status_code(200);
+        oHttpMsg.mutable_headers()->insert({"content-type", "application/grpc"});
+        oHttpMsg.mutable_headers()->insert({"grpc-accept-encoding", GrpcMessage::ACCEPT_ENCODING});
+        return(SendTo(pActor, pChannel, oHttpMsg));
+    }
+    oHttpMsg.set_encoding(1);
+    return(pActor->m_pLabor->GetDispatcher()->SendTo(pChannel, oHttpMsg, 0));
+}
+
+bool ActorSender::SendTo(Actor* pActor, const std::string& strUrl, const std::string& strGrpcRequest,
+        E_COMPRESSION eCompression, bool bStreamResponse)
 {
     int iPort = 0;
     std::string strHost;
@@ -219,7 +280,23 @@ bool ActorSender::SendTo(Actor* pActor, const std::string& strUrl, const std::st
     oHttpMsg.set_type(HTTP_REQUEST);
     oHttpMsg.set_method(HTTP_POST);
     oHttpMsg.set_url(strUrl);
+    oHttpMsg.set_chunk_notice(bStreamResponse);     // 流式响应逐条消息回调GrpcStep
     oHttpMsg.mutable_headers()->insert({"content-type", "application/grpc"});
+    oHttpMsg.mutable_headers()->insert({"grpc-accept-encoding", GrpcMessage::ACCEPT_ENCODING});
+    std::shared_ptr<Context> pContext = pActor->GetContext();
+    if (nullptr != pContext)
+    {
+        // 上游请求已取消或已超过截止时间，不再发起下游调用；未超时的以剩余时间作为grpc-timeout
+        ev_tstamp dRemaining = pContext->GetRemainingTime();
+        if (pContext->IsCancelled() || 0.0 == dRemaining)
+        {
+            return(false);
+        }
+        if (gc_dNoTimeout != dRemaining)
+        {
+            oHttpMsg.mutable_headers()->insert({"grpc-timeout", GrpcMessage::FormatTimeout(dRemaining)});
+        }
+    }
     oHttpMsg.add_adding_never_index_headers("content-type");
     if(0 == http_parser_parse_url(strUrl.c_str(), strUrl.length(), 0, &stUrl))
     {
@@ -247,43 +324,9 @@ bool ActorSender::SendTo(Actor* pActor, const std::string& strUrl, const std::st
             }
         }
 
-        uint8 ucCompressedFlag = 0;
-        uint32 uiMessageLength = 0;
-        std::string strRequestData;
-        switch (eCompression)
+        if (GrpcMessage::Encode(strGrpcRequest, eCompression, *oHttpMsg.mutable_body()))
         {
-            case COMPRESS_GZIP:
-                if (CodecUtil::Gzip(strGrpcRequest, strRequestData))
-                {
-                    oHttpMsg.mutable_headers()->insert({"grpc-encoding", "gzip"});
-                    ucCompressedFlag = 1;
-                    uiMessageLength = strRequestData.size();
-                    oHttpMsg.mutable_body()->append(1, ucCompressedFlag);
-                    oHttpMsg.mutable_body()->append(1, ((uiMessageLength >> 24) & 0xFF));
-                    oHttpMsg.mutable_body()->append(1, ((uiMessageLength >> 16) & 0xFF));
-                    oHttpMsg.mutable_body()->append(1, ((uiMessageLength >> 8) & 0xFF));
-                    oHttpMsg.mutable_body()->append(1, (uiMessageLength & 0xFF));
-                    oHttpMsg.mutable_body()->append(strRequestData);
-                }
-                else
-                {
-                    uiMessageLength = strGrpcRequest.size();
-                    oHttpMsg.mutable_body()->append(1, ucCompressedFlag);
-                    oHttpMsg.mutable_body()->append(1, ((uiMessageLength >> 24) & 0xFF));
-                    oHttpMsg.mutable_body()->append(1, ((uiMessageLength >> 16) & 0xFF));
-                    oHttpMsg.mutable_body()->append(1, ((uiMessageLength >> 8) & 0xFF));
-                    oHttpMsg.mutable_body()->append(1, (uiMessageLength & 0xFF));
-                    oHttpMsg.mutable_body()->append(strGrpcRequest);
-                }
-                break;
-            default:
-                uiMessageLength = strGrpcRequest.size();
-                oHttpMsg.mutable_body()->append(1, ucCompressedFlag);
-                oHttpMsg.mutable_body()->append(1, ((uiMessageLength >> 24) & 0xFF));
-                oHttpMsg.mutable_body()->append(1, ((uiMessageLength >> 16) & 0xFF));
-                oHttpMsg.mutable_body()->append(1, ((uiMessageLength >> 8) & 0xFF));
-                oHttpMsg.mutable_body()->append(1, (uiMessageLength & 0xFF));
-                oHttpMsg.mutable_body()->append(strGrpcRequest);
+            oHttpMsg.mutable_headers()->insert({"grpc-encoding", GrpcMessage::GetEncoding(eCompression)});
         }
         return(SendTo(pActor, strHost, iPort, oHttpMsg));
     }
@@ -64,11 +64,51 @@ public:
     static bool SendTo(Actor* pActor, const std::string& strIdentify, const char* pRawData, uint32 uiRawDataSize, bool bWithSsl = false, bool bPipeline = false, uint32 uiStepSeq = 0);
 
     // send grpc message
+    /**
+     * @brief 发送gRPC响应
+     * @param eCompression 压缩算法（gzip或deflate），须为请求方grpc-accept-encoding所支持的，
+     * GrpcModule中取GetResponseCompression()；短于GrpcMessage::COMPRESS_MIN_LENGTH的消息不压缩
+     */
     static bool SendTo(Actor* pActor, std::shared_ptr<SocketChannel> pChannel,
             uint32 uiStreamId, const std::string& strGrpcResponse,
             E_GRPC_STATUS_CODE eStatus, const std::string& strStatusMessage,
             E_COMPRESSION eCompression = COMPRESS_NA);
-    static bool SendTo(Actor* pActor, const std::string& strUrl, const std::string& strGrpcRequest, E_COMPRESSION eCompression = COMPRESS_NA);
+
+    /**
+     * @brief 发送gRPC请求
+     * @param bStreamResponse 响应是否为流式（server streaming），为true时每收到一条响应消息
+     * 回调一次GrpcStep::OnStreamMessage()，stream结束时回调GrpcStep::Callback()
+     */
+    static bool SendTo(Actor* pActor, const std::string& strUrl, const std::string& strGrpcRequest,
+            E_COMPRESSION eCompression = COMPRESS_NA, bool bStreamResponse = false);
+
+    /**
+     * @brief 发送gRPC流式响应（server streaming、bidi streaming）的一条消息
+     * @note 同一stream的第一条消息bWithHeaders须为true，同时发送响应头，之后stream保持打开，
+     * 全部消息发送完毕后调用SendStreamStatus()以trailer结束stream。超出http2流控窗口的数据
+     * 缓存在stream中，收到对端WINDOW_UPDATE后按序发送，业务可根据
+     * pChannel->GetSendWindow(uiStreamId)控制生产速度。缓存的数据达到
+     * H2_STREAM_MAX_WAITTING_BYTES时拒绝发送并返回false；由Module发送时，缓存的数据全部
+     * 发出后回调Module::OnStreamWritable()。
+     * @param eCompression 压缩算法，须与第一条消息一致
+     */
+    static bool SendStreamMessage(Actor* pActor, std::shared_ptr<SocketChannel> pChannel,
+            uint32 uiStreamId, const std::string& strGrpcMessage, bool bWithHeaders,
+            E_COMPRESSION eCompression = COMPRESS_NA);
+
+    /**
+     * @brief 以trailer（grpc-status、grpc-message）结束gRPC流式响应
+     * @param bTrailersOnly 未发送过任何响应消息时为true，响应头与trailer在同一个HEADERS帧发送
+     */
+    static bool SendStreamStatus(Actor* pActor, std::shared_ptr<SocketChannel> pChannel,
+            uint32 uiStreamId, E_GRPC_STATUS_CODE eStatus, const std::string& strStatusMessage,
+            bool bTrailersOnly = false);
+
+private:
+    /**
+     * @brief pActor为Module时登记stream的可写通知
+     */
+    static void WatchStreamWritable(Actor* pActor, std::shared_ptr<SocketChannel> pChannel, uint32 uiStreamId);
 };
 
 } /* namespace neb */
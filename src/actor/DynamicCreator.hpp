@@ -13,6 +13,7 @@
 #include <typeinfo>
 #include <cxxabi.h>
 #include "ActorFactory.hpp"
+#include "ActorPool.hpp"
 
 namespace neb
 {
@@ -66,21 +67,45 @@ public:
     }
     virtual ~DynamicCreator(){};
 
+    /**
+     * @brief 创建对象
+     * @note 从当前线程的ActorPool<T>取内存块，placement new构造，对象释放时由Recycle()
+     * 析构并归还内存池。
+     */
     static T* CreateObject(std::shared_ptr<NetLogger> pLogger, Targs&&... args)
     {
         T* pT = nullptr;
+        void* pBlock = nullptr;
         try
         {
-            pT = new T(std::forward<Targs>(args)...);
+            pBlock = ActorPool<T>::Allocate();
+            pT = ::new(pBlock) T(std::forward<Targs>(args)...);
         }
         catch(std::bad_alloc& e)
         {
+            if (nullptr != pBlock)
+            {
+                ActorPool<T>::Deallocate(pBlock);
+            }
             pLogger->WriteLog(Logger::ERROR, __FILE__, __LINE__, __FUNCTION__, "%s", e.what());
             return(nullptr);
         }
+        catch(...)
+        {
+            ActorPool<T>::Deallocate(pBlock);
+            throw;
+        }
+        pT->m_pRecycle = Recycle;
         return(pT);
     }
 
+    static void Recycle(Actor* pActor)
+    {
+        T* pT = static_cast<T*>(pActor);
+        pT->~T();
+        ActorPool<T>::Deallocate(pT);
+    }
+
 private:
     static Register s_oRegister;
 };
@@ -96,7 +96,7 @@ E_CMD_STATUS Chain::Next()
             // pSharedModel->SetContext(GetContext()); it had been set in MakeSharedActor().
             if (Actor::ACT_OPERATOR == pSharedActor->GetActorType())
             {
-                pSharedModel = std::dynamic_pointer_cast<Operator>(pSharedActor);
+                pSharedModel = std::static_pointer_cast<Operator>(pSharedActor);
                 eResult = pSharedModel->Submit();
                 pSharedModel->SetContext(nullptr);
                 pSharedModel->SetTraceId("");
@@ -110,7 +110,7 @@ E_CMD_STATUS Chain::Next()
                     || Actor::ACT_REDIS_STEP == pSharedActor->GetActorType())
             {
                 bStepInBlock = true;
-                std::shared_ptr<Step> pSharedStep = std::dynamic_pointer_cast<Step>(pSharedActor);
+                std::shared_ptr<Step> pSharedStep = std::static_pointer_cast<Step>(pSharedActor);
                 pSharedStep->SetChainId(GetSequence());
                 eResult = pSharedStep->Emit();
                 if (CMD_STATUS_FAULT == eResult)
@@ -8,7 +8,11 @@
  * Modify history:
  ******************************************************************************/
 #include "GrpcModule.hpp"
+#include <algorithm>
 #include "util/StringConverter.hpp"
+#include "codec/grpc/GrpcMessage.hpp"
+#include "actor/context/Context.hpp"
+#include "channel/SocketChannel.hpp"
 
 namespace neb
 {
@@ -25,47 +29,227 @@ GrpcModule::~GrpcModule()
 bool GrpcModule::AnyMessage(
         std::shared_ptr<SocketChannel> pChannel, const HttpMsg& oHttpMsg)
 {
-    uint8 ucCompressedFlag = 0;
-    uint32 uiMessageLength = 0;
+    size_t uiOffset = 0;
     std::string strMessage;
-    ucCompressedFlag = oHttpMsg.body()[0];
-    uiMessageLength |= (oHttpMsg.body()[4] & 0xFF);
-    uiMessageLength |= ((oHttpMsg.body()[3] << 8) & 0xFF);
-    uiMessageLength |= ((oHttpMsg.body()[2] << 16) & 0xFF);
-    uiMessageLength |= ((oHttpMsg.body()[1] << 24) & 0xFF);
-    if (ucCompressedFlag)
+    std::string strEncoding;
+    auto iter = oHttpMsg.headers().find("grpc-encoding");
+    if (iter != oHttpMsg.headers().end())
     {
-        auto iter = oHttpMsg.headers().find("grpc-encoding");
-        if (iter == oHttpMsg.headers().end())
+        strEncoding = iter->second;
+    }
+    m_eResponseCompression = NegotiateCompression(oHttpMsg);
+    E_CODEC_STATUS eCodecStatus = GrpcMessage::Decode(oHttpMsg.body(), uiOffset, strEncoding, strMessage);
+    switch (eCodecStatus)
+    {
+        case CODEC_STATUS_OK:
         {
-            LOG4_ERROR("Compressed-Flag had been set, but no \"grpc-encoding\" found in header.");
+            SetContext(MakeCallContext(pChannel, oHttpMsg));
+            bool bResult = AnyMessage(pChannel, oHttpMsg.stream_id(), strMessage);
+            SetContext(nullptr);
+            return(bResult);
+        }
+        case CODEC_STATUS_INVALID:
+            LOG4_ERROR("compression algorithm \"%s\" not support.", strEncoding.c_str());
+            ActorSender::SendTo(this, pChannel, oHttpMsg.stream_id(),
+                    "", GRPC_UNIMPLEMENTED, "compression algorithm not support.");
+            return(false);
+        case CODEC_STATUS_ERR:
+            LOG4_ERROR("grpc message larger than %u, body length %u.",
+                    GrpcMessage::MAX_MESSAGE_LENGTH, (uint32)oHttpMsg.body().size());
             ActorSender::SendTo(this, pChannel, oHttpMsg.stream_id(),
-                    "", GRPC_UNAVAILABLE, "Compressed-Flag had been set, but no \"grpc-encoding\" found in header.");
+                    "", GRPC_RESOURCE_EXHAUSTED, "grpc message too large.");
+            return(false);
+        default:
+            LOG4_ERROR("invalid grpc message, body length %u.", (uint32)oHttpMsg.body().size());
+            ActorSender::SendTo(this, pChannel, oHttpMsg.stream_id(),
+                    "", GRPC_INTERNAL, "invalid grpc message.");
+            return(false);
+    }
+}
+
+bool GrpcModule::OnHeaders(
+        std::shared_ptr<SocketChannel> pChannel, const HttpMsg& oHttpMsg)
+{
+    tagGrpcStream& stStream = m_mapStream[StreamKey(pChannel, oHttpMsg.stream_id())];
+    stStream.eResponseCompression = NegotiateCompression(oHttpMsg);
+    stStream.strBuffer.clear();
+    stStream.strEncoding.clear();
+    // 首次解码期间持有Context，之后由回调中创建的Step持有
+    std::shared_ptr<Context> pContext = MakeCallContext(pChannel, oHttpMsg);
+    stStream.pContext = pContext;
+    stStream.dDeadline = (nullptr == pContext) ? 0.0 : pContext->GetDeadline();
+    auto iter = oHttpMsg.headers().find("grpc-encoding");
+    if (iter != oHttpMsg.headers().end())
+    {
+        stStream.strEncoding = iter->second;
+    }
+    return(DecodeStream(pChannel, oHttpMsg));
+}
+
+bool GrpcModule::OnBodyChunk(
+        std::shared_ptr<SocketChannel> pChannel, const HttpMsg& oHttpMsg)
+{
+    return(DecodeStream(pChannel, oHttpMsg));
+}
+
+bool GrpcModule::OnComplete(
+        std::shared_ptr<SocketChannel> pChannel, const HttpMsg& oHttpMsg)
+{
+    if (0 == oHttpMsg.encoding())
+    {
+        // HEADERS帧带END_STREAM，未经OnHeaders()
+        if (!OnHeaders(pChannel, oHttpMsg))
+        {
+            m_mapStream.erase(StreamKey(pChannel, oHttpMsg.stream_id()));
             return(false);
         }
-        else
+    }
+    else if (!DecodeStream(pChannel, oHttpMsg))
+    {
+        return(false);
+    }
+    auto iter = m_mapStream.find(StreamKey(pChannel, oHttpMsg.stream_id()));
+    if (iter == m_mapStream.end())
+    {
+        return(false);
+    }
+    bool bComplete = iter->second.strBuffer.empty();
+    m_eResponseCompression = iter->second.eResponseCompression;
+    std::shared_ptr<Context> pContext = GetCallContext(pChannel, oHttpMsg.stream_id(), iter->second);
+    m_mapStream.erase(iter);
+    if (!bComplete)
+    {
+        LOG4_ERROR("stream %u ended with an incomplete grpc message.", oHttpMsg.stream_id());
+        ActorSender::SendStreamStatus(this, pChannel, oHttpMsg.stream_id(),
+                GRPC_INTERNAL, "incomplete grpc message.", true);
+        return(false);
+    }
+    SetContext(pContext);
+    bool bResult = OnStreamEnd(pChannel, oHttpMsg.stream_id());
+    SetContext(nullptr);
+    return(bResult);
+}
+
+void GrpcModule::OnStreamReset(std::shared_ptr<SocketChannel> pChannel, uint32 uiStreamId)
+{
+    m_mapStream.erase(StreamKey(pChannel, uiStreamId));
+}
+
+void GrpcModule::OnChannelClosed(std::shared_ptr<SocketChannel> pChannel)
+{
+    uint64 ullChannelKey = (uint64)pChannel->GetSequence() << 32;
+    m_mapStream.erase(m_mapStream.lower_bound(ullChannelKey),
+            m_mapStream.lower_bound(ullChannelKey + 0x100000000ULL));
+}
+
+bool GrpcModule::DecodeStream(std::shared_ptr<SocketChannel> pChannel, const HttpMsg& oHttpMsg)
+{
+    uint64 ullKey = StreamKey(pChannel, oHttpMsg.stream_id());
+    auto iter = m_mapStream.find(ullKey);
+    if (iter == m_mapStream.end())
+    {
+        LOG4_ERROR("no grpc stream context for stream %u.", oHttpMsg.stream_id());
+        return(false);
+    }
+    m_eResponseCompression = iter->second.eResponseCompression;
+    // 取出待解码数据，回调中可能重置stream从而删除其上下文
+    std::string strBuffer;
+    strBuffer.swap(iter->second.strBuffer);
+    strBuffer.append(oHttpMsg.body());
+    std::string strEncoding = iter->second.strEncoding;
+    size_t uiOffset = 0;
+    std::string strMessage;
+    E_CODEC_STATUS eCodecStatus = CODEC_STATUS_OK;
+    while (CODEC_STATUS_OK == eCodecStatus)
+    {
+        eCodecStatus = GrpcMessage::Decode(strBuffer, uiOffset, strEncoding, strMessage);
+        if (CODEC_STATUS_OK == eCodecStatus)
         {
-            if (iter->second == "gzip")
+            SetContext(GetCallContext(pChannel, oHttpMsg.stream_id(), iter->second));
+            bool bResult = OnStreamMessage(pChannel, oHttpMsg.stream_id(), strMessage);
+            SetContext(nullptr);
+            iter = m_mapStream.find(ullKey);
+            if (iter == m_mapStream.end())
             {
-                if (!CodecUtil::Gunzip(oHttpMsg.body().substr(5, uiMessageLength), strMessage))
-                {
-                    LOG4_ERROR("failed to gunzip message.");
-                    return(false);
-                }
+                return(false);
             }
-            else
+            if (!bResult)
             {
-                LOG4_ERROR("compression algorithm not support.");
+                m_mapStream.erase(iter);
                 return(false);
             }
         }
     }
-    else
+    if (CODEC_STATUS_PAUSE != eCodecStatus)
     {
-        strMessage.assign(oHttpMsg.body(), 5, uiMessageLength);
+        LOG4_ERROR("failed to decode grpc message of stream %u, codec status %d.",
+                oHttpMsg.stream_id(), eCodecStatus);
+        m_mapStream.erase(iter);
+        if (CODEC_STATUS_ERR == eCodecStatus)
+        {
+            ActorSender::SendStreamStatus(this, pChannel, oHttpMsg.stream_id(),
+                    GRPC_RESOURCE_EXHAUSTED, "grpc message too large.", true);
+        }
+        else
+        {
+            ActorSender::SendStreamStatus(this, pChannel, oHttpMsg.stream_id(),
+                    (CODEC_STATUS_INVALID == eCodecStatus) ? GRPC_UNIMPLEMENTED : GRPC_INTERNAL,
+                    "invalid grpc message.", true);
+        }
+        return(false);
     }
-    return(AnyMessage(pChannel, oHttpMsg.stream_id(), strMessage));
+    strBuffer.erase(0, uiOffset);
+    iter->second.strBuffer.swap(strBuffer);
+    return(true);
 }
 
-} /* namespace neb */
+uint64 GrpcModule::StreamKey(std::shared_ptr<SocketChannel> pChannel, uint32 uiStreamId)
+{
+    return(((uint64)pChannel->GetSequence() << 32) | uiStreamId);
+}
 
+E_COMPRESSION GrpcModule::NegotiateCompression(const HttpMsg& oHttpMsg) const
+{
+    auto iter = oHttpMsg.headers().find("grpc-accept-encoding");
+    if (iter == oHttpMsg.headers().end())
+    {
+        return(COMPRESS_NA);
+    }
+    return(GrpcMessage::Negotiate(iter->second, PreferredCompression()));
+}
+
+std::shared_ptr<Context> GrpcModule::MakeCallContext(std::shared_ptr<SocketChannel> pChannel, const HttpMsg& oHttpMsg)
+{
+    ev_tstamp dTimeout = gc_dNoTimeout;
+    auto iter = oHttpMsg.headers().find("grpc-timeout");
+    if (iter != oHttpMsg.headers().end())
+    {
+        dTimeout = GrpcMessage::ParseTimeout(iter->second);
+        if (dTimeout < 0.0)
+        {
+            LOG4_WARNING("invalid grpc-timeout \"%s\" of stream %u, ignored.",
+                    iter->second.c_str(), oHttpMsg.stream_id());
+        }
+    }
+    return(MakeStreamContext(pChannel, oHttpMsg.stream_id(), dTimeout));
+}
+
+std::shared_ptr<Context> GrpcModule::GetCallContext(std::shared_ptr<SocketChannel> pChannel,
+        uint32 uiStreamId, tagGrpcStream& stStream)
+{
+    std::shared_ptr<Context> pContext = stStream.pContext.lock();
+    if (nullptr != pContext)
+    {
+        return(pContext);
+    }
+    ev_tstamp dTimeout = gc_dNoTimeout;
+    if (stStream.dDeadline > 0.0)
+    {
+        dTimeout = std::max(stStream.dDeadline - (ev_tstamp)GetNowTimeMs() / 1000.0, 0.001);
+    }
+    pContext = MakeStreamContext(pChannel, uiStreamId, dTimeout);
+    stStream.pContext = pContext;
+    return(pContext);
+}
+
+} /* namespace neb */
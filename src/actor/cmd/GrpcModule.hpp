@@ -10,6 +10,8 @@
 #ifndef SRC_ACTOR_CMD_GRPCMODULE_HPP_
 #define SRC_ACTOR_CMD_GRPCMODULE_HPP_
 
+#include <map>
+#include <memory>
 #include "Module.hpp"
 #include "codec/CodecUtil.hpp"
 #include "codec/grpc/Grpc.hpp"
@@ -17,6 +19,16 @@
 namespace neb
 {
 
+/**
+ * @brief gRPC服务
+ * @note 默认为unary调用，请求接收完毕后回调一次AnyMessage(pChannel, uiStreamId, strGrpcRequest)。
+ * WithChunkNotice()返回true时为流式调用（client streaming、bidi streaming）：每收到一条完整的
+ * 请求消息回调一次OnStreamMessage()，请求流结束时回调OnStreamEnd()；流式响应通过
+ * ActorSender::SendStreamMessage()和ActorSender::SendStreamStatus()发送，积压的响应数据达到上限时
+ * SendStreamMessage()返回false，积压的数据发出后回调OnStreamWritable()，可在此继续发送。
+ *     回调期间GetContext()为绑定本次调用的Context，其截止时间取自请求的grpc-timeout，
+ * 由回调中创建的Step继承；调用被客户端取消（RST_STREAM）时Context::IsCancelled()为true。
+ */
 class GrpcModule: public Module
 {
 public:
@@ -28,15 +40,114 @@ public:
         return(true);
     }
 
+    /**
+     * @brief 期望的响应压缩算法（gzip或deflate）
+     * @note 按请求方的grpc-accept-encoding协商后由GetResponseCompression()取得，默认不压缩
+     */
+    virtual E_COMPRESSION PreferredCompression() const
+    {
+        return(COMPRESS_NA);
+    }
+
     virtual bool AnyMessage(
             std::shared_ptr<SocketChannel> pChannel,
             const HttpMsg& oHttpMsg
             ) override final;
 
+    virtual bool OnHeaders(
+            std::shared_ptr<SocketChannel> pChannel,
+            const HttpMsg& oHttpMsg
+            ) override final;
+
+    virtual bool OnBodyChunk(
+            std::shared_ptr<SocketChannel> pChannel,
+            const HttpMsg& oHttpMsg
+            ) override final;
+
+    virtual bool OnComplete(
+            std::shared_ptr<SocketChannel> pChannel,
+            const HttpMsg& oHttpMsg
+            ) override final;
+
+    virtual void OnStreamReset(
+            std::shared_ptr<SocketChannel> pChannel,
+            uint32 uiStreamId
+            ) override final;
+
+    virtual void OnChannelClosed(
+            std::shared_ptr<SocketChannel> pChannel
+            ) override final;
+
     virtual bool AnyMessage(
             std::shared_ptr<SocketChannel> pChannel,
             uint32 uiStreamId,
             const std::string& strGrpcRequest) = 0;
+
+    /**
+     * @brief 流式调用：收到一条请求消息
+     * @note 默认按unary处理，回调AnyMessage(pChannel, uiStreamId, strGrpcRequest)
+     * @return 是否处理成功
+     */
+    virtual bool OnStreamMessage(
+            std::shared_ptr<SocketChannel> pChannel,
+            uint32 uiStreamId,
+            const std::string& strGrpcRequest)
+    {
+        return(AnyMessage(pChannel, uiStreamId, strGrpcRequest));
+    }
+
+    /**
+     * @brief 流式调用：请求流结束（客户端half-close）
+     * @note client streaming在此发送响应，bidi streaming在此调用SendStreamStatus()结束响应流
+     * @return 是否处理成功
+     */
+    virtual bool OnStreamEnd(
+            std::shared_ptr<SocketChannel> pChannel,
+            uint32 uiStreamId)
+    {
+        return(true);
+    }
+
+protected:
+    /**
+     * @brief 当前请求协商的响应压缩算法
+     * @note 在AnyMessage()、OnStreamMessage()、OnStreamEnd()中有效，作为ActorSender发送响应的
+     * eCompression参数；异步响应须在回调中取得并保存
+     */
+    E_COMPRESSION GetResponseCompression() const
+    {
+        return(m_eResponseCompression);
+    }
+
+private:
+    struct tagGrpcStream
+    {
+        E_COMPRESSION eResponseCompression = COMPRESS_NA;   ///< 协商的响应压缩算法
+        ev_tstamp dDeadline = 0.0;          ///< 本次调用的截止时间，0表示不限
+        std::string strEncoding;            ///< 请求的grpc-encoding
+        std::string strBuffer;              ///< 尚不足一条消息的请求数据
+        std::weak_ptr<Context> pContext;    ///< 绑定本次调用的Context，由回调中创建的Step持有
+    };
+
+    static uint64 StreamKey(std::shared_ptr<SocketChannel> pChannel, uint32 uiStreamId);
+
+    E_COMPRESSION NegotiateCompression(const HttpMsg& oHttpMsg) const;
+
+    /**
+     * @brief 创建绑定本次调用的Context，截止时间取自grpc-timeout
+     */
+    std::shared_ptr<Context> MakeCallContext(std::shared_ptr<SocketChannel> pChannel, const HttpMsg& oHttpMsg);
+
+    /**
+     * @brief 流式调用的Context，已释放（此前的回调未创建Step）则按原截止时间重新创建
+     */
+    std::shared_ptr<Context> GetCallContext(std::shared_ptr<SocketChannel> pChannel,
+            uint32 uiStreamId, tagGrpcStream& stStream);
+
+    bool DecodeStream(std::shared_ptr<SocketChannel> pChannel, const HttpMsg& oHttpMsg);
+
+    E_COMPRESSION m_eResponseCompression = COMPRESS_NA;
+    std::map<uint64, tagGrpcStream> m_mapStream;   ///< 请求未接收完毕的流式调用，key为channel seq << 32 | stream id
 };
 
 }
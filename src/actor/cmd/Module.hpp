@@ -11,8 +11,10 @@
 #define SRC_ACTOR_CMD_MODULE_HPP_
 
 #include "codec/CodecHttp.hpp"
+#include "codec/http2/CodecHttp2.hpp"
 #include "actor/Actor.hpp"
 #include "actor/DynamicCreator.hpp"
+#include "ModuleRouter.hpp"
 #include "pb/http.pb.h"
 
 namespace neb
@@ -30,7 +32,13 @@ public:
     }
     Module(const Module&) = delete;
     Module& operator=(const Module&) = delete;
-    virtual ~Module(){};
+    virtual ~Module()
+    {
+        for (auto uiHeaderBlockId : m_vecHeaderBlockId)
+        {
+            CodecHttp::ReleaseHeaderBlock(uiHeaderBlockId);
+        }
+    }
 
     /**
      * @brief 初始化Module
@@ -55,14 +63,181 @@ public:
                     std::shared_ptr<SocketChannel> pChannel,
                     const HttpMsg& oHttpMsg) = 0;
 
+    /**
+     * @brief http服务模块处理入口（轻量http请求）
+     * @note 完整到达的普通http/1.1请求由快速路径解码为NativeHttpMsg，不构造protobuf消息。
+     * 默认实现转换为HttpMsg后调用AnyMessage(pChannel, oHttpMsg)，对性能敏感的Module可派生
+     * 后直接处理oNativeMsg，oNativeMsg中的数据只在本函数返回之前有效。
+     * @param pChannel 消息来源通道
+     * @param oNativeMsg 接收到的http请求
+     * @return 是否处理成功
+     */
+    virtual bool AnyMessage(
+                    std::shared_ptr<SocketChannel> pChannel,
+                    const NativeHttpMsg& oNativeMsg)
+    {
+        HttpMsg* pHttpMsg = NewArenaMessage<HttpMsg>();
+        oNativeMsg.ToHttpMsg(*pHttpMsg);
+        return(AnyMessage(pChannel, *pHttpMsg));
+    }
+
+    /**
+     * @brief 是否启用请求包体分块通知
+     * @note 启用分块通知的Module，请求包体不在内存中完整缓存，而是依次回调OnHeaders()、
+     * OnBodyChunk()（零次或多次）、OnComplete()，每次回调的包体不超过gc_iMaxBuffLen，
+     * 适用于文件上传等大包体请求。分块通知不做Content-Encoding解压。
+     * @return 是否启用分块通知
+     */
+    virtual bool WithChunkNotice() const
+    {
+        return(false);
+    }
+
+    /**
+     * @brief 分块通知：http头接收完毕
+     * @param pChannel 消息来源通道
+     * @param oHttpMsg 不含包体的http请求
+     * @return 是否处理成功
+     */
+    virtual bool OnHeaders(
+                    std::shared_ptr<SocketChannel> pChannel,
+                    const HttpMsg& oHttpMsg)
+    {
+        return(true);
+    }
+
+    /**
+     * @brief 分块通知：收到一段请求包体
+     * @param pChannel 消息来源通道
+     * @param oHttpMsg body为本段包体，只含url、path、method等路由信息，不含http头
+     * @return 是否处理成功
+     */
+    virtual bool OnBodyChunk(
+                    std::shared_ptr<SocketChannel> pChannel,
+                    const HttpMsg& oHttpMsg)
+    {
+        return(true);
+    }
+
+    /**
+     * @brief 分块通知：请求接收完毕
+     * @param pChannel 消息来源通道
+     * @param oHttpMsg body为最后一段包体（可能为空）
+     * @return 是否处理成功
+     */
+    virtual bool OnComplete(
+                    std::shared_ptr<SocketChannel> pChannel,
+                    const HttpMsg& oHttpMsg)
+    {
+        return(AnyMessage(pChannel, oHttpMsg));
+    }
+
+    /**
+     * @brief HTTP2 stream积压的待发送数据已全部发出
+     * @note 本Module经ActorSender::SendStreamMessage()发送时数据超出流控窗口而积压（或积压
+     * 达到上限被拒绝发送）后回调一次，可在此继续生产后续消息。连接关闭或stream被重置则不回调。
+     * @param pChannel 消息来源通道
+     * @param uiStreamId stream id
+     */
+    virtual void OnStreamWritable(
+                    std::shared_ptr<SocketChannel> pChannel,
+                    uint32 uiStreamId)
+    {
+    }
+
+    /**
+     * @brief 分块通知：HTTP2 stream被对端重置（RST_STREAM）
+     * @note 请求未接收完毕的stream此后不再回调OnBodyChunk()、OnComplete()，为该请求保存的
+     * 状态须在此释放。只回调启用了分块通知的Module。
+     * @param pChannel 消息来源通道
+     * @param uiStreamId 被重置的stream id
+     */
+    virtual void OnStreamReset(
+                    std::shared_ptr<SocketChannel> pChannel,
+                    uint32 uiStreamId)
+    {
+    }
+
+    /**
+     * @brief 分块通知：HTTP2连接关闭
+     * @note 连接上请求未接收完毕的stream此后不再回调，为这些请求保存的状态须在此释放。
+     * 只回调启用了分块通知的Module。
+     * @param pChannel 已关闭的通道
+     */
+    virtual void OnChannelClosed(std::shared_ptr<SocketChannel> pChannel)
+    {
+    }
+
 protected:
+    /**
+     * @brief 注册可复用的http响应头块
+     * @note 在Init()中注册，发送响应时通过SendWithHeaderBlock(pChannel, oHttpMsg, uiHeaderBlockId)附加。
+     * Module析构（如卸载、重新加载）时释放所注册的头块。
+     * @param mapHeader 固定不变的http头
+     * @return http头块编号
+     */
+    uint32 RegisterHeaderBlock(const std::unordered_map<std::string, std::string>& mapHeader)
+    {
+        uint32 uiHeaderBlockId = CodecHttp::RegisterHeaderBlock(mapHeader);
+        m_vecHeaderBlockId.push_back(uiHeaderBlockId);
+        return(uiHeaderBlockId);
+    }
+
+    /**
+     * @brief 缓存可供HTTP2 server push的资源
+     * @note 缓存为本Worker所有HTTP2连接共用。发送HTTP2响应时，响应头link中rel=preload且
+     * 未标记nopush的同源资源（如"</css/app.css>; rel=preload; as=style"）若在缓存中，
+     * 框架先推送这些资源再发送响应；客户端禁用了push时只发送响应。资源更新后须重新Add或Remove。
+     * @param strPath 资源的请求路径，与link头中的路径一致
+     * @param oResponse 资源的完整响应（状态码、http头、包体）
+     * @return 是否缓存成功
+     */
+    bool AddPushResource(const std::string& strPath, const HttpMsg& oResponse)
+    {
+        return(CodecHttp2::AddPushResource(strPath, oResponse));
+    }
+
+    void RemovePushResource(const std::string& strPath)
+    {
+        CodecHttp2::RemovePushResource(strPath);
+    }
+
     const std::string& GetModulePath() const
     {
         return(m_strModulePath);
     }
 
+    /**
+     * @brief 获取路径参数
+     * @note Module路径含{param}或以'*'结尾时，由路由匹配得到，在AnyMessage()等处理入口内有效。
+     * @param strName 参数名（前缀匹配的剩余路径参数名为"*"）
+     * @param strValue 参数值
+     * @return 参数是否存在
+     */
+    bool GetPathParam(const std::string& strName, std::string& strValue) const
+    {
+        for (int i = 0; i < m_stRouteMatch.iParamNum; ++i)
+        {
+            if (m_stRouteMatch.astParam[i].stName.uiLen == strName.size()
+                    && 0 == strName.compare(0, strName.size(),
+                            m_stRouteMatch.astParam[i].stName.pData, m_stRouteMatch.astParam[i].stName.uiLen))
+            {
+                strValue.assign(m_stRouteMatch.astParam[i].stValue.pData, m_stRouteMatch.astParam[i].stValue.uiLen);
+                return(true);
+            }
+        }
+        return(false);
+    }
+
+    const RouteMatch& GetRouteMatch() const
+    {
+        return(m_stRouteMatch);
+    }
+
 private:
     std::string m_strModulePath;
+    RouteMatch m_stRouteMatch;
+    std::vector<uint32> m_vecHeaderBlockId;     ///< 本Module注册的http头块
     friend class ActorBuilder;
 };
 
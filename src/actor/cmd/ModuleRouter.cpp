@@ -0,0 +1,320 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     ModuleRouter.cpp
+ * @brief    Module路由
+ * @author   Bwar
+ * @date:    2026年10月18日
+ * @note
+ * Modify history:
+ ******************************************************************************/
+#include "ModuleRouter.hpp"
+
+namespace neb
+{
+
+static const int ROUTE_ANY_METHOD = -1;
+static const int ROUTE_INVALID_METHOD = -2;
+
+Module* ModuleRouter::tagNode::GetModule(int iMethod) const
+{
+    for (size_t i = 0; i < vecMethodModule.size(); ++i)
+    {
+        if (vecMethodModule[i].first == iMethod && vecMethodModule[i].second != nullptr)
+        {
+            return(vecMethodModule[i].second.get());
+        }
+    }
+    return(pAnyMethodModule.get());
+}
+
+std::shared_ptr<Module>* ModuleRouter::tagNode::GetModuleSlot(int iMethod, bool bCreate)
+{
+    if (ROUTE_ANY_METHOD == iMethod)
+    {
+        return(&pAnyMethodModule);
+    }
+    for (size_t i = 0; i < vecMethodModule.size(); ++i)
+    {
+        if (vecMethodModule[i].first == iMethod)
+        {
+            return(&vecMethodModule[i].second);
+        }
+    }
+    if (!bCreate)
+    {
+        return(nullptr);
+    }
+    vecMethodModule.push_back(std::make_pair(iMethod, std::shared_ptr<Module>()));
+    return(&vecMethodModule.back().second);
+}
+
+ModuleRouter::ModuleRouter()
+{
+}
+
+ModuleRouter::~ModuleRouter()
+{
+}
+
+bool ModuleRouter::AddRoute(const std::string& strRoute, std::shared_ptr<Module> pModule)
+{
+    size_t uiPathOffset = 0;
+    int iMethod = ParseMethod(strRoute, uiPathOffset);
+    if (ROUTE_INVALID_METHOD == iMethod)
+    {
+        return(false);
+    }
+    tagNode* pNode = FindNode(strRoute.data() + uiPathOffset, strRoute.size() - uiPathOffset, true);
+    if (nullptr == pNode)
+    {
+        return(false);
+    }
+    std::shared_ptr<Module>* pSlot = pNode->GetModuleSlot(iMethod, true);
+    if (*pSlot != nullptr)
+    {
+        return(false);
+    }
+    *pSlot = pModule;
+    return(true);
+}
+
+void ModuleRouter::DelRoute(const std::string& strRoute)
+{
+    size_t uiPathOffset = 0;
+    int iMethod = ParseMethod(strRoute, uiPathOffset);
+    if (ROUTE_INVALID_METHOD == iMethod)
+    {
+        return;
+    }
+    tagNode* pNode = FindNode(strRoute.data() + uiPathOffset, strRoute.size() - uiPathOffset, false);
+    if (nullptr == pNode)
+    {
+        return;
+    }
+    std::shared_ptr<Module>* pSlot = pNode->GetModuleSlot(iMethod, false);
+    if (nullptr != pSlot)
+    {
+        pSlot->reset();
+    }
+}
+
+Module* ModuleRouter::Match(const char* szPath, size_t uiPathLen, int iMethod, RouteMatch& stMatch) const
+{
+    Module* pModule = nullptr;
+    stMatch.iParamNum = 0;
+    if (MatchNode(&m_stRoot, szPath, uiPathLen, iMethod, stMatch, pModule))
+    {
+        return(pModule);
+    }
+    return(nullptr);
+}
+
+ModuleRouter::tagNode* ModuleRouter::FindNode(const char* szRoute, size_t uiRouteLen, bool bCreate)
+{
+    tagNode* pNode = &m_stRoot;
+    size_t uiPos = 0;
+    int iParamNum = 0;
+    while (uiPos < uiRouteLen)
+    {
+        if (('{' == szRoute[uiPos] || '*' == szRoute[uiPos]) && uiPos > 0 && '/' != szRoute[uiPos - 1])
+        {
+            return(nullptr);    // 参数和通配符必须从路径段开头开始，如"/a{b}"非法
+        }
+        if ('{' == szRoute[uiPos])
+        {
+            size_t uiNameEnd = uiPos + 1;
+            while (uiNameEnd < uiRouteLen && '}' != szRoute[uiNameEnd] && '/' != szRoute[uiNameEnd])
+            {
+                ++uiNameEnd;
+            }
+            if (uiNameEnd == uiRouteLen || '}' != szRoute[uiNameEnd] || uiNameEnd == uiPos + 1
+                    || ++iParamNum > RouteMatch::MAX_PARAM_NUM)
+            {
+                return(nullptr);
+            }
+            std::string strParamName(szRoute + uiPos + 1, uiNameEnd - uiPos - 1);
+            if (nullptr == pNode->pParamChild)
+            {
+                if (!bCreate)
+                {
+                    return(nullptr);
+                }
+                pNode->pParamChild.reset(new tagNode());
+                pNode->pParamChild->strParamName = strParamName;
+            }
+            else if (pNode->pParamChild->strParamName != strParamName)
+            {
+                return(nullptr);    // 同一位置的参数名必须一致
+            }
+            pNode = pNode->pParamChild.get();
+            uiPos = uiNameEnd + 1;
+            if (uiPos < uiRouteLen && '/' != szRoute[uiPos])
+            {
+                return(nullptr);    // 参数必须占据完整的路径段
+            }
+        }
+        else if ('*' == szRoute[uiPos])
+        {
+            if (uiPos + 1 != uiRouteLen || ++iParamNum > RouteMatch::MAX_PARAM_NUM)
+            {
+                return(nullptr);
+            }
+            if (nullptr == pNode->pCatchAllChild)
+            {
+                if (!bCreate)
+                {
+                    return(nullptr);
+                }
+                pNode->pCatchAllChild.reset(new tagNode());
+                pNode->pCatchAllChild->strParamName = "*";
+            }
+            return(pNode->pCatchAllChild.get());
+        }
+        else
+        {
+            size_t uiStaticEnd = uiPos;
+            while (uiStaticEnd < uiRouteLen && '{' != szRoute[uiStaticEnd] && '*' != szRoute[uiStaticEnd])
+            {
+                ++uiStaticEnd;
+            }
+            pNode = FindStaticChild(pNode, szRoute + uiPos, uiStaticEnd - uiPos, bCreate);
+            if (nullptr == pNode)
+            {
+                return(nullptr);
+            }
+            uiPos = uiStaticEnd;
+        }
+    }
+    return(pNode);
+}
+
+ModuleRouter::tagNode* ModuleRouter::FindStaticChild(tagNode* pNode, const char* szPath, size_t uiPathLen, bool bCreate)
+{
+    while (uiPathLen > 0)
+    {
+        size_t uiIndex = pNode->strIndices.find(szPath[0]);
+        if (std::string::npos == uiIndex)
+        {
+            if (!bCreate)
+            {
+                return(nullptr);
+            }
+            std::unique_ptr<tagNode> pChild(new tagNode());
+            pChild->strPrefix.assign(szPath, uiPathLen);
+            pNode->strIndices.push_back(szPath[0]);
+            pNode->vecChild.push_back(std::move(pChild));
+            return(pNode->vecChild.back().get());
+        }
+        tagNode* pChild = pNode->vecChild[uiIndex].get();
+        size_t uiCommonLen = 0;
+        while (uiCommonLen < uiPathLen && uiCommonLen < pChild->strPrefix.size()
+                && szPath[uiCommonLen] == pChild->strPrefix[uiCommonLen])
+        {
+            ++uiCommonLen;
+        }
+        if (uiCommonLen < pChild->strPrefix.size())
+        {
+            if (!bCreate)
+            {
+                return(nullptr);
+            }
+            // 拆分子节点：公共前缀成为新的中间节点
+            std::unique_ptr<tagNode> pMiddle(new tagNode());
+            pMiddle->strPrefix = pChild->strPrefix.substr(0, uiCommonLen);
+            pChild->strPrefix.erase(0, uiCommonLen);
+            pMiddle->strIndices.push_back(pChild->strPrefix[0]);
+            pMiddle->vecChild.push_back(std::move(pNode->vecChild[uiIndex]));
+            pNode->vecChild[uiIndex] = std::move(pMiddle);
+            pChild = pNode->vecChild[uiIndex].get();
+        }
+        pNode = pChild;
+        szPath += uiCommonLen;
+        uiPathLen -= uiCommonLen;
+    }
+    return(pNode);
+}
+
+bool ModuleRouter::MatchNode(const tagNode* pNode, const char* szPath, size_t uiPathLen,
+                int iMethod, RouteMatch& stMatch, Module*& pModule)
+{
+    if (0 == uiPathLen)
+    {
+        pModule = pNode->GetModule(iMethod);
+        if (nullptr != pModule)
+        {
+            return(true);
+        }
+    }
+    else
+    {
+        const char* pIndex = (const char*)memchr(pNode->strIndices.data(), szPath[0], pNode->strIndices.size());
+        if (nullptr != pIndex)
+        {
+            const tagNode* pChild = pNode->vecChild[pIndex - pNode->strIndices.data()].get();
+            size_t uiPrefixLen = pChild->strPrefix.size();
+            if (uiPrefixLen <= uiPathLen && 0 == memcmp(szPath, pChild->strPrefix.data(), uiPrefixLen)
+                    && MatchNode(pChild, szPath + uiPrefixLen, uiPathLen - uiPrefixLen, iMethod, stMatch, pModule))
+            {
+                return(true);
+            }
+        }
+        if (nullptr != pNode->pParamChild)
+        {
+            const char* pSegmentEnd = (const char*)memchr(szPath, '/', uiPathLen);
+            size_t uiSegmentLen = (nullptr == pSegmentEnd) ? uiPathLen : (pSegmentEnd - szPath);
+            if (uiSegmentLen > 0)
+            {
+                RouteParam& stParam = stMatch.astParam[stMatch.iParamNum++];
+                stParam.stName.pData = pNode->pParamChild->strParamName.data();
+                stParam.stName.uiLen = pNode->pParamChild->strParamName.size();
+                stParam.stValue.pData = szPath;
+                stParam.stValue.uiLen = uiSegmentLen;
+                if (MatchNode(pNode->pParamChild.get(), szPath + uiSegmentLen, uiPathLen - uiSegmentLen,
+                        iMethod, stMatch, pModule))
+                {
+                    return(true);
+                }
+                --stMatch.iParamNum;
+            }
+        }
+    }
+    if (nullptr != pNode->pCatchAllChild && stMatch.iParamNum < RouteMatch::MAX_PARAM_NUM)
+    {
+        pModule = pNode->pCatchAllChild->GetModule(iMethod);
+        if (nullptr != pModule)
+        {
+            RouteParam& stParam = stMatch.astParam[stMatch.iParamNum++];
+            stParam.stName.pData = pNode->pCatchAllChild->strParamName.data();
+            stParam.stName.uiLen = pNode->pCatchAllChild->strParamName.size();
+            stParam.stValue.pData = szPath;
+            stParam.stValue.uiLen = uiPathLen;
+            return(true);
+        }
+    }
+    return(false);
+}
+
+int ModuleRouter::ParseMethod(const std::string& strRoute, size_t& uiPathOffset)
+{
+    uiPathOffset = 0;
+    size_t uiSpacePos = strRoute.find(' ');
+    if (std::string::npos == uiSpacePos)
+    {
+        return(ROUTE_ANY_METHOD);
+    }
+    uiPathOffset = strRoute.find_first_not_of(' ', uiSpacePos);
+    if (std::string::npos == uiPathOffset)
+    {
+        return(ROUTE_INVALID_METHOD);
+    }
+#define XX(num, name, string) \
+    if (sizeof(#string) - 1 == uiSpacePos && 0 == strRoute.compare(0, uiSpacePos, #string)) \
+    { \
+        return(num); \
+    }
+    HTTP_METHOD_MAP(XX)
+#undef XX
+    return(ROUTE_INVALID_METHOD);
+}
+
+} /* namespace neb */
@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     ModuleRouter.hpp
+ * @brief    Module路由
+ * @author   Bwar
+ * @date:    2026年10月18日
+ * @note     基数树（radix tree）路由，路由规则即Module路径，支持：
+ *           1. 精确路径，如 /user/info
+ *           2. 路径参数，如 /user/{id}/info，参数匹配一个不含'/'的非空段
+ *           3. 前缀匹配，规则以'*'结尾，如"/static/"加'*'，匹配其后任意内容（参数名为"*"）
+ *           4. 按http方法分发，如 "GET /user/{id}"，不带方法的规则匹配所有方法
+ *           匹配时静态路径优先于参数，参数优先于前缀。查找不做内存分配，复杂度与
+ *           路径长度成正比，与注册的Module数量无关。
+ * Modify history:
+ ******************************************************************************/
+#ifndef SRC_ACTOR_CMD_MODULEROUTER_HPP_
+#define SRC_ACTOR_CMD_MODULEROUTER_HPP_
+
+#include <string>
+#include <vector>
+#include <memory>
+#include "util/http/HttpRequestScanner.hpp"
+
+namespace neb
+{
+
+class Module;
+
+struct RouteParam
+{
+    HttpStringView stName;
+    HttpStringView stValue;
+};
+
+/**
+ * @brief 路由匹配结果
+ * @note 参数名指向路由树，参数值指向被匹配的路径，只在当前请求处理期间有效。
+ */
+struct RouteMatch
+{
+    static const int MAX_PARAM_NUM = 8;
+
+    int iParamNum = 0;
+    RouteParam astParam[MAX_PARAM_NUM];
+};
+
+class ModuleRouter
+{
+public:
+    ModuleRouter();
+    ModuleRouter(const ModuleRouter&) = delete;
+    ModuleRouter& operator=(const ModuleRouter&) = delete;
+    ~ModuleRouter();
+
+    /**
+     * @brief 添加路由
+     * @param strRoute 路由规则（Module路径）
+     * @param pModule 处理该路由的Module
+     * @return 是否添加成功（规则非法或已存在则失败）
+     */
+    bool AddRoute(const std::string& strRoute, std::shared_ptr<Module> pModule);
+
+    /**
+     * @brief 删除路由
+     * @note 只摘除Module，树结构保留，供同一路由再次加载时复用。
+     */
+    void DelRoute(const std::string& strRoute);
+
+    /**
+     * @brief 路由匹配
+     * @param szPath 请求路径
+     * @param uiPathLen 请求路径长度
+     * @param iMethod http方法
+     * @param stMatch 匹配得到的路径参数
+     * @return 匹配到的Module，无匹配返回nullptr
+     */
+    Module* Match(const char* szPath, size_t uiPathLen, int iMethod, RouteMatch& stMatch) const;
+
+protected:
+    struct tagNode
+    {
+        std::string strPrefix;                          ///< 静态路径片段（参数节点和前缀节点为空）
+        std::string strIndices;                         ///< 各静态子节点的首字符，与vecChild一一对应
+        std::vector<std::unique_ptr<tagNode> > vecChild;
+        std::unique_ptr<tagNode> pParamChild;
+        std::unique_ptr<tagNode> pCatchAllChild;
+        std::string strParamName;                       ///< 参数节点的参数名
+        std::shared_ptr<Module> pAnyMethodModule;
+        std::vector<std::pair<int, std::shared_ptr<Module> > > vecMethodModule;
+
+        Module* GetModule(int iMethod) const;
+        std::shared_ptr<Module>* GetModuleSlot(int iMethod, bool bCreate);
+    };
+
+    /**
+     * @brief 查找路由规则对应的节点
+     * @param bCreate 节点不存在时是否创建
+     * @return 节点，规则非法或（bCreate为false时）节点不存在返回nullptr
+     */
+    tagNode* FindNode(const char* szRoute, size_t uiRouteLen, bool bCreate);
+    static tagNode* FindStaticChild(tagNode* pNode, const char* szPath, size_t uiPathLen, bool bCreate);
+    static bool MatchNode(const tagNode* pNode, const char* szPath, size_t uiPathLen,
+                    int iMethod, RouteMatch& stMatch, Module*& pModule);
+    static int ParseMethod(const std::string& strRoute, size_t& uiPathOffset);
+
+private:
+    tagNode m_stRoot;
+};
+
+} /* namespace neb */
+
+#endif /* SRC_ACTOR_CMD_MODULEROUTER_HPP_ */
@@ -15,12 +15,14 @@ namespace neb
 
 Context::Context()
     : Actor(ACT_CONTEXT, gc_dNoTimeout),
+      m_bCancelled(false), m_uiStreamId(0), m_dDeadline(0.0),
       m_pChannel(nullptr)
 {
 }
 
 Context::Context(std::shared_ptr<SocketChannel> pChannel)
     : Actor(ACT_CONTEXT, gc_dNoTimeout),
+      m_bCancelled(false), m_uiStreamId(0), m_dDeadline(0.0),
       m_pChannel(pChannel)
 {
 }
@@ -29,4 +31,39 @@ Context::~Context()
 {
 }
 
+ev_tstamp Context::GetRemainingTime() const
+{
+    if (m_dDeadline <= 0.0)
+    {
+        return(gc_dNoTimeout);
+    }
+    ev_tstamp dRemaining = m_dDeadline - (ev_tstamp)GetNowTimeMs() / 1000.0;
+    return((dRemaining > 0.0) ? dRemaining : 0.0);
+}
+
+bool Context::IsCancelled() const
+{
+    if (m_bCancelled)
+    {
+        return(true);
+    }
+    std::shared_ptr<Context> pUpstreamContext = m_pUpstreamContext.lock();
+    return(nullptr != pUpstreamContext && pUpstreamContext->m_bCancelled);
+}
+
+void Context::InheritUpstream(std::shared_ptr<Context> pUpstreamContext)
+{
+    m_dDeadline = pUpstreamContext->m_dDeadline;
+    m_pUpstreamContext = pUpstreamContext->GetUpstreamContext();
+}
+
+std::shared_ptr<Context> Context::GetUpstreamContext()
+{
+    if (m_uiStreamId > 0)
+    {
+        return(std::static_pointer_cast<Context>(shared_from_this()));
+    }
+    return(m_pUpstreamContext.lock());
+}
+
 } /* namespace neb */
@@ -10,6 +10,7 @@
 #ifndef SRC_ACTOR_CONTEXT_HPP_
 #define SRC_ACTOR_CONTEXT_HPP_
 
+#include <vector>
 #include "actor/DynamicCreator.hpp"
 #include "actor/Actor.hpp"
 
@@ -74,8 +75,54 @@ public:
         return(m_pChannel);
     }
 
+    /**
+     * @brief 请求处理的截止时间
+     * @note 截止时间由上游请求携带的超时（如gRPC的grpc-timeout）换算而来，由该Context
+     * 派生的Context继承。持有Context的Actor所创建的Step超时时间不超过剩余时间，发出
+     * 的gRPC请求以剩余时间作为grpc-timeout。
+     * @return 截止时间（秒，与GetNowTimeMs()同一时钟），0表示不限
+     */
+    ev_tstamp GetDeadline() const
+    {
+        return(m_dDeadline);
+    }
+
+    /**
+     * @brief 距截止时间的剩余时间
+     * @return 未设置截止时间返回gc_dNoTimeout，已过截止时间返回0
+     */
+    ev_tstamp GetRemainingTime() const;
+
+    /**
+     * @brief 上游请求是否已取消（如上游HTTP2 stream被对端重置）
+     * @note 已取消的请求无须继续处理，也无须响应。框架会取消该请求发往下游的HTTP2
+     * stream，其他下游请求由业务在回调中检查IsCancelled()后自行放弃。
+     */
+    bool IsCancelled() const;
+
+private:
+    struct tagDownstream
+    {
+        int32 iFd;
+        uint32 uiChannelSeq;
+        uint32 uiStreamId;
+        uint32 uiStepSeq;
+    };
+
+    void SetDeadline(ev_tstamp dDeadline)
+    {
+        m_dDeadline = dDeadline;
+    }
+    void InheritUpstream(std::shared_ptr<Context> pUpstreamContext);
+    std::shared_ptr<Context> GetUpstreamContext();
+
 private:
+    bool m_bCancelled;
+    uint32 m_uiStreamId;                                ///< 绑定的上游HTTP2 stream id，0表示未绑定
+    ev_tstamp m_dDeadline;
     std::shared_ptr<SocketChannel> m_pChannel;
+    std::weak_ptr<Context> m_pUpstreamContext;          ///< 绑定上游stream的Context
+    std::vector<tagDownstream> m_vecDownstream;         ///< 本请求发往下游的HTTP2 stream
     friend class ActorBuilder;
 };
 
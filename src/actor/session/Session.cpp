@@ -16,32 +16,28 @@ namespace neb
 
 Session::Session(uint32 uiSessionId, ev_tstamp dSessionTimeout)
     : Actor(Actor::ACT_SESSION, dSessionTimeout),
-      m_bDataReady(false), m_bDataLoading(false)
+      m_bDataReady(false), m_bDataLoading(false), m_bInAssemblyLine(false),
+      m_strSessionId(std::to_string(uiSessionId))
 {
-    std::ostringstream oss;
-    oss << uiSessionId;
-    m_strSessionId = std::move(oss.str());
 }
 
 Session::Session(const std::string& strSessionId, ev_tstamp dSessionTimeout)
     : Actor(Actor::ACT_SESSION, dSessionTimeout),
-      m_bDataReady(false), m_bDataLoading(false),
+      m_bDataReady(false), m_bDataLoading(false), m_bInAssemblyLine(false),
       m_strSessionId(strSessionId)
 {
 }
 
 Session::Session(ACTOR_TYPE eActorType, uint32 ulSessionId, ev_tstamp dSessionTimeout)
     : Actor(eActorType, dSessionTimeout),
-      m_bDataReady(false), m_bDataLoading(false)
+      m_bDataReady(false), m_bDataLoading(false), m_bInAssemblyLine(false),
+      m_strSessionId(std::to_string(ulSessionId))
 {
-    std::ostringstream oss;
-    oss << ulSessionId;
-    m_strSessionId = std::move(oss.str());
 }
 
 Session::Session(ACTOR_TYPE eActorType, const std::string& strSessionId, ev_tstamp dSessionTimeout)
     : Actor(eActorType, dSessionTimeout),
-      m_bDataReady(false), m_bDataLoading(false),
+      m_bDataReady(false), m_bDataLoading(false), m_bInAssemblyLine(false),
       m_strSessionId(strSessionId)
 {
 }
@@ -65,7 +61,7 @@ void Session::SetReady()
     m_bDataLoading = false;
     if (m_vecWaitingStep.size() > 0)
     {
-        AddAssemblyLine(std::dynamic_pointer_cast<Session>(shared_from_this()));
+        AddAssemblyLine(std::static_pointer_cast<Session>(shared_from_this()));
     }
 }
 
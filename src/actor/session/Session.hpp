@@ -69,6 +69,7 @@ private:
 private:
     bool m_bDataReady;
     bool m_bDataLoading;
+    bool m_bInAssemblyLine;         ///< 是否已在ActorBuilder的就绪执行队列中
     std::string m_strSessionId;
     std::queue<uint32> m_vecWaitingStep;
     friend class ActorBuilder;
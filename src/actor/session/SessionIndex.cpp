@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     SessionIndex.cpp
+ * @brief    Session索引
+ * @author   Bwar
+ * @date:    2026年10月18日
+ * @note
+ * Modify history:
+ ******************************************************************************/
+#include "SessionIndex.hpp"
+#include "Session.hpp"
+
+namespace neb
+{
+
+SessionIndex::SessionIndex()
+{
+}
+
+SessionIndex::~SessionIndex()
+{
+    Clear();
+}
+
+bool SessionIndex::Insert(std::shared_ptr<Session> pSession)
+{
+    const std::string& strSessionId = pSession->GetSessionId();
+    auto ret = m_mapSessionById.insert(std::make_pair(
+            tagIdView(strSessionId.data(), strSessionId.size()), pSession));
+    if (!ret.second)
+    {
+        return(false);
+    }
+    uint32 uiSessionId = 0;
+    if (ToNumericId(strSessionId.data(), strSessionId.size(), uiSessionId))
+    {
+        m_mapSessionByNum.insert(std::make_pair(uiSessionId, pSession));
+    }
+    return(true);
+}
+
+bool SessionIndex::Erase(const std::string& strSessionId)
+{
+    auto iter = m_mapSessionById.find(tagIdView(strSessionId.data(), strSessionId.size()));
+    if (iter == m_mapSessionById.end())
+    {
+        return(false);
+    }
+    // strSessionId可能就是被删除Session的会话ID，先持有Session直到两个索引都删除完毕
+    std::shared_ptr<Session> pSession = iter->second;
+    uint32 uiSessionId = 0;
+    if (ToNumericId(strSessionId.data(), strSessionId.size(), uiSessionId))
+    {
+        m_mapSessionByNum.erase(uiSessionId);
+    }
+    m_mapSessionById.erase(iter);
+    return(true);
+}
+
+void SessionIndex::Clear()
+{
+    m_mapSessionByNum.clear();
+    m_mapSessionById.clear();
+}
+
+bool SessionIndex::ToNumericId(const char* szSessionId, size_t uiSessionIdLen, uint32& uiSessionId)
+{
+    if (0 == uiSessionIdLen || uiSessionIdLen > 10
+            || (szSessionId[0] == '0' && uiSessionIdLen > 1))
+    {
+        return(false);
+    }
+    uint64 ullSessionId = 0;
+    for (size_t i = 0; i < uiSessionIdLen; ++i)
+    {
+        if (szSessionId[i] < '0' || szSessionId[i] > '9')
+        {
+            return(false);
+        }
+        ullSessionId = ullSessionId * 10 + (szSessionId[i] - '0');
+    }
+    if (ullSessionId > 0xFFFFFFFFULL)
+    {
+        return(false);
+    }
+    uiSessionId = (uint32)ullSessionId;
+    return(true);
+}
+
+} /* namespace neb */
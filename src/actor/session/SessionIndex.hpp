@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     SessionIndex.hpp
+ * @brief    Session索引
+ * @author   Bwar
+ * @date:    2026年10月18日
+ * @note     同时按字符串和整型会话ID索引Session：
+ *           1. 字符串索引的键是指向Session自身m_strSessionId的视图（Session存续期间
+ *              会话ID不变），按(szSessionId, uiSessionIdLen)查找无需构造std::string；
+ *           2. 会话ID是规范的十进制uint32（无前导0、无符号、不溢出）的Session同时
+ *              进入整型索引，按uint32查找无需把ID转换成字符串。
+ * Modify history:
+ ******************************************************************************/
+#ifndef SRC_ACTOR_SESSION_SESSIONINDEX_HPP_
+#define SRC_ACTOR_SESSION_SESSIONINDEX_HPP_
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include "Definition.hpp"
+
+namespace neb
+{
+
+class Session;
+
+class SessionIndex
+{
+public:
+    SessionIndex();
+    SessionIndex(const SessionIndex&) = delete;
+    SessionIndex& operator=(const SessionIndex&) = delete;
+    ~SessionIndex();
+
+    std::shared_ptr<Session> Get(uint32 uiSessionId) const
+    {
+        auto iter = m_mapSessionByNum.find(uiSessionId);
+        return((iter == m_mapSessionByNum.end()) ? nullptr : iter->second);
+    }
+
+    std::shared_ptr<Session> Get(const char* szSessionId, size_t uiSessionIdLen) const
+    {
+        auto iter = m_mapSessionById.find(tagIdView(szSessionId, uiSessionIdLen));
+        return((iter == m_mapSessionById.end()) ? nullptr : iter->second);
+    }
+
+    /**
+     * @brief 添加Session
+     * @return 是否添加成功（会话ID已存在则失败）
+     */
+    bool Insert(std::shared_ptr<Session> pSession);
+
+    /**
+     * @brief 删除Session
+     * @return 是否存在并删除
+     */
+    bool Erase(const std::string& strSessionId);
+
+    void Clear();
+
+    size_t Size() const
+    {
+        return(m_mapSessionById.size());
+    }
+
+    /**
+     * @brief 会话ID是否为规范的十进制uint32
+     * @param uiSessionId 转换得到的整型会话ID
+     */
+    static bool ToNumericId(const char* szSessionId, size_t uiSessionIdLen, uint32& uiSessionId);
+
+protected:
+    struct tagIdView
+    {
+        const char* pData;
+        size_t uiLen;
+
+        tagIdView(const char* szData, size_t uiDataLen)
+            : pData(szData), uiLen(uiDataLen)
+        {
+        }
+
+        bool operator==(const tagIdView& stOther) const
+        {
+            return(uiLen == stOther.uiLen && 0 == memcmp(pData, stOther.pData, uiLen));
+        }
+    };
+
+    struct IdViewHash
+    {
+        size_t operator()(const tagIdView& stId) const
+        {
+            // FNV-1a
+            uint64 ullHash = 14695981039346656037ULL;
+            for (size_t i = 0; i < stId.uiLen; ++i)
+            {
+                ullHash ^= (unsigned char)stId.pData[i];
+                ullHash *= 1099511628211ULL;
+            }
+            return((size_t)ullHash);
+        }
+    };
+
+private:
+    std::unordered_map<tagIdView, std::shared_ptr<Session>, IdViewHash> m_mapSessionById;
+    std::unordered_map<uint32, std::shared_ptr<Session> > m_mapSessionByNum;
+};
+
+} /* namespace neb */
+
+#endif /* SRC_ACTOR_SESSION_SESSIONINDEX_HPP_ */
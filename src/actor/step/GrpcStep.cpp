@@ -9,6 +9,8 @@
  ******************************************************************************/
 #include "GrpcStep.hpp"
 #include "util/StringConverter.hpp"
+#include "codec/grpc/Grpc.hpp"
+#include "codec/grpc/GrpcMessage.hpp"
 
 namespace neb
 {
@@ -25,61 +27,180 @@ GrpcStep::~GrpcStep()
 E_CMD_STATUS GrpcStep::Callback(
         std::shared_ptr<SocketChannel> pChannel, const HttpMsg& oHttpMsg)
 {
-    char szLength[5] = {0};
-    uint8 ucCompressedFlag = 0;
-    uint32 uiMessageLength = 0;
+    if (oHttpMsg.chunk_notice())
+    {
+        return(StreamCallback(pChannel, oHttpMsg));
+    }
+
+    int iStatus = 0;
+    std::string strStatusMsg;
     std::string strResponseData;
-    ucCompressedFlag = oHttpMsg.body()[0];
-    szLength[0] = oHttpMsg.body()[4];
-    szLength[1] = oHttpMsg.body()[3];
-    szLength[2] = oHttpMsg.body()[2];
-    szLength[3] = oHttpMsg.body()[1];
-    uiMessageLength = StringConverter::RapidAtoi<uint32>(szLength);
-    if (ucCompressedFlag)
+    GetStatus(oHttpMsg, iStatus, strStatusMsg);
+    if (oHttpMsg.body().empty())
     {
+        return(Callback(pChannel, strResponseData, iStatus, strStatusMsg));
+    }
+
+    size_t uiOffset = 0;
+    std::string strEncoding;
+    auto iter = oHttpMsg.headers().find("grpc-encoding");
+    if (iter != oHttpMsg.headers().end())
+    {
+        strEncoding = iter->second;
+    }
+    E_CODEC_STATUS eCodecStatus = GrpcMessage::Decode(oHttpMsg.body(), uiOffset, strEncoding, strResponseData);
+    if (CODEC_STATUS_INVALID == eCodecStatus)
+    {
+        LOG4_ERROR("compression algorithm \"%s\" not support.", strEncoding.c_str());
+        return(Callback(pChannel, strResponseData, GRPC_INTERNAL, "compression algorithm not support."));
+    }
+    else if (CODEC_STATUS_ERR == eCodecStatus)
+    {
+        LOG4_ERROR("grpc message larger than %u, body length %u.",
+                GrpcMessage::MAX_MESSAGE_LENGTH, (uint32)oHttpMsg.body().size());
+        return(Callback(pChannel, "", GRPC_RESOURCE_EXHAUSTED, "grpc message too large."));
+    }
+    else if (CODEC_STATUS_OK != eCodecStatus)
+    {
+        LOG4_ERROR("invalid grpc message, body length %u.", (uint32)oHttpMsg.body().size());
+        return(Callback(pChannel, strResponseData, GRPC_INTERNAL, "invalid grpc message."));
+    }
+    return(Callback(pChannel, strResponseData, iStatus, strStatusMsg));
+}
+
+E_CMD_STATUS GrpcStep::StreamCallback(
+        std::shared_ptr<SocketChannel> pChannel, const HttpMsg& oHttpMsg)
+{
+    if (0 == oHttpMsg.encoding())
+    {
+        m_strBuffer.clear();
+        m_strEncoding.clear();
         auto iter = oHttpMsg.headers().find("grpc-encoding");
-        if (iter == oHttpMsg.headers().end())
+        if (iter != oHttpMsg.headers().end())
         {
-            LOG4_ERROR("Compressed-Flag had been set, but no \"grpc-encoding\" found in header.");
-            return(Callback(pChannel, strResponseData, GRPC_INVALID_ARGUMENT,
-                    "Compressed-Flag had been set, but no \"grpc-encoding\" found in header."));
+            m_strEncoding = iter->second;
         }
-        else
+    }
+    m_strBuffer.append(oHttpMsg.body());
+    size_t uiOffset = 0;
+    std::string strResponseData;
+    E_CODEC_STATUS eCodecStatus = CODEC_STATUS_OK;
+    while (CODEC_STATUS_OK == eCodecStatus)
+    {
+        eCodecStatus = GrpcMessage::Decode(m_strBuffer, uiOffset, m_strEncoding, strResponseData);
+        if (CODEC_STATUS_OK == eCodecStatus)
         {
-            if (iter->second == "gzip")
-            {
-                if (!CodecUtil::Gunzip(oHttpMsg.body().substr(5, uiMessageLength), strResponseData))
-                {
-                    LOG4_ERROR("failed to gunzip message.");
-                    return(Callback(pChannel, strResponseData, GRPC_INVALID_ARGUMENT, "failed to gunzip message."));
-                }
-            }
-            else
+            E_CMD_STATUS eResult = OnStreamMessage(pChannel, strResponseData);
+            if (CMD_STATUS_RUNNING != eResult)
             {
-                LOG4_ERROR("compression algorithm not support.");
-                return(Callback(pChannel, strResponseData, GRPC_INVALID_ARGUMENT, "compression algorithm not support."));
+                return(eResult);
             }
         }
     }
-    else
+    m_strBuffer.erase(0, uiOffset);
+    if (CODEC_STATUS_PAUSE != eCodecStatus)
     {
-        strResponseData.assign(oHttpMsg.body(), 5, uiMessageLength);
+        LOG4_ERROR("failed to decode grpc message, codec status %d.", eCodecStatus);
+        if (CODEC_STATUS_ERR == eCodecStatus)
+        {
+            return(Callback(pChannel, "", GRPC_RESOURCE_EXHAUSTED, "grpc message too large."));
+        }
+        return(Callback(pChannel, "", GRPC_INTERNAL, "invalid grpc message."));
+    }
+    if (oHttpMsg.is_decoding())
+    {
+        return(CMD_STATUS_RUNNING);
+    }
+    if (!m_strBuffer.empty())
+    {
+        LOG4_ERROR("stream ended with an incomplete grpc message.");
+        return(Callback(pChannel, "", GRPC_INTERNAL, "incomplete grpc message."));
     }
-
     int iStatus = 0;
     std::string strStatusMsg;
+    GetStatus(oHttpMsg, iStatus, strStatusMsg);
+    return(Callback(pChannel, "", iStatus, strStatusMsg));
+}
+
+E_CMD_STATUS GrpcStep::ErrBack(std::shared_ptr<SocketChannel> pChannel,
+        int iErrno, const std::string& strErrMsg)
+{
+    switch (iErrno)
+    {
+        case ERR_STREAM_RESET:
+            return(Callback(pChannel, "", GRPC_CANCELLED, strErrMsg));
+        case ERR_STREAM_REFUSED:
+            return(Callback(pChannel, "", GRPC_UNAVAILABLE, strErrMsg));
+        case ERR_STREAM_ERROR:
+            return(Callback(pChannel, "", GRPC_INTERNAL, strErrMsg));
+        default:
+            break;
+    }
+    return(Step::ErrBack(pChannel, iErrno, strErrMsg));
+}
+
+void GrpcStep::GetStatus(const HttpMsg& oHttpMsg, int& iStatus, std::string& strStatusMessage)
+{
+    bool bWithStatus = false;
     for (int i = 0; i < oHttpMsg.trailer_header_size(); ++i)
     {
         if ("grpc-status" == oHttpMsg.trailer_header(i).name())
         {
+            bWithStatus = true;
             iStatus = StringConverter::RapidAtoi<int32>(oHttpMsg.trailer_header(i).value().c_str());
         }
         else if ("grpc-message" == oHttpMsg.trailer_header(i).name())
         {
-            strStatusMsg = oHttpMsg.trailer_header(i).value();
+            strStatusMessage = oHttpMsg.trailer_header(i).value();
         }
     }
-    return(Callback(pChannel, strResponseData, iStatus, strStatusMsg));
+    if (bWithStatus)
+    {
+        return;
+    }
+    // Trailers-Only响应的grpc-status在响应头中
+    auto iter = oHttpMsg.headers().find("grpc-status");
+    if (iter != oHttpMsg.headers().end())
+    {
+        iStatus = StringConverter::RapidAtoi<int32>(iter->second.c_str());
+        iter = oHttpMsg.headers().find("grpc-message");
+        if (iter != oHttpMsg.headers().end())
+        {
+            strStatusMessage = iter->second;
+        }
+        return;
+    }
+    // 没有grpc-status（如经过的代理直接返回了http错误），按http状态码映射gRPC状态码
+    switch (oHttpMsg.status_code())
+    {
+        case 400:
+            iStatus = GRPC_INTERNAL;
+            break;
+        case 401:
+            iStatus = GRPC_UNAUTHENTICATED;
+            break;
+        case 403:
+            iStatus = GRPC_PERMISSION_DENIED;
+            break;
+        case 404:
+            iStatus = GRPC_UNIMPLEMENTED;
+            break;
+        case 429:
+        case 502:
+        case 503:
+        case 504:
+            iStatus = GRPC_UNAVAILABLE;
+            break;
+        case 0:
+        case 200:
+            iStatus = GRPC_INTERNAL;
+            strStatusMessage = "missing grpc-status.";
+            return;
+        default:
+            iStatus = GRPC_UNKNOWN;
+            break;
+    }
+    strStatusMessage = "http status " + std::to_string(oHttpMsg.status_code()) + ".";
 }
 
 } /* namespace neb */
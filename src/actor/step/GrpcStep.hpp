@@ -10,6 +10,7 @@
 #ifndef SRC_ACTOR_STEP_GRPCSTEP_HPP_
 #define SRC_ACTOR_STEP_GRPCSTEP_HPP_
 
+#include <string>
 #include "Step.hpp"
 
 namespace neb
@@ -27,10 +28,44 @@ public:
                     std::shared_ptr<SocketChannel> pChannel,
                     const HttpMsg& oHttpMsg);
 
+    /**
+     * @brief gRPC调用结束
+     * @note 流式响应（ActorSender::SendTo()的bStreamResponse为true）的各条消息已通过
+     * OnStreamMessage()回调，此时strGrpcResponse为空。响应中没有grpc-status时iStatus
+     * 由http状态码映射（见gRPC的http-grpc-status-mapping），200则为GRPC_INTERNAL
+     */
     virtual E_CMD_STATUS Callback(
                     std::shared_ptr<SocketChannel> pChannel,
                     const std::string& strGrpcResponse,
                     int iStatus, const std::string& strStatusMessage) = 0;
+
+    /**
+     * @brief 错误回调
+     * @note stream被服务端重置时按RST_STREAM的错误码回调Callback()：CANCEL（ERR_STREAM_RESET）
+     * 为GRPC_CANCELLED，REFUSED_STREAM（ERR_STREAM_REFUSED）为GRPC_UNAVAILABLE，
+     * 其他（ERR_STREAM_ERROR）为GRPC_INTERNAL
+     */
+    virtual E_CMD_STATUS ErrBack(std::shared_ptr<SocketChannel> pChannel,
+            int iErrno, const std::string& strErrMsg) override;
+
+    /**
+     * @brief 流式响应：收到一条响应消息
+     * @return CMD_STATUS_RUNNING 继续接收；其他值则不再接收后续响应，框架向对端发送RST_STREAM(CANCEL)
+     */
+    virtual E_CMD_STATUS OnStreamMessage(
+                    std::shared_ptr<SocketChannel> pChannel,
+                    const std::string& strGrpcResponse)
+    {
+        return(CMD_STATUS_RUNNING);
+    }
+
+private:
+    static void GetStatus(const HttpMsg& oHttpMsg, int& iStatus, std::string& strStatusMessage);
+    E_CMD_STATUS StreamCallback(std::shared_ptr<SocketChannel> pChannel, const HttpMsg& oHttpMsg);
+
+private:
+    std::string m_strEncoding;          ///< 流式响应的grpc-encoding
+    std::string m_strBuffer;            ///< 流式响应中尚不足一条消息的数据
 };
 
 } /* namespace neb */
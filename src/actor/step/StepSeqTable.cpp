@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     StepSeqTable.cpp
+ * @brief    等待回调的Step表
+ * @author   Bwar
+ * @date:    2026年10月18日
+ * @note
+ * Modify history:
+ ******************************************************************************/
+#include "StepSeqTable.hpp"
+
+namespace neb
+{
+
+StepSeqTable::StepSeqTable()
+    : m_uiMask(INIT_CAPACITY - 1), m_uiShift(INIT_SHIFT), m_uiSize(0), m_vecSlot(INIT_CAPACITY)
+{
+}
+
+StepSeqTable::~StepSeqTable()
+{
+}
+
+bool StepSeqTable::Insert(uint32 uiSeq, std::shared_ptr<Step> pStep)
+{
+    if (nullptr == pStep || nullptr != FindSlot(uiSeq))
+    {
+        return(false);
+    }
+    if ((m_uiSize + 1) * 2 > m_vecSlot.size())
+    {
+        Grow();
+    }
+    Place(uiSeq, std::move(pStep));
+    ++m_uiSize;
+    return(true);
+}
+
+bool StepSeqTable::Erase(uint32 uiSeq)
+{
+    const tagSlot* pSlot = FindSlot(uiSeq);
+    if (nullptr == pSlot)
+    {
+        return(false);
+    }
+    uint32 uiIndex = pSlot - m_vecSlot.data();
+    // 先移出，Step析构（可能间接访问本表）在槽位调整完成之后
+    std::shared_ptr<Step> pErased = std::move(m_vecSlot[uiIndex].pStep);
+    --m_uiSize;
+
+    // 后移删除：后续不在初始槽位的元素依次前移一格，遇到空槽位或位于初始槽位的元素为止
+    uint32 uiNext = (uiIndex + 1) & m_uiMask;
+    while (nullptr != m_vecSlot[uiNext].pStep && ProbeDistance(uiNext) > 0)
+    {
+        m_vecSlot[uiIndex].uiSeq = m_vecSlot[uiNext].uiSeq;
+        m_vecSlot[uiIndex].pStep = std::move(m_vecSlot[uiNext].pStep);
+        uiIndex = uiNext;
+        uiNext = (uiNext + 1) & m_uiMask;
+    }
+    return(true);
+}
+
+void StepSeqTable::Clear()
+{
+    std::vector<tagSlot> vecSlot(m_vecSlot.size());
+    vecSlot.swap(m_vecSlot);
+    m_uiSize = 0;
+}
+
+void StepSeqTable::Place(uint32 uiSeq, std::shared_ptr<Step>&& pStep)
+{
+    uint32 uiIndex = HomeSlot(uiSeq);
+    for (uint32 uiDistance = 0; nullptr != m_vecSlot[uiIndex].pStep; ++uiDistance)
+    {
+        uint32 uiResidentDistance = ProbeDistance(uiIndex);
+        if (uiResidentDistance < uiDistance)
+        {
+            // 劫富济贫：离初始槽位更近的原有元素让出槽位，继续为它寻找位置
+            std::swap(uiSeq, m_vecSlot[uiIndex].uiSeq);
+            std::swap(pStep, m_vecSlot[uiIndex].pStep);
+            uiDistance = uiResidentDistance;
+        }
+        uiIndex = (uiIndex + 1) & m_uiMask;
+    }
+    m_vecSlot[uiIndex].uiSeq = uiSeq;
+    m_vecSlot[uiIndex].pStep = std::move(pStep);
+}
+
+void StepSeqTable::Grow()
+{
+    std::vector<tagSlot> vecSlot(m_vecSlot.size() * 2);
+    vecSlot.swap(m_vecSlot);
+    m_uiMask = m_vecSlot.size() - 1;
+    --m_uiShift;
+    for (auto& stSlot : vecSlot)
+    {
+        if (nullptr != stSlot.pStep)
+        {
+            Place(stSlot.uiSeq, std::move(stSlot.pStep));
+        }
+    }
+}
+
+} /* namespace neb */
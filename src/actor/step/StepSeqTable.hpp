@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     StepSeqTable.hpp
+ * @brief    等待回调的Step表
+ * @author   Bwar
+ * @date:    2026年10月18日
+ * @note     以Step的Sequence为键的开放寻址（线性探测）哈希表。每16个连续的Sequence
+ *           为一组，组内按Sequence低4位顺序存放（连续的Sequence位于相邻槽位），组的
+ *           位置由Fibonacci哈希（组号乘以2^32/φ取高位）打散：若直接取Sequence的低位，
+ *           长期未回调的Step会与后续连续的Sequence在同一区域堆积，形成贯穿全表的探测链。
+ *           槽位中保存完整的Sequence，不同Sequence不会被误匹配。冲突按Robin Hood
+ *           规则排列（离初始槽位远的元素优先），删除采用后移删除（backward shift），
+ *           不留墓碑，查找和删除通常只访问一两个槽位。容量只在负载超过一半时翻倍，
+ *           稳态下插入、查找、删除都不做内存分配。
+ * Modify history:
+ ******************************************************************************/
+#ifndef SRC_ACTOR_STEP_STEPSEQTABLE_HPP_
+#define SRC_ACTOR_STEP_STEPSEQTABLE_HPP_
+
+#include <memory>
+#include <vector>
+#include "Definition.hpp"
+
+namespace neb
+{
+
+class Step;
+
+class StepSeqTable
+{
+public:
+    StepSeqTable();
+    StepSeqTable(const StepSeqTable&) = delete;
+    StepSeqTable& operator=(const StepSeqTable&) = delete;
+    ~StepSeqTable();
+
+    /**
+     * @brief 查找Step
+     * @note 返回shared_ptr副本而不是槽位引用：Step回调中可能注册或删除其他Step，
+     * 导致槽位移动。
+     * @return Step，不存在返回nullptr
+     */
+    std::shared_ptr<Step> Get(uint32 uiSeq) const
+    {
+        const tagSlot* pSlot = FindSlot(uiSeq);
+        return((nullptr == pSlot) ? nullptr : pSlot->pStep);
+    }
+
+    bool Exist(uint32 uiSeq) const
+    {
+        return(nullptr != FindSlot(uiSeq));
+    }
+
+    /**
+     * @brief 插入Step
+     * @return 是否插入成功（Sequence已存在则失败）
+     */
+    bool Insert(uint32 uiSeq, std::shared_ptr<Step> pStep);
+
+    /**
+     * @brief 删除Step
+     * @return 是否存在并删除
+     */
+    bool Erase(uint32 uiSeq);
+
+    void Clear();
+
+    uint32 Size() const
+    {
+        return(m_uiSize);
+    }
+
+protected:
+    struct tagSlot
+    {
+        uint32 uiSeq = 0;
+        std::shared_ptr<Step> pStep;        ///< 为nullptr表示空槽位
+    };
+
+    /**
+     * @brief 初始槽位：组位置取组号哈希值的高(log2(容量) - 4)位，组内偏移取Sequence低4位
+     */
+    uint32 HomeSlot(uint32 uiSeq) const
+    {
+        return(((uint32)((uiSeq >> 4) * 2654435769u) >> (m_uiShift + 4) << 4) | (uiSeq & 15));
+    }
+
+    /**
+     * @brief 槽位上的元素与其初始槽位的距离
+     */
+    uint32 ProbeDistance(uint32 uiIndex) const
+    {
+        return((uiIndex - HomeSlot(m_vecSlot[uiIndex].uiSeq)) & m_uiMask);
+    }
+
+    const tagSlot* FindSlot(uint32 uiSeq) const
+    {
+        uint32 uiIndex = HomeSlot(uiSeq);
+        for (uint32 uiDistance = 0; nullptr != m_vecSlot[uiIndex].pStep; ++uiDistance)
+        {
+            if (uiSeq == m_vecSlot[uiIndex].uiSeq)
+            {
+                return(&m_vecSlot[uiIndex]);
+            }
+            if (ProbeDistance(uiIndex) < uiDistance)
+            {
+                break;      // Robin Hood：要找的元素不可能在更远的槽位
+            }
+            uiIndex = (uiIndex + 1) & m_uiMask;
+        }
+        return(nullptr);
+    }
+
+    void Place(uint32 uiSeq, std::shared_ptr<Step>&& pStep);
+    void Grow();
+
+private:
+    static const uint32 INIT_CAPACITY = 1024;  ///< 必须为2的幂
+    static const uint32 INIT_SHIFT = 22;        ///< 32 - log2(INIT_CAPACITY)
+    uint32 m_uiMask;
+    uint32 m_uiShift;                           ///< 哈希值右移位数，取高log2(容量)位
+    uint32 m_uiSize;
+    std::vector<tagSlot> m_vecSlot;
+};
+
+} /* namespace neb */
+
+#endif /* SRC_ACTOR_STEP_STEPSEQTABLE_HPP_ */
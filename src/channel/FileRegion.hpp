@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     FileRegion.hpp
+ * @brief    待发送的文件区间
+ * @author   Bwar
+ * @date:    2026年10月18日
+ * @note     以文件（或memfd）的一段区间作为http响应的body，由SocketChannelImpl
+ *           使用sendfile()直接从内核发送，无须将文件内容读入内存。
+ * Modify history:
+ ******************************************************************************/
+#ifndef SRC_CHANNEL_FILEREGION_HPP_
+#define SRC_CHANNEL_FILEREGION_HPP_
+
+#include <unistd.h>
+#include <sys/types.h>
+#include "Definition.hpp"
+#include "util/CBuffer.hpp"
+
+namespace neb
+{
+
+class FileRegion
+{
+public:
+    /**
+     * @brief 文件区间
+     * @param iFd 文件描述符
+     * @param llOffset 区间起始偏移
+     * @param llLength 区间长度
+     * @param bCloseFd 发送完毕（或连接关闭）时是否关闭文件描述符
+     */
+    FileRegion(int iFd, int64 llOffset, int64 llLength, bool bCloseFd = true)
+        : m_iFd(iFd), m_bCloseFd(bCloseFd), m_llOffset(llOffset), m_llRemain(llLength),
+          m_pTailBuff(nullptr)
+    {
+    }
+    FileRegion(const FileRegion&) = delete;
+    FileRegion& operator=(const FileRegion&) = delete;
+
+    ~FileRegion()
+    {
+        if (m_bCloseFd && m_iFd >= 0)
+        {
+            close(m_iFd);
+            m_iFd = -1;
+        }
+        DELETE(m_pTailBuff);
+    }
+
+    int GetFd() const
+    {
+        return(m_iFd);
+    }
+
+    off_t* MutableOffset()
+    {
+        return(&m_llOffset);
+    }
+
+    int64 GetRemain() const
+    {
+        return(m_llRemain);
+    }
+
+    void Advance(int64 llSize)
+    {
+        m_llRemain -= llSize;
+    }
+
+    /**
+     * @brief 文件区间之后待发送的数据
+     * @note 文件区间未发送完毕之前，后续编码的数据须追加到此缓冲区以保证发送顺序。
+     */
+    CBuffer* GetTailBuff()
+    {
+        if (m_pTailBuff == nullptr)
+        {
+            m_pTailBuff = new CBuffer();
+        }
+        return(m_pTailBuff);
+    }
+
+    /**
+     * @brief 交换文件区间之后待发送的数据
+     * @note 文件区间发送完毕时调用，pBuff通常为已发送完毕的发送缓冲区。
+     */
+    CBuffer* SwapTailBuff(CBuffer* pBuff)
+    {
+        CBuffer* pTailBuff = GetTailBuff();
+        m_pTailBuff = pBuff;
+        return(pTailBuff);
+    }
+
+private:
+    int m_iFd;
+    bool m_bCloseFd;
+    off_t m_llOffset;
+    int64 m_llRemain;
+    CBuffer* m_pTailBuff;
+};
+
+} /* namespace neb */
+
+#endif /* SRC_CHANNEL_FILEREGION_HPP_ */
@@ -60,6 +60,11 @@ bool SocketChannel::IsClient() const
     return(m_pImpl->GetFd());
 }
 
+uint32 SocketChannel::GetSequence() const
+{
+    return(m_pImpl->GetSequence());
+}
+
 bool SocketChannel::IsPipeline() const
 {
     return(m_pImpl->IsPipeline());
@@ -85,6 +90,16 @@ E_CODEC_TYPE SocketChannel::GetCodecType() const
     return(m_pImpl->GetCodecType());
 }
 
+uint32 SocketChannel::GetSendWindow(uint32 uiStreamId) const
+{
+    return(m_pImpl->GetHttp2SendWindow(uiStreamId));
+}
+
+uint32 SocketChannel::GetWaittingBytes(uint32 uiStreamId) const
+{
+    return(m_pImpl->GetHttp2WaittingBytes(uiStreamId));
+}
+
 int SocketChannel::SendChannelFd(int iSocketFd, int iSendFd, int iAiFamily, int iCodecType, std::shared_ptr<NetLogger> pLogger)
 {
     ssize_t             n;
@@ -39,6 +39,7 @@ public:
     virtual bool Init(E_CODEC_TYPE eCodecType, bool bIsClient = false);
 
     int GetFd() const;
+    uint32 GetSequence() const;
     bool IsClient() const;
     bool IsPipeline() const;
     const std::string& GetIdentify() const;
@@ -46,6 +47,19 @@ public:
     const std::string& GetClientData() const;
     E_CODEC_TYPE GetCodecType() const;
 
+    /**
+     * @brief http2 stream当前可立即发送的DATA字节数
+     * @note 流式发送时据此控制生产速度：为0时继续发送的数据缓存在stream中，待对端
+     * WINDOW_UPDATE后发送。非http2连接返回0。
+     */
+    uint32 GetSendWindow(uint32 uiStreamId) const;
+
+    /**
+     * @brief http2 stream因流控窗口不足缓存、尚未发送的字节数
+     * @note 达到H2_STREAM_MAX_WAITTING_BYTES时ActorSender::SendStreamMessage()拒绝发送。
+     */
+    uint32 GetWaittingBytes(uint32 uiStreamId) const;
+
 private:
     // Hide most of the channel implementation for Actors
     // 以m_pImpl对Actor及其派生类隐藏框架层才需要的Channel大部分实现
@@ -8,6 +8,9 @@
  * Modify history:
  ******************************************************************************/
 #include <cstring>
+#include <algorithm>
+#include <fcntl.h>
+#include <sys/sendfile.h>
 #include "codec/CodecProto.hpp"
 #include "codec/CodecPrivate.hpp"
 #include "codec/CodecHttp.hpp"
@@ -15,6 +18,8 @@
 #include "codec/CodecResp.hpp"
 #include "labor/Labor.hpp"
 #include "labor/Manager.hpp"
+#include "ios/Dispatcher.hpp"
+#include "actor/ActorBuilder.hpp"
 #include "logger/NetLogger.hpp"
 #include "SocketChannelImpl.hpp"
 
@@ -23,7 +28,7 @@ namespace neb
 
 SocketChannelImpl::SocketChannelImpl(SocketChannel* pSocketChannel, std::shared_ptr<NetLogger> pLogger, int iFd, uint32 ulSeq, ev_tstamp dKeepAlive)
     : m_ucChannelStatus(CHANNEL_STATUS_INIT), m_bIsClientConnection(false),
-      m_unRemoteWorkerIdx(0), m_iFd(iFd), m_uiSeq(ulSeq), m_uiForeignSeq(0), m_bPipeline(true),
+      m_unRemoteWorkerIdx(0), m_iFd(iFd), m_uiSeq(ulSeq), m_uiForeignSeq(0), m_bPipeline(true), m_bFlushPending(false),
       m_uiUnitTimeMsgNum(0), m_uiMsgNum(0),
       m_dActiveTime(0.0), m_dKeepAlive(dKeepAlive),
       m_pIoWatcher(NULL), m_pTimerWatcher(NULL),
@@ -37,6 +42,8 @@ SocketChannelImpl::~SocketChannelImpl()
 {
     LOG4_DEBUG("SocketChannelImpl::~SocketChannelImpl() fd %d, seq %u", m_iFd, m_uiSeq);
     m_listPipelineStepSeq.clear();
+    m_mapStreamStepSeq.clear();
+    m_listFileRegion.clear();
     if (CHANNEL_STATUS_CLOSED != m_ucChannelStatus)
     {
         Close();
@@ -129,6 +136,114 @@ uint32 SocketChannelImpl::PopStepSeq()
     return(uiStepSeq);
 }
 
+uint32 SocketChannelImpl::PopStepSeq(uint32 uiStreamId)
+{
+    auto iter = m_mapStreamStepSeq.find(uiStreamId);
+    if (iter == m_mapStreamStepSeq.end())
+    {
+        return(0);
+    }
+    uint32 uiStepSeq = iter->second;
+    m_mapStreamStepSeq.erase(iter);
+    // 并发stream数受SETTINGS_MAX_CONCURRENT_STREAMS限制，线性查找的代价可以接受
+    auto seq_iter = std::find(m_listPipelineStepSeq.begin(), m_listPipelineStepSeq.end(), uiStepSeq);
+    if (seq_iter != m_listPipelineStepSeq.end())
+    {
+        m_listPipelineStepSeq.erase(seq_iter);
+    }
+    return(uiStepSeq);
+}
+
+uint32 SocketChannelImpl::GetStepSeq(uint32 uiStreamId) const
+{
+    auto iter = m_mapStreamStepSeq.find(uiStreamId);
+    if (iter == m_mapStreamStepSeq.end())
+    {
+        return(0);
+    }
+    return(iter->second);
+}
+
+uint32 SocketChannelImpl::GetHttp2SendWindow(uint32 uiStreamId) const
+{
+    if (m_pCodec == nullptr || CODEC_HTTP2 != m_pCodec->GetCodecType()
+            || CHANNEL_STATUS_CLOSED == m_ucChannelStatus)
+    {
+        return(0);
+    }
+    return(((CodecHttp2*)m_pCodec)->GetStreamSendWindow(uiStreamId));
+}
+
+uint32 SocketChannelImpl::GetHttp2WaittingBytes(uint32 uiStreamId) const
+{
+    if (m_pCodec == nullptr || CODEC_HTTP2 != m_pCodec->GetCodecType()
+            || CHANNEL_STATUS_CLOSED == m_ucChannelStatus)
+    {
+        return(0);
+    }
+    return(((CodecHttp2*)m_pCodec)->GetStreamWaittingBytes(uiStreamId));
+}
+
+bool SocketChannelImpl::IsHttp2StreamAvailable() const
+{
+    if (m_pCodec == nullptr || CODEC_HTTP2 != m_pCodec->GetCodecType()
+            || CHANNEL_STATUS_CLOSED == m_ucChannelStatus)
+    {
+        return(false);
+    }
+    return(((CodecHttp2*)m_pCodec)->IsStreamAvailable());
+}
+
+void SocketChannelImpl::AddStreamStepSeq(const HttpMsg& oHttpMsg, uint32 uiStepSeq)
+{
+    // http2请求编码时由CodecHttp2分配stream id
+    if (uiStepSeq > 0 && HTTP_REQUEST == oHttpMsg.type() && oHttpMsg.stream_id() > 0
+            && CODEC_HTTP2 == m_pCodec->GetCodecType())
+    {
+        m_mapStreamStepSeq[oHttpMsg.stream_id()] = uiStepSeq;
+        m_pLabor->GetActorBuilder()->AddDownstream(m_iFd, m_uiSeq, oHttpMsg.stream_id(), uiStepSeq);
+    }
+}
+
+bool SocketChannelImpl::TakeHttp2ResetStreams(std::vector<std::pair<uint32, uint32> >& vecResetStream)
+{
+    if (m_pCodec == nullptr || CODEC_HTTP2 != m_pCodec->GetCodecType())
+    {
+        return(false);
+    }
+    return(((CodecHttp2*)m_pCodec)->TakeResetStreams(vecResetStream));
+}
+
+bool SocketChannelImpl::TakeHttp2WritableStreams(std::vector<uint32>& vecStreamId)
+{
+    if (m_pCodec == nullptr || CODEC_HTTP2 != m_pCodec->GetCodecType())
+    {
+        return(false);
+    }
+    return(((CodecHttp2*)m_pCodec)->TakeWritableStreams(vecStreamId));
+}
+
+uint32 SocketChannelImpl::CancelHttp2Stream(uint32 uiStreamId)
+{
+    if (m_pCodec == nullptr || CODEC_HTTP2 != m_pCodec->GetCodecType()
+            || CHANNEL_STATUS_ESTABLISHED != m_ucChannelStatus)
+    {
+        return(0);
+    }
+    CBuffer* pBuff = m_listFileRegion.empty() ? m_pSendBuff : m_listFileRegion.back()->GetTailBuff();
+    ((CodecHttp2*)m_pCodec)->CancelStream(uiStreamId, pBuff);
+    return(PopStepSeq(uiStreamId));
+}
+
+const NativeHttpMsg* SocketChannelImpl::TakeNativeHttpMsg()
+{
+    if (m_pCodec != nullptr && CODEC_HTTP == m_pCodec->GetCodecType())
+    {
+        return(((CodecHttp*)m_pCodec)->TakeNativeHttpMsg());
+    }
+    return(nullptr);
+}
+
 ev_tstamp SocketChannelImpl::GetKeepAlive()
 {
     if (CODEC_HTTP == m_pCodec->GetCodecType())
@@ -169,6 +284,15 @@ E_CODEC_STATUS SocketChannelImpl::Send()
         LOG4_ERROR("no codec found, please check whether the CODEC_TYPE is valid.");
         return(CODEC_STATUS_ERR);
     }
+    m_bFlushPending = false;
+    if (!m_listFileRegion.empty())
+    {
+        E_CODEC_STATUS eCodecStatus = SendFileRegion();
+        if (CODEC_STATUS_OK != eCodecStatus)
+        {
+            return(eCodecStatus);
+        }
+    }
     int iNeedWriteLen = 0;
     int iWrittenLen = 0;
     iNeedWriteLen = m_pSendBuff->ReadableBytes();
@@ -240,8 +364,9 @@ E_CODEC_STATUS SocketChannelImpl::Send(int32 iCmd, uint32 uiSeq, const MsgBody&
     oMsgHead.set_len(iMsgBodyLen);
     switch (m_ucChannelStatus)
     {
-        case CHANNEL_STATUS_ESTABLISHED:
-            eCodecStatus = m_pCodec->Encode(oMsgHead, oMsgBody, m_pSendBuff);
+        case CHANNEL_STATUS_ESTABLISHED:    // 有未发送完的文件区间时须排在其后发送
+            eCodecStatus = m_pCodec->Encode(oMsgHead, oMsgBody,
+                    m_listFileRegion.empty() ? m_pSendBuff : m_listFileRegion.back()->GetTailBuff());
             break;
         case CHANNEL_STATUS_CLOSED:
             LOG4_WARNING("channel_fd[%d], channel_seq[%d], channel_status[%d] send EOF.", m_iFd, m_uiSeq, m_ucChannelStatus);
@@ -299,6 +424,11 @@ E_CODEC_STATUS SocketChannelImpl::Send(int32 iCmd, uint32 uiSeq, const MsgBody&
         return(eCodecStatus);
     }
 
+    if (CMD_RSP_TELL_WORKER != iCmd && DeferFlush(0))
+    {
+        return(CODEC_STATUS_OK);
+    }
+
     errno = 0;
     int iWrittenLen = Write(m_pSendBuff, m_iErrno);
     LOG4_TRACE("iNeedWriteLen = %d, iWrittenLen = %d", iNeedWriteLen, iWrittenLen);
@@ -348,11 +478,36 @@ E_CODEC_STATUS SocketChannelImpl::Send(const HttpMsg& oHttpMsg, uint32 uiStepSeq
         LOG4_ERROR("no codec found, please check whether the CODEC_TYPE is valid.");
         return(CODEC_STATUS_ERR);
     }
+    CodecHttp::SetNowTime(m_pLabor->GetNowTime());
     E_CODEC_STATUS eCodecStatus = CODEC_STATUS_OK;
     switch (m_ucChannelStatus)
     {
         case CHANNEL_STATUS_ESTABLISHED:
-            eCodecStatus = ((CodecHttp*)m_pCodec)->Encode(oHttpMsg, m_pSendBuff);
+            if (m_listFileRegion.empty())
+            {
+                eCodecStatus = ((CodecHttp*)m_pCodec)->Encode(oHttpMsg, m_pSendBuff);
+                if (CODEC_STATUS_OK == eCodecStatus || CODEC_STATUS_PART_OK == eCodecStatus)
+                {
+                    AddStreamStepSeq(oHttpMsg, uiStepSeq);
+                }
+            }
+            else    // 须在未发送完的文件区间之后发送
+            {
+                eCodecStatus = ((CodecHttp*)m_pCodec)->Encode(oHttpMsg, m_listFileRegion.back()->GetTailBuff());
+                if (CODEC_STATUS_OK == eCodecStatus)
+                {
+                    AddStreamStepSeq(oHttpMsg, uiStepSeq);
+                    if (DeferFlush(uiStepSeq))
+                    {
+                        return(CODEC_STATUS_OK);
+                    }
+                    if (uiStepSeq > 0)
+                    {
+                        m_listPipelineStepSeq.push_back(uiStepSeq);
+                    }
+                    return(Send());
+                }
+            }
             break;
         case CHANNEL_STATUS_CLOSED:
             LOG4_WARNING("channel_fd[%d], channel_seq[%d], channel_status[%d] send EOF.", m_iFd, m_uiSeq, m_ucChannelStatus);
@@ -368,6 +523,7 @@ E_CODEC_STATUS SocketChannelImpl::Send(const HttpMsg& oHttpMsg, uint32 uiStepSeq
             {
                 eCodecStatus = CODEC_STATUS_PAUSE;
                 m_listPipelineStepSeq.push_back(uiStepSeq);
+                AddStreamStepSeq(oHttpMsg, uiStepSeq);
             }
             break;
         default:
@@ -386,6 +542,11 @@ E_CODEC_STATUS SocketChannelImpl::Send(const HttpMsg& oHttpMsg, uint32 uiStepSeq
         return(eCodecStatus);
     }
 
+    if (CODEC_STATUS_OK == eCodecStatus && DeferFlush(uiStepSeq))
+    {
+        return(CODEC_STATUS_OK);
+    }
+
     int iWrittenLen = Write(m_pSendBuff, m_iErrno);
     LOG4_TRACE("fd[%d], channel_seq[%u] iWrittenLen = %d, m_iErrno = %d",
             GetFd(), GetSequence(), iWrittenLen, m_iErrno);
@@ -424,6 +585,80 @@ E_CODEC_STATUS SocketChannelImpl::Send(const HttpMsg& oHttpMsg, uint32 uiStepSeq
     }
 }
 
+E_CODEC_STATUS SocketChannelImpl::Send(const HttpMsg& oHttpMsg, uint32 uiStepSeq, uint32 uiHeaderBlockId)
+{
+    if (m_pCodec != nullptr && CODEC_HTTP == m_pCodec->GetCodecType())
+    {
+        ((CodecHttp*)m_pCodec)->SetHeaderBlock(uiHeaderBlockId);
+    }
+    return(Send(oHttpMsg, uiStepSeq));
+}
+
+E_CODEC_STATUS SocketChannelImpl::Send(const HttpMsg& oHttpMsg, std::shared_ptr<FileRegion> pFileRegion, uint32 uiStepSeq)
+{
+    LOG4_TRACE("channel_fd[%d], channel_seq[%d], channel_status[%d]", m_iFd, m_uiSeq, m_ucChannelStatus);
+    if (m_pCodec == nullptr)
+    {
+        LOG4_ERROR("no codec found, please check whether the CODEC_TYPE is valid.");
+        return(CODEC_STATUS_ERR);
+    }
+    if (CHANNEL_STATUS_CLOSED == m_ucChannelStatus)
+    {
+        LOG4_WARNING("channel_fd[%d], channel_seq[%d], channel_status[%d] send EOF.", m_iFd, m_uiSeq, m_ucChannelStatus);
+        return(CODEC_STATUS_EOF);
+    }
+    if (CODEC_HTTP != m_pCodec->GetCodecType() || CHANNEL_STATUS_ESTABLISHED != m_ucChannelStatus)
+    {
+        // http2的DATA帧需经编解码器分帧，连接未建立时也无法确定发送方式，只能将文件内容读入body发送
+        LOG4_DEBUG("codec type %d channel status %d, read file region into http body.",
+                m_pCodec->GetCodecType(), m_ucChannelStatus);
+        HttpMsg oFileHttpMsg(oHttpMsg);
+        std::string* pBody = oFileHttpMsg.mutable_body();
+        pBody->resize(pFileRegion->GetRemain());
+        int64 llReadLen = 0;
+        while (pFileRegion->GetRemain() > 0)
+        {
+            ssize_t iReadLen = pread(pFileRegion->GetFd(), &(*pBody)[llReadLen],
+                    pFileRegion->GetRemain(), *pFileRegion->MutableOffset());
+            if (iReadLen <= 0)
+            {
+                if (iReadLen < 0 && EINTR == errno)
+                {
+                    continue;
+                }
+                LOG4_ERROR("read file region error %d, %lld bytes remain.", errno, pFileRegion->GetRemain());
+                return(CODEC_STATUS_ERR);
+            }
+            *pFileRegion->MutableOffset() += iReadLen;
+            pFileRegion->Advance(iReadLen);
+            llReadLen += iReadLen;
+        }
+        return(Send(oFileHttpMsg, uiStepSeq));
+    }
+
+    CBuffer* pBuff = m_listFileRegion.empty() ? m_pSendBuff : m_listFileRegion.back()->GetTailBuff();
+    CodecHttp::SetNowTime(m_pLabor->GetNowTime());
+    ((CodecHttp*)m_pCodec)->SetExternalBodyLength(pFileRegion->GetRemain());
+    E_CODEC_STATUS eCodecStatus = ((CodecHttp*)m_pCodec)->Encode(oHttpMsg, pBuff);
+    if (CODEC_STATUS_OK != eCodecStatus)
+    {
+        return(eCodecStatus);
+    }
+    if (pFileRegion->GetRemain() > 0)
+    {
+        m_listFileRegion.push_back(pFileRegion);
+    }
+    if (DeferFlush(uiStepSeq))
+    {
+        return(CODEC_STATUS_OK);
+    }
+    if (uiStepSeq > 0)
+    {
+        m_listPipelineStepSeq.push_back(uiStepSeq);
+    }
+    return(Send());
+}
+
 E_CODEC_STATUS SocketChannelImpl::Send(const RedisMsg& oRedisMsg, uint32 uiStepSeq)
 {
     LOG4_TRACE("channel_fd[%d], channel_seq[%d], channel_status[%d]", m_iFd, m_uiSeq, m_ucChannelStatus);
@@ -470,6 +705,11 @@ E_CODEC_STATUS SocketChannelImpl::Send(const RedisMsg& oRedisMsg, uint32 uiStepS
         return(eCodecStatus);
     }
 
+    if (CODEC_STATUS_OK == eCodecStatus && DeferFlush(uiStepSeq))
+    {
+        return(CODEC_STATUS_OK);
+    }
+
     int iWrittenLen = Write(m_pSendBuff, m_iErrno);
     LOG4_TRACE("fd[%d], channel_seq[%u] iWrittenLen = %d, m_iErrno = %d",
             GetFd(), GetSequence(), iWrittenLen, m_iErrno);
@@ -514,8 +754,8 @@ E_CODEC_STATUS SocketChannelImpl::Send(const char* pRaw, uint32 uiRawSize, uint3
     E_CODEC_STATUS eCodecStatus = CODEC_STATUS_OK;
     switch (m_ucChannelStatus)
     {
-        case CHANNEL_STATUS_ESTABLISHED:
-            m_pSendBuff->Write(pRaw, uiRawSize);
+        case CHANNEL_STATUS_ESTABLISHED:    // 有未发送完的文件区间时须排在其后发送
+            (m_listFileRegion.empty() ? m_pSendBuff : m_listFileRegion.back()->GetTailBuff())->Write(pRaw, uiRawSize);
             break;
         case CHANNEL_STATUS_CLOSED:
             LOG4_WARNING("channel_fd[%d], channel_seq[%d], channel_status[%d] send EOF.", m_iFd, m_uiSeq, m_ucChannelStatus);
@@ -545,6 +785,11 @@ E_CODEC_STATUS SocketChannelImpl::Send(const char* pRaw, uint32 uiRawSize, uint3
         return(eCodecStatus);
     }
 
+    if (CODEC_STATUS_OK == eCodecStatus && DeferFlush(uiStepSeq))
+    {
+        return(CODEC_STATUS_OK);
+    }
+
     int iWrittenLen = Write(m_pSendBuff, m_iErrno);
     LOG4_TRACE("fd[%d], channel_seq[%u] iWrittenLen = %d, m_iErrno = %d",
             GetFd(), GetSequence(), iWrittenLen, m_iErrno);
@@ -758,6 +1003,14 @@ E_CODEC_STATUS SocketChannelImpl::Recv(HttpMsg& oHttpMsg)
                 }
             }
         }
+        else if (CODEC_STATUS_PART_OK == eCodecStatus)
+        {
+            if (0 == m_uiMsgNum)    // 分块通知的http头，连接已可用于响应
+            {
+                m_dKeepAlive = m_pLabor->GetNodeInfo().dIoTimeout;
+                m_ucChannelStatus = CHANNEL_STATUS_ESTABLISHED;
+            }
+        }
         else
         {
             if (0 == m_uiMsgNum && CODEC_STATUS_PAUSE != eCodecStatus)
@@ -776,13 +1029,26 @@ E_CODEC_STATUS SocketChannelImpl::Recv(HttpMsg& oHttpMsg)
         m_strErrMsg = strerror_r(m_iErrno, m_szErrBuff, sizeof(m_szErrBuff));
         LOG4_TRACE("fd %d closed by peer, error %d %s!",
                         m_iFd, m_iErrno, m_strErrMsg.c_str());
-        if (m_pRecvBuff->ReadableBytes() > 0)
+        if (CODEC_HTTP == m_pCodec->GetCodecType())
         {
-            E_CODEC_STATUS eCodecStatus = ((CodecHttp*)m_pCodec)->Decode(m_pRecvBuff, oHttpMsg);
-            if (CODEC_STATUS_PAUSE == eCodecStatus || CODEC_STATUS_OK == eCodecStatus)
+            E_CODEC_STATUS eCodecStatus = CODEC_STATUS_PAUSE;
+            if (m_pRecvBuff->ReadableBytes() > 0)
+            {
+                eCodecStatus = ((CodecHttp*)m_pCodec)->Decode(m_pRecvBuff, oHttpMsg);
+            }
+            if (CODEC_STATUS_OK == eCodecStatus)
             {
+                const NativeHttpMsg* pNativeMsg = ((CodecHttp*)m_pCodec)->TakeNativeHttpMsg();
+                if (pNativeMsg != nullptr)  // 连接即将关闭，转换为HttpMsg随CODEC_STATUS_EOF返回
+                {
+                    pNativeMsg->ToHttpMsg(oHttpMsg);
+                }
                 oHttpMsg.set_is_decoding(false);
             }
+            else
+            {
+                ((CodecHttp*)m_pCodec)->DecodeEof(oHttpMsg);
+            }
         }
         return(CODEC_STATUS_EOF);
     }
@@ -1007,6 +1273,11 @@ E_CODEC_STATUS SocketChannelImpl::Fetch(HttpMsg& oHttpMsg)
             }
         }
     }
+    else if (CODEC_STATUS_PART_OK == eCodecStatus && 0 == m_uiMsgNum)
+    {
+        m_dKeepAlive = m_pLabor->GetNodeInfo().dIoTimeout;
+        m_ucChannelStatus = CHANNEL_STATUS_ESTABLISHED;
+    }
     return(eCodecStatus);
 }
 
@@ -1184,6 +1455,7 @@ bool SocketChannelImpl::Close()
     LOG4_TRACE("channel[%d] channel_status %d", m_iFd, m_ucChannelStatus);
     if (CHANNEL_STATUS_CLOSED != m_ucChannelStatus)
     {
+        FlushPending();
         m_pSendBuff->Compact(1);
         m_pWaitForSendBuff->Compact(1);
         if (0 == close(m_iFd))
@@ -1205,6 +1477,132 @@ bool SocketChannelImpl::Close()
     }
 }
 
+E_CODEC_STATUS SocketChannelImpl::SendFileRegion()
+{
+    while (true)
+    {
+        int iNeedWriteLen = m_pSendBuff->ReadableBytes();   // 文件区间之前的数据
+        if (iNeedWriteLen > 0)
+        {
+            int iWrittenLen = Write(m_pSendBuff, m_iErrno);
+            if (iWrittenLen < 0)
+            {
+                if (EAGAIN == m_iErrno || EINTR == m_iErrno)
+                {
+                    m_dActiveTime = m_pLabor->GetNowTime();
+                    return(CODEC_STATUS_PAUSE);
+                }
+                m_strErrMsg = strerror_r(m_iErrno, m_szErrBuff, sizeof(m_szErrBuff));
+                LOG4_ERROR("send to %s[fd %d] error %d: %s", m_strIdentify.c_str(),
+                        m_iFd, m_iErrno, m_strErrMsg.c_str());
+                return(CODEC_STATUS_INT);
+            }
+            m_dActiveTime = m_pLabor->GetNowTime();
+            if (iWrittenLen < iNeedWriteLen)
+            {
+                return(CODEC_STATUS_PAUSE);
+            }
+        }
+        if (m_listFileRegion.empty())
+        {
+            return(CODEC_STATUS_OK);
+        }
+
+        auto pFileRegion = m_listFileRegion.front();
+        if (pFileRegion->GetRemain() > 0)
+        {
+            ssize_t iSentLen = 0;
+            if (WithSendfile())
+            {
+                iSentLen = sendfile(m_iFd, pFileRegion->GetFd(),
+                        pFileRegion->MutableOffset(), pFileRegion->GetRemain());
+            }
+            else    // 分块读入发送缓冲区，下一轮循环经Write()发送
+            {
+                size_t uiChunkSize = (pFileRegion->GetRemain() > (int64)gc_iMaxBuffLen)
+                        ? gc_iMaxBuffLen : pFileRegion->GetRemain();
+                m_pSendBuff->Clear();     // 此时发送缓冲区已无待发送数据
+                if (!m_pSendBuff->EnsureWritableBytes(uiChunkSize))
+                {
+                    LOG4_ERROR("no enough memory for file region chunk!");
+                    return(CODEC_STATUS_ERR);
+                }
+                iSentLen = pread(pFileRegion->GetFd(), m_pSendBuff->GetRawWriteBuffer(),
+                        uiChunkSize, *pFileRegion->MutableOffset());
+                if (iSentLen > 0)
+                {
+                    m_pSendBuff->AdvanceWriteIndex(iSentLen);
+                    *pFileRegion->MutableOffset() += iSentLen;
+                }
+            }
+            if (iSentLen < 0)
+            {
+                m_iErrno = errno;
+                if (EAGAIN == m_iErrno || EINTR == m_iErrno)
+                {
+                    m_dActiveTime = m_pLabor->GetNowTime();
+                    return(CODEC_STATUS_PAUSE);
+                }
+                m_strErrMsg = strerror_r(m_iErrno, m_szErrBuff, sizeof(m_szErrBuff));
+                LOG4_ERROR("send file to %s[fd %d] error %d: %s", m_strIdentify.c_str(),
+                        m_iFd, m_iErrno, m_strErrMsg.c_str());
+                return(CODEC_STATUS_INT);
+            }
+            else if (iSentLen == 0)     // 文件在发送过程中被截断，已发出的Content-Length无法兑现，只能断开连接
+            {
+                m_strErrMsg = "file region truncated";
+                LOG4_ERROR("send file to %s[fd %d] error: %s, %lld bytes remain.", m_strIdentify.c_str(),
+                        m_iFd, m_strErrMsg.c_str(), pFileRegion->GetRemain());
+                return(CODEC_STATUS_ERR);
+            }
+            pFileRegion->Advance(iSentLen);
+            m_dActiveTime = m_pLabor->GetNowTime();
+            if (WithSendfile() && pFileRegion->GetRemain() > 0)
+            {
+                return(CODEC_STATUS_PAUSE);
+            }
+        }
+        if (pFileRegion->GetRemain() == 0 && m_pSendBuff->ReadableBytes() == 0)
+        {
+            // 文件区间发送完毕，其后的数据成为发送缓冲区的数据
+            m_pSendBuff = pFileRegion->SwapTailBuff(m_pSendBuff);
+            m_listFileRegion.pop_front();
+        }
+    }
+}
+
+bool SocketChannelImpl::DeferFlush(uint32 uiStepSeq)
+{
+    if (!m_pLabor->GetNodeInfo().bDeferredFlush)
+    {
+        return(false);
+    }
+    if (uiStepSeq > 0)
+    {
+        m_listPipelineStepSeq.push_back(uiStepSeq);
+    }
+    m_dActiveTime = m_pLabor->GetNowTime();
+    if (!m_bFlushPending)
+    {
+        m_bFlushPending = true;
+        m_pLabor->GetDispatcher()->AddFlushChannel(m_pSocketChannel->shared_from_this());
+    }
+    return(true);
+}
+
+void SocketChannelImpl::FlushPending()
+{
+    if (m_bFlushPending)
+    {
+        m_bFlushPending = false;
+        if (CHANNEL_STATUS_ESTABLISHED == m_ucChannelStatus)
+        {
+            E_CODEC_STATUS eCodecStatus = Send();
+            LOG4_TRACE("fd[%d] flush before close status %d", m_iFd, eCodecStatus);
+        }
+    }
+}
+
 int SocketChannelImpl::Write(CBuffer* pBuff, int& iErrno)
 {
     LOG4_TRACE("fd[%d], channel_seq[%u]", GetFd(), GetSequence());
@@ -11,6 +11,8 @@
 #define SRC_CHANNEL_SOCKETCHANNELIMPL_HPP_
 
 #include <memory>
+#include <list>
+#include <unordered_map>
 
 #ifdef __GNUC__
 #pragma GCC diagnostic push
@@ -29,6 +31,7 @@
 #include "pb/redis.pb.h"
 #include "codec/Codec.hpp"
 #include "Channel.hpp"
+#include "FileRegion.hpp"
 #include "Definition.hpp"
 #include "logger/NetLogger.hpp"
 
@@ -40,6 +43,7 @@ typedef RedisReply RedisMsg;
 class Labor;
 class NetLogger;
 class SocketChannel;
+class NativeHttpMsg;
 
 class SocketChannelImpl: public Channel
 {
@@ -54,6 +58,8 @@ public:
     virtual E_CODEC_STATUS Send();
     virtual E_CODEC_STATUS Send(int32 iCmd, uint32 uiSeq, const MsgBody& oMsgBody);
     virtual E_CODEC_STATUS Send(const HttpMsg& oHttpMsg, uint32 uiStepSeq);
+    virtual E_CODEC_STATUS Send(const HttpMsg& oHttpMsg, uint32 uiStepSeq, uint32 uiHeaderBlockId);
+    virtual E_CODEC_STATUS Send(const HttpMsg& oHttpMsg, std::shared_ptr<FileRegion> pFileRegion, uint32 uiStepSeq);
     virtual E_CODEC_STATUS Send(const RedisMsg& oRedisMsg, uint32 uiStepSeq);
     virtual E_CODEC_STATUS Send(const char* pRaw, uint32 uiRawSize, uint32 uiStepSeq);
     virtual E_CODEC_STATUS Recv(MsgHead& oMsgHead, MsgBody& oMsgBody);
@@ -80,6 +86,60 @@ public:
 
     uint32 PopStepSeq();
 
+    /**
+     * @brief 取出http2 stream对应的等待回调的Step seq
+     * @note http2连接上多个stream的响应不按请求顺序返回，须按stream id而非先进先出取出。
+     * @return 没有stream对应的Step seq返回0
+     */
+    uint32 PopStepSeq(uint32 uiStreamId);
+
+    /**
+     * @brief 获取http2 stream对应的等待回调的Step seq但不取出
+     * @note 分块通知的响应在最后一个分块之前回调Step时使用。
+     */
+    uint32 GetStepSeq(uint32 uiStreamId) const;
+
+    /**
+     * @brief http2 stream当前可立即发送的DATA字节数
+     */
+    uint32 GetHttp2SendWindow(uint32 uiStreamId) const;
+
+    /**
+     * @brief http2 stream因流控窗口不足尚未发送的字节数
+     */
+    uint32 GetHttp2WaittingBytes(uint32 uiStreamId) const;
+
+    /**
+     * @brief 是否为可发起新stream的http2连接
+     */
+    bool IsHttp2StreamAvailable() const;
+
+    /**
+     * @brief 取出被对端重置（RST_STREAM）的http2 stream
+     * @return 是否有被重置的stream
+     */
+    bool TakeHttp2ResetStreams(std::vector<std::pair<uint32, uint32> >& vecResetStream);
+
+    /**
+     * @brief 取出待发送数据已全部发出的http2 stream
+     * @return 是否有这样的stream
+     */
+    bool TakeHttp2WritableStreams(std::vector<uint32>& vecStreamId);
+
+    /**
+     * @brief 取消本端发起的http2 stream（发送RST_STREAM(CANCEL)），发送须由调用者触发
+     * @return stream对应的等待回调的Step seq，没有则返回0
+     */
+    uint32 CancelHttp2Stream(uint32 uiStreamId);
+
+    /**
+     * @brief 取出快速路径解码的http请求
+     * @note Recv()/Fetch()返回CODEC_STATUS_OK而oHttpMsg为空时，请求由HttpRequestScanner
+     * 解码为NativeHttpMsg，在下一次Recv()/Fetch()之前有效。
+     * @return 非快速路径解码返回nullptr
+     */
+    const NativeHttpMsg* TakeNativeHttpMsg();
+
     ev_tstamp GetActiveTime() const
     {
         return(m_dActiveTime);
@@ -159,6 +219,11 @@ public:
         return(m_strErrMsg);
     }
 
+    bool IsFlushPending() const
+    {
+        return(m_bFlushPending);
+    }
+
 public:
     void SetLabor(Labor* pLabor)
     {
@@ -219,6 +284,36 @@ protected:
     virtual int Write(CBuffer* pBuff, int& iErrno);
     virtual int Read(CBuffer* pBuff, int& iErrno);
 
+    /**
+     * @brief 延迟发送
+     * @note 开启了合并发送（deferred_flush）时，编码后的数据只追加到发送缓冲区，
+     *       并将通道登记到Dispatcher，由Dispatcher在本轮事件循环结束前统一发送。
+     * @param uiStepSeq 等待回调的Step seq
+     * @return 是否已延迟（false表示需立即发送）
+     */
+    bool DeferFlush(uint32 uiStepSeq);
+
+    /**
+     * @brief 关闭连接前发出延迟发送的数据
+     * @note 编解码器决定关闭连接（如EOF、Connection: close）时，同一批次已编码进发送缓冲区的
+     *       响应尚未等到Dispatcher统一发送，关闭前尽力写出，并清除待发送标记。
+     */
+    void FlushPending();
+
+    /**
+     * @brief 是否可以使用sendfile()发送文件区间
+     * @note SSL连接的数据须经加密，不能由内核直接发送，需覆盖此方法返回false，
+     *       文件区间将分块读入发送缓冲区后经Write()发送。
+     */
+    virtual bool WithSendfile() const
+    {
+        return(true);
+    }
+
+private:
+    E_CODEC_STATUS SendFileRegion();
+    void AddStreamStepSeq(const HttpMsg& oHttpMsg, uint32 uiStepSeq);
+
 private:
     uint8 m_ucChannelStatus;
     char m_szErrBuff[256];
@@ -228,6 +323,7 @@ private:
     uint32 m_uiSeq;                       ///< 文件描述符创建时对应的序列号
     uint32 m_uiForeignSeq;                ///< 外来的seq，每个连接的包都是有序的，用作接入Server数据包检查，防止篡包
     uint32 m_bPipeline;                   ///< 是否支持pipeline
+    bool m_bFlushPending;                 ///< 发送缓冲区有待合并发送的数据
     uint32 m_uiUnitTimeMsgNum;            ///< 统计单位时间内接收消息数量
     uint32 m_uiMsgNum;                    ///< 接收消息数量
     ev_tstamp m_dActiveTime;              ///< 最后一次访问时间
@@ -246,6 +342,8 @@ private:
     std::string m_strIdentify;            ///< 连接标识（可以为空，不为空时用于标识业务层与连接的关系）
     std::string m_strRemoteAddr;          ///< 对端IP地址（不是客户端地址，但可能跟客户端地址相同）
     std::list<uint32> m_listPipelineStepSeq;  ///< 等待回调的Step seq
+    std::unordered_map<uint32, uint32> m_mapStreamStepSeq;  ///< http2 stream id -> 等待回调的Step seq（Step seq同时在m_listPipelineStepSeq中）
+    std::list<std::shared_ptr<FileRegion> > m_listFileRegion;  ///< 待发送的文件区间（按发送顺序，文件区间之后的数据在其TailBuff中）
     std::set<E_CODEC_TYPE> m_setSkipCodecType;  ///< Codec转换需跳过的CodecType
     Labor* m_pLabor;
     SocketChannel* m_pSocketChannel;
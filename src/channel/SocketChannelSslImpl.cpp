@@ -823,6 +823,7 @@ bool SocketChannelSslImpl::Close()
 {
     if (m_eSslChannelStatus != SSL_CHANNEL_SHUTDOWN)
     {
+        FlushPending();     // 须在SSL_shutdown之前写出
         SslShutdown();
         if (m_eSslChannelStatus == SSL_CHANNEL_SHUTING_WANT_READ
                 || m_eSslChannelStatus == SSL_CHANNEL_SHUTING_WANT_WRITE)
@@ -74,6 +74,10 @@ public:
 
 protected:
     virtual int Write(CBuffer* pBuff, int& iErrno) override;
+    virtual bool WithSendfile() const override     ///< SSL数据须加密后发送，文件区间分块读取后经SSL_write()发送
+    {
+        return(false);
+    }
     virtual int Read(CBuffer* pBuff, int& iErrno) override;
 
 private: 
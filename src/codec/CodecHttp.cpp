@@ -8,8 +8,11 @@
  * Modify history:
  ******************************************************************************/
 #include <algorithm>
+#include <ctime>
+#include <vector>
 #include "util/StringCoder.hpp"
 #include "logger/NetLogger.hpp"
+#include "actor/cmd/Module.hpp"
 #include "CodecHttp.hpp"
 
 #define STATUS_CODE(code, str) case code: return str;
@@ -75,14 +78,88 @@ static const char * status_string(int code)
     return 0;
 }
 
+/**
+ * @brief 预先生成的状态行
+ * @return 状态行，未知状态码返回nullptr
+ */
+static const std::string* status_line(int iHttpMinor, int iStatusCode)
+{
+    static const std::vector<std::string> s_vecStatusLine = []()
+    {
+        std::vector<std::string> vecStatusLine(2 * 500);
+        char szStatusLine[64];
+        for (int iMinor = 0; iMinor < 2; ++iMinor)
+        {
+            for (int iCode = 100; iCode < 600; ++iCode)
+            {
+                if (nullptr != status_string(iCode))
+                {
+                    snprintf(szStatusLine, sizeof(szStatusLine), "HTTP/1.%d %d %s\r\n", iMinor, iCode, status_string(iCode));
+                    vecStatusLine[iMinor * 500 + iCode - 100] = szStatusLine;
+                }
+            }
+        }
+        return(vecStatusLine);
+    }();
+    if (iHttpMinor < 0 || iHttpMinor > 1 || iStatusCode < 100 || iStatusCode >= 600
+            || s_vecStatusLine[iHttpMinor * 500 + iStatusCode - 100].empty())
+    {
+        return(nullptr);
+    }
+    return(&s_vecStatusLine[iHttpMinor * 500 + iStatusCode - 100]);
+}
+
+/**
+ * @brief Date响应头（每秒更新一次）
+ * @param lNow 当前时间，通常为事件循环缓存的时间
+ */
+static const std::string& date_header(time_t lNow)
+{
+    static thread_local time_t s_lDate = 0;
+    static thread_local std::string s_strDateHeader;
+    if (lNow != s_lDate)
+    {
+        struct tm stTime;
+        char szDateHeader[64];
+        gmtime_r(&lNow, &stTime);
+        strftime(szDateHeader, sizeof(szDateHeader), "Date: %a, %d %b %Y %H:%M:%S GMT\r\n", &stTime);
+        s_strDateHeader = szDateHeader;
+        s_lDate = lNow;
+    }
+    return(s_strDateHeader);
+}
+
 namespace neb
 {
 
+static const std::string s_strConnectionKeepAlive = "Connection: keep-alive\r\n";
+static const std::string s_strConnectionClose = "Connection: close\r\n";
+static const std::string s_strServerHeader = "Server: NebulaHttp\r\nAllow: POST,GET\r\n";
+
+thread_local const ModuleRouter* CodecHttp::s_pModuleRouter = nullptr;
+thread_local uint32 CodecHttp::s_uiChunkNoticeModuleNum = 0;
+thread_local std::vector<std::string> CodecHttp::s_vecHeaderBlock;
+thread_local std::vector<uint32> CodecHttp::s_vecHeaderBlockRefCount;
+thread_local time_t CodecHttp::s_lNowTime = 0;
+thread_local const std::string* CodecHttp::s_pSendingTraceId = nullptr;
+
 CodecHttp::CodecHttp(std::shared_ptr<NetLogger> pLogger, E_CODEC_TYPE eCodecType, ev_tstamp dKeepAlive)
     : Codec(pLogger, eCodecType),
       m_bChannelIsClient(false), m_uiEncodedNum(0), m_uiDecodedNum(0),
-      m_iHttpMajor(1), m_iHttpMinor(1), m_dKeepAlive(dKeepAlive)
+      m_iHttpMajor(1), m_iHttpMinor(1), m_dKeepAlive(dKeepAlive), m_llExternalBodyLength(-1), m_uiHeaderBlockId(0),
+      m_bDecoding(false), m_bChunkNoticeDecoding(false), m_bParsingHeaderValue(false),
+      m_bNativeDecoded(false)
 {
+    m_parser_setting.on_message_begin = OnMessageBegin;
+    m_parser_setting.on_url = OnUrl;
+    m_parser_setting.on_status = OnStatus;
+    m_parser_setting.on_header_field = OnHeaderField;
+    m_parser_setting.on_header_value = OnHeaderValue;
+    m_parser_setting.on_headers_complete = OnHeadersComplete;
+    m_parser_setting.on_body = OnBody;
+    m_parser_setting.on_message_complete = OnMessageComplete;
+    m_parser_setting.on_chunk_header = OnChunkHeader;
+    m_parser_setting.on_chunk_complete = OnChunkComplete;
 }
 
 CodecHttp::~CodecHttp()
@@ -122,6 +199,11 @@ E_CODEC_STATUS CodecHttp::Decode(CBuffer* pBuff, MsgHead& oMsgHead, MsgBody& oMs
     ++m_uiDecodedNum;
     HttpMsg oHttpMsg;
     E_CODEC_STATUS eCodecStatus = Decode(pBuff, oHttpMsg);
+    const NativeHttpMsg* pNativeMsg = TakeNativeHttpMsg();
+    if (nullptr != pNativeMsg)
+    {
+        pNativeMsg->ToHttpMsg(oHttpMsg);
+    }
     if (CODEC_STATUS_OK == eCodecStatus)
     {
         oMsgBody.set_data(oHttpMsg.body());
@@ -154,12 +236,23 @@ E_CODEC_STATUS CodecHttp::Encode(const HttpMsg& oHttpMsg, CBuffer* pBuff)
     {
         m_bChannelIsClient = true;
     }
+    int64 llExternalBodyLength = m_llExternalBodyLength;
+    m_llExternalBodyLength = -1;
+    uint32 uiHeaderBlockId = m_uiHeaderBlockId;
+    m_uiHeaderBlockId = 0;
+    bool bDirectHeader = m_mapAddingHttpHeader.empty();     // 无须经m_mapAddingHttpHeader去重，直接写入发送缓冲区
     if (0 == oHttpMsg.http_major())
     {
         LOG4_WARNING("miss http version!");
         m_mapAddingHttpHeader.clear();
         return(CODEC_STATUS_ERR);
     }
+    if (llExternalBodyLength >= 0 && oHttpMsg.body().size() > 0)
+    {
+        LOG4_WARNING("http body and external body can not be sent together!");
+        m_mapAddingHttpHeader.clear();
+        return(CODEC_STATUS_ERR);
+    }
 
     int iWriteSize = 0;
     int iHadEncodedSize = 0;
@@ -252,8 +345,20 @@ E_CODEC_STATUS CodecHttp::Encode(const HttpMsg& oHttpMsg, CBuffer* pBuff)
             m_mapAddingHttpHeader.clear();
             return(CODEC_STATUS_ERR);
         }
-        iWriteSize = pBuff->Printf("HTTP/%u.%u %u %s\r\n", m_iHttpMajor, m_iHttpMinor,
-                        oHttpMsg.status_code(), status_string(oHttpMsg.status_code()));
+        const std::string* pStatusLine = nullptr;
+        if (1 == m_iHttpMajor)
+        {
+            pStatusLine = status_line(m_iHttpMinor, oHttpMsg.status_code());
+        }
+        if (nullptr == pStatusLine)
+        {
+            iWriteSize = pBuff->Printf("HTTP/%u.%u %u %s\r\n", m_iHttpMajor, m_iHttpMinor,
+                            oHttpMsg.status_code(), status_string(oHttpMsg.status_code()));
+        }
+        else
+        {
+            iWriteSize = pBuff->Write(pStatusLine->data(), pStatusLine->size());
+        }
         if (iWriteSize < 0)
         {
             pBuff->SetWriteIndex(pBuff->GetWriteIndex() - iHadEncodedSize);
@@ -264,56 +369,138 @@ E_CODEC_STATUS CodecHttp::Encode(const HttpMsg& oHttpMsg, CBuffer* pBuff)
         {
             iHadEncodedSize += iWriteSize;
         }
-        if (!m_bChannelIsClient)
+        bool bHasDate = (oHttpMsg.headers().find("Date") != oHttpMsg.headers().end());
+        if (bDirectHeader)  // 默认http头整块写入
         {
-            if (m_dKeepAlive == 0)
+            if (!m_bChannelIsClient)
             {
-                m_mapAddingHttpHeader.insert(std::pair<std::string, std::string>("Connection", "close"));
+                const std::string& strConnection = (m_dKeepAlive == 0) ? s_strConnectionClose : s_strConnectionKeepAlive;
+                iWriteSize = pBuff->Write(strConnection.data(), strConnection.size());
+                if (iWriteSize < 0)
+                {
+                    pBuff->SetWriteIndex(pBuff->GetWriteIndex() - iHadEncodedSize);
+                    m_mapAddingHttpHeader.clear();
+                    return(CODEC_STATUS_ERR);
+                }
+                iHadEncodedSize += iWriteSize;
             }
-            else
+            iWriteSize = pBuff->Write(s_strServerHeader.data(), s_strServerHeader.size());
+            if (iWriteSize < 0)
+            {
+                pBuff->SetWriteIndex(pBuff->GetWriteIndex() - iHadEncodedSize);
+                m_mapAddingHttpHeader.clear();
+                return(CODEC_STATUS_ERR);
+            }
+            iHadEncodedSize += iWriteSize;
+            if (!bHasDate)
+            {
+                const std::string& strDate = date_header((s_lNowTime > 0) ? s_lNowTime : time(nullptr));
+                iWriteSize = pBuff->Write(strDate.data(), strDate.size());
+                if (iWriteSize < 0)
+                {
+                    pBuff->SetWriteIndex(pBuff->GetWriteIndex() - iHadEncodedSize);
+                    m_mapAddingHttpHeader.clear();
+                    return(CODEC_STATUS_ERR);
+                }
+                iHadEncodedSize += iWriteSize;
+            }
+        }
+        else
+        {
+            if (!m_bChannelIsClient)
+            {
+                if (m_dKeepAlive == 0)
+                {
+                    m_mapAddingHttpHeader.insert(std::pair<std::string, std::string>("Connection", "close"));
+                }
+                else
+                {
+                    m_mapAddingHttpHeader.insert(std::pair<std::string, std::string>("Connection", "keep-alive"));
+                }
+            }
+            m_mapAddingHttpHeader.insert(std::make_pair("Server", "NebulaHttp"));
+            m_mapAddingHttpHeader.insert(std::make_pair("Allow", "POST,GET"));
+            if (!bHasDate)
             {
-                m_mapAddingHttpHeader.insert(std::pair<std::string, std::string>("Connection", "keep-alive"));
+                const std::string& strDate = date_header((s_lNowTime > 0) ? s_lNowTime : time(nullptr));
+                m_mapAddingHttpHeader.insert(std::make_pair("Date", strDate.substr(6, strDate.size() - 8)));
             }
         }
-        m_mapAddingHttpHeader.insert(std::make_pair("Server", "NebulaHttp"));
-        m_mapAddingHttpHeader.insert(std::make_pair("Allow", "POST,GET"));
         //m_mapAddingHttpHeader.insert(std::make_pair("Content-Type", "application/json;charset=UTF-8"));
+        if (uiHeaderBlockId > 0 && uiHeaderBlockId <= s_vecHeaderBlock.size())
+        {
+            const std::string& strHeaderBlock = s_vecHeaderBlock[uiHeaderBlockId - 1];
+            iWriteSize = pBuff->Write(strHeaderBlock.data(), strHeaderBlock.size());
+            if (iWriteSize < 0)
+            {
+                pBuff->SetWriteIndex(pBuff->GetWriteIndex() - iHadEncodedSize);
+                m_mapAddingHttpHeader.clear();
+                return(CODEC_STATUS_ERR);
+            }
+            iHadEncodedSize += iWriteSize;
+        }
     }
     bool bIsChunked = false;
     bool bIsGzip = false;   // 是否用gizp压缩传输包
-    for (auto h_iter = oHttpMsg.headers().begin(); h_iter != oHttpMsg.headers().end(); ++h_iter)
+    if (bDirectHeader)
+    {
+        for (auto h_iter = oHttpMsg.headers().begin(); h_iter != oHttpMsg.headers().end(); ++h_iter)
+        {
+            if (h_iter->first == "Content-Length" || h_iter->first == "Host")
+            {
+                continue;
+            }
+            if (HTTP_RESPONSE == oHttpMsg.type() && (h_iter->first == "Connection"
+                    || h_iter->first == "Server" || h_iter->first == "Allow"))
+            {
+                continue;   // 与已写入的默认http头重复
+            }
+            iWriteSize = EncodeHeader(h_iter->first, h_iter->second, llExternalBodyLength, bIsGzip, bIsChunked, pBuff);
+            if (iWriteSize < 0)
+            {
+                pBuff->SetWriteIndex(pBuff->GetWriteIndex() - iHadEncodedSize);
+                return(CODEC_STATUS_ERR);
+            }
+            iHadEncodedSize += iWriteSize;
+        }
+    }
+    else
     {
-        if (h_iter->first == "Content-Length" || h_iter->first == "Host")
+        for (auto h_iter = oHttpMsg.headers().begin(); h_iter != oHttpMsg.headers().end(); ++h_iter)
         {
-            continue;
+            if (h_iter->first == "Content-Length" || h_iter->first == "Host")
+            {
+                continue;
+            }
+            auto h_a_iter = m_mapAddingHttpHeader.find(h_iter->first);
+            if (h_a_iter == m_mapAddingHttpHeader.end())
+            {
+                m_mapAddingHttpHeader.insert(std::make_pair(h_iter->first, h_iter->second));
+            }
         }
-        auto h_a_iter = m_mapAddingHttpHeader.find(h_iter->first);
-        if (h_a_iter == m_mapAddingHttpHeader.end())
+        for (auto h_iter = m_mapAddingHttpHeader.begin(); h_iter != m_mapAddingHttpHeader.end(); ++h_iter)
         {
-            m_mapAddingHttpHeader.insert(std::make_pair(h_iter->first, h_iter->second));
+            iWriteSize = EncodeHeader(h_iter->first, h_iter->second, llExternalBodyLength, bIsGzip, bIsChunked, pBuff);
+            if (iWriteSize < 0)
+            {
+                pBuff->SetWriteIndex(pBuff->GetWriteIndex() - iHadEncodedSize);
+                m_mapAddingHttpHeader.clear();
+                return(CODEC_STATUS_ERR);
+            }
+            iHadEncodedSize += iWriteSize;
         }
     }
-    for (auto h_iter = m_mapAddingHttpHeader.begin(); h_iter != m_mapAddingHttpHeader.end(); ++h_iter)
+    if (nullptr != s_pSendingTraceId && s_pSendingTraceId->size() > 0
+            && oHttpMsg.headers().find("x-trace-id") == oHttpMsg.headers().end())
     {
-        iWriteSize = pBuff->Printf("%s: %s\r\n", h_iter->first.c_str(), h_iter->second.c_str());
+        iWriteSize = pBuff->Printf("x-trace-id: %s\r\n", s_pSendingTraceId->c_str());
         if (iWriteSize < 0)
         {
             pBuff->SetWriteIndex(pBuff->GetWriteIndex() - iHadEncodedSize);
             m_mapAddingHttpHeader.clear();
             return(CODEC_STATUS_ERR);
         }
-        else
-        {
-            iHadEncodedSize += iWriteSize;
-        }
-        if (std::string("Content-Encoding") == h_iter->first && std::string("gzip") == h_iter->second)
-        {
-            bIsGzip = true;
-        }
-        if (std::string("Transfer-Encoding") == h_iter->first && std::string("chunked") == h_iter->second)
-        {
-            bIsChunked = true;
-        }
+        iHadEncodedSize += iWriteSize;
     }
     if (oHttpMsg.body().size() > 0)
     {
@@ -514,6 +701,20 @@ E_CODEC_STATUS CodecHttp::Encode(const HttpMsg& oHttpMsg, CBuffer* pBuff)
                 iHadEncodedSize += iWriteSize;
             }
         }
+        else if (llExternalBodyLength > 0)
+        {
+            iWriteSize = pBuff->Printf("Content-Length: %lld\r\n\r\n", llExternalBodyLength);
+            if (iWriteSize < 0)
+            {
+                pBuff->SetWriteIndex(pBuff->GetWriteIndex() - iHadEncodedSize);
+                m_mapAddingHttpHeader.clear();
+                return(CODEC_STATUS_ERR);
+            }
+            else
+            {
+                iHadEncodedSize += iWriteSize;
+            }
+        }
         else
         {
             iWriteSize = pBuff->Printf("Content-Length: 0\r\n\r\n");
@@ -541,43 +742,63 @@ E_CODEC_STATUS CodecHttp::Encode(const HttpMsg& oHttpMsg, CBuffer* pBuff)
 
 E_CODEC_STATUS CodecHttp::Decode(CBuffer* pBuff, HttpMsg& oHttpMsg)
 {
-    LOG4_TRACE(" ");
+    LOG4_TRACE("pBuff->ReadableBytes() = %u", pBuff->ReadableBytes());
     if (pBuff->ReadableBytes() == 0)
     {
         return(CODEC_STATUS_PAUSE);
     }
-    ++m_uiDecodedNum;
-    m_parser_setting.on_message_begin = OnMessageBegin;
-    m_parser_setting.on_url = OnUrl;
-    m_parser_setting.on_status = OnStatus;
-    m_parser_setting.on_header_field = OnHeaderField;
-    m_parser_setting.on_header_value = OnHeaderValue;
-    m_parser_setting.on_headers_complete = OnHeadersComplete;
-    m_parser_setting.on_body = OnBody;
-    m_parser_setting.on_message_complete = OnMessageComplete;
-    m_parser_setting.on_chunk_header = OnChunkHeader;
-    m_parser_setting.on_chunk_complete = OnChunkComplete;
-    m_parser.data = &oHttpMsg;
-    http_parser_init(&m_parser, HTTP_BOTH);
-    const char* pDecodeBuff = pBuff->GetRawReadBuffer();
-    size_t uiDecodeBuffLen = pBuff->ReadableBytes();
+    m_bNativeDecoded = false;
+    if (!m_bDecoding && !m_bChannelIsClient && ScanRequest(pBuff, m_oNativeHttpMsg))
+    {
+        m_iHttpMajor = m_oNativeHttpMsg.iHttpMajor;
+        m_iHttpMinor = m_oNativeHttpMsg.iHttpMinor;
+        m_dKeepAlive = (m_oNativeHttpMsg.fKeepAlive > 0) ? m_oNativeHttpMsg.fKeepAlive : m_dKeepAlive;
+        m_bNativeDecoded = true;
+        return(CODEC_STATUS_OK);    // 解码结果须由TakeNativeHttpMsg()取出
+    }
+    if (!m_bDecoding)   // 新消息
+    {
+        ++m_uiDecodedNum;
+        m_oParsingHttpMsg.Clear();
+        m_strParsingHeaderName.clear();
+        m_strParsingHeaderValue.clear();
+        m_bParsingHeaderValue = false;
+        http_parser_init(&m_parser, HTTP_BOTH);
+        m_parser.data = this;
+        m_bDecoding = true;
+    }
+    // 已解析的数据均已转存到m_oParsingHttpMsg，无论消息是否完整都从缓冲区移除，下次从断点处继续解析
     size_t uiLen = http_parser_execute(&m_parser, &m_parser_setting,
-                    pDecodeBuff, uiDecodeBuffLen);
-    if (!oHttpMsg.is_decoding())
+                    pBuff->GetRawReadBuffer(), pBuff->ReadableBytes());
+    pBuff->AdvanceReadIndex(uiLen);
+    if (HPE_PAUSED == m_parser.http_errno)
     {
-        if(m_parser.http_errno != HPE_OK)
-        {
-            LOG4_WARNING("Failed to parse http message for cause:%s",
-                            http_errno_name((http_errno)m_parser.http_errno));
-            return(CODEC_STATUS_ERR);
-        }
-        pBuff->AdvanceReadIndex(uiLen);
+        http_parser_pause(&m_parser, 0);
     }
-    else
+    else if (HPE_OK != m_parser.http_errno)
+    {
+        LOG4_WARNING("Failed to parse http message for cause:%s",
+                        http_errno_name((http_errno)m_parser.http_errno));
+        m_bDecoding = false;
+        m_bChunkNoticeDecoding = false;
+        m_oParsingHttpMsg.Clear();
+        return(CODEC_STATUS_ERR);
+    }
+    if (m_oParsingHttpMsg.chunk_notice())
+    {
+        return(DecodeChunkNotice(oHttpMsg));
+    }
+    if (m_bDecoding)
     {
         LOG4_TRACE("decoding...");
         return(CODEC_STATUS_PAUSE);
     }
+    TakeParsingMsg(oHttpMsg);
+    return(DecodeCompleted(oHttpMsg));
+}
+
+E_CODEC_STATUS CodecHttp::DecodeCompleted(HttpMsg& oHttpMsg)
+{
     if (HTTP_REQUEST == oHttpMsg.type())
     {
         m_iHttpMajor = oHttpMsg.http_major();
@@ -605,6 +826,266 @@ E_CODEC_STATUS CodecHttp::Decode(CBuffer* pBuff, HttpMsg& oHttpMsg)
     return(CODEC_STATUS_OK);
 }
 
+E_CODEC_STATUS CodecHttp::DecodeEof(HttpMsg& oHttpMsg)
+{
+    LOG4_TRACE(" ");
+    if (!m_bDecoding)
+    {
+        return(CODEC_STATUS_EOF);
+    }
+    // 通知解析器连接已关闭，无Content-Length的http1.0响应以此结束
+    http_parser_execute(&m_parser, &m_parser_setting, NULL, 0);
+    if (m_bDecoding)
+    {
+        LOG4_WARNING("incomplete http message at eof.");
+    }
+    m_bDecoding = false;
+    m_bChunkNoticeDecoding = false;
+    TakeParsingMsg(oHttpMsg);
+    oHttpMsg.set_is_decoding(false);
+    return(CODEC_STATUS_EOF);
+}
+
+E_CODEC_STATUS CodecHttp::DecodeChunkNotice(HttpMsg& oHttpMsg)
+{
+    if (!m_bChunkNoticeDecoding)    // 分块通知的http头解析完毕
+    {
+        m_bChunkNoticeDecoding = true;
+        oHttpMsg.CopyFrom(m_oParsingHttpMsg);
+        oHttpMsg.set_is_decoding(true);
+        oHttpMsg.set_encoding(0);
+        m_oParsingHttpMsg.set_encoding(0);
+        m_iHttpMajor = oHttpMsg.http_major();
+        m_iHttpMinor = oHttpMsg.http_minor();
+        m_dKeepAlive = (oHttpMsg.keep_alive() > 0) ? oHttpMsg.keep_alive() : m_dKeepAlive;
+        LOG4_DEBUG("%s", ToString(oHttpMsg).c_str());
+        return(CODEC_STATUS_PART_OK);
+    }
+    if (m_bDecoding && m_oParsingHttpMsg.body().size() == 0)
+    {
+        return(CODEC_STATUS_PAUSE);
+    }
+    oHttpMsg.set_type(m_oParsingHttpMsg.type());
+    oHttpMsg.set_method(m_oParsingHttpMsg.method());
+    oHttpMsg.set_http_major(m_oParsingHttpMsg.http_major());
+    oHttpMsg.set_http_minor(m_oParsingHttpMsg.http_minor());
+    oHttpMsg.set_keep_alive(m_oParsingHttpMsg.keep_alive());
+    oHttpMsg.set_url(m_oParsingHttpMsg.url());
+    oHttpMsg.set_path(m_oParsingHttpMsg.path());
+    oHttpMsg.set_chunk_notice(true);
+    oHttpMsg.set_is_decoding(m_bDecoding);
+    oHttpMsg.set_encoding(m_oParsingHttpMsg.encoding() + 1);
+    m_oParsingHttpMsg.set_encoding(oHttpMsg.encoding());
+    oHttpMsg.mutable_body()->swap(*m_oParsingHttpMsg.mutable_body());
+    m_oParsingHttpMsg.mutable_body()->clear();
+    if (m_bDecoding)
+    {
+        return(CODEC_STATUS_PART_OK);
+    }
+    m_bChunkNoticeDecoding = false;
+    m_oParsingHttpMsg.Clear();
+    return(CODEC_STATUS_OK);
+}
+
+bool CodecHttp::ScanRequest(CBuffer* pBuff, NativeHttpMsg& oNativeMsg)
+{
+    static thread_local HttpRequestScanner s_oRequestScanner;     // 扫描结果在本函数内用完，各连接共用
+    int iHeadLen = s_oRequestScanner.Scan(pBuff->GetRawReadBuffer(), pBuff->ReadableBytes());
+    if (iHeadLen < 0 || 0 == s_oRequestScanner.GetHttpMinor()
+            || HTTP_CONNECT == s_oRequestScanner.GetMethod())
+    {
+        return(false);  // 请求头不完整、http1.0或CONNECT等交由http_parser处理
+    }
+    uint64 ullContentLength = 0;
+    bool bHasContentLength = false;
+    float fKeepAlive = 0.0;
+    for (int i = 0; i < s_oRequestScanner.GetHeaderNum(); ++i)
+    {
+        const HttpHeaderView& stHeader = s_oRequestScanner.GetHeader(i);
+        if (stHeader.stName.EqualsIgnoreCase("Content-Length", 14))
+        {
+            if (bHasContentLength || 0 == stHeader.stValue.uiLen || stHeader.stValue.uiLen > 18)
+            {
+                return(false);
+            }
+            for (size_t j = 0; j < stHeader.stValue.uiLen; ++j)
+            {
+                char c = stHeader.stValue.pData[j];
+                if (c < '0' || c > '9')
+                {
+                    return(false);
+                }
+                ullContentLength = ullContentLength * 10 + (c - '0');
+            }
+            bHasContentLength = true;
+        }
+        else if (stHeader.stName.EqualsIgnoreCase("Transfer-Encoding", 17)
+                || stHeader.stName.EqualsIgnoreCase("Upgrade", 7)
+                || stHeader.stName.EqualsIgnoreCase("Content-Encoding", 16))
+        {
+            return(false);  // chunked包体、协议升级和压缩包体交由http_parser处理
+        }
+        else if (stHeader.stName.EqualsIgnoreCase("Connection", 10))
+        {
+            if (stHeader.stValue.uiLen == 10 && 0 == memcmp(stHeader.stValue.pData, "keep-alive", 10))
+            {
+                fKeepAlive = -1;    // 由配置的IoTimeout决定
+            }
+            else if (stHeader.stValue.uiLen == 5 && 0 == memcmp(stHeader.stValue.pData, "close", 5))
+            {
+                fKeepAlive = 0.0;
+            }
+        }
+        else if (stHeader.stName.EqualsIgnoreCase("Keep-Alive", 10))
+        {
+            fKeepAlive = atof(std::string(stHeader.stValue.pData, stHeader.stValue.uiLen).c_str());
+        }
+    }
+    if ((uint64)iHeadLen + ullContentLength > pBuff->ReadableBytes())
+    {
+        return(false);  // 包体不完整，交由http_parser断点续解
+    }
+    oNativeMsg.Clear();
+    oNativeMsg.stUrl = s_oRequestScanner.GetUrl();
+    struct http_parser_url stUrl;
+    if (0 == http_parser_parse_url(oNativeMsg.stUrl.pData, oNativeMsg.stUrl.uiLen, 0, &stUrl))
+    {
+        if (stUrl.field_set & (1 << UF_PATH))
+        {
+            oNativeMsg.stPath.pData = oNativeMsg.stUrl.pData + stUrl.field_data[UF_PATH].off;
+            oNativeMsg.stPath.uiLen = stUrl.field_data[UF_PATH].len;
+        }
+        if (stUrl.field_set & (1 << UF_QUERY))
+        {
+            oNativeMsg.stQuery.pData = oNativeMsg.stUrl.pData + stUrl.field_data[UF_QUERY].off;
+            oNativeMsg.stQuery.uiLen = stUrl.field_data[UF_QUERY].len;
+        }
+    }
+    if (IsChunkNoticePath(oNativeMsg.stPath.pData, oNativeMsg.stPath.uiLen, s_oRequestScanner.GetMethod()))
+    {
+        return(false);
+    }
+    ++m_uiDecodedNum;
+    oNativeMsg.iType = HTTP_REQUEST;
+    oNativeMsg.iMethod = s_oRequestScanner.GetMethod();
+    oNativeMsg.iHttpMajor = 1;
+    oNativeMsg.iHttpMinor = s_oRequestScanner.GetHttpMinor();
+    oNativeMsg.fKeepAlive = fKeepAlive;
+    for (int i = 0; i < s_oRequestScanner.GetHeaderNum(); ++i)
+    {
+        oNativeMsg.AddHeader(s_oRequestScanner.GetHeader(i));
+    }
+    if (ullContentLength > 0)
+    {
+        oNativeMsg.stBody.pData = pBuff->GetRawReadBuffer() + iHeadLen;
+        oNativeMsg.stBody.uiLen = ullContentLength;
+    }
+    // 已解码数据移出可读区间但仍留在缓冲区内存中，视图在下次读取数据之前有效
+    pBuff->AdvanceReadIndex(iHeadLen + ullContentLength);
+    return(true);
+}
+
+void CodecHttp::TakeParsingMsg(HttpMsg& oHttpMsg)
+{
+    // body可能很大，交换而不是拷贝；其余字段经MergeFrom()拷贝（oHttpMsg可能分配在Arena上）
+    oHttpMsg.mutable_body()->swap(*m_oParsingHttpMsg.mutable_body());
+    m_oParsingHttpMsg.clear_body();
+    oHttpMsg.MergeFrom(m_oParsingHttpMsg);
+    m_oParsingHttpMsg.Clear();
+}
+
+int CodecHttp::EncodeHeader(const std::string& strHeaderName, const std::string& strHeaderValue,
+        int64 llExternalBodyLength, bool& bIsGzip, bool& bIsChunked, CBuffer* pBuff)
+{
+    if (std::string("Transfer-Encoding") == strHeaderName)
+    {
+        if (llExternalBodyLength >= 0)
+        {
+            return(0);  // 外部body以Content-Length方式发送
+        }
+        if (std::string("chunked") == strHeaderValue)
+        {
+            bIsChunked = true;
+        }
+    }
+    else if (std::string("Content-Encoding") == strHeaderName && std::string("gzip") == strHeaderValue)
+    {
+        bIsGzip = true;
+    }
+    size_t uiWriteIndex = pBuff->GetWriteIndex();
+    if (pBuff->Write(strHeaderName.data(), strHeaderName.size()) < 0
+            || pBuff->Write(": ", 2) < 0
+            || pBuff->Write(strHeaderValue.data(), strHeaderValue.size()) < 0
+            || pBuff->Write("\r\n", 2) < 0)
+    {
+        pBuff->SetWriteIndex(uiWriteIndex);
+        return(-1);
+    }
+    return(pBuff->GetWriteIndex() - uiWriteIndex);
+}
+
+uint32 CodecHttp::RegisterHeaderBlock(const std::unordered_map<std::string, std::string>& mapHeader)
+{
+    std::string strHeaderBlock;
+    for (auto iter = mapHeader.begin(); iter != mapHeader.end(); ++iter)
+    {
+        strHeaderBlock.append(iter->first);
+        strHeaderBlock.append(": ");
+        strHeaderBlock.append(iter->second);
+        strHeaderBlock.append("\r\n");
+    }
+    // 模块重新加载时注册的头块通常与之前相同，复用已有头块；已释放的位置优先复用
+    size_t uiFreeIndex = s_vecHeaderBlock.size();
+    for (size_t i = 0; i < s_vecHeaderBlock.size(); ++i)
+    {
+        if (s_vecHeaderBlockRefCount[i] > 0 && s_vecHeaderBlock[i] == strHeaderBlock)
+        {
+            ++s_vecHeaderBlockRefCount[i];
+            return(i + 1);
+        }
+        if (0 == s_vecHeaderBlockRefCount[i] && uiFreeIndex == s_vecHeaderBlock.size())
+        {
+            uiFreeIndex = i;
+        }
+    }
+    if (uiFreeIndex == s_vecHeaderBlock.size())
+    {
+        s_vecHeaderBlock.push_back(strHeaderBlock);
+        s_vecHeaderBlockRefCount.push_back(1);
+    }
+    else
+    {
+        s_vecHeaderBlock[uiFreeIndex] = strHeaderBlock;
+        s_vecHeaderBlockRefCount[uiFreeIndex] = 1;
+    }
+    return(uiFreeIndex + 1);
+}
+
+void CodecHttp::ReleaseHeaderBlock(uint32 uiHeaderBlockId)
+{
+    if (uiHeaderBlockId == 0 || uiHeaderBlockId > s_vecHeaderBlock.size()
+            || 0 == s_vecHeaderBlockRefCount[uiHeaderBlockId - 1])
+    {
+        return;
+    }
+    if (0 == --s_vecHeaderBlockRefCount[uiHeaderBlockId - 1])
+    {
+        std::string strEmpty;
+        s_vecHeaderBlock[uiHeaderBlockId - 1].swap(strEmpty);
+    }
+}
+
+bool CodecHttp::IsChunkNoticePath(const char* szPath, size_t uiPathLen, int iMethod)
+{
+    if (0 == s_uiChunkNoticeModuleNum || nullptr == s_pModuleRouter)
+    {
+        return(false);
+    }
+    RouteMatch stRouteMatch;
+    Module* pModule = s_pModuleRouter->Match(szPath, uiPathLen, iMethod, stRouteMatch);
+    return(pModule != nullptr && pModule->WithChunkNotice());
+}
+
 void CodecHttp::AddHttpHeader(const std::string& strHeaderName, const std::string& strHeaderValue)
 {
     m_mapAddingHttpHeader.insert(std::pair<std::string, std::string>(strHeaderName, strHeaderValue));
@@ -674,136 +1155,98 @@ bool CodecHttp::CloseRightAway() const
 
 int CodecHttp::OnMessageBegin(http_parser *parser)
 {
-    HttpMsg* pHttpMsg = (HttpMsg*) parser->data;
-    pHttpMsg->set_is_decoding(true);
+    CodecHttp* pCodec = (CodecHttp*) parser->data;
+    pCodec->m_oParsingHttpMsg.set_is_decoding(true);
     return(0);
 }
 
 int CodecHttp::OnUrl(http_parser *parser, const char *at, size_t len)
 {
-    HttpMsg* pHttpMsg = (HttpMsg*) parser->data;
-    pHttpMsg->set_url(at, len);
-    struct http_parser_url stUrl;
-    if(0 == http_parser_parse_url(at, len, 0, &stUrl))
-    {
-//        if(stUrl.field_set & (1 << UF_PORT))
-//        {
-//            pHttpMsg->set_port(stUrl.port);
-//        }
-//        else
-//        {
-//            pHttpMsg->set_port(80);
-//        }
-//
-//        if(stUrl.field_set & (1 << UF_HOST) )
-//        {
-//            char* host = (char*)malloc(stUrl.field_data[UF_HOST].len+1);
-//            strncpy(host, at+stUrl.field_data[UF_HOST].off, stUrl.field_data[UF_HOST].len);
-//            host[stUrl.field_data[UF_HOST].len] = 0;
-//            pHttpMsg->set_host(host, stUrl.field_data[UF_HOST].len+1);
-//            free(host);
-//        }
-
-        if(stUrl.field_set & (1 << UF_PATH))
-        {
-            char *path = (char*)malloc(stUrl.field_data[UF_PATH].len);
-            strncpy(path, at+stUrl.field_data[UF_PATH].off, stUrl.field_data[UF_PATH].len);
-            pHttpMsg->set_path(path, stUrl.field_data[UF_PATH].len);
-            free(path);
-        }
-
-        if (stUrl.field_set & (1 << UF_QUERY))
-        {
-            std::string strQuery;
-            strQuery.assign(at+stUrl.field_data[UF_QUERY].off, stUrl.field_data[UF_QUERY].len);
-            std::map<std::string, std::string> mapParam;
-            DecodeParameter(strQuery, mapParam);
-            for (auto it = mapParam.begin(); it != mapParam.end(); ++it)
-            {
-                (*pHttpMsg->mutable_params())[it->first] = it->second;
-            }
-        }
-    }
-    return 0;
+    // url可能跨越多次Decode()，先拼接，待http头解析完毕再解析path和参数
+    CodecHttp* pCodec = (CodecHttp*) parser->data;
+    pCodec->m_oParsingHttpMsg.mutable_url()->append(at, len);
+    return(0);
 }
 
 int CodecHttp::OnStatus(http_parser *parser, const char *at, size_t len)
 {
-    HttpMsg* pHttpMsg = (HttpMsg*) parser->data;
-    pHttpMsg->set_status_code(parser->status_code);
+    CodecHttp* pCodec = (CodecHttp*) parser->data;
+    pCodec->m_oParsingHttpMsg.set_status_code(parser->status_code);
     return(0);
 }
 
 int CodecHttp::OnHeaderField(http_parser *parser, const char *at, size_t len)
 {
-    HttpMsg* pHttpMsg = (HttpMsg*) parser->data;
-    pHttpMsg->set_body(at, len);        // 用body暂存head_name，解析完head_value后再填充到head里
+    CodecHttp* pCodec = (CodecHttp*) parser->data;
+    if (pCodec->m_bParsingHeaderValue)
+    {
+        AddParsedHeader(&pCodec->m_oParsingHttpMsg, pCodec->m_strParsingHeaderName, pCodec->m_strParsingHeaderValue);
+        pCodec->m_strParsingHeaderName.clear();
+        pCodec->m_strParsingHeaderValue.clear();
+        pCodec->m_bParsingHeaderValue = false;
+    }
+    pCodec->m_strParsingHeaderName.append(at, len);
     return(0);
 }
 
 int CodecHttp::OnHeaderValue(http_parser *parser, const char *at, size_t len)
 {
-    HttpMsg* pHttpMsg = (HttpMsg*) parser->data;
-    std::string strHeadName = pHttpMsg->body();
-    std::string strHeadValue;
-    strHeadValue.assign(at, len);
-    pHttpMsg->set_body("");
-    pHttpMsg->mutable_headers()->insert(google::protobuf::MapPair<std::string, std::string>(strHeadName, strHeadValue));
-    if (strHeadName == std::string("Keep-Alive"))
+    CodecHttp* pCodec = (CodecHttp*) parser->data;
+    pCodec->m_bParsingHeaderValue = true;
+    pCodec->m_strParsingHeaderValue.append(at, len);
+    return(0);
+}
+
+int CodecHttp::OnHeadersComplete(http_parser *parser)
+{
+    CodecHttp* pCodec = (CodecHttp*) parser->data;
+    HttpMsg* pHttpMsg = &pCodec->m_oParsingHttpMsg;
+    if (pCodec->m_bParsingHeaderValue)
     {
-        pHttpMsg->set_keep_alive(atof(strHeadValue.c_str()));
+        AddParsedHeader(pHttpMsg, pCodec->m_strParsingHeaderName, pCodec->m_strParsingHeaderValue);
+        pCodec->m_strParsingHeaderName.clear();
+        pCodec->m_strParsingHeaderValue.clear();
+        pCodec->m_bParsingHeaderValue = false;
     }
-    else if (std::string("Connection") == strHeadName)
+    if (pHttpMsg->url().size() > 0)
     {
-        if (std::string("keep-alive") == strHeadValue)
-        {
-            pHttpMsg->set_keep_alive(-1);     // 由配置的IoTimeout决定
-        }
-        else if (std::string("close") == strHeadValue)
-        {
-            pHttpMsg->set_keep_alive(0.0);
-        }
-
-        size_t uiPos = 0;
-        uiPos = strHeadValue.find_first_of("Upgrade");
-        if (0 == uiPos)
-        {
-            pHttpMsg->mutable_upgrade()->set_is_upgrade(true);
-        }
-        else
-        {
-            pHttpMsg->mutable_upgrade()->set_is_upgrade(false);
-        }
+        ParseUrl(pHttpMsg);
     }
-    else if (std::string("Upgrade") == strHeadName)
+    if (0 == parser->status_code && s_uiChunkNoticeModuleNum > 0)
     {
-        pHttpMsg->mutable_upgrade()->set_protocol(strHeadValue);
+        if (IsChunkNoticePath(pHttpMsg->path().data(), pHttpMsg->path().size(), parser->method))
+        {
+            pHttpMsg->set_method(parser->method);
+            pHttpMsg->set_type(HTTP_REQUEST);
+            pHttpMsg->set_http_major(parser->http_major);
+            pHttpMsg->set_http_minor(parser->http_minor);
+            pHttpMsg->set_chunk_notice(true);
+            if (!http_should_keep_alive(parser))
+            {
+                pHttpMsg->set_keep_alive(0.0);
+            }
+            http_parser_pause(parser, 1);   // 先通知http头，包体在后续Decode()中分块通知
+        }
     }
     return(0);
 }
 
-int CodecHttp::OnHeadersComplete(http_parser *parser)
-{
-    return(0);
-}
-
 int CodecHttp::OnBody(http_parser *parser, const char *at, size_t len)
 {
-    HttpMsg* pHttpMsg = (HttpMsg*) parser->data;
-    if (pHttpMsg->body().size() > 0)
-    {
-        pHttpMsg->mutable_body()->append(at, len);
-    }
-    else
+    CodecHttp* pCodec = (CodecHttp*) parser->data;
+    HttpMsg* pHttpMsg = &pCodec->m_oParsingHttpMsg;
+    pHttpMsg->mutable_body()->append(at, len);
+    if (pHttpMsg->chunk_notice() && pHttpMsg->body().size() >= (size_t)gc_iMaxBuffLen)
     {
-        pHttpMsg->set_body(at, len);
+        http_parser_pause(parser, 1);   // 分块通知的包体缓存有上限
     }
     return(0);
 }
 
 int CodecHttp::OnMessageComplete(http_parser *parser)
 {
-    HttpMsg* pHttpMsg = (HttpMsg*) parser->data;
+    CodecHttp* pCodec = (CodecHttp*) parser->data;
+    HttpMsg* pHttpMsg = &pCodec->m_oParsingHttpMsg;
     if (0 != parser->status_code)
     {
         pHttpMsg->set_status_code(parser->status_code);
@@ -817,31 +1260,74 @@ int CodecHttp::OnMessageComplete(http_parser *parser)
     pHttpMsg->set_http_major(parser->http_major);
     pHttpMsg->set_http_minor(parser->http_minor);
     pHttpMsg->set_is_decoding(false);
+    pCodec->m_bDecoding = false;
 
     if (!http_should_keep_alive(parser))
     {
         pHttpMsg->set_keep_alive(0.0); 
     }
-    /*
-    switch ((http_method)pHttpMsg->method())
+    http_parser_pause(parser, 1);   // 一次只解析一个消息，pipeline的后续消息留在缓冲区由下次Decode()解析
+    return(0);
+}
+
+void CodecHttp::ParseUrl(HttpMsg* pHttpMsg)
+{
+    struct http_parser_url stUrl;
+    const std::string& strUrl = pHttpMsg->url();
+    if(0 == http_parser_parse_url(strUrl.data(), strUrl.size(), 0, &stUrl))
     {
-        case HTTP_GET:
-        case HTTP_OPTIONS:
-            pHttpMsg->set_is_decoding(false);
-            break;
-        default:
-            if (parser->content_length == 0)
-            {
-                pHttpMsg->set_is_decoding(false);
-            }
-            else if (parser->content_length == pHttpMsg->body().size())
+        if(stUrl.field_set & (1 << UF_PATH))
+        {
+            pHttpMsg->set_path(strUrl.data() + stUrl.field_data[UF_PATH].off, stUrl.field_data[UF_PATH].len);
+        }
+
+        if (stUrl.field_set & (1 << UF_QUERY))
+        {
+            std::string strQuery;
+            strQuery.assign(strUrl.data() + stUrl.field_data[UF_QUERY].off, stUrl.field_data[UF_QUERY].len);
+            std::map<std::string, std::string> mapParam;
+            DecodeParameter(strQuery, mapParam);
+            for (auto it = mapParam.begin(); it != mapParam.end(); ++it)
             {
-                pHttpMsg->set_is_decoding(false);
+                (*pHttpMsg->mutable_params())[it->first] = it->second;
             }
-            break;
+        }
+    }
+}
+
+void CodecHttp::AddParsedHeader(HttpMsg* pHttpMsg, const std::string& strHeadName, const std::string& strHeadValue)
+{
+    pHttpMsg->mutable_headers()->insert(google::protobuf::MapPair<std::string, std::string>(strHeadName, strHeadValue));
+    if (strHeadName == std::string("Keep-Alive"))
+    {
+        pHttpMsg->set_keep_alive(atof(strHeadValue.c_str()));
+    }
+    else if (std::string("Connection") == strHeadName)
+    {
+        if (std::string("keep-alive") == strHeadValue)
+        {
+            pHttpMsg->set_keep_alive(-1);     // 由配置的IoTimeout决定
+        }
+        else if (std::string("close") == strHeadValue)
+        {
+            pHttpMsg->set_keep_alive(0.0);
+        }
+
+        size_t uiPos = 0;
+        uiPos = strHeadValue.find_first_of("Upgrade");
+        if (0 == uiPos)
+        {
+            pHttpMsg->mutable_upgrade()->set_is_upgrade(true);
+        }
+        else
+        {
+            pHttpMsg->mutable_upgrade()->set_is_upgrade(false);
+        }
+    }
+    else if (std::string("Upgrade") == strHeadName)
+    {
+        pHttpMsg->mutable_upgrade()->set_protocol(strHeadValue);
     }
-    */
-    return(0);
 }
 
 int CodecHttp::OnChunkHeader(http_parser *parser)
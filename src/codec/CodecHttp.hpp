@@ -10,13 +10,18 @@
 #ifndef SRC_CODEC_CODECHTTP_HPP_
 #define SRC_CODEC_CODECHTTP_HPP_
 
+#include <vector>
 #include "util/http/http_parser.h"
+#include "util/http/HttpRequestScanner.hpp"
+#include "NativeHttpMsg.hpp"
 #include "pb/http.pb.h"
 #include "Codec.hpp"
 
 namespace neb
 {
 
+class ModuleRouter;
+
 class CodecHttp: public Codec
 {
 public:
@@ -35,8 +40,122 @@ public:
      */
     virtual void AddHttpHeader(const std::string& strHeaderName, const std::string& strHeaderValue);
 
+    /**
+     * @brief 设置外部body长度
+     * @note 在encode前调用，用于body不在HttpMsg内（如文件区间）的消息，encode时只编码
+     * http头并以此长度作为Content-Length，encode之后失效。
+     */
+    void SetExternalBodyLength(int64 llBodyLength)
+    {
+        m_llExternalBodyLength = llBodyLength;
+    }
+
     const std::string& ToString(const HttpMsg& oHttpMsg);
 
+    /**
+     * @brief 取出快速解码得到的轻量http请求
+     * @note Decode()返回CODEC_STATUS_OK时，若请求经HttpRequestScanner快速解码，则解码结果
+     * 存放于NativeHttpMsg而不填充HttpMsg，须调用此函数取出（只能取一次）。
+     * @return 轻量http请求，上次Decode()结果在HttpMsg中则返回nullptr
+     */
+    const NativeHttpMsg* TakeNativeHttpMsg()
+    {
+        if (m_bNativeDecoded)
+        {
+            m_bNativeDecoded = false;
+            return(&m_oNativeHttpMsg);
+        }
+        return(nullptr);
+    }
+
+    /**
+     * @brief 设置下一个encode的http响应附加的预编码http头块
+     * @note 只对紧接着的一次Encode()有效。
+     * @param uiHeaderBlockId RegisterHeaderBlock()返回的http头块编号
+     */
+    void SetHeaderBlock(uint32 uiHeaderBlockId)
+    {
+        m_uiHeaderBlockId = uiHeaderBlockId;
+    }
+
+    /**
+     * @brief 注册可复用的http头块
+     * @note 固定不变的响应头（如跨域、缓存控制等）预先编码成"name: value\r\n"格式，
+     * encode时整块拷贝到发送缓冲区。头块为线程局部，通常由Module在Init()中注册；
+     * 头块中的http头不要在HttpMsg中重复设置。
+     * @param mapHeader http头
+     * @return http头块编号
+     */
+    static uint32 RegisterHeaderBlock(const std::unordered_map<std::string, std::string>& mapHeader);
+
+    /**
+     * @brief 释放http头块
+     * @note 与RegisterHeaderBlock()成对调用，相同内容的头块共用一个编号并计数，
+     * 计数归零后编号可被再次注册的头块复用。
+     * @param uiHeaderBlockId RegisterHeaderBlock()返回的http头块编号
+     */
+    static void ReleaseHeaderBlock(uint32 uiHeaderBlockId);
+
+    /**
+     * @brief 设置本线程事件循环的当前时间
+     * @note 由SocketChannel在encode http消息前设置，Date响应头据此生成，encode时无需调用time()。
+     */
+    static void SetNowTime(time_t lNowTime)
+    {
+        s_lNowTime = lNowTime;
+    }
+
+    /**
+     * @brief 设置本线程接下来encode的http消息附加的trace id
+     * @note 由Actor在发送http/1.x消息前设置、发送后以nullptr复位。encode时直接写入
+     * "x-trace-id"头（HttpMsg中已有该头则不写），不修改HttpMsg，也不分配内存。
+     */
+    static void SetSendingTraceId(const std::string* pTraceId)
+    {
+        s_pSendingTraceId = pTraceId;
+    }
+
+    /**
+     * @brief 设置本线程的Module路由
+     * @note 请求是否分块通知由路由匹配到的Module的WithChunkNotice()决定，与ActorBuilder
+     * 分发请求使用同一路由，路径参数、前缀匹配的Module同样适用。分块通知的请求在http头
+     * 解析完毕时即以CODEC_STATUS_PART_OK返回，包体解析到多少返回多少（每段不超过
+     * gc_iMaxBuffLen），最后一段以CODEC_STATUS_OK返回，包体不在内存中完整缓存。返回的
+     * HttpMsg的chunk_notice为true，encoding为通知序号（0为http头），is_decoding为false
+     * 表示请求接收完毕。路由为线程局部，由所在Worker的ActorBuilder设置。
+     */
+    static void SetModuleRouter(const ModuleRouter* pModuleRouter)
+    {
+        s_pModuleRouter = pModuleRouter;
+    }
+
+    /**
+     * @brief 启用分块通知的Module数量增减
+     * @note 由ActorBuilder在加载、卸载WithChunkNotice()的Module时调用，数量为0时解码不做路由匹配。
+     */
+    static void AddChunkNoticeModule()
+    {
+        ++s_uiChunkNoticeModuleNum;
+    }
+
+    static void DelChunkNoticeModule()
+    {
+        if (s_uiChunkNoticeModuleNum > 0)
+        {
+            --s_uiChunkNoticeModuleNum;
+        }
+    }
+
+    static bool IsChunkNoticePath(const char* szPath, size_t uiPathLen, int iMethod);
+
+    /**
+     * @brief 连接关闭时结束未解析完的消息
+     * @note 未带Content-Length的http1.0响应以关闭连接表示数据发送完毕，已解析的部分消息
+     * 交换到oHttpMsg。
+     * @return CODEC_STATUS_EOF
+     */
+    E_CODEC_STATUS DecodeEof(HttpMsg& oHttpMsg);
+
 public:
     ev_tstamp GetKeepAlive() const
     {
@@ -46,6 +165,23 @@ public:
     bool CloseRightAway() const;
 
 protected:
+    E_CODEC_STATUS DecodeChunkNotice(HttpMsg& oHttpMsg);
+    int EncodeHeader(const std::string& strHeaderName, const std::string& strHeaderValue,
+            int64 llExternalBodyLength, bool& bIsGzip, bool& bIsChunked, CBuffer* pBuff);
+    E_CODEC_STATUS DecodeCompleted(HttpMsg& oHttpMsg);
+
+    /**
+     * @brief 快速解码完整的http请求
+     * @note 服务端收到的完整http/1.1请求（请求头和Content-Length指定的包体均已在缓冲区，
+     * 非chunked、非协议升级、非压缩）由HttpRequestScanner一次扫描解码为NativeHttpMsg，不经过http_parser
+     * 的逐字节状态机和回调；其他情况返回false，由http_parser处理。
+     * @return 是否已解码
+     */
+    bool ScanRequest(CBuffer* pBuff, NativeHttpMsg& oNativeMsg);
+    void TakeParsingMsg(HttpMsg& oHttpMsg);
+    static void ParseUrl(HttpMsg* pHttpMsg);
+    static void AddParsedHeader(HttpMsg* pHttpMsg, const std::string& strHeadName, const std::string& strHeadValue);
+
     static int OnMessageBegin(http_parser *parser);
     static int OnUrl(http_parser *parser, const char *at, size_t len);
     static int OnStatus(http_parser *parser, const char *at, size_t len);
@@ -58,17 +194,35 @@ protected:
     static int OnChunkComplete(http_parser *parser);
 
 private:
+    friend class NativeHttpMsg;
+
     bool m_bChannelIsClient;    // 当前编解码器所在channel是作为http客户端还是作为http服务端
     uint32 m_uiEncodedNum;
     uint32 m_uiDecodedNum;
     int32 m_iHttpMajor;
     int32 m_iHttpMinor;
     ev_tstamp m_dKeepAlive;
+    int64 m_llExternalBodyLength;   ///< 不在HttpMsg内的body长度，小于0表示body在HttpMsg内
+    uint32 m_uiHeaderBlockId;       ///< 下一个encode的http响应附加的http头块，0表示无
     http_parser_settings m_parser_setting;
     http_parser m_parser;
-    HttpMsg m_oParsingHttpMsg;      // TODO 如果是较大的http包只解了一部分，要记录断点位置，收到信的数据再从断点位置开始解
+    bool m_bDecoding;               ///< 有未解析完的消息（解析器状态和m_oParsingHttpMsg跨Decode()保留）
+    bool m_bChunkNoticeDecoding;    ///< 分块通知的http头已返回，正在分块返回包体
+    bool m_bParsingHeaderValue;     ///< 最近一次回调的是header value（header name和value可能被分成多段回调）
+    bool m_bNativeDecoded;          ///< 上次Decode()的结果在m_oNativeHttpMsg中
+    NativeHttpMsg m_oNativeHttpMsg;
+    HttpMsg m_oParsingHttpMsg;      ///< 正在解析的消息，已解析的数据从接收缓冲区移除后暂存于此
+    std::string m_strParsingHeaderName;
+    std::string m_strParsingHeaderValue;
     std::string m_strHttpString;
     std::unordered_map<std::string, std::string> m_mapAddingHttpHeader;       ///< encode前添加的http头，encode之后要清空
+
+    static thread_local const ModuleRouter* s_pModuleRouter;                    ///< 本线程的Module路由
+    static thread_local uint32 s_uiChunkNoticeModuleNum;                        ///< 启用分块通知的Module数量
+    static thread_local std::vector<std::string> s_vecHeaderBlock;              ///< 预编码的http头块
+    static thread_local std::vector<uint32> s_vecHeaderBlockRefCount;          ///< http头块引用计数，为0的位置可复用
+    static thread_local time_t s_lNowTime;                                      ///< 事件循环缓存的当前时间
+    static thread_local const std::string* s_pSendingTraceId;                   ///< 当前发送消息的trace id
 };
 
 } /* namespace neb */
@@ -8,14 +8,63 @@
 * Modify history:
 ******************************************************************************/
 #include "CodecUtil.hpp"
+#include <algorithm>
 #include <cryptopp/default.h>
 #include <cryptopp/cryptlib.h>
 #include <cryptopp/aes.h>
 #include <cryptopp/gzip.h>
+#include <cryptopp/zlib.h>
 
 namespace neb
 {
 
+/**
+ * @brief 分块解压，每块输入后取出已解压的数据并检查长度
+ * @note deflate的最大压缩比约为1032:1，每块输入最多解压出约1MB
+ */
+template <typename T>
+static bool BoundedDecompress(const std::string& strSrc, std::string& strDest, size_t uiMaxLength)
+{
+    const size_t uiChunkSize = 1024;
+    T oDecompressor;
+    strDest.clear();
+    auto Retrieve = [&]() -> bool
+    {
+        CryptoPP::lword ullAvail = oDecompressor.MaxRetrievable();
+        if (ullAvail == 0)
+        {
+            return(true);
+        }
+        if (ullAvail > uiMaxLength - strDest.size())
+        {
+            strDest.resize(uiMaxLength + 1);    // 标记超长，剩余数据不再取出
+            return(false);
+        }
+        size_t uiOldSize = strDest.size();
+        strDest.resize(uiOldSize + ullAvail);
+        oDecompressor.Get((CryptoPP::byte*)&strDest[uiOldSize], ullAvail);
+        return(true);
+    };
+    try
+    {
+        for (size_t uiPos = 0; uiPos < strSrc.size(); uiPos += uiChunkSize)
+        {
+            size_t uiLength = std::min(uiChunkSize, strSrc.size() - uiPos);
+            oDecompressor.Put((const CryptoPP::byte*)strSrc.data() + uiPos, uiLength);
+            if (!Retrieve())
+            {
+                return(false);
+            }
+        }
+        oDecompressor.MessageEnd();
+        return(Retrieve());
+    }
+    catch(CryptoPP::Exception& e)
+    {
+        return(false);
+    }
+}
+
 CodecUtil::UnionHostOrder CodecUtil::s_uHostOrder = { { 'L', '?', '?', 'B' } };
 
 CodecUtil::CodecUtil()
@@ -143,6 +192,59 @@ bool CodecUtil::Gunzip(const std::string& strSrc, std::string& strDest)
     return (true);
 }
 
+bool CodecUtil::Deflate(const std::string& strSrc, std::string& strDest)
+{
+    try
+    {
+        CryptoPP::ZlibCompressor oCompressor;
+        oCompressor.Put((CryptoPP::byte*)strSrc.c_str(), strSrc.size());
+        oCompressor.MessageEnd();
+
+        CryptoPP::word64 avail = oCompressor.MaxRetrievable();
+        if(avail)
+        {
+            strDest.resize(avail);
+            oCompressor.Get((CryptoPP::byte*)&strDest[0], strDest.size());
+        }
+    }
+    catch(CryptoPP::Exception& e)
+    {
+        return(false);
+    }
+    return (true);
+}
+
+bool CodecUtil::Undeflate(const std::string& strSrc, std::string& strDest)
+{
+    try
+    {
+        CryptoPP::ZlibDecompressor oDecompressor;
+        oDecompressor.Put((CryptoPP::byte*)strSrc.c_str(), strSrc.size());
+        oDecompressor.MessageEnd();
+        CryptoPP::word64 avail = oDecompressor.MaxRetrievable();
+        if(avail)
+        {
+            strDest.resize(avail);
+            oDecompressor.Get((CryptoPP::byte*)&strDest[0], strDest.size());
+        }
+    }
+    catch(CryptoPP::Exception& e)
+    {
+        return(false);
+    }
+    return (true);
+}
+
+bool CodecUtil::Gunzip(const std::string& strSrc, std::string& strDest, size_t uiMaxLength)
+{
+    return(BoundedDecompress<CryptoPP::Gunzip>(strSrc, strDest, uiMaxLength));
+}
+
+bool CodecUtil::Undeflate(const std::string& strSrc, std::string& strDest, size_t uiMaxLength)
+{
+    return(BoundedDecompress<CryptoPP::ZlibDecompressor>(strSrc, strDest, uiMaxLength));
+}
+
 bool CodecUtil::AesEncrypt(const std::string& strKey, const std::string& strSrc, std::string& strDest)
 {
     try
@@ -52,8 +52,16 @@ public:
 
     static bool Gzip(const std::string& strSrc, std::string& strDest);
     static bool Gunzip(const std::string& strSrc, std::string& strDest);
-    //static bool Deflate(const std::string& strSrc, std::string& strDest);
-    //static bool Undeflate(const std::string& strSrc, std::string& strDest);
+    static bool Deflate(const std::string& strSrc, std::string& strDest);     ///< zlib格式（RFC 1950）
+    static bool Undeflate(const std::string& strSrc, std::string& strDest);
+
+    /**
+     * @brief 限制解压后长度的Gunzip()、Undeflate()
+     * @note 分块输入解压器，解压出的数据超过uiMaxLength时立即停止，不会先把整条数据解压到内存
+     * @return 解压是否成功；超过uiMaxLength时返回false且strDest.size() > uiMaxLength
+     */
+    static bool Gunzip(const std::string& strSrc, std::string& strDest, size_t uiMaxLength);
+    static bool Undeflate(const std::string& strSrc, std::string& strDest, size_t uiMaxLength);
     static bool AesEncrypt(const std::string& strKey, const std::string& strSrc, std::string& strDest);
     static bool AesDecrypt(const std::string& strKey, const std::string& strSrc, std::string& strDest);
 
@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     NativeHttpMsg.cpp
+ * @brief    轻量http请求
+ * @author   Bwar
+ * @date:    2026年10月18日
+ * @note
+ * Modify history:
+ ******************************************************************************/
+#include "NativeHttpMsg.hpp"
+#include "CodecHttp.hpp"
+
+namespace neb
+{
+
+NativeHttpMsg::NativeHttpMsg()
+    : m_iHeaderNum(0)
+{
+}
+
+NativeHttpMsg::~NativeHttpMsg()
+{
+}
+
+void NativeHttpMsg::Clear()
+{
+    iType = HTTP_REQUEST;
+    iMethod = 0;
+    iHttpMajor = 1;
+    iHttpMinor = 1;
+    fKeepAlive = 0.0;
+    stUrl = HttpStringView();
+    stPath = HttpStringView();
+    stQuery = HttpStringView();
+    stBody = HttpStringView();
+    m_iHeaderNum = 0;
+    m_vecMoreHeader.clear();
+}
+
+void NativeHttpMsg::AddHeader(const HttpHeaderView& stHeader)
+{
+    if (m_iHeaderNum < INLINE_HEADER_NUM)
+    {
+        m_astHeader[m_iHeaderNum] = stHeader;
+    }
+    else
+    {
+        m_vecMoreHeader.push_back(stHeader);
+    }
+    ++m_iHeaderNum;
+}
+
+const HttpStringView* NativeHttpMsg::FindHeader(const char* szName, size_t uiNameLen) const
+{
+    for (int i = 0; i < m_iHeaderNum; ++i)
+    {
+        const HttpHeaderView& stHeader = GetHeader(i);
+        if (stHeader.stName.EqualsIgnoreCase(szName, uiNameLen))
+        {
+            return(&stHeader.stValue);
+        }
+    }
+    return(nullptr);
+}
+
+void NativeHttpMsg::ToHttpMsg(HttpMsg& oHttpMsg) const
+{
+    oHttpMsg.set_type(iType);
+    oHttpMsg.set_method(iMethod);
+    oHttpMsg.set_http_major(iHttpMajor);
+    oHttpMsg.set_http_minor(iHttpMinor);
+    oHttpMsg.set_url(stUrl.pData, stUrl.uiLen);
+    CodecHttp::ParseUrl(&oHttpMsg);
+    for (int i = 0; i < m_iHeaderNum; ++i)
+    {
+        const HttpHeaderView& stHeader = GetHeader(i);
+        CodecHttp::AddParsedHeader(&oHttpMsg, std::string(stHeader.stName.pData, stHeader.stName.uiLen),
+                std::string(stHeader.stValue.pData, stHeader.stValue.uiLen));
+    }
+    oHttpMsg.set_keep_alive(fKeepAlive);
+    if (stBody.uiLen > 0)
+    {
+        oHttpMsg.set_body(stBody.pData, stBody.uiLen);
+    }
+    oHttpMsg.set_is_decoding(false);
+}
+
+} /* namespace neb */
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     NativeHttpMsg.hpp
+ * @brief    轻量http请求
+ * @author   Bwar
+ * @date:    2026年10月18日
+ * @note     HttpRequestScanner快速解码的http请求，url、http头和body均为指向接收
+ *           缓冲区的视图，不做内存分配，只在当前消息处理（Module::AnyMessage()返回）
+ *           之前有效。需要protobuf消息（转发、保存等）时调用ToHttpMsg()转换。
+ * Modify history:
+ ******************************************************************************/
+#ifndef SRC_CODEC_NATIVEHTTPMSG_HPP_
+#define SRC_CODEC_NATIVEHTTPMSG_HPP_
+
+#include <vector>
+#include "Definition.hpp"
+#include "util/http/HttpRequestScanner.hpp"
+#include "pb/http.pb.h"
+
+namespace neb
+{
+
+class NativeHttpMsg
+{
+public:
+    static const int INLINE_HEADER_NUM = 16;   ///< 超过此数量的http头存放于m_vecMoreHeader
+
+    NativeHttpMsg();
+    NativeHttpMsg(const NativeHttpMsg&) = delete;
+    NativeHttpMsg& operator=(const NativeHttpMsg&) = delete;
+    ~NativeHttpMsg();
+
+    void Clear();
+    void AddHeader(const HttpHeaderView& stHeader);
+
+    int GetHeaderNum() const
+    {
+        return(m_iHeaderNum);
+    }
+
+    const HttpHeaderView& GetHeader(int iIndex) const
+    {
+        return((iIndex < INLINE_HEADER_NUM) ? m_astHeader[iIndex] : m_vecMoreHeader[iIndex - INLINE_HEADER_NUM]);
+    }
+
+    /**
+     * @brief 查找http头（名字不区分大小写）
+     * @return http头的值，不存在返回nullptr
+     */
+    const HttpStringView* FindHeader(const char* szName, size_t uiNameLen) const;
+
+    /**
+     * @brief 转换为protobuf http消息
+     * @note 与http_parser解码得到的HttpMsg一致（path、params、keep_alive、upgrade等）。
+     */
+    void ToHttpMsg(HttpMsg& oHttpMsg) const;
+
+public:
+    int32 iType                 = HTTP_REQUEST;
+    int32 iMethod               = 0;
+    int32 iHttpMajor            = 1;
+    int32 iHttpMinor            = 1;
+    float fKeepAlive            = 0.0;      ///< 同HttpMsg.keep_alive
+    HttpStringView stUrl;
+    HttpStringView stPath;                  ///< 从url中解析
+    HttpStringView stQuery;                 ///< 从url中解析，参数解码在ToHttpMsg()时进行
+    HttpStringView stBody;
+
+private:
+    int m_iHeaderNum;
+    HttpHeaderView m_astHeader[INLINE_HEADER_NUM];
+    std::vector<HttpHeaderView> m_vecMoreHeader;
+};
+
+} /* namespace neb */
+
+#endif /* SRC_CODEC_NATIVEHTTPMSG_HPP_ */
@@ -0,0 +1,214 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     GrpcMessage.cpp
+ * @brief    gRPC Length-Prefixed-Message编解码
+ * @author   Bwar
+ * @date:    2026-10-19
+ * @note
+ * Modify history:
+ ******************************************************************************/
+#include <cmath>
+#include "GrpcMessage.hpp"
+
+namespace neb
+{
+
+const char* GrpcMessage::ACCEPT_ENCODING = "identity,deflate,gzip";
+
+bool GrpcMessage::Encode(const std::string& strMessage, E_COMPRESSION eCompression, std::string& strData)
+{
+    std::string strCompressed;
+    bool bCompressed = false;
+    if (strMessage.size() >= COMPRESS_MIN_LENGTH)
+    {
+        switch (eCompression)
+        {
+            case COMPRESS_GZIP:
+                bCompressed = CodecUtil::Gzip(strMessage, strCompressed);
+                break;
+            case COMPRESS_DEFLATE:
+                bCompressed = CodecUtil::Deflate(strMessage, strCompressed);
+                break;
+            default:
+                break;
+        }
+        bCompressed = bCompressed && (strCompressed.size() < strMessage.size());
+    }
+    const std::string& strPayload = bCompressed ? strCompressed : strMessage;
+    uint32 uiMessageLength = strPayload.size();
+    strData.append(1, (char)(bCompressed ? 1 : 0));
+    strData.append(1, (char)((uiMessageLength >> 24) & 0xFF));
+    strData.append(1, (char)((uiMessageLength >> 16) & 0xFF));
+    strData.append(1, (char)((uiMessageLength >> 8) & 0xFF));
+    strData.append(1, (char)(uiMessageLength & 0xFF));
+    strData.append(strPayload);
+    return(bCompressed);
+}
+
+E_CODEC_STATUS GrpcMessage::Decode(const std::string& strData, size_t& uiOffset,
+        const std::string& strEncoding, std::string& strMessage)
+{
+    if (strData.size() < uiOffset + PREFIX_SIZE)
+    {
+        return(CODEC_STATUS_PAUSE);
+    }
+    const unsigned char* pPrefix = (const unsigned char*)strData.data() + uiOffset;
+    uint8 ucCompressedFlag = pPrefix[0];
+    uint32 uiMessageLength = ((uint32)pPrefix[1] << 24) | ((uint32)pPrefix[2] << 16)
+            | ((uint32)pPrefix[3] << 8) | (uint32)pPrefix[4];
+    if (uiMessageLength > MAX_MESSAGE_LENGTH)
+    {
+        return(CODEC_STATUS_ERR);
+    }
+    if (strData.size() < uiOffset + PREFIX_SIZE + uiMessageLength)
+    {
+        return(CODEC_STATUS_PAUSE);
+    }
+    if (ucCompressedFlag)
+    {
+        bool bDecompressed = false;
+        switch (GetCompression(strEncoding))
+        {
+            case COMPRESS_GZIP:
+                bDecompressed = CodecUtil::Gunzip(strData.substr(uiOffset + PREFIX_SIZE, uiMessageLength),
+                        strMessage, MAX_MESSAGE_LENGTH);
+                break;
+            case COMPRESS_DEFLATE:
+                bDecompressed = CodecUtil::Undeflate(strData.substr(uiOffset + PREFIX_SIZE, uiMessageLength),
+                        strMessage, MAX_MESSAGE_LENGTH);
+                break;
+            default:
+                return(CODEC_STATUS_INVALID);
+        }
+        if (!bDecompressed)
+        {
+            return((strMessage.size() > MAX_MESSAGE_LENGTH) ? CODEC_STATUS_ERR : CODEC_STATUS_PART_ERR);
+        }
+    }
+    else
+    {
+        strMessage.assign(strData, uiOffset + PREFIX_SIZE, uiMessageLength);
+    }
+    uiOffset += PREFIX_SIZE + uiMessageLength;
+    return(CODEC_STATUS_OK);
+}
+
+E_COMPRESSION GrpcMessage::GetCompression(const std::string& strEncoding)
+{
+    if (strEncoding == "gzip")
+    {
+        return(COMPRESS_GZIP);
+    }
+    else if (strEncoding == "deflate")
+    {
+        return(COMPRESS_DEFLATE);
+    }
+    return(COMPRESS_NA);
+}
+
+const char* GrpcMessage::GetEncoding(E_COMPRESSION eCompression)
+{
+    switch (eCompression)
+    {
+        case COMPRESS_GZIP:
+            return("gzip");
+        case COMPRESS_DEFLATE:
+            return("deflate");
+        default:
+            return("identity");
+    }
+}
+
+E_COMPRESSION GrpcMessage::Negotiate(const std::string& strAcceptEncoding, E_COMPRESSION ePreferred)
+{
+    if (COMPRESS_NA == ePreferred)
+    {
+        return(COMPRESS_NA);
+    }
+    E_COMPRESSION eFirstAccepted = COMPRESS_NA;
+    size_t uiPos = 0;
+    while (uiPos < strAcceptEncoding.size())
+    {
+        size_t uiEnd = strAcceptEncoding.find(',', uiPos);
+        if (uiEnd == std::string::npos)
+        {
+            uiEnd = strAcceptEncoding.size();
+        }
+        size_t uiBegin = strAcceptEncoding.find_first_not_of(' ', uiPos);
+        size_t uiLast = strAcceptEncoding.find_last_not_of(' ', uiEnd - 1);
+        if (uiBegin < uiEnd && uiLast != std::string::npos && uiLast >= uiBegin)
+        {
+            E_COMPRESSION eCompression = GetCompression(strAcceptEncoding.substr(uiBegin, uiLast - uiBegin + 1));
+            if (eCompression == ePreferred)
+            {
+                return(ePreferred);
+            }
+            if (COMPRESS_NA == eFirstAccepted)
+            {
+                eFirstAccepted = eCompression;
+            }
+        }
+        uiPos = uiEnd + 1;
+    }
+    return(eFirstAccepted);
+}
+
+ev_tstamp GrpcMessage::ParseTimeout(const std::string& strTimeout)
+{
+    // TimeoutValue → {positive integer as ASCII string of at most 8 digits}
+    if (strTimeout.size() < 2 || strTimeout.size() > 9)
+    {
+        return(-1.0);
+    }
+    uint64 ullValue = 0;
+    for (size_t i = 0; i < strTimeout.size() - 1; ++i)
+    {
+        if (strTimeout[i] < '0' || strTimeout[i] > '9')
+        {
+            return(-1.0);
+        }
+        ullValue = ullValue * 10 + (strTimeout[i] - '0');
+    }
+    switch (strTimeout.back())
+    {
+        case 'H':
+            return((ev_tstamp)ullValue * 3600.0);
+        case 'M':
+            return((ev_tstamp)ullValue * 60.0);
+        case 'S':
+            return((ev_tstamp)ullValue);
+        case 'm':
+            return((ev_tstamp)ullValue / 1000.0);
+        case 'u':
+            return((ev_tstamp)ullValue / 1000000.0);
+        case 'n':
+            return((ev_tstamp)ullValue / 1000000000.0);
+        default:
+            return(-1.0);
+    }
+}
+
+std::string GrpcMessage::FormatTimeout(ev_tstamp dTimeout)
+{
+    static const struct
+    {
+        double dScale;
+        char cUnit;
+    } c_aUnit[] = {{1000000000.0, 'n'}, {1000000.0, 'u'}, {1000.0, 'm'}, {1.0, 'S'}, {1.0 / 60.0, 'M'}, {1.0 / 3600.0, 'H'}};
+    static const double c_dMaxValue = 99999999.0;
+    if (dTimeout < 0.0)
+    {
+        dTimeout = 0.0;
+    }
+    for (size_t i = 0; i < sizeof(c_aUnit) / sizeof(c_aUnit[0]); ++i)
+    {
+        double dValue = std::ceil(dTimeout * c_aUnit[i].dScale);
+        if (dValue <= c_dMaxValue)
+        {
+            return(std::to_string((uint64)dValue) + c_aUnit[i].cUnit);
+        }
+    }
+    return("99999999H");
+}
+
+} /* namespace neb */
@@ -0,0 +1,83 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     GrpcMessage.hpp
+ * @brief    gRPC Length-Prefixed-Message编解码
+ * @author   Bwar
+ * @date:    2026-10-19
+ * @note     Length-Prefixed-Message → Compressed-Flag(1 byte) Message-Length(4 bytes, big endian) Message
+ * Modify history:
+ ******************************************************************************/
+#ifndef SRC_CODEC_GRPC_GRPCMESSAGE_HPP_
+#define SRC_CODEC_GRPC_GRPCMESSAGE_HPP_
+
+#include <string>
+#include "Definition.hpp"
+#include "codec/Codec.hpp"
+#include "codec/CodecUtil.hpp"
+
+namespace neb
+{
+
+class GrpcMessage
+{
+public:
+    static const uint32 PREFIX_SIZE = 5;
+    static const uint32 MAX_MESSAGE_LENGTH = 4194304;     ///< 接收消息的长度上限（与gRPC默认值一致）
+    static const uint32 COMPRESS_MIN_LENGTH = 1024;       ///< 小于该长度的消息不压缩，压缩收益抵不过CPU开销
+    static const char* ACCEPT_ENCODING;                   ///< 本端支持的grpc-accept-encoding
+
+    /**
+     * @brief 编码一条消息追加到strData
+     * @param eCompression 压缩算法；COMPRESS_NA、不支持的算法、消息短于COMPRESS_MIN_LENGTH、
+     * 压缩失败或压缩后不比原消息短时不压缩
+     * @return 消息是否已压缩（Compressed-Flag）
+     */
+    static bool Encode(const std::string& strMessage, E_COMPRESSION eCompression, std::string& strData);
+
+    /**
+     * @brief 从strData的uiOffset处解码一条消息
+     * @param strData 已接收的数据（可能含多条消息或不完整的消息）
+     * @param uiOffset 解码位置，解码成功时前移到下一条消息
+     * @param strEncoding 对端的grpc-encoding
+     * @param strMessage 解码（解压）后的消息
+     * @return CODEC_STATUS_OK 解码成功；CODEC_STATUS_PAUSE 数据不足一条消息；
+     * CODEC_STATUS_INVALID 不支持的压缩算法；CODEC_STATUS_ERR 消息或解压后的消息超过
+     * MAX_MESSAGE_LENGTH（对应GRPC_RESOURCE_EXHAUSTED），解压中一超过即停止；
+     * CODEC_STATUS_PART_ERR 解压失败
+     */
+    static E_CODEC_STATUS Decode(const std::string& strData, size_t& uiOffset,
+            const std::string& strEncoding, std::string& strMessage);
+
+    /**
+     * @brief grpc-encoding对应的压缩算法，不支持的算法为COMPRESS_NA
+     */
+    static E_COMPRESSION GetCompression(const std::string& strEncoding);
+
+    /**
+     * @brief 压缩算法对应的grpc-encoding，不支持的算法为"identity"
+     */
+    static const char* GetEncoding(E_COMPRESSION eCompression);
+
+    /**
+     * @brief 按对端的grpc-accept-encoding协商压缩算法
+     * @param strAcceptEncoding 对端的grpc-accept-encoding，如"identity,deflate,gzip"
+     * @param ePreferred 本端期望的压缩算法，为COMPRESS_NA时不压缩
+     * @return 对端支持ePreferred则为ePreferred，否则为对端列出的第一个本端也支持的算法，都没有则不压缩
+     */
+    static E_COMPRESSION Negotiate(const std::string& strAcceptEncoding, E_COMPRESSION ePreferred);
+
+    /**
+     * @brief 解析grpc-timeout，如"100m"、"5S"
+     * @return 超时时间（秒），格式非法时为-1
+     */
+    static ev_tstamp ParseTimeout(const std::string& strTimeout);
+
+    /**
+     * @brief 生成grpc-timeout，取不超过8位数字的最精确单位
+     */
+    static std::string FormatTimeout(ev_tstamp dTimeout);
+};
+
+} /* namespace neb */
+
+#endif /* SRC_CODEC_GRPC_GRPCMESSAGE_HPP_ */
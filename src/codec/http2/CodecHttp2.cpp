@@ -18,6 +18,8 @@
 namespace neb
 {
 
+thread_local Http2PushCache CodecHttp2::s_oPushCache;
+
 CodecHttp2::CodecHttp2(std::shared_ptr<NetLogger> pLogger,
         E_CODEC_TYPE eCodecType, bool bChannelIsClient)
     : Codec(pLogger, eCodecType),
@@ -26,9 +28,6 @@ CodecHttp2::CodecHttp2(std::shared_ptr<NetLogger> pLogger,
     try
     {
         m_pFrame = new Http2Frame(pLogger, eCodecType);
-        m_pStreamWeightRoot = new TreeNode<tagStreamWeight>();
-        m_pStreamWeightRoot->pData = new tagStreamWeight();
-        m_pStreamWeightRoot->pData->uiStreamId = 0;
     }
     catch(std::bad_alloc& e)
     {
@@ -38,14 +37,12 @@ CodecHttp2::CodecHttp2(std::shared_ptr<NetLogger> pLogger,
 
 CodecHttp2::~CodecHttp2()
 {
-    ReleaseStreamWeight(m_pStreamWeightRoot);
-    m_pStreamWeightRoot = nullptr;
-    for (auto iter = m_mapStream.begin(); iter != m_mapStream.end(); ++iter)
+    std::vector<Http2Stream*> vecStream;
+    m_oStreamTable.Clear(vecStream);
+    for (auto pStream : vecStream)
     {
-        delete iter->second;
-        iter->second = nullptr;
+        delete pStream;
     }
-    m_mapStream.clear();
     if (m_pFrame != nullptr)
     {
         delete m_pFrame;
@@ -60,9 +57,14 @@ void CodecHttp2::ConnectionSetting(CBuffer* pBuff)
     tagSetting stSetting;
     if (m_bChannelIsClient)
     {
+        // 客户端连接前言：magic之后紧跟SETTINGS帧（rfc7540 3.5）
+        pBuff->Write("PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n", 24);
+        m_bWantMagic = false;
         stSetting.unIdentifier = H2_SETTINGS_INITIAL_WINDOW_SIZE;
         stSetting.uiValue = DEFAULT_SETTINGS_MAX_INITIAL_WINDOW_SIZE;
+        m_uiLocalInitialWindowSize = DEFAULT_SETTINGS_MAX_INITIAL_WINDOW_SIZE;
         m_uiRecvWindowSize = DEFAULT_SETTINGS_MAX_INITIAL_WINDOW_SIZE;
+        m_oBdpEstimator.SetBdp(m_uiRecvWindowSize);
         vecSetting.push_back(stSetting);
         stSetting.unIdentifier = H2_SETTINGS_MAX_FRAME_SIZE;
         stSetting.uiValue = DEFAULT_SETTINGS_MAX_FRAME_SIZE;
@@ -73,7 +75,9 @@ void CodecHttp2::ConnectionSetting(CBuffer* pBuff)
     {
         stSetting.unIdentifier = H2_SETTINGS_INITIAL_WINDOW_SIZE;
         stSetting.uiValue = 4194304;
-        m_uiRecvWindowSize = 4194304;
+        m_uiLocalInitialWindowSize = 4194304;
+        m_uiRecvWindowSize = 4194304;   // 连接窗口由下面的WINDOW_UPDATE从65535增长到4194304
+        m_oBdpEstimator.SetBdp(m_uiRecvWindowSize);
         vecSetting.push_back(stSetting);
         stSetting.unIdentifier = H2_SETTINGS_MAX_FRAME_SIZE;
         stSetting.uiValue = 4194304;
@@ -97,7 +101,6 @@ E_CODEC_STATUS CodecHttp2::Encode(const HttpMsg& oHttpMsg, CBuffer* pBuff)
             m_bWantMagic = false;
         }
     }
-    m_bChunkNotice = oHttpMsg.chunk_notice();
     for (int i = 0; i < oHttpMsg.adding_without_index_headers_size(); ++i)
     {
         m_setEncodingWithoutIndexHeaders.insert(oHttpMsg.adding_without_index_headers(i));
@@ -117,7 +120,9 @@ E_CODEC_STATUS CodecHttp2::Encode(const HttpMsg& oHttpMsg, CBuffer* pBuff)
         }
         m_pFrame->EncodeSetting(this, vecSetting, pBuff);
     }
-    if (HTTP_REQUEST == oHttpMsg.type())
+    // 分段发送（chunk_notice为true且encoding大于0）的后续数据在已打开的stream上发送
+    bool bStreamSegment = (oHttpMsg.chunk_notice() && oHttpMsg.encoding() > 0);
+    if (HTTP_REQUEST == oHttpMsg.type() && !bStreamSegment)
     {
         if (oHttpMsg.stream_id() != 0)
         {
@@ -134,12 +139,22 @@ E_CODEC_STATUS CodecHttp2::Encode(const HttpMsg& oHttpMsg, CBuffer* pBuff)
             return(CODEC_STATUS_PART_ERR);
         }
     }
+    std::vector<std::pair<uint32, const HttpMsg*> > vecPushResponse;
+    if (!m_bChannelIsClient && HTTP_RESPONSE == oHttpMsg.type() && !bStreamSegment)
+    {
+        PushPreload(oHttpMsg, pBuff, vecPushResponse);  // PUSH_PROMISE须先于引用被推送资源的响应
+    }
     //const_cast<HttpMsg&>(oHttpMsg).set_with_huffman(true);
-    if (oHttpMsg.stream_id() != m_pCodingStream->GetStreamId())
+    if (m_pCodingStream == nullptr || oHttpMsg.stream_id() != m_pCodingStream->GetStreamId())
     {
-        auto stream_iter = m_mapStream.find(oHttpMsg.stream_id());
-        if (stream_iter == m_mapStream.end())
+        Http2Stream* pStream = m_oStreamTable.Get(oHttpMsg.stream_id());
+        if (pStream == nullptr)
         {
+            if (bStreamSegment)
+            {
+                LOG4_ERROR("stream %u not found, it may have been closed.", oHttpMsg.stream_id());
+                return(CODEC_STATUS_PART_ERR);
+            }
             if (NewCodingStream(oHttpMsg.stream_id()) == nullptr)
             {
                 return(CODEC_STATUS_ERR);
@@ -147,9 +162,13 @@ E_CODEC_STATUS CodecHttp2::Encode(const HttpMsg& oHttpMsg, CBuffer* pBuff)
         }
         else
         {
-            m_pCodingStream = stream_iter->second;
+            m_pCodingStream = pStream;
         }
     }
+    if (HTTP_REQUEST == oHttpMsg.type() && oHttpMsg.chunk_notice() && !bStreamSegment)
+    {
+        m_pCodingStream->SetChunkNotice(true);     // 响应以分块通知方式逐帧返回
+    }
     size_t uiReadIdx = pBuff->GetReadIndex();
     LOG4_TRACE("%s", oHttpMsg.DebugString().c_str());
     E_CODEC_STATUS eCodecStatus = m_pCodingStream->Encode(this, oHttpMsg, pBuff);
@@ -161,13 +180,18 @@ E_CODEC_STATUS CodecHttp2::Encode(const HttpMsg& oHttpMsg, CBuffer* pBuff)
     if (CODEC_STATUS_PART_ERR == eCodecStatus
             || CODEC_STATUS_OK == eCodecStatus)
     {
-        LOG4_TRACE("m_bChannelIsClient = %d, m_stFrameHead.uiStreamIdentifier = %u",
-                m_bChannelIsClient, m_stFrameHead.uiStreamIdentifier);
+        LOG4_TRACE("m_bChannelIsClient = %d, stream id = %u",
+                m_bChannelIsClient, oHttpMsg.stream_id());
         if (m_pCodingStream->GetStreamState() == H2_STREAM_CLOSE)
         {
-            CloseStream(m_stFrameHead.uiStreamIdentifier);
+            CloseStream(oHttpMsg.stream_id());
         }
     }
+    // 推送资源的响应排在引用它们的响应之后，且urgency低于该响应，流控受限时不与之争抢窗口
+    for (auto& rPushResponse : vecPushResponse)
+    {
+        PushResponse(rPushResponse.first, *rPushResponse.second, pBuff);
+    }
     return(eCodecStatus);
 }
 
@@ -204,15 +228,9 @@ E_CODEC_STATUS CodecHttp2::Decode(CBuffer* pBuff, HttpMsg& oHttpMsg, CBuffer* pR
             oHttpMsg.mutable_upgrade()->set_is_upgrade(false);
             oHttpMsg.mutable_upgrade()->set_protocol("");
             oHttpMsg.set_stream_id(1);
-            try
+            if (NewCodingStream(oHttpMsg.stream_id()) != nullptr)
             {
-                m_pCodingStream = new Http2Stream(m_pLogger, GetCodecType(), oHttpMsg.stream_id());
                 m_pCodingStream->SetState(H2_STREAM_HALF_CLOSE_REMOTE);
-                m_mapStream.insert(std::make_pair((uint32)1, m_pCodingStream));
-            }
-            catch(std::bad_alloc& e)
-            {
-                LOG4_ERROR("%s", e.what());
             }
             delete m_pHoldingHttpMsg;
             m_pHoldingHttpMsg = nullptr;
@@ -263,7 +281,8 @@ E_CODEC_STATUS CodecHttp2::Decode(CBuffer* pBuff, HttpMsg& oHttpMsg, CBuffer* pR
                     pBuff->SetReadIndex(uiReadIdx);
                 }
                 if (CODEC_STATUS_PART_ERR == eCodecStatus
-                        || CODEC_STATUS_OK == eCodecStatus)
+                        || CODEC_STATUS_OK == eCodecStatus
+                        || H2_FRAME_RST_STREAM == m_stFrameHead.ucType)
                 {
                     if (m_pCodingStream->GetStreamState() == H2_STREAM_CLOSE)
                     {
@@ -286,8 +305,20 @@ E_CODEC_STATUS CodecHttp2::Decode(CBuffer* pBuff, HttpMsg& oHttpMsg, CBuffer* pR
             return(CODEC_STATUS_ERR);
         }
         LOG4_TRACE("m_stFrameHead.ucType = %u", m_stFrameHead.ucType);
-        auto stream_iter = m_mapStream.find(m_stFrameHead.uiStreamIdentifier);
-        if (stream_iter == m_mapStream.end())
+        Http2Stream* pStream = m_oStreamTable.Get(m_stFrameHead.uiStreamIdentifier);
+        if (pStream == nullptr
+                && (m_stFrameHead.uiStreamIdentifier <= m_uiStreamIdGenerate
+                    || (0 == (m_stFrameHead.uiStreamIdentifier & 0x01)
+                        && m_stFrameHead.uiStreamIdentifier <= m_uiPushStreamIdGenerate))
+                && (H2_FRAME_RST_STREAM == m_stFrameHead.ucType
+                    || H2_FRAME_WINDOW_UPDATE == m_stFrameHead.ucType
+                    || H2_FRAME_PRIORITY == m_stFrameHead.ucType))
+        {
+            // 已关闭的stream（如本端取消后）上迟到的帧直接丢弃
+            pBuff->AdvanceReadIndex(m_stFrameHead.uiLength);
+            return(CODEC_STATUS_PART_OK);
+        }
+        if (pStream == nullptr)
         {
             /** The identifier of a newly established stream MUST be numerically
              *  greater than all streams that the initiating endpoint has opened
@@ -313,7 +344,7 @@ E_CODEC_STATUS CodecHttp2::Decode(CBuffer* pBuff, HttpMsg& oHttpMsg, CBuffer* pR
         }
         else
         {
-            m_pCodingStream = stream_iter->second;
+            m_pCodingStream = pStream;
         }
         E_CODEC_STATUS eCodecStatus = m_pCodingStream->Decode(this, m_stFrameHead, pBuff, oHttpMsg, pReactBuff);
         if (CODEC_STATUS_PAUSE == eCodecStatus
@@ -322,7 +353,8 @@ E_CODEC_STATUS CodecHttp2::Decode(CBuffer* pBuff, HttpMsg& oHttpMsg, CBuffer* pR
             pBuff->SetReadIndex(uiReadIdx);
         }
         if (CODEC_STATUS_PART_ERR == eCodecStatus
-                || CODEC_STATUS_OK == eCodecStatus)
+                || CODEC_STATUS_OK == eCodecStatus
+                || H2_FRAME_RST_STREAM == m_stFrameHead.ucType)
         {
             if (m_pCodingStream->GetStreamState() == H2_STREAM_CLOSE)
             {
@@ -349,106 +381,39 @@ E_CODEC_STATUS CodecHttp2::Decode(CBuffer* pBuff, HttpMsg& oHttpMsg, CBuffer* pR
 
 void CodecHttp2::SetPriority(uint32 uiStreamId, const tagPriority& stPriority)
 {
-    auto pCurrentStreamWeight = FindStreamWeight(uiStreamId, m_pStreamWeightRoot);
-    if (pCurrentStreamWeight == nullptr)
-    {
-        try
-        {
-            pCurrentStreamWeight = new TreeNode<tagStreamWeight>();
-            pCurrentStreamWeight->pData = new tagStreamWeight();
-            pCurrentStreamWeight->pData->uiStreamId = uiStreamId;
-            pCurrentStreamWeight->pData->ucWeight = stPriority.ucWeight;
-        }
-        catch(std::bad_alloc& e)
-        {
-            LOG4_ERROR("%s", e.what());
-            return;
-        }
-    }
-    if (pCurrentStreamWeight->pParent != nullptr)
+    /* rfc9113 5.3.2 已废弃rfc7540的依赖树，这里只把权重映射为rfc9218的urgency，忽略依赖关系 */
+    Http2Stream* pStream = m_oStreamTable.Get(uiStreamId);
+    if (pStream == nullptr)
     {
-        if (pCurrentStreamWeight->pParent->pFirstChild == pCurrentStreamWeight)
-        {
-            pCurrentStreamWeight->pParent->pFirstChild = pCurrentStreamWeight->pRightBrother;
-        }
-        else
-        {
-            auto pLast = pCurrentStreamWeight->pParent->pFirstChild;
-            while (pLast->pRightBrother != pCurrentStreamWeight)
-            {
-                pLast = pLast->pRightBrother;
-            }
-            pLast->pRightBrother = pCurrentStreamWeight->pRightBrother;
-        }
+        return;
     }
-    auto pDependencyStreamWeight = FindStreamWeight(stPriority.uiDependency, m_pStreamWeightRoot);
-    if (pDependencyStreamWeight == nullptr)
+    uint8 ucUrgency = WeightToUrgency(stPriority.ucWeight);
+    if (ucUrgency == pStream->GetUrgency())
     {
-        pCurrentStreamWeight->pRightBrother = m_pStreamWeightRoot->pRightBrother;
-        m_pStreamWeightRoot->pRightBrother = pCurrentStreamWeight;
+        return;
     }
-    else
+    pStream->SetUrgency(ucUrgency);
+    if (pStream->IsWaitting())
     {
-        if (stPriority.E)
-        {
-            pCurrentStreamWeight->pFirstChild = pDependencyStreamWeight->pFirstChild;
-        }
-        else
-        {
-            pCurrentStreamWeight->pRightBrother = pDependencyStreamWeight->pFirstChild;
-        }
-        pDependencyStreamWeight->pFirstChild = pCurrentStreamWeight;
-        pCurrentStreamWeight->pParent = pDependencyStreamWeight;
+        PushWaittingStream(pStream, uiStreamId);    // 原urgency队列中的条目随之失效
     }
 }
 
-void CodecHttp2::RstStream(uint32 uiStreamId)
+void CodecHttp2::RstStream(uint32 uiStreamId, uint32 uiErrCode)
 {
-    auto iter = m_mapStream.find(uiStreamId);
-    if (iter != m_mapStream.end())
-    {
-        auto pStreamWeight = FindStreamWeight(uiStreamId, m_pStreamWeightRoot);
-        if (pStreamWeight != nullptr)
-        {
-            auto pParent = pStreamWeight->pParent;
-            if (pParent != nullptr)
-            {
-                if (pParent->pFirstChild == pStreamWeight)
-                {
-                    if (pStreamWeight->pFirstChild != nullptr)
-                    {
-                        pParent->pFirstChild = pStreamWeight->pFirstChild;
-                    }
-                    else
-                    {
-                        pParent->pFirstChild = pStreamWeight->pRightBrother;
-                    }
-                }
-                else
-                {
-                    auto pBrother = pParent->pFirstChild;
-                    while (pBrother->pRightBrother != pStreamWeight)
-                    {
-                        pBrother = pBrother->pRightBrother;
-                    }
-                    pBrother->pRightBrother = pStreamWeight->pRightBrother;
-                }
-                delete pStreamWeight;
-            }
-        }
-        else
-        {
-            // TODO?
-        }
+    // 正在解码的stream已由Http2Stream::Decode()置为关闭状态，解码返回后由CloseStream()删除，
+    // 这里只记录下来通知业务层
+    m_vecResetStream.push_back(std::make_pair(uiStreamId, uiErrCode));
+}
 
-        if (iter->second == m_pCodingStream)
-        {
-            m_pCodingStream = nullptr;
-        }
-        delete iter->second;
-        iter->second = nullptr;
-        m_mapStream.erase(iter);
+void CodecHttp2::CancelStream(uint32 uiStreamId, CBuffer* pBuff)
+{
+    if (m_oStreamTable.Get(uiStreamId) == nullptr)
+    {
+        return;
     }
+    m_pFrame->EncodeRstStream(this, uiStreamId, H2_ERR_CANCEL, pBuff);
+    CloseStream(uiStreamId);
 }
 
 E_H2_ERR_CODE CodecHttp2::Setting(const std::vector<tagSetting>& vecSetting)
@@ -479,9 +444,12 @@ E_H2_ERR_CODE CodecHttp2::Setting(const std::vector<tagSetting>& vecSetting)
             case H2_SETTINGS_INITIAL_WINDOW_SIZE:
                 if (vecSetting[i].uiValue <= SETTINGS_MAX_INITIAL_WINDOW_SIZE)
                 {
-                    for (auto it = m_mapStream.begin(); it != m_mapStream.end(); ++it)
+                    std::vector<Http2Stream*> vecStream;
+                    m_oStreamTable.GetAll(vecStream);
+                    for (auto pStream : vecStream)
                     {
-                        it->second->WindowInit(vecSetting[i].uiValue - m_uiSettingsMaxWindowSize);
+                        // 已有stream的发送窗口按新旧初始值之差调整（rfc7540 6.9.2）
+                        pStream->WindowUpdate((int32)(vecSetting[i].uiValue - m_uiSettingsMaxWindowSize));
                     }
                     m_uiSettingsMaxWindowSize = vecSetting[i].uiValue;
                 }
@@ -516,10 +484,10 @@ void CodecHttp2::WindowUpdate(uint32 uiStreamId, uint32 uiIncrement)
     m_uiSendWindowSize += uiIncrement;
     if (uiStreamId > 0)
     {
-        auto iter = m_mapStream.find(uiStreamId);
-        if (iter != m_mapStream.end())
+        Http2Stream* pStream = m_oStreamTable.Get(uiStreamId);
+        if (pStream != nullptr)
         {
-            iter->second->WindowUpdate((int32)uiIncrement);
+            pStream->WindowUpdate((int32)uiIncrement);
         }
     }
 }
@@ -529,29 +497,71 @@ void CodecHttp2::ShrinkSendWindow(uint32 uiStreamId, uint32 uiSendLength)
     m_uiSendWindowSize -= uiSendLength;
     if (uiStreamId > 0)
     {
-        auto iter = m_mapStream.find(uiStreamId);
-        if (iter != m_mapStream.end())
+        Http2Stream* pStream = m_oStreamTable.Get(uiStreamId);
+        if (pStream != nullptr)
         {
-            iter->second->WindowUpdate(-uiSendLength);
+            pStream->WindowUpdate(-uiSendLength);
         }
     }
 }
 
 void CodecHttp2::ShrinkRecvWindow(uint32 uiStreamId, uint32 uiRecvLength, CBuffer* pBuff)
 {
-    m_uiRecvWindowSize -= uiRecvLength;
-    if (m_uiRecvWindowSize < DEFAULT_SETTINGS_MAX_INITIAL_WINDOW_SIZE / 4)
+    if (m_oBdpEstimator.Add(uiRecvLength))
+    {
+        m_pFrame->EncodePing(this, false, Http2BdpEstimator::PING_PAYLOAD1,
+                Http2BdpEstimator::PING_PAYLOAD2, pBuff);
+    }
+    // 已接收的字节数累计到连接窗口的一半再发送WINDOW_UPDATE，而不是每个DATA帧发送一次
+    m_uiRecvWindowUnacked += uiRecvLength;
+    if (m_uiRecvWindowUnacked >= m_uiRecvWindowSize / 2)
     {
-        m_pFrame->EncodeWindowUpdate(this, 0,
-                SETTINGS_MAX_INITIAL_WINDOW_SIZE - m_uiRecvWindowSize, pBuff);
+        m_pFrame->EncodeWindowUpdate(this, 0, m_uiRecvWindowUnacked, pBuff);
+        m_uiRecvWindowUnacked = 0;
     }
-    m_uiRecvWindowSize = SETTINGS_MAX_INITIAL_WINDOW_SIZE;
     if (uiStreamId > 0)
     {
-        auto iter = m_mapStream.find(uiStreamId);
-        if (iter != m_mapStream.end())
+        Http2Stream* pStream = m_oStreamTable.Get(uiStreamId);
+        if (pStream != nullptr)
+        {
+            pStream->ShrinkRecvWindow(this, uiStreamId, uiRecvLength, pBuff);
+        }
+    }
+}
+
+void CodecHttp2::PingAck(int32 iPayload1, int32 iPayload2, CBuffer* pBuff)
+{
+    if (!Http2BdpEstimator::IsBdpPing(iPayload1, iPayload2))
+    {
+        return;
+    }
+    uint32 uiBdp = m_oBdpEstimator.Calculate();
+    if (uiBdp == 0)
+    {
+        return;
+    }
+    LOG4_TRACE("bdp = %u, recv window size = %u, initial window size = %u",
+            uiBdp, m_uiRecvWindowSize, m_uiLocalInitialWindowSize);
+    if (uiBdp > m_uiRecvWindowSize)
+    {
+        m_pFrame->EncodeWindowUpdate(this, 0, uiBdp - m_uiRecvWindowSize, pBuff);
+        m_uiRecvWindowSize = uiBdp;
+    }
+    if (uiBdp > m_uiLocalInitialWindowSize)
+    {
+        // 调大SETTINGS_INITIAL_WINDOW_SIZE，对端按差值增大所有stream的发送窗口
+        std::vector<tagSetting> vecSetting;
+        tagSetting stSetting;
+        stSetting.unIdentifier = H2_SETTINGS_INITIAL_WINDOW_SIZE;
+        stSetting.uiValue = uiBdp;
+        vecSetting.push_back(stSetting);
+        m_pFrame->EncodeSetting(this, vecSetting, pBuff);
+        m_uiLocalInitialWindowSize = uiBdp;
+        std::vector<Http2Stream*> vecStream;
+        m_oStreamTable.GetAll(vecStream);
+        for (auto pStream : vecStream)
         {
-            iter->second->ShrinkRecvWindow(this, uiStreamId, uiRecvLength, pBuff);
+            pStream->RecvWindowInit(uiBdp);
         }
     }
 }
@@ -589,7 +599,7 @@ E_CODEC_STATUS CodecHttp2::UnpackHeader(uint32 uiHeaderBlockEndPos, CBuffer* pBu
                 return(eStatus);
             }
             ClassifyHeader(strHeaderName, strHeaderValue, oHttpMsg);
-            UpdateDecodingDynamicTable(0, strHeaderName, strHeaderValue);
+            UpdateDecodingDynamicTable(strHeaderName, strHeaderValue);
         }
         else if (H2_HPACK_CONDITION_LITERAL_HEADER_NEVER_INDEXED & B)
         {
@@ -636,6 +646,17 @@ E_CODEC_STATUS CodecHttp2::UnpackHeader(uint32 uiHeaderBlockEndPos, CBuffer* pBu
 
 void CodecHttp2::PackHeader(const HttpMsg& oHttpMsg, int iHeaderType, CBuffer* pBuff)
 {
+    if (iHeaderType & H2_HEADER_LITERAL)
+    {
+        if (iHeaderType & H2_HEADER_TRAILER)
+        {
+            for (int i = 0; i < oHttpMsg.trailer_header_size(); ++i)
+            {
+                PackHeaderLiteral(oHttpMsg.trailer_header(i).name(), oHttpMsg.trailer_header(i).value(), oHttpMsg.with_huffman(), pBuff);
+            }
+        }
+        return;
+    }
     if (oHttpMsg.dynamic_table_update_size() > 0)
     {
         if (oHttpMsg.dynamic_table_update_size() > SETTINGS_MAX_FRAME_SIZE)
@@ -737,8 +758,10 @@ E_CODEC_STATUS CodecHttp2::PromiseStream(uint32 uiStreamId, CBuffer* pReactBuff)
     try
     {
         pPromiseStream = new Http2Stream(m_pLogger, GetCodecType(), uiStreamId);
+        pPromiseStream->WindowInit(m_uiSettingsMaxWindowSize);
+        pPromiseStream->RecvWindowInit(m_uiLocalInitialWindowSize);
         pPromiseStream->SetState(H2_STREAM_RESERVED_REMOTE);
-        m_mapStream.insert(std::make_pair(uiStreamId, pPromiseStream));
+        m_oStreamTable.Insert(uiStreamId, pPromiseStream);
     }
     catch(std::bad_alloc& e)
     {
@@ -748,38 +771,224 @@ E_CODEC_STATUS CodecHttp2::PromiseStream(uint32 uiStreamId, CBuffer* pReactBuff)
     return(CODEC_STATUS_PART_OK);
 }
 
-E_CODEC_STATUS CodecHttp2::SendWaittingFrameData(CBuffer* pBuff)
+void CodecHttp2::PushPreload(const HttpMsg& oHttpMsg, CBuffer* pBuff,
+        std::vector<std::pair<uint32, const HttpMsg*> >& vecPushResponse)
 {
-    if (m_pStreamWeightRoot != nullptr)
+    if (0 == m_uiSettingsEnablePush || s_oPushCache.Empty() || m_strAuthority.empty())
+    {
+        return;
+    }
+    auto link_iter = oHttpMsg.headers().find("link");
+    if (link_iter == oHttpMsg.headers().end())
+    {
+        link_iter = oHttpMsg.headers().find("Link");
+        if (link_iter == oHttpMsg.headers().end())
+        {
+            return;
+        }
+    }
+    // 只能在对端发起的、仍可发送的stream上推送
+    Http2Stream* pStream = m_oStreamTable.Get(oHttpMsg.stream_id());
+    if (pStream == nullptr
+            || (pStream->GetStreamState() != H2_STREAM_OPEN
+                && pStream->GetStreamState() != H2_STREAM_HALF_CLOSE_REMOTE))
     {
-        E_CODEC_STATUS eStatus = CODEC_STATUS_OK;
-        uint32 uiStreamId = 0;
-        std::vector<uint32> vecCompleteStream;
-        auto pCurrent = m_pStreamWeightRoot->pFirstChild;
-        while (pCurrent)
+        return;
+    }
+    std::vector<std::string> vecPath;
+    Http2PushCache::GetPreloadPath(link_iter->second, vecPath);
+    for (auto& strPath : vecPath)
+    {
+        if (m_oStreamTable.Size() >= m_uiSettingsMaxConcurrentStreams
+                || m_uiPushStreamIdGenerate + 2 > STREAM_IDENTIFY_MASK)
         {
-            uiStreamId = pCurrent->pData->uiStreamId;
-            auto iter = m_mapStream.find(uiStreamId);
-            if (iter != m_mapStream.end())
+            break;
+        }
+        uint64 ullVersion = 0;
+        const HttpMsg* pResource = s_oPushCache.Get(strPath, ullVersion);
+        if (pResource == nullptr)
+        {
+            continue;
+        }
+        auto pushed_iter = m_mapPushedVersion.find(strPath);
+        if (pushed_iter != m_mapPushedVersion.end() && pushed_iter->second == ullVersion)
+        {
+            continue;       // 对端已有该版本的资源（推送过或已拒绝），不重复推送
+        }
+        uint32 uiPromiseStreamId = Push(oHttpMsg.stream_id(), strPath, pBuff);
+        if (uiPromiseStreamId > 0)
+        {
+            m_mapPushedVersion[strPath] = ullVersion;
+            vecPushResponse.push_back(std::make_pair(uiPromiseStreamId, pResource));
+        }
+    }
+}
+
+uint32 CodecHttp2::Push(uint32 uiStreamId, const std::string& strPath, CBuffer* pBuff)
+{
+    HttpMsg oPromise;
+    auto pHeader = oPromise.add_pseudo_header();
+    pHeader->set_name(":method");
+    pHeader->set_value("GET");
+    pHeader = oPromise.add_pseudo_header();
+    pHeader->set_name(":scheme");
+    pHeader->set_value(m_strScheme.empty() ? "https" : m_strScheme);
+    pHeader = oPromise.add_pseudo_header();
+    pHeader->set_name(":authority");
+    pHeader->set_value(m_strAuthority);
+    pHeader = oPromise.add_pseudo_header();
+    pHeader->set_name(":path");
+    pHeader->set_value(strPath);
+    uint32 uiPromiseStreamId = m_uiPushStreamIdGenerate + 2;
+    if (CODEC_STATUS_OK != m_pFrame->EncodePushPromise(this, uiStreamId, uiPromiseStreamId, "", oPromise, pBuff))
+    {
+        return(0);
+    }
+    m_uiPushStreamIdGenerate = uiPromiseStreamId;
+    Http2Stream* pParentStream = m_oStreamTable.Get(uiStreamId);
+    uint8 ucUrgency = (pParentStream == nullptr) ? H2_DEFAULT_URGENCY : pParentStream->GetUrgency();
+    if (NewCodingStream(uiPromiseStreamId) == nullptr)
+    {
+        return(0);
+    }
+    m_pCodingStream->SetState(H2_STREAM_RESERVED_LOCAL);
+    m_pCodingStream->SetUrgency((ucUrgency + 1 < H2_URGENCY_NUM) ? ucUrgency + 1 : ucUrgency);
+    LOG4_TRACE("promise \"%s\" on stream %u, promise stream %u", strPath.c_str(), uiStreamId, uiPromiseStreamId);
+    return(uiPromiseStreamId);
+}
+
+void CodecHttp2::PushResponse(uint32 uiPromiseStreamId, const HttpMsg& oResponse, CBuffer* pBuff)
+{
+    m_pCodingStream = m_oStreamTable.Get(uiPromiseStreamId);
+    if (m_pCodingStream == nullptr)
+    {
+        return;
+    }
+    HttpMsg oPushResponse(oResponse);
+    oPushResponse.set_type(HTTP_RESPONSE);
+    oPushResponse.set_http_major(2);
+    oPushResponse.set_http_minor(0);
+    oPushResponse.set_stream_id(uiPromiseStreamId);
+    E_CODEC_STATUS eCodecStatus = m_pCodingStream->Encode(this, oPushResponse, pBuff);
+    LOG4_TRACE("push response on stream %u, codec status %d", uiPromiseStreamId, eCodecStatus);
+    if (m_pCodingStream != nullptr && m_pCodingStream->GetStreamState() == H2_STREAM_CLOSE)
+    {
+        CloseStream(uiPromiseStreamId);
+    }
+}
+
+E_CODEC_STATUS CodecHttp2::SendWaittingFrameData(CBuffer* pBuff)
+{
+    E_CODEC_STATUS eStatus = CODEC_STATUS_OK;
+    std::vector<uint32> vecCloseStream;
+    for (uint8 ucUrgency = 0; ucUrgency < H2_URGENCY_NUM; ++ucUrgency)
+    {
+        auto& rQueue = m_aWaittingStream[ucUrgency];
+        // 每个stream本轮最多发送一次，未发完的移到队尾，同一urgency的stream轮流占用连接窗口
+        for (size_t uiTurn = rQueue.size(); uiTurn > 0 && m_uiSendWindowSize > 0; --uiTurn)
+        {
+            auto stEntry = rQueue.front();
+            uint32 uiStreamId = stEntry.first;
+            rQueue.pop_front();
+            Http2Stream* pStream = m_oStreamTable.Get(uiStreamId);
+            if (pStream == nullptr || !pStream->IsWaitting() || pStream->GetWaittingSeq() != stEntry.second)
             {
-                eStatus = iter->second->SendWaittingFrameData(this, pBuff);
-                if (eStatus == CODEC_STATUS_OK)
+                continue;   // stream已关闭、已移出队列或已移到其他urgency的队列
+            }
+            if (pStream->SendWaittingFrameData(this, pBuff) == CODEC_STATUS_OK)
+            {
+                pStream->SetWaitting(false);
+                --m_uiWaittingStreamNum;
+                if (pStream->GetStreamState() == H2_STREAM_CLOSE)
                 {
-                    vecCompleteStream.push_back(uiStreamId);
+                    vecCloseStream.push_back(uiStreamId);
                 }
                 else
                 {
-                    break;
+                    m_vecWritableStream.push_back(uiStreamId);
                 }
             }
+            else
+            {
+                rQueue.push_back(stEntry);
+            }
         }
-        for (auto id : vecCompleteStream)
-        {
-            CloseStream(id);
-        }
-        return(eStatus);
     }
-    return(CODEC_STATUS_OK);
+    if (m_uiWaittingStreamNum > 0)
+    {
+        eStatus = CODEC_STATUS_PART_OK;
+    }
+    for (auto uiStreamId : vecCloseStream)
+    {
+        CloseStream(uiStreamId);
+    }
+    return(eStatus);
+}
+
+void CodecHttp2::AddWaittingStream(uint32 uiStreamId)
+{
+    Http2Stream* pStream = m_oStreamTable.Get(uiStreamId);
+    if (pStream == nullptr || pStream->IsWaitting())
+    {
+        return;
+    }
+    pStream->SetWaitting(true);
+    ++m_uiWaittingStreamNum;
+    PushWaittingStream(pStream, uiStreamId);
+}
+
+void CodecHttp2::DelWaittingStream(uint32 uiStreamId)
+{
+    Http2Stream* pStream = m_oStreamTable.Get(uiStreamId);
+    if (pStream == nullptr || !pStream->IsWaitting())
+    {
+        return;
+    }
+    // 队列中的条目不在这里删除，发送时发现stream已不在待发送状态即跳过
+    pStream->SetWaitting(false);
+    --m_uiWaittingStreamNum;
+    if (pStream->GetStreamState() != H2_STREAM_CLOSE)     // 已关闭的stream由解码流程删除
+    {
+        m_vecWritableStream.push_back(uiStreamId);
+    }
+}
+
+void CodecHttp2::PushWaittingStream(Http2Stream* pStream, uint32 uiStreamId)
+{
+    pStream->SetWaittingSeq(++m_uiWaittingSeqGenerate);
+    auto& rQueue = m_aWaittingStream[pStream->GetUrgency()];
+    rQueue.push_back(std::make_pair(uiStreamId, pStream->GetWaittingSeq()));
+    if (rQueue.size() > 2 * m_uiWaittingStreamNum + 64)   // 失效条目过多时清理，均摊O(1)
+    {
+        auto iter = std::remove_if(rQueue.begin(), rQueue.end(),
+                [this](const std::pair<uint32, uint32>& stEntry)
+                {
+                    Http2Stream* pWaittingStream = m_oStreamTable.Get(stEntry.first);
+                    return(pWaittingStream == nullptr || !pWaittingStream->IsWaitting()
+                            || pWaittingStream->GetWaittingSeq() != stEntry.second);
+                });
+        rQueue.erase(iter, rQueue.end());
+    }
+}
+
+uint32 CodecHttp2::GetStreamSendWindow(uint32 uiStreamId)
+{
+    Http2Stream* pStream = m_oStreamTable.Get(uiStreamId);
+    if (pStream == nullptr || pStream->IsWaitting() || pStream->GetSendWindowSize() <= 0)
+    {
+        return(0);
+    }
+    return(std::min(m_uiSendWindowSize, (uint32)pStream->GetSendWindowSize()));
+}
+
+uint32 CodecHttp2::GetStreamWaittingBytes(uint32 uiStreamId)
+{
+    Http2Stream* pStream = m_oStreamTable.Get(uiStreamId);
+    if (pStream == nullptr)
+    {
+        return(0);
+    }
+    return(pStream->GetWaittingBytes());
 }
 
 void CodecHttp2::TransferHoldingMsg(HttpMsg* pHoldingHttpMsg)
@@ -816,14 +1025,12 @@ uint32 CodecHttp2::StreamIdGenerate()
 
 Http2Stream* CodecHttp2::NewCodingStream(uint32 uiStreamId)
 {
-    uint32 uiNewWindowSize = m_uiRecvWindowSize + DEFAULT_SETTINGS_MAX_INITIAL_WINDOW_SIZE;
     try
     {
         m_pCodingStream = new Http2Stream(m_pLogger, GetCodecType(), uiStreamId);
         m_pCodingStream->WindowInit(m_uiSettingsMaxWindowSize);
-        m_uiRecvWindowSize = (uiNewWindowSize < SETTINGS_MAX_INITIAL_WINDOW_SIZE)
-                ? uiNewWindowSize : SETTINGS_MAX_INITIAL_WINDOW_SIZE;
-        m_mapStream.insert(std::make_pair(uiStreamId, m_pCodingStream));
+        m_pCodingStream->RecvWindowInit(m_uiLocalInitialWindowSize);
+        m_oStreamTable.Insert(uiStreamId, m_pCodingStream);
         return(m_pCodingStream);
     }
     catch(std::bad_alloc& e)
@@ -833,41 +1040,18 @@ Http2Stream* CodecHttp2::NewCodingStream(uint32 uiStreamId)
     }
 }
 
-TreeNode<tagStreamWeight>* CodecHttp2::FindStreamWeight(uint32 uiStreamId, TreeNode<tagStreamWeight>* pTarget)
+uint8 CodecHttp2::WeightToUrgency(uint8 ucWeight)
 {
-    if (pTarget == nullptr)
-    {
-        return(nullptr);
-    }
-    if (pTarget->pData->uiStreamId == uiStreamId)
+    /* rfc7540的权重为ucWeight + 1（1~256），按权重的对数分到8个urgency：
+     * 默认权重16对应默认urgency 3，权重每翻一倍urgency提高一级 */
+    uint32 uiWeight = (uint32)ucWeight + 1;
+    int iUrgency = 7;
+    while (uiWeight > 1 && iUrgency > 0)
     {
-        return(pTarget);
-    }
-    else
-    {
-        auto pFound = FindStreamWeight(uiStreamId, pTarget->pFirstChild);
-        if (pFound == nullptr)
-        {
-            pFound = FindStreamWeight(uiStreamId, pTarget->pRightBrother);
-        }
-        return(pFound);
+        uiWeight >>= 1;
+        --iUrgency;
     }
-}
-
-void CodecHttp2::ReleaseStreamWeight(TreeNode<tagStreamWeight>* pNode)
-{
-    if (pNode == nullptr)
-    {
-        return;
-    }
-    ReleaseStreamWeight(pNode->pFirstChild);
-    pNode->pFirstChild = nullptr;
-    ReleaseStreamWeight(pNode->pRightBrother);
-    pNode->pRightBrother = nullptr;
-    pNode->pParent = nullptr;
-    delete pNode->pData;
-    pNode->pData = nullptr;
-    delete pNode;
+    return((uint8)iUrgency);
 }
 
 E_CODEC_STATUS CodecHttp2::UnpackHeaderIndexed(CBuffer* pBuff, HttpMsg& oHttpMsg)
@@ -885,11 +1069,10 @@ E_CODEC_STATUS CodecHttp2::UnpackHeaderIndexed(CBuffer* pBuff, HttpMsg& oHttpMsg
                 Http2Header::sc_vecStaticTable[uiTableIndex].second, oHttpMsg);
         return(CODEC_STATUS_PART_OK);
     }
-    else if (uiTableIndex <= Http2Header::sc_uiMaxStaticTableIndex + m_vecDecodingDynamicTable.size())
+    else if (uiTableIndex <= Http2Header::sc_uiMaxStaticTableIndex + m_oDecodingDynamicTable.Size())
     {
-        uint32 uiDynamicTableIndex = uiTableIndex - Http2Header::sc_uiMaxStaticTableIndex - 1;
-        ClassifyHeader(m_vecDecodingDynamicTable[uiDynamicTableIndex].Name(),
-                m_vecDecodingDynamicTable[uiDynamicTableIndex].Value(), oHttpMsg);
+        const Http2Header& oHeader = m_oDecodingDynamicTable.Get(uiTableIndex - Http2Header::sc_uiMaxStaticTableIndex);
+        ClassifyHeader(oHeader.Name(), oHeader.Value(), oHttpMsg);
         return(CODEC_STATUS_PART_OK);
     }
     else
@@ -925,16 +1108,15 @@ E_CODEC_STATUS CodecHttp2::UnpackHeaderLiteralIndexing(CBuffer* pBuff, uint8 ucF
             strHeaderName = Http2Header::sc_vecStaticTable[uiTableIndex].first;
             return(CODEC_STATUS_PART_OK);
         }
-        else if (uiTableIndex < Http2Header::sc_uiMaxStaticTableIndex + m_vecDecodingDynamicTable.size())
+        else if (uiTableIndex <= Http2Header::sc_uiMaxStaticTableIndex + m_oDecodingDynamicTable.Size())
         {
-            uint32 uiDynamicTableIndex = uiTableIndex - Http2Header::sc_uiMaxStaticTableIndex - 1;
             if (!Http2Header::DecodeStringLiteral(pBuff, strHeaderValue, bWithHuffman))
             {
                 SetErrno(H2_ERR_COMPRESSION_ERROR);
                 LOG4_ERROR("DecodeStringLiteral failed!");
                 return(CODEC_STATUS_ERR);
             }
-            strHeaderName = m_vecDecodingDynamicTable[uiDynamicTableIndex].Name();
+            strHeaderName = m_oDecodingDynamicTable.Get(uiTableIndex - Http2Header::sc_uiMaxStaticTableIndex).Name();
             return(CODEC_STATUS_PART_OK);
         }
         else
@@ -961,60 +1143,54 @@ E_CODEC_STATUS CodecHttp2::UnpackHeaderLiteralIndexing(CBuffer* pBuff, uint8 ucF
 
 void CodecHttp2::ClassifyHeader(const std::string& strHeaderName, const std::string& strHeaderValue, HttpMsg& oHttpMsg)
 {
-    if (oHttpMsg.stream_id() & 0x01)
+    // 首个header block之后的header block为trailer（分块通知时首个header block已随通知移出oHttpMsg）
+    if (oHttpMsg.body().size() > 0
+            || (m_pCodingStream != nullptr && m_pCodingStream->IsHeadersReceived()))
     {
-        if (oHttpMsg.body().size() > 0)
-        {
-            auto pHeader = oHttpMsg.add_trailer_header();
-            pHeader->set_name(strHeaderName);
-            pHeader->set_value(strHeaderValue);
-        }
-        else
-        {
-            if (strHeaderName == ":method")
+        auto pHeader = oHttpMsg.add_trailer_header();
+        pHeader->set_name(strHeaderName);
+        pHeader->set_value(strHeaderValue);
+        return;
+    }
+    // 按伪头部而非stream id的奇偶区分请求和响应：客户端发起的stream（奇数）上收到的是响应
+    switch (Http2Header::GetPseudoHeader(strHeaderName))
+    {
+        case H2_PSEUDO_METHOD:
+            if (strHeaderValue == "POST")
             {
-                if (strHeaderValue == "POST")
-                {
-                    oHttpMsg.set_method(HTTP_POST);
-                }
-                else if (strHeaderValue == "GET")
-                {
-                    oHttpMsg.set_method(HTTP_GET);
-                }
-                else
-                {
-                    ;// TODO other http method
-                }
+                oHttpMsg.set_method(HTTP_POST);
             }
-            else if (strHeaderName == ":path")
+            else if (strHeaderValue == "GET")
             {
-                oHttpMsg.set_path(strHeaderValue);
+                oHttpMsg.set_method(HTTP_GET);
             }
             else
             {
-                oHttpMsg.mutable_headers()->insert({strHeaderName, strHeaderValue});
+                ;// TODO other http method
             }
-        }
-    }
-    else
-    {
-        if (oHttpMsg.body().size() > 0)
-        {
-            auto pHeader = oHttpMsg.add_trailer_header();
-            pHeader->set_name(strHeaderName);
-            pHeader->set_value(strHeaderValue);
-        }
-        else
-        {
-            if (strHeaderName == ":status")
+            break;
+        case H2_PSEUDO_PATH:
+            oHttpMsg.set_path(strHeaderValue);
+            break;
+        case H2_PSEUDO_STATUS:
+            oHttpMsg.set_status_code(StringConverter::RapidAtoi<int32>(strHeaderValue.c_str()));
+            break;
+        case H2_PSEUDO_AUTHORITY:
+            if (!m_bChannelIsClient)
             {
-                oHttpMsg.set_status_code(StringConverter::RapidAtoi<int32>(strHeaderValue.c_str()));
+                m_strAuthority = strHeaderValue;
             }
-            else
+            oHttpMsg.mutable_headers()->insert({strHeaderName, strHeaderValue});
+            break;
+        case H2_PSEUDO_SCHEME:
+            if (!m_bChannelIsClient)
             {
-                oHttpMsg.mutable_headers()->insert({strHeaderName, strHeaderValue});
+                m_strScheme = strHeaderValue;
             }
-        }
+            oHttpMsg.mutable_headers()->insert({strHeaderName, strHeaderValue});
+            break;
+        default:
+            oHttpMsg.mutable_headers()->insert({strHeaderName, strHeaderValue});
     }
 }
 
@@ -1064,7 +1240,7 @@ void CodecHttp2::PackHeaderWithIndexing(const std::string& strHeaderName,
             Http2Header::EncodeStringLiteral(strHeaderValue, pBuff);
             LOG4_TRACE("pBuff->ReadableBytes() = %u", pBuff->ReadableBytes());
         }
-        UpdateEncodingDynamicTable(0, strHeaderName, strHeaderValue);
+        UpdateEncodingDynamicTable(strHeaderName, strHeaderValue);
     }
 }
 
@@ -1108,6 +1284,31 @@ void CodecHttp2::PackHeaderWithoutIndexing(const std::string& strHeaderName,
     }
 }
 
+void CodecHttp2::PackHeaderLiteral(const std::string& strHeaderName,
+        const std::string& strHeaderValue, bool bWithHuffman, CBuffer* pBuff)
+{
+    // 只引用静态表，header block晚于其他stream的header block发送也能正确解码
+    size_t uiTableIndex = Http2Header::GetStaticTableIndex(strHeaderName);
+    Http2Header::EncodeInt(uiTableIndex, (size_t)H2_HPACK_PREFIX_4_BITS,
+            (char)H2_HPACK_CONDITION_LITERAL_HEADER_WITHOUT_INDEXING, pBuff);
+    if (bWithHuffman)
+    {
+        if (uiTableIndex == 0)
+        {
+            Http2Header::EncodeStringLiteralWithHuffman(strHeaderName, pBuff);
+        }
+        Http2Header::EncodeStringLiteralWithHuffman(strHeaderValue, pBuff);
+    }
+    else
+    {
+        if (uiTableIndex == 0)
+        {
+            Http2Header::EncodeStringLiteral(strHeaderName, pBuff);
+        }
+        Http2Header::EncodeStringLiteral(strHeaderValue, pBuff);
+    }
+}
+
 void CodecHttp2::PackHeaderNeverIndexing(const std::string& strHeaderName,
         const std::string& strHeaderValue, bool bWithHuffman, CBuffer* pBuff)
 {
@@ -1154,183 +1355,56 @@ void CodecHttp2::PackHeaderDynamicTableSize(uint32 uiDynamicTableSize, CBuffer*
             (char)H2_HPACK_CONDITION_DYNAMIC_TABLE_SIZE_UPDATE, pBuff);
 }
 
-size_t CodecHttp2::GetEncodingTableIndex(const std::string& strHeaderName, const std::string& strHeaderValue)
+size_t CodecHttp2::GetEncodingTableIndex(const std::string& strHeaderName)
 {
-    size_t uiTableIndex = 0;
-    if (strHeaderValue.size() == 0)
-    {
-        for (size_t i = 0; i < m_vecEncodingDynamicTable.size(); ++i)
-        {
-            if (m_vecEncodingDynamicTable[i].Name() == strHeaderName)
-            {
-                uiTableIndex = Http2Header::sc_uiMaxStaticTableIndex + i + 1;
-                break;
-            }
-        }
-    }
-    else
-    {
-        for (size_t i = 0; i < m_vecEncodingDynamicTable.size(); ++i)
-        {
-            if (m_vecEncodingDynamicTable[i].Name() == strHeaderName
-                    && m_vecEncodingDynamicTable[i].Value() == strHeaderValue)
-            {
-                uiTableIndex = Http2Header::sc_uiMaxStaticTableIndex + i + 1;
-                break;
-            }
-        }
-    }
-    return(uiTableIndex);
+    size_t uiDynamicTableIndex = m_oEncodingDynamicTable.Find(strHeaderName);
+    return((uiDynamicTableIndex == 0) ? 0 : Http2Header::sc_uiMaxStaticTableIndex + uiDynamicTableIndex);
 }
 
-//size_t CodecHttp2::GetDecodingTableIndex(const std::string& strHeaderName, const std::string& strHeaderValue)
-//{
-//    size_t uiTableIndex = 0;
-//    if (strHeaderValue.size() == 0)
-//    {
-//        for (size_t i = 0; i < m_vecDecodingDynamicTable.size(); ++i)
-//        {
-//            if (m_vecDecodingDynamicTable[i].Name() == strHeaderName)
-//            {
-//                uiTableIndex = Http2Header::sc_uiMaxStaticTableIndex + i + 1;
-//                break;
-//            }
-//        }
-//    }
-//    else
-//    {
-//        for (size_t i = 0; i < m_vecDecodingDynamicTable.size(); ++i)
-//        {
-//            if (m_vecDecodingDynamicTable[i].Name() == strHeaderName
-//                    && m_vecDecodingDynamicTable[i].Value() == strHeaderValue)
-//            {
-//                uiTableIndex = Http2Header::sc_uiMaxStaticTableIndex + i + 1;
-//                break;
-//            }
-//        }
-//    }
-//    return(uiTableIndex);
-//}
+size_t CodecHttp2::GetEncodingTableIndex(const std::string& strHeaderName, const std::string& strHeaderValue)
+{
+    size_t uiDynamicTableIndex = m_oEncodingDynamicTable.Find(strHeaderName, strHeaderValue);
+    return((uiDynamicTableIndex == 0) ? 0 : Http2Header::sc_uiMaxStaticTableIndex + uiDynamicTableIndex);
+}
 
-void CodecHttp2::UpdateEncodingDynamicTable(uint32 uiDynamicTableIndex, const std::string& strHeaderName, const std::string& strHeaderValue)
+void CodecHttp2::UpdateEncodingDynamicTable(const std::string& strHeaderName, const std::string& strHeaderValue)
 {
-    Http2Header oHeader(strHeaderName, strHeaderValue);
-    if (uiDynamicTableIndex <= 0 || uiDynamicTableIndex >= m_vecEncodingDynamicTable.size())   // new header
-    {
-        while (m_uiEncodingDynamicTableSize + oHeader.HpackSize() > m_uiSettingsHeaderTableSize
-                && m_uiEncodingDynamicTableSize > 0)
-        {
-            auto& rLastElement = m_vecEncodingDynamicTable.back();
-            m_uiEncodingDynamicTableSize -= rLastElement.HpackSize();
-            m_vecEncodingDynamicTable.pop_back();
-        }
-        if (oHeader.HpackSize() <= m_uiSettingsHeaderTableSize)
-        {
-            m_vecEncodingDynamicTable.insert(m_vecEncodingDynamicTable.begin(),
-                    std::move(oHeader));
-            m_uiEncodingDynamicTableSize += oHeader.HpackSize();
-        }
-    }
-    else    // replace header ?
-    {
-        while ((m_uiEncodingDynamicTableSize + oHeader.HpackSize()
-                - m_vecEncodingDynamicTable[uiDynamicTableIndex].HpackSize())
-                > m_uiSettingsHeaderTableSize
-                && m_uiEncodingDynamicTableSize > 0)
-        {
-            auto& rLastElement = m_vecEncodingDynamicTable.back();
-            m_uiEncodingDynamicTableSize -= rLastElement.HpackSize();
-            m_vecEncodingDynamicTable.pop_back();
-        }
-        if (oHeader.HpackSize() <= m_uiSettingsHeaderTableSize)
-        {
-            if (uiDynamicTableIndex < m_vecEncodingDynamicTable.size())  // replace header
-            {
-                m_vecEncodingDynamicTable[uiDynamicTableIndex] = std::move(oHeader);
-            }
-            else    // new header
-            {
-                m_vecEncodingDynamicTable.insert(m_vecEncodingDynamicTable.begin(),
-                        std::move(oHeader));
-            }
-            m_uiEncodingDynamicTableSize += oHeader.HpackSize();
-        }
-    }
+    m_oEncodingDynamicTable.Insert(strHeaderName, strHeaderValue, m_uiSettingsHeaderTableSize);
 }
 
 void CodecHttp2::UpdateEncodingDynamicTable(uint32 uiTableSize)
 {
     m_uiSettingsHeaderTableSize = uiTableSize;
-    while (m_uiEncodingDynamicTableSize > m_uiSettingsHeaderTableSize
-            && m_uiEncodingDynamicTableSize > 0)
-    {
-        auto& rLastElement = m_vecEncodingDynamicTable.back();
-        m_uiEncodingDynamicTableSize -= rLastElement.HpackSize();
-        m_vecEncodingDynamicTable.pop_back();
-    }
+    m_oEncodingDynamicTable.Evict(m_uiSettingsHeaderTableSize);
 }
 
-void CodecHttp2::UpdateDecodingDynamicTable(uint32 uiDynamicTableIndex, const std::string& strHeaderName, const std::string& strHeaderValue)
+void CodecHttp2::UpdateDecodingDynamicTable(const std::string& strHeaderName, const std::string& strHeaderValue)
 {
-    Http2Header oHeader(strHeaderName, strHeaderValue);
-    if (uiDynamicTableIndex <= 0 || uiDynamicTableIndex >= m_vecDecodingDynamicTable.size())   // new header
-    {
-        while (m_uiDecodingDynamicTableSize + oHeader.HpackSize() > m_uiSettingsHeaderTableSize
-                && m_uiDecodingDynamicTableSize > 0)
-        {
-            auto& rLastElement = m_vecDecodingDynamicTable.back();
-            m_uiDecodingDynamicTableSize -= rLastElement.HpackSize();
-            m_vecDecodingDynamicTable.pop_back();
-        }
-        if (oHeader.HpackSize() <= m_uiSettingsHeaderTableSize)
-        {
-            m_vecDecodingDynamicTable.insert(m_vecDecodingDynamicTable.begin(),
-                    std::move(oHeader));
-            m_uiDecodingDynamicTableSize += oHeader.HpackSize();
-        }
-    }
-    else    // replace header ?
-    {
-        while ((m_uiDecodingDynamicTableSize + oHeader.HpackSize()
-                - m_vecDecodingDynamicTable[uiDynamicTableIndex].HpackSize())
-                > m_uiSettingsHeaderTableSize
-                && m_uiDecodingDynamicTableSize > 0)
-        {
-            auto& rLastElement = m_vecDecodingDynamicTable.back();
-            m_uiDecodingDynamicTableSize -= rLastElement.HpackSize();
-            m_vecDecodingDynamicTable.pop_back();
-        }
-        if (oHeader.HpackSize() <= m_uiSettingsHeaderTableSize)
-        {
-            if (uiDynamicTableIndex < m_vecDecodingDynamicTable.size())  // replace header
-            {
-                m_vecDecodingDynamicTable[uiDynamicTableIndex] = std::move(oHeader);
-            }
-            else    // new header
-            {
-                m_vecDecodingDynamicTable.insert(m_vecDecodingDynamicTable.begin(),
-                        std::move(oHeader));
-            }
-            m_uiDecodingDynamicTableSize += oHeader.HpackSize();
-        }
-    }
+    m_oDecodingDynamicTable.Insert(strHeaderName, strHeaderValue, m_uiSettingsHeaderTableSize);
 }
 
 void CodecHttp2::UpdateDecodingDynamicTable(uint32 uiTableSize)
 {
     m_uiSettingsHeaderTableSize = uiTableSize;
-    while (m_uiDecodingDynamicTableSize > m_uiSettingsHeaderTableSize
-            && m_uiDecodingDynamicTableSize > 0)
-    {
-        auto& rLastElement = m_vecDecodingDynamicTable.back();
-        m_uiDecodingDynamicTableSize -= rLastElement.HpackSize();
-        m_vecDecodingDynamicTable.pop_back();
-    }
+    m_oDecodingDynamicTable.Evict(m_uiSettingsHeaderTableSize);
 }
 
 void CodecHttp2::CloseStream(uint32 uiStreamId)
 {
-    RstStream(uiStreamId);
+    // 待发送队列中的stream id在发送时发现stream已不存在即跳过，无需在这里从队列中删除
+    Http2Stream* pStream = m_oStreamTable.Erase(uiStreamId);
+    if (pStream != nullptr)
+    {
+        if (pStream->IsWaitting())
+        {
+            --m_uiWaittingStreamNum;
+        }
+        if (pStream == m_pCodingStream)
+        {
+            m_pCodingStream = nullptr;
+        }
+        delete pStream;
+    }
 }
 
 } /* namespace neb */
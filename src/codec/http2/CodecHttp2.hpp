@@ -10,26 +10,24 @@
 #ifndef SRC_CODEC_HTTP2_CODECHTTP2_HPP_
 #define SRC_CODEC_HTTP2_CODECHTTP2_HPP_
 
+#include <deque>
 #include <unordered_map>
+#include <unordered_set>
 #include "codec/Codec.hpp"
 #include "util/http/http_parser.h"
 #include "pb/http.pb.h"
 #include "H2Comm.hpp"
-#include "Tree.hpp"
 #include "Http2Header.hpp"
+#include "Http2DynamicTable.hpp"
+#include "Http2StreamTable.hpp"
+#include "Http2BdpEstimator.hpp"
+#include "Http2PushCache.hpp"
 
 namespace neb
 {
 
 const uint32 STREAM_IDENTIFY_MASK = 0x7FFFFFFF;
 
-struct tagStreamWeight
-{
-    uint32 uiStreamId                       = 0;
-    uint8 ucWeight                          = 0;
-    uint8 ucCurrentWeight                   = 0;
-};
-
 class Http2Frame;
 class Http2Stream;
 
@@ -57,16 +55,41 @@ public:
     virtual void ConnectionSetting(CBuffer* pBuff);
 
 public:
-    bool IsChunkNotice() const
+    void SetPriority(uint32 uiStreamId, const tagPriority& stPriority);
+    /**
+     * @brief 收到对端的RST_STREAM，记录被重置的stream及其错误码
+     */
+    void RstStream(uint32 uiStreamId, uint32 uiErrCode);
+
+    /**
+     * @brief 取消stream：发送RST_STREAM(CANCEL)并关闭stream
+     */
+    void CancelStream(uint32 uiStreamId, CBuffer* pBuff);
+
+    /**
+     * @brief 取出上次取出之后被对端重置的stream
+     * @param vecResetStream 被重置的stream id及RST_STREAM的错误码
+     * @return 是否有被重置的stream
+     */
+    bool TakeResetStreams(std::vector<std::pair<uint32, uint32> >& vecResetStream)
     {
-        return(m_bChunkNotice);
+        if (m_vecResetStream.empty())
+        {
+            return(false);
+        }
+        vecResetStream.swap(m_vecResetStream);
+        m_vecResetStream.clear();
+        return(true);
     }
-    void SetPriority(uint32 uiStreamId, const tagPriority& stPriority);
-    void RstStream(uint32 uiStreamId);
     E_H2_ERR_CODE Setting(const std::vector<tagSetting>& vecSetting);
     void WindowUpdate(uint32 uiStreamId, uint32 uiIncrement);
     void ShrinkSendWindow(uint32 uiStreamId, uint32 uiSendLength);
     void ShrinkRecvWindow(uint32 uiStreamId, uint32 uiRecvLength, CBuffer* pBuff);
+
+    /**
+     * @brief 收到PING ACK，若为BDP探测PING则按估算的BDP增大连接和stream的接收窗口
+     */
+    void PingAck(int32 iPayload1, int32 iPayload2, CBuffer* pBuff);
     uint32 GetSendWindowSize()
     {
         return(m_uiSendWindowSize);
@@ -81,6 +104,7 @@ public:
     E_CODEC_STATUS PromiseStream(uint32 uiStreamId, CBuffer* pReactBuff);
     void SetGoaway(uint32 uiLastStreamId)
     {
+        m_bGoaway = true;
         m_uiGoawayLastStreamId = uiLastStreamId;
     }
     uint32 GetLastStreamId()
@@ -88,15 +112,79 @@ public:
         return(m_uiStreamIdGenerate);
     }
 
+    /**
+     * @brief 能否在当前连接上发起新的stream
+     * @note 未收到GOAWAY且活跃stream数小于对端SETTINGS_MAX_CONCURRENT_STREAMS时可发起。
+     */
+    bool IsStreamAvailable() const
+    {
+        return(!m_bGoaway && m_oStreamTable.Size() < m_uiSettingsMaxConcurrentStreams);
+    }
+
+    /**
+     * @brief 按urgency从高到低、同一urgency内轮转发送各stream的待发送数据帧
+     */
     E_CODEC_STATUS SendWaittingFrameData(CBuffer* pBuff);
+
+    /**
+     * @brief stream有因流控窗口不足而待发送的数据帧，加入待发送队列
+     */
+    void AddWaittingStream(uint32 uiStreamId);
+
+    /**
+     * @brief stream的待发送数据帧已在收到stream级WINDOW_UPDATE时全部发出，移出待发送队列
+     */
+    void DelWaittingStream(uint32 uiStreamId);
+
+    /**
+     * @brief stream当前可立即发送的DATA字节数
+     * @note 取连接和stream发送窗口的较小值；stream已有待发送数据帧时为0，此时继续发送的
+     * 数据帧排在待发送队列之后，收到对端WINDOW_UPDATE后依次发送。
+     */
+    uint32 GetStreamSendWindow(uint32 uiStreamId);
+
+    /**
+     * @brief stream因流控窗口不足尚未发送的字节数，stream不存在返回0
+     */
+    uint32 GetStreamWaittingBytes(uint32 uiStreamId);
+
+    /**
+     * @brief 取出上次取出之后待发送数据已全部发出的stream
+     * @return 是否有这样的stream
+     */
+    bool TakeWritableStreams(std::vector<uint32>& vecStreamId)
+    {
+        if (m_vecWritableStream.empty())
+        {
+            return(false);
+        }
+        vecStreamId.swap(m_vecWritableStream);
+        m_vecWritableStream.clear();
+        return(true);
+    }
     void TransferHoldingMsg(HttpMsg* pHoldingHttpMsg);
 
+    /**
+     * @brief 缓存可推送的资源（本线程所有HTTP2连接共用）
+     * @note 作为服务端发送响应时，响应link头中rel=preload且未标记nopush的同源资源若在缓存中，
+     * 在响应之前以PUSH_PROMISE推送；对端关闭了SETTINGS_ENABLE_PUSH时不推送，同一连接上的
+     * 同一资源只推送一次，资源被替换（再次AddPushResource()）后重新推送。
+     */
+    static bool AddPushResource(const std::string& strPath, const HttpMsg& oResponse)
+    {
+        return(s_oPushCache.Add(strPath, oResponse));
+    }
+
+    static void RemovePushResource(const std::string& strPath)
+    {
+        s_oPushCache.Remove(strPath);
+    }
+
 protected:
     uint32 StreamIdGenerate();
     Http2Stream* NewCodingStream(uint32 uiStreamId);
-    TreeNode<tagStreamWeight>* FindStreamWeight(uint32 uiStreamId, TreeNode<tagStreamWeight>* pTarget);
-    TreeNode<tagStreamWeight>* FindHighestWeightStream();
-    void ReleaseStreamWeight(TreeNode<tagStreamWeight>* pNode);
+    void PushWaittingStream(Http2Stream* pStream, uint32 uiStreamId);
+    static uint8 WeightToUrgency(uint8 ucWeight);
 
     E_CODEC_STATUS UnpackHeaderIndexed(CBuffer* pBuff, HttpMsg& oHttpMsg);
     E_CODEC_STATUS UnpackHeaderLiteralIndexing(CBuffer* pBuff, uint8 ucFirstByte, int32 iPrefixMask,
@@ -108,22 +196,41 @@ protected:
             const std::string& strHeaderValue, bool bWithHuffman, CBuffer* pBuff);
     void PackHeaderWithoutIndexing(const std::string& strHeaderName,
             const std::string& strHeaderValue, bool bWithHuffman, CBuffer* pBuff);
+    void PackHeaderLiteral(const std::string& strHeaderName,
+            const std::string& strHeaderValue, bool bWithHuffman, CBuffer* pBuff);
     void PackHeaderNeverIndexing(const std::string& strHeaderName,
             const std::string& strHeaderValue, bool bWithHuffman, CBuffer* pBuff);
     void PackHeaderDynamicTableSize(uint32 uiDynamicTableSize, CBuffer* pBuff);
-    size_t GetEncodingTableIndex(const std::string& strHeaderName, const std::string& strHeaderValue = "");
-//    size_t GetDecodingTableIndex(const std::string& strHeaderName, const std::string& strHeaderValue = "");
-    void UpdateEncodingDynamicTable(uint32 uiDynamicTableIndex, const std::string& strHeaderName, const std::string& strHeaderValue);
+    size_t GetEncodingTableIndex(const std::string& strHeaderName);
+    size_t GetEncodingTableIndex(const std::string& strHeaderName, const std::string& strHeaderValue);
+    void UpdateEncodingDynamicTable(const std::string& strHeaderName, const std::string& strHeaderValue);
     void UpdateEncodingDynamicTable(uint32 uiTableSize);
-    void UpdateDecodingDynamicTable(uint32 uiDynamicTableIndex, const std::string& strHeaderName, const std::string& strHeaderValue);
+    void UpdateDecodingDynamicTable(const std::string& strHeaderName, const std::string& strHeaderValue);
     void UpdateDecodingDynamicTable(uint32 uiTableSize);
     void CloseStream(uint32 uiStreamId);
 
+    /**
+     * @brief 为响应link头中preload的缓存资源发送PUSH_PROMISE
+     * @param vecPushResponse 保留的stream id及待推送的资源，须在引用它们的响应之后由PushResponse()发送
+     */
+    void PushPreload(const HttpMsg& oHttpMsg, CBuffer* pBuff,
+            std::vector<std::pair<uint32, const HttpMsg*> >& vecPushResponse);
+    /**
+     * @brief 在uiStreamId上发送PUSH_PROMISE并保留推送的stream
+     * @return 保留的stream id，失败返回0
+     */
+    uint32 Push(uint32 uiStreamId, const std::string& strPath, CBuffer* pBuff);
+    /**
+     * @brief 在保留的stream上发送推送资源的响应
+     */
+    void PushResponse(uint32 uiPromiseStreamId, const HttpMsg& oResponse, CBuffer* pBuff);
+
 private:
     bool m_bChannelIsClient = false;    // 当前编解码器所在channel是作为http客户端还是作为http服务端
     bool m_bWantMagic = true;
-    bool m_bChunkNotice = false;        // 是否启用分块传输通知（当包体比较大时，部分传输完毕也会通知业务层而无须等待整个http包传输完毕。）
+    bool m_bGoaway = false;             ///< 是否已收到GOAWAY
     uint32 m_uiStreamIdGenerate = 0;
+    uint32 m_uiPushStreamIdGenerate = 0;        ///< 本端（服务端）推送保留的最大stream id
     uint32 m_uiGoawayLastStreamId = 0;
     uint32 m_uiSettingsEnablePush = 1;
     uint32 m_uiSettingsHeaderTableSize = 4096;
@@ -132,20 +239,30 @@ private:
     uint32 m_uiSettingsMaxFrameSize = DEFAULT_SETTINGS_MAX_FRAME_SIZE;
     uint32 m_uiSettingsMaxHeaderListSize = 50;  // TODO SettingsMaxHeaderListSize
     uint32 m_uiSendWindowSize = DEFAULT_SETTINGS_MAX_INITIAL_WINDOW_SIZE;
-    uint32 m_uiRecvWindowSize = DEFAULT_SETTINGS_MAX_INITIAL_WINDOW_SIZE;
+    uint32 m_uiRecvWindowSize = DEFAULT_SETTINGS_MAX_INITIAL_WINDOW_SIZE;     ///< 连接的接收窗口大小
+    uint32 m_uiRecvWindowUnacked = 0;                                       ///< 已接收但尚未通过WINDOW_UPDATE归还的字节数
+    uint32 m_uiLocalInitialWindowSize = DEFAULT_SETTINGS_MAX_INITIAL_WINDOW_SIZE;   ///< 本端通告的SETTINGS_INITIAL_WINDOW_SIZE
     tagH2FrameHead m_stFrameHead;
     HttpMsg* m_pHoldingHttpMsg = nullptr;       // upgrade未完成时暂存请求
     Http2Frame* m_pFrame = nullptr;
     Http2Stream* m_pCodingStream = nullptr;
-    std::unordered_map<uint32, Http2Stream*> m_mapStream;
-    TreeNode<tagStreamWeight>* m_pStreamWeightRoot = nullptr;
+    Http2StreamTable m_oStreamTable;
+    Http2BdpEstimator m_oBdpEstimator;
+    std::deque<std::pair<uint32, uint32> > m_aWaittingStream[H2_URGENCY_NUM];  ///< 按urgency分桶的待发送stream id及条目序号
+    uint32 m_uiWaittingSeqGenerate = 0;
+    uint32 m_uiWaittingStreamNum = 0;                         ///< 待发送队列中的有效stream数
+    std::vector<std::pair<uint32, uint32> > m_vecResetStream; ///< 被对端重置、尚未通知业务层的stream id及错误码
+    std::vector<uint32> m_vecWritableStream;                  ///< 待发送数据已全部发出、尚未通知业务层的stream id
 
-    uint32 m_uiEncodingDynamicTableSize = 0;
-    uint32 m_uiDecodingDynamicTableSize = 0;
-    std::vector<Http2Header> m_vecEncodingDynamicTable;
-    std::vector<Http2Header> m_vecDecodingDynamicTable;
+    Http2DynamicTable m_oEncodingDynamicTable{true};
+    Http2DynamicTable m_oDecodingDynamicTable{false};
     std::unordered_set<std::string> m_setEncodingWithoutIndexHeaders;
     std::unordered_set<std::string> m_setEncodingNeverIndexHeaders;
+    std::string m_strAuthority;                 ///< 最近请求的:authority，推送资源的请求头沿用
+    std::string m_strScheme;                    ///< 最近请求的:scheme
+    std::unordered_map<std::string, uint64> m_mapPushedVersion; ///< 本连接上已推送的资源路径及其版本号
+
+    static thread_local Http2PushCache s_oPushCache;
 };
 
 } /* namespace neb */
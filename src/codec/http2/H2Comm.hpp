@@ -18,6 +18,9 @@ const uint32 SETTINGS_MAX_FRAME_SIZE = 16777215;                // (2^24) - 1;
 const uint32 DEFAULT_SETTINGS_MAX_FRAME_SIZE = 16384;           // (2^14);
 const uint32 SETTINGS_MAX_INITIAL_WINDOW_SIZE = 2147483647;     // (2^31) - 1;
 const uint32 DEFAULT_SETTINGS_MAX_INITIAL_WINDOW_SIZE = 65535;  // (2^16) - 1;
+const uint8 H2_URGENCY_NUM = 8;                                // rfc9218 urgency 0~7，0最紧急
+const uint8 H2_DEFAULT_URGENCY = 3;                             // rfc9218 4.1
+const uint32 H2_STREAM_MAX_WAITTING_BYTES = 4194304;            // 单个stream因流控待发送的数据上限，超过后拒绝发送新的消息
 
 /*
  * @see https://httpwg.org/specs/rfc7540.html#FRAME_SIZE_ERROR
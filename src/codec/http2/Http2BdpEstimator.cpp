@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     Http2BdpEstimator.cpp
+ * @brief    HTTP2接收窗口的带宽时延积（BDP）估算
+ * @author   nebim
+ * @date:    2026-10-18
+ * @note
+ * Modify history:
+ ******************************************************************************/
+#include "Http2BdpEstimator.hpp"
+
+namespace neb
+{
+
+Http2BdpEstimator::Http2BdpEstimator()
+    : m_bPinging(false), m_uiBdp(DEFAULT_SETTINGS_MAX_INITIAL_WINDOW_SIZE),
+      m_uiSample(0), m_uiSampleCount(0), m_dRtt(0.0), m_dBandwidthMax(0.0)
+{
+}
+
+Http2BdpEstimator::~Http2BdpEstimator()
+{
+}
+
+bool Http2BdpEstimator::Add(uint32 uiRecvLength)
+{
+    if (m_uiBdp >= BDP_LIMIT)
+    {
+        return(false);
+    }
+    if (m_bPinging)
+    {
+        m_uiSample += uiRecvLength;
+        return(false);
+    }
+    m_bPinging = true;
+    m_uiSample = uiRecvLength;
+    m_oPingTime = std::chrono::steady_clock::now();
+    return(true);
+}
+
+uint32 Http2BdpEstimator::Calculate()
+{
+    if (!m_bPinging)
+    {
+        return(0);
+    }
+    m_bPinging = false;
+    double dRttSample = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - m_oPingTime).count();
+    if (dRttSample <= 0.0)
+    {
+        return(0);
+    }
+    // 前10次采样取平均值，之后按0.1的权重平滑
+    ++m_uiSampleCount;
+    if (m_uiSampleCount <= 10)
+    {
+        m_dRtt += (dRttSample - m_dRtt) / m_uiSampleCount;
+    }
+    else
+    {
+        m_dRtt += (dRttSample - m_dRtt) * 0.1;
+    }
+    // 采样期间可能还收到了PING之前发出的数据，RTT放大1.5倍以免高估带宽
+    double dBandwidth = (double)m_uiSample / (m_dRtt * 1.5);
+    if (dBandwidth <= m_dBandwidthMax)
+    {
+        return(0);
+    }
+    m_dBandwidthMax = dBandwidth;
+    if ((uint64)m_uiSample * 3 < (uint64)m_uiBdp * 2)
+    {
+        return(0);
+    }
+    uint64 ullBdp = (uint64)m_uiSample * 2;
+    m_uiBdp = (ullBdp < BDP_LIMIT) ? (uint32)ullBdp : BDP_LIMIT;
+    return(m_uiBdp);
+}
+
+} /* namespace neb */
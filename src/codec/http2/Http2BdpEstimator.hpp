@@ -0,0 +1,72 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     Http2BdpEstimator.hpp
+ * @brief    HTTP2接收窗口的带宽时延积（BDP）估算
+ * @author   nebim
+ * @date:    2026-10-18
+ * @note     收到DATA帧时若没有未确认的探测PING则发出一个，从发出PING到收到PING ACK
+ *           期间接收的字节数即为一个RTT内收到的数据量（BDP采样）。采样达到当前窗口
+ *           的2/3且带宽创新高时，说明接收窗口限制了吞吐，窗口增长为采样的2倍，直到
+ *           BDP_LIMIT。
+ * Modify history:
+ ******************************************************************************/
+#ifndef SRC_CODEC_HTTP2_HTTP2BDPESTIMATOR_HPP_
+#define SRC_CODEC_HTTP2_HTTP2BDPESTIMATOR_HPP_
+
+#include <chrono>
+#include "Definition.hpp"
+#include "H2Comm.hpp"
+
+namespace neb
+{
+
+class Http2BdpEstimator
+{
+public:
+    static const int32 PING_PAYLOAD1 = 0x62647020;     ///< 探测PING的payload，用于与其他PING区分
+    static const int32 PING_PAYLOAD2 = 0x65737469;
+    static const uint32 BDP_LIMIT = 16777216;           ///< 窗口增长上限（16MB）
+
+    Http2BdpEstimator();
+    Http2BdpEstimator(const Http2BdpEstimator&) = delete;
+    Http2BdpEstimator& operator=(const Http2BdpEstimator&) = delete;
+    ~Http2BdpEstimator();
+
+    static bool IsBdpPing(int32 iPayload1, int32 iPayload2)
+    {
+        return(PING_PAYLOAD1 == iPayload1 && PING_PAYLOAD2 == iPayload2);
+    }
+
+    /**
+     * @brief 设置当前接收窗口大小（连接建立时通告的窗口）
+     */
+    void SetBdp(uint32 uiBdp)
+    {
+        m_uiBdp = uiBdp;
+    }
+
+    /**
+     * @brief 累计接收的DATA帧字节数
+     * @return 是否需要发出探测PING
+     */
+    bool Add(uint32 uiRecvLength);
+
+    /**
+     * @brief 收到探测PING的ACK，完成一次采样
+     * @return 增长后的窗口大小，窗口不需要增长则返回0
+     */
+    uint32 Calculate();
+
+private:
+    bool m_bPinging;
+    uint32 m_uiBdp;                 ///< 当前估算的BDP（即接收窗口大小）
+    uint32 m_uiSample;              ///< 本次采样期间接收的字节数
+    uint32 m_uiSampleCount;
+    double m_dRtt;                  ///< 平滑后的RTT（秒）
+    double m_dBandwidthMax;         ///< 采样得到的最大带宽（字节/秒）
+    std::chrono::steady_clock::time_point m_oPingTime;
+};
+
+} /* namespace neb */
+
+#endif /* SRC_CODEC_HTTP2_HTTP2BDPESTIMATOR_HPP_ */
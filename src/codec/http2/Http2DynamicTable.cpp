@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     Http2DynamicTable.cpp
+ * @brief    HPACK动态表
+ * @author   nebim
+ * @date:    2026-10-18
+ * @note
+ * Modify history:
+ ******************************************************************************/
+#include "Http2DynamicTable.hpp"
+
+namespace neb
+{
+
+Http2DynamicTable::Http2DynamicTable(bool bWithIndex)
+    : m_bWithIndex(bWithIndex), m_uiMask(INIT_CAPACITY - 1),
+      m_uiEntryNum(0), m_uiHpackSize(0), m_ullInsertNum(0),
+      m_vecEntry(INIT_CAPACITY)
+{
+}
+
+Http2DynamicTable::~Http2DynamicTable()
+{
+}
+
+void Http2DynamicTable::Insert(const std::string& strName, const std::string& strValue, size_t uiMaxHpackSize)
+{
+    size_t uiNewHpackSize = strName.size() + strValue.size() + 32;
+    while (m_uiEntryNum > 0 && m_uiHpackSize + uiNewHpackSize > uiMaxHpackSize)
+    {
+        EvictOldest();
+    }
+    if (uiNewHpackSize > uiMaxHpackSize)
+    {
+        return;
+    }
+    if (m_uiEntryNum == m_vecEntry.size())
+    {
+        Grow();
+    }
+    // 新条目的槽位要么从未使用过，要么属于已淘汰的条目，直接在原字符串内存上赋值
+    uint64 ullInsertId = m_ullInsertNum;
+    m_vecEntry[ullInsertId & m_uiMask].Assign(strName, strValue);
+    ++m_ullInsertNum;
+    ++m_uiEntryNum;
+    m_uiHpackSize += uiNewHpackSize;
+    AddIndex(ullInsertId);
+}
+
+void Http2DynamicTable::Evict(size_t uiMaxHpackSize)
+{
+    while (m_uiEntryNum > 0 && m_uiHpackSize > uiMaxHpackSize)
+    {
+        EvictOldest();
+    }
+}
+
+size_t Http2DynamicTable::Find(const std::string& strName) const
+{
+    auto iter = m_mapNameIndex.find(tagHeaderView(strName.data(), strName.size(), "", 0));
+    if (iter == m_mapNameIndex.end())
+    {
+        return(0);
+    }
+    return(m_ullInsertNum - iter->second);
+}
+
+size_t Http2DynamicTable::Find(const std::string& strName, const std::string& strValue) const
+{
+    auto iter = m_mapNameValueIndex.find(
+            tagHeaderView(strName.data(), strName.size(), strValue.data(), strValue.size()));
+    if (iter == m_mapNameValueIndex.end())
+    {
+        return(0);
+    }
+    return(m_ullInsertNum - iter->second);
+}
+
+void Http2DynamicTable::EvictOldest()
+{
+    uint64 ullOldestId = m_ullInsertNum - m_uiEntryNum;
+    DelIndex(ullOldestId);
+    m_uiHpackSize -= m_vecEntry[ullOldestId & m_uiMask].HpackSize();
+    --m_uiEntryNum;
+}
+
+void Http2DynamicTable::Grow()
+{
+    std::vector<Http2Header> vecEntry(m_vecEntry.size() * 2);
+    size_t uiNewMask = vecEntry.size() - 1;
+    for (uint64 ullId = m_ullInsertNum - m_uiEntryNum; ullId < m_ullInsertNum; ++ullId)
+    {
+        vecEntry[ullId & uiNewMask] = std::move(m_vecEntry[ullId & m_uiMask]);
+    }
+    m_vecEntry.swap(vecEntry);
+    m_uiMask = uiNewMask;
+    if (m_bWithIndex)
+    {
+        // 字符串移动后数据地址可能变化（短字符串），索引的键须重建
+        m_mapNameIndex.clear();
+        m_mapNameValueIndex.clear();
+        for (uint64 ullId = m_ullInsertNum - m_uiEntryNum; ullId < m_ullInsertNum; ++ullId)
+        {
+            AddIndex(ullId);
+        }
+    }
+}
+
+void Http2DynamicTable::AddIndex(uint64 ullInsertId)
+{
+    if (m_bWithIndex)
+    {
+        const Http2Header& oHeader = m_vecEntry[ullInsertId & m_uiMask];
+        SetIndex(m_mapNameIndex, NameView(oHeader), ullInsertId);
+        SetIndex(m_mapNameValueIndex, NameValueView(oHeader), ullInsertId);
+    }
+}
+
+void Http2DynamicTable::DelIndex(uint64 ullInsertId)
+{
+    if (m_bWithIndex)
+    {
+        const Http2Header& oHeader = m_vecEntry[ullInsertId & m_uiMask];
+        UnsetIndex(m_mapNameIndex, NameView(oHeader), ullInsertId);
+        UnsetIndex(m_mapNameValueIndex, NameValueView(oHeader), ullInsertId);
+    }
+}
+
+void Http2DynamicTable::SetIndex(T_MAP_HEADER_INDEX& mapIndex, const tagHeaderView& stView, uint64 ullInsertId)
+{
+    // 已存在相同的键时先删除，使键指向最新条目的字符串（旧条目先于新条目淘汰）
+    auto iter = mapIndex.find(stView);
+    if (iter != mapIndex.end())
+    {
+        mapIndex.erase(iter);
+    }
+    mapIndex.insert(std::make_pair(stView, ullInsertId));
+}
+
+void Http2DynamicTable::UnsetIndex(T_MAP_HEADER_INDEX& mapIndex, const tagHeaderView& stView, uint64 ullInsertId)
+{
+    auto iter = mapIndex.find(stView);
+    if (iter != mapIndex.end() && iter->second == ullInsertId)
+    {
+        mapIndex.erase(iter);
+    }
+}
+
+} /* namespace neb */
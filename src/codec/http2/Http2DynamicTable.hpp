@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     Http2DynamicTable.hpp
+ * @brief    HPACK动态表
+ * @author   nebim
+ * @date:    2026-10-18
+ * @note     环形数组实现的HPACK动态表（rfc7541 2.3.2），新条目插入到队头、旧条目
+ *           从队尾淘汰，均为O(1)。条目按插入序号（单调递增）定位：序号为n的条目
+ *           位于环形数组的n & mask槽位，动态表索引1对应最新插入的条目。
+ *           编码端可启用哈希索引，按name和(name, value)找到最新的条目，索引的键是
+ *           指向条目自身字符串的视图，查找不构造字符串。
+ * Modify history:
+ ******************************************************************************/
+#ifndef SRC_CODEC_HTTP2_HTTP2DYNAMICTABLE_HPP_
+#define SRC_CODEC_HTTP2_HTTP2DYNAMICTABLE_HPP_
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "Definition.hpp"
+#include "Http2Header.hpp"
+
+namespace neb
+{
+
+class Http2DynamicTable
+{
+public:
+    /**
+     * @param bWithIndex 是否建立哈希索引（编码端需要，解码端只按索引号访问）
+     */
+    explicit Http2DynamicTable(bool bWithIndex);
+    Http2DynamicTable(const Http2DynamicTable&) = delete;
+    Http2DynamicTable& operator=(const Http2DynamicTable&) = delete;
+    virtual ~Http2DynamicTable();
+
+    /**
+     * @brief 条目数量
+     */
+    size_t Size() const
+    {
+        return(m_uiEntryNum);
+    }
+
+    /**
+     * @brief 动态表大小（rfc7541 4.1）
+     */
+    size_t HpackSize() const
+    {
+        return(m_uiHpackSize);
+    }
+
+    /**
+     * @brief 按动态表索引取条目
+     * @param uiIndex 动态表索引，从1开始，必须不大于Size()
+     */
+    const Http2Header& Get(size_t uiIndex) const
+    {
+        return(m_vecEntry[(m_ullInsertNum - uiIndex) & m_uiMask]);
+    }
+
+    /**
+     * @brief 插入新条目，必要时从队尾淘汰旧条目
+     * @note 新条目大于uiMaxHpackSize时清空动态表且不插入（rfc7541 4.4）。
+     */
+    void Insert(const std::string& strName, const std::string& strValue, size_t uiMaxHpackSize);
+
+    /**
+     * @brief 动态表大小上限变更，淘汰超出部分（rfc7541 4.3）
+     */
+    void Evict(size_t uiMaxHpackSize);
+
+    /**
+     * @brief 查找name相同的最新条目（须启用哈希索引）
+     * @return 动态表索引，从1开始，不存在返回0
+     */
+    size_t Find(const std::string& strName) const;
+
+    /**
+     * @brief 查找name和value都相同的最新条目（须启用哈希索引）
+     * @return 动态表索引，从1开始，不存在返回0
+     */
+    size_t Find(const std::string& strName, const std::string& strValue) const;
+
+protected:
+    struct tagHeaderView
+    {
+        const char* pName;
+        size_t uiNameLen;
+        const char* pValue;
+        size_t uiValueLen;
+
+        tagHeaderView(const char* szName, size_t uiNameSize, const char* szValue, size_t uiValueSize)
+            : pName(szName), uiNameLen(uiNameSize), pValue(szValue), uiValueLen(uiValueSize)
+        {
+        }
+
+        bool operator==(const tagHeaderView& stOther) const
+        {
+            return(uiNameLen == stOther.uiNameLen && uiValueLen == stOther.uiValueLen
+                    && 0 == memcmp(pName, stOther.pName, uiNameLen)
+                    && 0 == memcmp(pValue, stOther.pValue, uiValueLen));
+        }
+    };
+
+    struct HeaderViewHash
+    {
+        size_t operator()(const tagHeaderView& stView) const
+        {
+            // FNV-1a，name与value之间加分隔字节
+            uint64 ullHash = 14695981039346656037ULL;
+            for (size_t i = 0; i < stView.uiNameLen; ++i)
+            {
+                ullHash = (ullHash ^ (unsigned char)stView.pName[i]) * 1099511628211ULL;
+            }
+            ullHash = (ullHash ^ 0xFF) * 1099511628211ULL;
+            for (size_t i = 0; i < stView.uiValueLen; ++i)
+            {
+                ullHash = (ullHash ^ (unsigned char)stView.pValue[i]) * 1099511628211ULL;
+            }
+            return((size_t)ullHash);
+        }
+    };
+
+    typedef std::unordered_map<tagHeaderView, uint64, HeaderViewHash> T_MAP_HEADER_INDEX;
+
+    static tagHeaderView NameView(const Http2Header& oHeader)
+    {
+        return(tagHeaderView(oHeader.Name().data(), oHeader.Name().size(), "", 0));
+    }
+
+    static tagHeaderView NameValueView(const Http2Header& oHeader)
+    {
+        return(tagHeaderView(oHeader.Name().data(), oHeader.Name().size(),
+                oHeader.Value().data(), oHeader.Value().size()));
+    }
+
+    void EvictOldest();
+    void Grow();
+    void AddIndex(uint64 ullInsertId);
+    void DelIndex(uint64 ullInsertId);
+
+    static void SetIndex(T_MAP_HEADER_INDEX& mapIndex, const tagHeaderView& stView, uint64 ullInsertId);
+    static void UnsetIndex(T_MAP_HEADER_INDEX& mapIndex, const tagHeaderView& stView, uint64 ullInsertId);
+
+private:
+    static const size_t INIT_CAPACITY = 64;     ///< 必须为2的幂，4096字节的动态表最多128个条目
+
+    bool m_bWithIndex;
+    size_t m_uiMask;
+    size_t m_uiEntryNum;
+    size_t m_uiHpackSize;
+    uint64 m_ullInsertNum;                      ///< 已插入的条目总数，最新条目的插入序号为m_ullInsertNum - 1
+    std::vector<Http2Header> m_vecEntry;
+    T_MAP_HEADER_INDEX m_mapNameIndex;          ///< name -> 最新条目的插入序号
+    T_MAP_HEADER_INDEX m_mapNameValueIndex;     ///< (name, value) -> 最新条目的插入序号
+};
+
+} /* namespace neb */
+
+#endif /* SRC_CODEC_HTTP2_HTTP2DYNAMICTABLE_HPP_ */
@@ -104,14 +104,16 @@ E_CODEC_STATUS Http2Frame::Encode(CodecHttp2* pCodecH2,
         const HttpMsg& oHttpMsg, const tagPriority& stPriority,
         const std::string& strPadding, CBuffer* pBuff)
 {
+    /* 分段发送（chunk_notice为true）：encoding为0时发送http头，大于0时只发送DATA和trailer；
+     * is_decoding为true表示stream还有后续数据，不设置END_STREAM */
     bool bEndStream = false;
+    bool bMoreData = (oHttpMsg.chunk_notice() && oHttpMsg.is_decoding());
+    bool bWithHeaders = (!oHttpMsg.chunk_notice() || 0 == oHttpMsg.encoding());
     E_CODEC_STATUS eCodecStatus = CODEC_STATUS_OK;
-    if (oHttpMsg.headers_size() > 0)
+    if (bWithHeaders)
     {
-        if (oHttpMsg.body().size() == 0)
-        {
-            bEndStream = true;
-        }
+        // 没有包体时trailer随http头在同一个HEADERS帧发送（如gRPC的Trailers-Only响应）
+        bEndStream = (oHttpMsg.body().size() == 0 && !bMoreData);
         eCodecStatus = EncodeHeaders(pCodecH2, oHttpMsg.stream_id(), oHttpMsg, stPriority, strPadding, bEndStream, pBuff);
         if (CODEC_STATUS_PART_ERR == eCodecStatus
                 || CODEC_STATUS_ERR == eCodecStatus)
@@ -121,10 +123,7 @@ E_CODEC_STATUS Http2Frame::Encode(CodecHttp2* pCodecH2,
     }
     if (oHttpMsg.body().size() > 0)
     {
-        if (oHttpMsg.trailer_header_size() == 0)
-        {
-            bEndStream = true;
-        }
+        bEndStream = (oHttpMsg.trailer_header_size() == 0 && !bMoreData);
         eCodecStatus = EncodeData(pCodecH2, oHttpMsg.stream_id(), oHttpMsg, bEndStream, strPadding, pBuff);
         if (CODEC_STATUS_PART_ERR == eCodecStatus
                 || CODEC_STATUS_ERR == eCodecStatus)
@@ -132,8 +131,20 @@ E_CODEC_STATUS Http2Frame::Encode(CodecHttp2* pCodecH2,
             return(eCodecStatus);
         }
     }
-    if (oHttpMsg.trailer_header_size() > 0)
+    else if (!bWithHeaders && !bMoreData && oHttpMsg.trailer_header_size() == 0)
+    {
+        // 分段发送的最后一段既无包体也无trailer，以空DATA帧结束stream
+        uint32 uiEncodedDataLen = 0;
+        eCodecStatus = EncodeData(pCodecH2, oHttpMsg.stream_id(), "", 0, true, strPadding, uiEncodedDataLen, pBuff);
+    }
+    if (oHttpMsg.trailer_header_size() > 0
+            && (oHttpMsg.body().size() > 0 || !bWithHeaders))
     {
+        if (!m_listWaittingFrameData.empty())
+        {
+            // 还有因流控窗口不足而待发送的DATA帧，trailer须排在其后发送
+            return(EncodeWaittingTrailer(pCodecH2, oHttpMsg.stream_id(), oHttpMsg));
+        }
         bEndStream = true;
         eCodecStatus = EncodeHeaders(pCodecH2, oHttpMsg.stream_id(), oHttpMsg, stPriority, strPadding, bEndStream, pBuff);
     }
@@ -323,11 +334,11 @@ E_CODEC_STATUS Http2Frame::DecodeRstStream(CodecHttp2* pCodecH2,
         return(CODEC_STATUS_ERR);
     }
     int32 iErrCode = 0;
-    pBuff->Read(&iErrCode, 4);    // the error code should be H2_ERR_CANCEL
+    pBuff->Read(&iErrCode, 4);
     iErrCode = CodecUtil::N2H((uint32)iErrCode);
     pCodecH2->SetErrno(iErrCode);
-    pCodecH2->RstStream(stFrameHead.uiStreamIdentifier);
-    return(CODEC_STATUS_PART_ERR);
+    pCodecH2->RstStream(stFrameHead.uiStreamIdentifier, (uint32)iErrCode);
+    return(CODEC_STATUS_PART_OK);   // 只关闭该stream，连接上后续的帧继续解码
 }
 
 E_CODEC_STATUS Http2Frame::DecodeSetting(CodecHttp2* pCodecH2,
@@ -462,7 +473,11 @@ E_CODEC_STATUS Http2Frame::DecodePing(CodecHttp2* pCodecH2,
     int iPayload2 = 0;
     pBuff->Read(&iPayload1, 4);
     pBuff->Read(&iPayload2, 4);
-    if (!(stFrameHead.ucFlag & H2_FRAME_FLAG_ACK))
+    if (stFrameHead.ucFlag & H2_FRAME_FLAG_ACK)
+    {
+        pCodecH2->PingAck(iPayload1, iPayload2, pReactBuff);
+    }
+    else
     {
         EncodePing(pCodecH2, true, iPayload1, iPayload2, pReactBuff);
     }
@@ -511,7 +526,7 @@ E_CODEC_STATUS Http2Frame::DecodeWindowUpdate(CodecHttp2* pCodecH2,
     uint32 uiIncrement = 0;
     pBuff->Read(&uiIncrement, 4);
     //cR = (uiIncrement & H2_DATA_MASK_4_BYTE_HIGHEST_BIT) >> 31;
-    uiIncrement = CodecUtil::N2H(stFrameHead.uiStreamIdentifier & H2_DATA_MASK_4_BYTE_LOW_31_BIT);
+    uiIncrement = CodecUtil::N2H(uiIncrement) & H2_DATA_MASK_4_BYTE_LOW_31_BIT;
     if (uiIncrement == 0)
     {
         // TODO just to confirm: curl --http2 receive MAGIC SETTING SETTING_ACK WINDOW_UPDATE(with an flow-control window increment of 0)
@@ -540,7 +555,10 @@ E_CODEC_STATUS Http2Frame::DecodeWindowUpdate(CodecHttp2* pCodecH2,
         pCodecH2->WindowUpdate(stFrameHead.uiStreamIdentifier, uiIncrement);
         if (stFrameHead.uiStreamIdentifier > 0)
         {
-            SendWaittingFrameData(pCodecH2, pReactBuff);
+            if (SendWaittingFrameData(pCodecH2, pReactBuff) == CODEC_STATUS_OK)
+            {
+                pCodecH2->DelWaittingStream(stFrameHead.uiStreamIdentifier);
+            }
         }
         else
         {
@@ -593,16 +611,18 @@ E_CODEC_STATUS Http2Frame::EncodeData(CodecHttp2* pCodecH2,
     const char* pBodyData = oHttpMsg.body().c_str();
     uint32 uiDataLen = oHttpMsg.body().size();
     uint32 uiEncodedDataLen = 0;
-    while (uiEncodedDataLen < uiDataLen)
+    while (uiDataLen > 0)
     {
         eEncodeStatus = EncodeData(pCodecH2, uiStreamId, pBodyData, uiDataLen, bEndStream, strPadding, uiEncodedDataLen, pBuff);
-        if (eEncodeStatus != CODEC_STATUS_OK)
+        if (CODEC_STATUS_PART_ERR == eEncodeStatus
+                || CODEC_STATUS_ERR == eEncodeStatus)
         {
             return(eEncodeStatus);
         }
         pBodyData += uiEncodedDataLen;
         uiDataLen -= uiEncodedDataLen;
     }
+    // 最后一帧已发送为CODEC_STATUS_OK，在待发送队列中为CODEC_STATUS_PART_OK
     return(eEncodeStatus);
 }
 
@@ -817,97 +837,57 @@ E_CODEC_STATUS Http2Frame::EncodeSetting(CodecHttp2* pCodecH2, CBuffer* pBuff)
 
 E_CODEC_STATUS Http2Frame::EncodePushPromise(CodecHttp2* pCodecH2,
         uint32 uiStreamId, uint32 uiPromiseStreamId,
-        const std::string& strPadding, const HttpMsg& oHttpMsg,
-        bool bEndStream, CBuffer* pBuff)
+        const std::string& strPadding, const HttpMsg& oHttpMsg, CBuffer* pBuff)
 {
-    if (uiStreamId == 0x0)
+    if (uiStreamId == 0x0 || strPadding.size() > 255)
     {
         pCodecH2->SetErrno(H2_ERR_PROTOCOL_ERROR);
         return(CODEC_STATUS_ERR);
     }
 
+    // PUSH_PROMISE帧没有END_STREAM标志，header block为被推送资源的请求头
     tagH2FrameHead stFrameHead;
     CBuffer oBuffer;
     stFrameHead.cR = 0;
-    stFrameHead.ucType = H2_FRAME_HEADERS;
+    stFrameHead.ucType = H2_FRAME_PUSH_PROMISE;
     stFrameHead.ucFlag = 0;
     stFrameHead.uiStreamIdentifier = uiStreamId;
-    if (bEndStream && oHttpMsg.body().size() > 0)
+    pCodecH2->PackHeader(oHttpMsg, H2_HEADER_PSEUDO | H2_HEADER_NORMAL, &oBuffer);
+    uint32 uiNetPromiseStreamId = CodecUtil::H2N(uiPromiseStreamId & H2_DATA_MASK_4_BYTE_LOW_31_BIT);
+    uint8 ucPadLength = (uint8)strPadding.size();
+    uint32 uiAddtionLength = 4;
+    if (strPadding.size() > 0)
+    {
+        stFrameHead.ucFlag |= H2_FRAME_FLAG_PADDED;
+        uiAddtionLength = 5 + strPadding.size();
+    }
+    stFrameHead.uiLength = uiAddtionLength + oBuffer.ReadableBytes();
+    bool bEndHeaders = true;
+    if (stFrameHead.uiLength > pCodecH2->GetMaxFrameSize())
     {
-        pCodecH2->PackHeader(oHttpMsg, true, &oBuffer);
+        stFrameHead.uiLength = pCodecH2->GetMaxFrameSize();
+        bEndHeaders = false;
     }
     else
     {
-        pCodecH2->PackHeader(oHttpMsg, false, &oBuffer);
+        stFrameHead.ucFlag |= H2_FRAME_FLAG_END_HEADERS;
     }
-    uint32 uiAddtionLength = 0;
+    EncodeFrameHeader(stFrameHead, pBuff);
     if (strPadding.size() > 0)
     {
-        stFrameHead.ucFlag |= H2_FRAME_FLAG_PADDED;
-        stFrameHead.uiLength = 5 + oBuffer.ReadableBytes() + strPadding.size();
-        uiAddtionLength = 5 + strPadding.size();
-        if (stFrameHead.uiLength > pCodecH2->GetMaxFrameSize())
-        {
-            stFrameHead.uiLength = pCodecH2->GetMaxFrameSize();
-            EncodeFrameHeader(stFrameHead, pBuff);
-            uint16 unNetLength = CodecUtil::H2N(strPadding.size());
-            pBuff->Write(&unNetLength, 1);
-            // ignore R
-            pBuff->Write(&uiPromiseStreamId, 4);
-            pBuff->Write(oBuffer.GetRawReadBuffer(), stFrameHead.uiLength - uiAddtionLength);
-            pBuff->Write(strPadding.c_str(), strPadding.size());
-            oBuffer.AdvanceReadIndex(stFrameHead.uiLength - uiAddtionLength);
-            EncodeSetStreamState(stFrameHead);
-            return(EncodeContinuation(pCodecH2, uiStreamId, bEndStream, &oBuffer, pBuff));
-        }
-        else
-        {
-            stFrameHead.ucFlag |= H2_FRAME_FLAG_END_HEADERS;
-            if (bEndStream)
-            {
-                stFrameHead.ucFlag |= H2_FRAME_FLAG_END_STREAM;
-            }
-            EncodeFrameHeader(stFrameHead, pBuff);
-            uint16 unNetLength = CodecUtil::H2N(strPadding.size());
-            pBuff->Write(&unNetLength, 1);
-            // ignore R
-            pBuff->Write(&uiPromiseStreamId, 4);
-            pBuff->Write(oBuffer.GetRawReadBuffer(), stFrameHead.uiLength);
-            pBuff->Write(strPadding.c_str(), strPadding.size());
-            EncodeSetStreamState(stFrameHead);
-            return(CODEC_STATUS_OK);
-        }
+        pBuff->Write(&ucPadLength, 1);
     }
-    else
+    // ignore R
+    pBuff->Write(&uiNetPromiseStreamId, 4);
+    pBuff->Write(oBuffer.GetRawReadBuffer(), stFrameHead.uiLength - uiAddtionLength);
+    pBuff->Write(strPadding.c_str(), strPadding.size());
+    oBuffer.AdvanceReadIndex(stFrameHead.uiLength - uiAddtionLength);
+    EncodeSetStreamState(stFrameHead);
+    if (bEndHeaders)
     {
-        stFrameHead.uiLength = 4 + oBuffer.ReadableBytes();
-        uiAddtionLength = 4;
-        if (stFrameHead.uiLength > pCodecH2->GetMaxFrameSize())
-        {
-            stFrameHead.uiLength = pCodecH2->GetMaxFrameSize();
-            EncodeFrameHeader(stFrameHead, pBuff);
-            // ignore R
-            pBuff->Write(&uiPromiseStreamId, 4);
-            pBuff->Write(oBuffer.GetRawReadBuffer(), stFrameHead.uiLength - uiAddtionLength);
-            oBuffer.AdvanceReadIndex(stFrameHead.uiLength - uiAddtionLength);
-            EncodeSetStreamState(stFrameHead);
-            return(EncodeContinuation(pCodecH2, uiStreamId, bEndStream, &oBuffer, pBuff));
-        }
-        else
-        {
-            stFrameHead.ucFlag |= H2_FRAME_FLAG_END_HEADERS;
-            if (bEndStream)
-            {
-                stFrameHead.ucFlag |= H2_FRAME_FLAG_END_STREAM;
-            }
-            EncodeFrameHeader(stFrameHead, pBuff);
-            // ignore R
-            pBuff->Write(&uiPromiseStreamId, 4);
-            pBuff->Write(oBuffer.GetRawReadBuffer(), stFrameHead.uiLength);
-            EncodeSetStreamState(stFrameHead);
-            return(CODEC_STATUS_OK);
-        }
+        return(CODEC_STATUS_OK);
     }
+    return(EncodeContinuation(pCodecH2, uiStreamId, false, &oBuffer, pBuff));
 }
 
 E_CODEC_STATUS Http2Frame::EncodePing(CodecHttp2* pCodecH2,
@@ -999,7 +979,7 @@ E_CODEC_STATUS Http2Frame::EncodeContinuation(CodecHttp2* pCodecH2,
             }
         }
         EncodeFrameHeader(stFrameHead, pBuff);
-        pBuff->Write(pHpackBuff->GetRawBuffer(), stFrameHead.uiLength);
+        pBuff->Write(pHpackBuff->GetRawReadBuffer(), stFrameHead.uiLength);
         pHpackBuff->AdvanceReadIndex(stFrameHead.uiLength);
     }
     EncodeSetStreamState(stFrameHead);
@@ -1036,102 +1016,119 @@ E_CODEC_STATUS Http2Frame::EncodeData(CodecHttp2* pCodecH2, uint32 uiStreamId,
     stFrameHead.ucType = H2_FRAME_DATA;
     stFrameHead.ucFlag = 0;
     stFrameHead.uiStreamIdentifier = uiStreamId;
+    uint32 uiAddtionLength = 0;
     if (strPadding.size() > 0)
     {
-        stFrameHead.uiLength = 1 + uiDataLen + strPadding.size();
-        if (stFrameHead.uiLength > pCodecH2->GetMaxFrameSize())
-        {
-            stFrameHead.uiLength = pCodecH2->GetMaxFrameSize();
-            uiEncodedDataLen = stFrameHead.uiLength - 1 - strPadding.size();
-        }
-        else
-        {
-            uiEncodedDataLen = uiDataLen;
-            if (bEndStream)
-            {
-                stFrameHead.ucFlag |= H2_FRAME_FLAG_END_STREAM;
-            }
-            eCodecStatus = CODEC_STATUS_OK;
-        }
         stFrameHead.ucFlag |= H2_FRAME_FLAG_PADDED;
-        if (uiEncodedDataLen < pCodecH2->GetSendWindowSize()
-                && (int32)uiEncodedDataLen < m_pStream->GetSendWindowSize())
-        {
-            EncodeFrameHeader(stFrameHead, pBuff);
-            uint16 unNetLength = CodecUtil::H2N(strPadding.size());
-            pBuff->Write(&unNetLength, 1);
-            pBuff->Write(pData, uiEncodedDataLen);
-            pBuff->Write(strPadding.c_str(), strPadding.size());
-            pCodecH2->ShrinkSendWindow(uiStreamId, uiEncodedDataLen);
-            EncodeSetStreamState(stFrameHead);
-        }
-        else
-        {
-            CBuffer* pWaittingBuff = nullptr;
-            try
-            {
-                pWaittingBuff = new CBuffer();
-            }
-            catch(std::bad_alloc& e)
-            {
-                LOG4_ERROR("%s", e.what());
-                return(CODEC_STATUS_PART_ERR);
-            }
-            m_listWaittingFrameData.push_back(pWaittingBuff);
-            EncodeFrameHeader(stFrameHead, pWaittingBuff);
-            uint16 unNetLength = CodecUtil::H2N(strPadding.size());
-            pWaittingBuff->Write(&unNetLength, 1);
-            pWaittingBuff->Write(pData, uiEncodedDataLen);
-            pWaittingBuff->Write(strPadding.c_str(), strPadding.size());
-            m_stLastDataFrameHead = stFrameHead;
-            eCodecStatus = CODEC_STATUS_PART_OK;
-        }
+        uiAddtionLength = 1 + strPadding.size();
+    }
+    if (uiDataLen + uiAddtionLength > pCodecH2->GetMaxFrameSize())
+    {
+        stFrameHead.uiLength = pCodecH2->GetMaxFrameSize();
+        uiEncodedDataLen = stFrameHead.uiLength - uiAddtionLength;
     }
     else
     {
-        if (uiDataLen > pCodecH2->GetMaxFrameSize())
-        {
-            stFrameHead.uiLength = pCodecH2->GetMaxFrameSize();
-        }
-        else
+        stFrameHead.uiLength = uiDataLen + uiAddtionLength;
+        uiEncodedDataLen = uiDataLen;
+        if (bEndStream)
         {
-            stFrameHead.uiLength = uiDataLen;
-            if (bEndStream)
-            {
-                stFrameHead.ucFlag |= H2_FRAME_FLAG_END_STREAM;
-            }
-            eCodecStatus = CODEC_STATUS_OK;
+            stFrameHead.ucFlag |= H2_FRAME_FLAG_END_STREAM;
         }
-        if (uiEncodedDataLen < pCodecH2->GetSendWindowSize()
-                && (int32)uiEncodedDataLen < m_pStream->GetSendWindowSize())
+        eCodecStatus = CODEC_STATUS_OK;
+    }
+
+    // 流控按帧负载（含填充）计算；已有待发送的帧时须排在其后，以保持stream内数据的顺序
+    if (m_listWaittingFrameData.empty()
+            && stFrameHead.uiLength <= pCodecH2->GetSendWindowSize()
+            && (int32)stFrameHead.uiLength <= m_pStream->GetSendWindowSize())
+    {
+        WriteDataFrame(stFrameHead, pData, uiEncodedDataLen, strPadding, pBuff);
+        pCodecH2->ShrinkSendWindow(uiStreamId, stFrameHead.uiLength);
+        EncodeSetStreamState(stFrameHead);
+        return(eCodecStatus);
+    }
+
+    CBuffer* pWaittingBuff = nullptr;
+    try
+    {
+        pWaittingBuff = new CBuffer();
+    }
+    catch(std::bad_alloc& e)
+    {
+        LOG4_ERROR("%s", e.what());
+        return(CODEC_STATUS_PART_ERR);
+    }
+    m_listWaittingFrameData.push_back(pWaittingBuff);
+    pCodecH2->AddWaittingStream(uiStreamId);
+    WriteDataFrame(stFrameHead, pData, uiEncodedDataLen, strPadding, pWaittingBuff);
+    m_uiWaittingBytes += pWaittingBuff->ReadableBytes();
+    m_stLastDataFrameHead = stFrameHead;
+    return(CODEC_STATUS_PART_OK);
+}
+
+E_CODEC_STATUS Http2Frame::EncodeWaittingTrailer(CodecHttp2* pCodecH2,
+        uint32 uiStreamId, const HttpMsg& oHttpMsg)
+{
+    // 待发送的header block晚于此后编码的其他header block到达对端，不能引用或更新动态表
+    CBuffer oHpackBuff;
+    pCodecH2->PackHeader(oHttpMsg, H2_HEADER_TRAILER | H2_HEADER_LITERAL, &oHpackBuff);
+    CBuffer* pWaittingBuff = nullptr;
+    try
+    {
+        pWaittingBuff = new CBuffer();
+    }
+    catch(std::bad_alloc& e)
+    {
+        LOG4_ERROR("%s", e.what());
+        return(CODEC_STATUS_PART_ERR);
+    }
+    tagH2FrameHead stFrameHead;
+    stFrameHead.cR = 0;
+    stFrameHead.ucType = H2_FRAME_HEADERS;
+    stFrameHead.ucFlag = H2_FRAME_FLAG_END_STREAM;
+    stFrameHead.uiStreamIdentifier = uiStreamId;
+    m_stLastDataFrameHead = stFrameHead;
+    m_stLastDataFrameHead.ucFlag |= H2_FRAME_FLAG_END_HEADERS;
+    // header block超过最大帧长度时拆分为HEADERS和CONTINUATION，在同一个待发送缓冲中连续发送
+    do
+    {
+        stFrameHead.uiLength = oHpackBuff.ReadableBytes();
+        if (stFrameHead.uiLength > pCodecH2->GetMaxFrameSize())
         {
-            uiEncodedDataLen = stFrameHead.uiLength;
-            EncodeFrameHeader(stFrameHead, pBuff);
-            pBuff->Write(pData, uiEncodedDataLen);
-            pCodecH2->ShrinkSendWindow(uiStreamId, uiEncodedDataLen);
-            EncodeSetStreamState(stFrameHead);
+            stFrameHead.uiLength = pCodecH2->GetMaxFrameSize();
         }
         else
         {
-            CBuffer* pWaittingBuff = nullptr;
-            try
-            {
-                pWaittingBuff = new CBuffer();
-            }
-            catch(std::bad_alloc& e)
-            {
-                LOG4_ERROR("%s", e.what());
-                return(CODEC_STATUS_PART_ERR);
-            }
-            m_listWaittingFrameData.push_back(pWaittingBuff);
-            uiEncodedDataLen = stFrameHead.uiLength;
-            EncodeFrameHeader(stFrameHead, pWaittingBuff);
-            pWaittingBuff->Write(pData, uiEncodedDataLen);
-            m_stLastDataFrameHead = stFrameHead;
-            eCodecStatus = CODEC_STATUS_PART_OK;
+            stFrameHead.ucFlag |= H2_FRAME_FLAG_END_HEADERS;
         }
+        EncodeFrameHeader(stFrameHead, pWaittingBuff);
+        pWaittingBuff->Write(oHpackBuff.GetRawReadBuffer(), stFrameHead.uiLength);
+        oHpackBuff.AdvanceReadIndex(stFrameHead.uiLength);
+        stFrameHead.ucType = H2_FRAME_CONTINUATION;
+        stFrameHead.ucFlag = 0;
+    } while (oHpackBuff.ReadableBytes() > 0);
+    m_listWaittingFrameData.push_back(pWaittingBuff);
+    m_uiWaittingBytes += pWaittingBuff->ReadableBytes();
+    pCodecH2->AddWaittingStream(uiStreamId);
+    return(CODEC_STATUS_PART_OK);
+}
+
+void Http2Frame::WriteDataFrame(const tagH2FrameHead& stFrameHead, const char* pData,
+        uint32 uiDataLen, const std::string& strPadding, CBuffer* pBuff)
+{
+    EncodeFrameHeader(stFrameHead, pBuff);
+    if (H2_FRAME_FLAG_PADDED & stFrameHead.ucFlag)
+    {
+        uint8 ucPadLength = strPadding.size();
+        pBuff->Write(&ucPadLength, 1);
+        pBuff->Write(pData, uiDataLen);
+        pBuff->Write(strPadding.c_str(), strPadding.size());
+    }
+    else
+    {
+        pBuff->Write(pData, uiDataLen);
     }
-    return(eCodecStatus);
 }
 
 E_CODEC_STATUS Http2Frame::SendWaittingFrameData(CodecHttp2* pCodecH2, CBuffer* pBuff)
@@ -1141,23 +1138,27 @@ E_CODEC_STATUS Http2Frame::SendWaittingFrameData(CodecHttp2* pCodecH2, CBuffer*
     {
         return(CODEC_STATUS_OK);
     }
-    uint32 uiDataLen = 0;
+    uint32 uiFrameLength = 0;
+    uint32 uiPayloadLength = 0;
     for (auto iter = m_listWaittingFrameData.begin();
-            iter != m_listWaittingFrameData.end(); ++iter)
+            iter != m_listWaittingFrameData.end(); )
     {
-        uiDataLen = (*iter)->ReadableBytes();
-        if (uiDataLen < pCodecH2->GetSendWindowSize()
-                && (int32)uiDataLen < m_pStream->GetSendWindowSize())
-        {
-            pBuff->Write(*iter, uiDataLen);
-            DELETE(*iter);
-            m_listWaittingFrameData.erase(iter);
-            iter = m_listWaittingFrameData.begin();
-        }
-        else
+        uiFrameLength = (*iter)->ReadableBytes();
+        // 待发送队列中的trailer（HEADERS、CONTINUATION）不受流控限制
+        if (H2_FRAME_DATA == (uint8)(*iter)->GetRawReadBuffer()[3])
         {
-            break;
+            uiPayloadLength = uiFrameLength - H2_FRAME_HEAD_SIZE;
+            if (uiPayloadLength > pCodecH2->GetSendWindowSize()
+                    || (int32)uiPayloadLength > m_pStream->GetSendWindowSize())
+            {
+                break;
+            }
+            pCodecH2->ShrinkSendWindow(m_pStream->GetStreamId(), uiPayloadLength);
         }
+        pBuff->Write(*iter, uiFrameLength);
+        m_uiWaittingBytes -= uiFrameLength;
+        DELETE(*iter);
+        iter = m_listWaittingFrameData.erase(iter);
     }
     if (m_listWaittingFrameData.empty())
     {
@@ -76,6 +76,14 @@ public:
             HttpMsg& oHttpMsg, CBuffer* pReactBuff);
     E_CODEC_STATUS SendWaittingFrameData(CodecHttp2* pCodecH2, CBuffer* pBuff);
 
+    /**
+     * @brief 待发送队列中的字节数（含帧头）
+     */
+    uint32 GetWaittingBytes() const
+    {
+        return(m_uiWaittingBytes);
+    }
+
 protected:
     E_CODEC_STATUS DecodeData(CodecHttp2* pCodecH2,
             const tagH2FrameHead& stFrameHead, CBuffer* pBuff,
@@ -125,8 +133,7 @@ protected:
     E_CODEC_STATUS EncodeSetting(CodecHttp2* pCodecH2, CBuffer* pBuff); // ACK
     E_CODEC_STATUS EncodePushPromise(CodecHttp2* pCodecH2,
             uint32 uiStreamId, uint32 uiPromiseStreamId,
-            const std::string& strPadding, const HttpMsg& oHttpMsg,
-            bool bEndStream, CBuffer* pBuff);
+            const std::string& strPadding, const HttpMsg& oHttpMsg, CBuffer* pBuff);
     E_CODEC_STATUS EncodePing(CodecHttp2* pCodecH2,
             bool bAck, int32 iPayload1, int32 iPayload2, CBuffer* pBuff);
     E_CODEC_STATUS EncodeGoaway(CodecHttp2* pCodecH2,
@@ -143,11 +150,20 @@ protected:
             const char* pData, uint32 uiDataLen, bool bEndStream,
             const std::string& strPadding, uint32& uiEncodedDataLen, CBuffer* pBuff);
 
+    /**
+     * @brief 将trailer加入待发送队列，在待发送的DATA帧之后发送
+     */
+    E_CODEC_STATUS EncodeWaittingTrailer(CodecHttp2* pCodecH2,
+            uint32 uiStreamId, const HttpMsg& oHttpMsg);
+    void WriteDataFrame(const tagH2FrameHead& stFrameHead, const char* pData,
+            uint32 uiDataLen, const std::string& strPadding, CBuffer* pBuff);
+
 private:
     friend class CodecHttp2;
     friend class Http2Stream;
 
     std::list<CBuffer*> m_listWaittingFrameData;
+    uint32 m_uiWaittingBytes = 0;
     tagH2FrameHead m_stLastDataFrameHead;
     Http2Stream* m_pStream;
 };
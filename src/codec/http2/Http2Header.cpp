@@ -7,6 +7,7 @@
  * @note     
  * Modify history:
  ******************************************************************************/
+#include <cstring>
 #include "Http2Header.hpp"
 #include "Huffman.hpp"
 
@@ -79,70 +80,145 @@ const std::vector<std::pair<std::string, std::string>> Http2Header::sc_vecStatic
         {"www-authenticate", ""}                    ///< 61
 };
 
-const std::unordered_map<std::string, size_t> Http2Header::sc_mapStaticTable = {
-        {":authority", 1},
-        {":method GET", 2},
-        {":method POST", 3},
-        {":path /", 4},
-        {":path /index.html", 5},
-        {":scheme http", 6},
-        {":scheme https", 7},
-        {":status 200", 8},
-        {":status 204", 9},
-        {":status 206", 10},
-        {":status 304", 11},
-        {":status 400", 12},
-        {":status 404", 13},
-        {":status 500", 14},
-        {"accept-charset", 15},
-        {"accept-encoding gzip, deflate", 16},
-        {"accept-language", 17},
-        {"accept-ranges", 18},
-        {"accept", 19},
-        {"access-control-allow-origin", 20},
-        {"age", 21},
-        {"allow", 22},
-        {"authorization", 23},
-        {"cache-control", 24},
-        {"content-disposition", 25},
-        {"content-encoding", 26},
-        {"content-language", 27},
-        {"content-length", 28},
-        {"content-location", 29},
-        {"content-range", 30},
-        {"content-type", 31},
-        {"cookie", 32},
-        {"date", 33},
-        {"etag", 34},
-        {"expect", 35},
-        {"expires", 36},
-        {"from", 37},
-        {"host", 38},
-        {"if-match", 39},
-        {"if-modified-since", 40},
-        {"if-none-match", 41},
-        {"if-range", 42},
-        {"if-unmodified-since", 43},
-        {"last-modified", 44},
-        {"link", 45},
-        {"location", 46},
-        {"max-forwards", 47},
-        {"proxy-authenticate", 48},
-        {"proxy-authorization", 49},
-        {"range", 50},
-        {"referer", 51},
-        {"refresh", 52},
-        {"retry-after", 53},
-        {"server", 54},
-        {"set-cookie", 55},
-        {"strict-transport-security", 56},
-        {"transfer-encoding", 57},
-        {"user-agent", 58},
-        {"vary", 59},
-        {"via", 60},
-        {"www-authenticate", 61}
+/**
+ * @brief 静态表中的header name
+ * @note 相同name的条目在静态表中相邻，ucFirstIndex和ucIndexNum给出这些条目的索引范围。
+ */
+struct tagH2StaticName
+{
+    const char* szName;
+    size_t uiNameLen;
+    uint8_t ucFirstIndex;
+    uint8_t ucIndexNum;
+    E_H2_PSEUDO_HEADER ePseudoHeader;
+};
+
+static constexpr tagH2StaticName sc_aStaticName[] = {
+        {":authority", sizeof(":authority") - 1, 1, 1, H2_PSEUDO_AUTHORITY},
+        {":method", sizeof(":method") - 1, 2, 2, H2_PSEUDO_METHOD},
+        {":path", sizeof(":path") - 1, 4, 2, H2_PSEUDO_PATH},
+        {":scheme", sizeof(":scheme") - 1, 6, 2, H2_PSEUDO_SCHEME},
+        {":status", sizeof(":status") - 1, 8, 7, H2_PSEUDO_STATUS},
+        {"accept-charset", sizeof("accept-charset") - 1, 15, 1, H2_PSEUDO_NONE},
+        {"accept-encoding", sizeof("accept-encoding") - 1, 16, 1, H2_PSEUDO_NONE},
+        {"accept-language", sizeof("accept-language") - 1, 17, 1, H2_PSEUDO_NONE},
+        {"accept-ranges", sizeof("accept-ranges") - 1, 18, 1, H2_PSEUDO_NONE},
+        {"accept", sizeof("accept") - 1, 19, 1, H2_PSEUDO_NONE},
+        {"access-control-allow-origin", sizeof("access-control-allow-origin") - 1, 20, 1, H2_PSEUDO_NONE},
+        {"age", sizeof("age") - 1, 21, 1, H2_PSEUDO_NONE},
+        {"allow", sizeof("allow") - 1, 22, 1, H2_PSEUDO_NONE},
+        {"authorization", sizeof("authorization") - 1, 23, 1, H2_PSEUDO_NONE},
+        {"cache-control", sizeof("cache-control") - 1, 24, 1, H2_PSEUDO_NONE},
+        {"content-disposition", sizeof("content-disposition") - 1, 25, 1, H2_PSEUDO_NONE},
+        {"content-encoding", sizeof("content-encoding") - 1, 26, 1, H2_PSEUDO_NONE},
+        {"content-language", sizeof("content-language") - 1, 27, 1, H2_PSEUDO_NONE},
+        {"content-length", sizeof("content-length") - 1, 28, 1, H2_PSEUDO_NONE},
+        {"content-location", sizeof("content-location") - 1, 29, 1, H2_PSEUDO_NONE},
+        {"content-range", sizeof("content-range") - 1, 30, 1, H2_PSEUDO_NONE},
+        {"content-type", sizeof("content-type") - 1, 31, 1, H2_PSEUDO_NONE},
+        {"cookie", sizeof("cookie") - 1, 32, 1, H2_PSEUDO_NONE},
+        {"date", sizeof("date") - 1, 33, 1, H2_PSEUDO_NONE},
+        {"etag", sizeof("etag") - 1, 34, 1, H2_PSEUDO_NONE},
+        {"expect", sizeof("expect") - 1, 35, 1, H2_PSEUDO_NONE},
+        {"expires", sizeof("expires") - 1, 36, 1, H2_PSEUDO_NONE},
+        {"from", sizeof("from") - 1, 37, 1, H2_PSEUDO_NONE},
+        {"host", sizeof("host") - 1, 38, 1, H2_PSEUDO_NONE},
+        {"if-match", sizeof("if-match") - 1, 39, 1, H2_PSEUDO_NONE},
+        {"if-modified-since", sizeof("if-modified-since") - 1, 40, 1, H2_PSEUDO_NONE},
+        {"if-none-match", sizeof("if-none-match") - 1, 41, 1, H2_PSEUDO_NONE},
+        {"if-range", sizeof("if-range") - 1, 42, 1, H2_PSEUDO_NONE},
+        {"if-unmodified-since", sizeof("if-unmodified-since") - 1, 43, 1, H2_PSEUDO_NONE},
+        {"last-modified", sizeof("last-modified") - 1, 44, 1, H2_PSEUDO_NONE},
+        {"link", sizeof("link") - 1, 45, 1, H2_PSEUDO_NONE},
+        {"location", sizeof("location") - 1, 46, 1, H2_PSEUDO_NONE},
+        {"max-forwards", sizeof("max-forwards") - 1, 47, 1, H2_PSEUDO_NONE},
+        {"proxy-authenticate", sizeof("proxy-authenticate") - 1, 48, 1, H2_PSEUDO_NONE},
+        {"proxy-authorization", sizeof("proxy-authorization") - 1, 49, 1, H2_PSEUDO_NONE},
+        {"range", sizeof("range") - 1, 50, 1, H2_PSEUDO_NONE},
+        {"referer", sizeof("referer") - 1, 51, 1, H2_PSEUDO_NONE},
+        {"refresh", sizeof("refresh") - 1, 52, 1, H2_PSEUDO_NONE},
+        {"retry-after", sizeof("retry-after") - 1, 53, 1, H2_PSEUDO_NONE},
+        {"server", sizeof("server") - 1, 54, 1, H2_PSEUDO_NONE},
+        {"set-cookie", sizeof("set-cookie") - 1, 55, 1, H2_PSEUDO_NONE},
+        {"strict-transport-security", sizeof("strict-transport-security") - 1, 56, 1, H2_PSEUDO_NONE},
+        {"transfer-encoding", sizeof("transfer-encoding") - 1, 57, 1, H2_PSEUDO_NONE},
+        {"user-agent", sizeof("user-agent") - 1, 58, 1, H2_PSEUDO_NONE},
+        {"vary", sizeof("vary") - 1, 59, 1, H2_PSEUDO_NONE},
+        {"via", sizeof("via") - 1, 60, 1, H2_PSEUDO_NONE},
+        {"www-authenticate", sizeof("www-authenticate") - 1, 61, 1, H2_PSEUDO_NONE}
+};
+static constexpr uint32_t sc_uiStaticNameNum = sizeof(sc_aStaticName) / sizeof(sc_aStaticName[0]);
+
+/**
+ * @brief 静态表name的完美哈希
+ * @note FNV-1a取高7位作为槽位，偏移基数经离线搜索选定，使静态表中52个name落在128个槽位中
+ * 互不冲突（由下面的static_assert在编译期校验）。槽位表在编译期由name表生成，查找只需
+ * 计算一次哈希再比较一次name。以下constexpr函数均为单return语句以兼容c++11。
+ */
+static constexpr uint32_t sc_uiStaticNameHashBasis = 0x811dbda5;
+static constexpr uint32_t sc_uiStaticNameSlotBits = 7;
+static constexpr uint8_t sc_ucStaticNameNone = 0xFF;
+
+static constexpr uint32_t StaticNameHash(const char* szName, size_t uiNameLen, uint32_t uiHash)
+{
+    return((uiNameLen == 0) ? uiHash
+            : StaticNameHash(szName + 1, uiNameLen - 1, (uiHash ^ (uint8_t)szName[0]) * 16777619u));
+}
+
+static constexpr uint32_t StaticNameSlot(const char* szName, size_t uiNameLen)
+{
+    return(StaticNameHash(szName, uiNameLen, sc_uiStaticNameHashBasis) >> (32 - sc_uiStaticNameSlotBits));
+}
+
+static constexpr uint8_t SearchStaticNameSlot(uint32_t uiSlot, uint32_t uiName)
+{
+    return((uiName >= sc_uiStaticNameNum) ? sc_ucStaticNameNone
+            : (StaticNameSlot(sc_aStaticName[uiName].szName, sc_aStaticName[uiName].uiNameLen) == uiSlot)
+            ? (uint8_t)uiName : SearchStaticNameSlot(uiSlot, uiName + 1));
+}
+
+static constexpr bool IsStaticNameHashPerfect(uint32_t uiName)
+{
+    return((uiName >= sc_uiStaticNameNum) ? true
+            : (SearchStaticNameSlot(StaticNameSlot(sc_aStaticName[uiName].szName,
+                    sc_aStaticName[uiName].uiNameLen), 0) == uiName)
+            && IsStaticNameHashPerfect(uiName + 1));
+}
+
+static_assert(IsStaticNameHashPerfect(0), "hpack static table name hash is not perfect, choose another hash basis.");
+
+#define H2_STATIC_NAME_SLOT_4(n) SearchStaticNameSlot(n, 0), SearchStaticNameSlot(n + 1, 0), \
+        SearchStaticNameSlot(n + 2, 0), SearchStaticNameSlot(n + 3, 0)
+#define H2_STATIC_NAME_SLOT_16(n) H2_STATIC_NAME_SLOT_4(n), H2_STATIC_NAME_SLOT_4(n + 4), \
+        H2_STATIC_NAME_SLOT_4(n + 8), H2_STATIC_NAME_SLOT_4(n + 12)
+
+static constexpr uint8_t sc_aStaticNameSlot[1 << sc_uiStaticNameSlotBits] = {
+        H2_STATIC_NAME_SLOT_16(0), H2_STATIC_NAME_SLOT_16(16),
+        H2_STATIC_NAME_SLOT_16(32), H2_STATIC_NAME_SLOT_16(48),
+        H2_STATIC_NAME_SLOT_16(64), H2_STATIC_NAME_SLOT_16(80),
+        H2_STATIC_NAME_SLOT_16(96), H2_STATIC_NAME_SLOT_16(112)
 };
 
+#undef H2_STATIC_NAME_SLOT_16
+#undef H2_STATIC_NAME_SLOT_4
+
+static const tagH2StaticName* FindStaticName(const std::string& strHeaderName)
+{
+    uint8_t ucName = sc_aStaticNameSlot[StaticNameSlot(strHeaderName.data(), strHeaderName.size())];
+    if (ucName == sc_ucStaticNameNone
+            || sc_aStaticName[ucName].uiNameLen != strHeaderName.size()
+            || 0 != memcmp(sc_aStaticName[ucName].szName, strHeaderName.data(), strHeaderName.size()))
+    {
+        return(nullptr);
+    }
+    return(&sc_aStaticName[ucName]);
+}
+
+Http2Header::Http2Header()
+    : m_uiHpackSize(32)
+{
+}
+
 Http2Header::Http2Header(const std::string& strName, const std::string& strValue)
     : m_strName(strName), m_strValue(strValue), m_uiHpackSize(0)
 {
@@ -168,6 +244,13 @@ Http2Header& Http2Header::operator=(Http2Header&& rHeader)
     return(*this);
 }
 
+void Http2Header::Assign(const std::string& strName, const std::string& strValue)
+{
+    m_strName.assign(strName);
+    m_strValue.assign(strValue);
+    m_uiHpackSize = m_strName.size() + m_strValue.size() + 32;
+}
+
 void Http2Header::EncodeInt(size_t uiValue, size_t uiPrefix, char cBits, CBuffer* pBuff)
 {
     if (uiValue < uiPrefix)
@@ -224,13 +307,12 @@ void Http2Header::EncodeStringLiteral(const std::string& strLiteral, CBuffer* pB
 
 void Http2Header::EncodeStringLiteralWithHuffman(const std::string& strLiteral, CBuffer* pBuff)
 {
-    CBuffer oBuff;
-    Huffman::Instance()->Encode(strLiteral, &oBuff);
-    if (oBuff.ReadableBytes() < strLiteral.size())
+    size_t uiEncodedLength = Huffman::Instance()->EncodedLength(strLiteral);
+    if (uiEncodedLength < strLiteral.size())
     {
-        Http2Header::EncodeInt(oBuff.ReadableBytes(), (size_t)H2_HPACK_PREFIX_7_BITS,
+        Http2Header::EncodeInt(uiEncodedLength, (size_t)H2_HPACK_PREFIX_7_BITS,
                 (char)0x80, pBuff);
-        pBuff->Write(oBuff.GetRawReadBuffer(), oBuff.ReadableBytes());
+        Huffman::Instance()->Encode(strLiteral, pBuff);
     }
     else
     {
@@ -266,26 +348,37 @@ bool Http2Header::DecodeStringLiteral(CBuffer* pBuff, std::string& strLiteral, b
     }
 }
 
+size_t Http2Header::GetStaticTableIndex(const std::string& strHeaderName)
+{
+    const tagH2StaticName* pStaticName = FindStaticName(strHeaderName);
+    return((pStaticName == nullptr) ? 0 : pStaticName->ucFirstIndex);
+}
+
 size_t Http2Header::GetStaticTableIndex(const std::string& strHeaderName, const std::string& strHeaderValue)
 {
-    if (strHeaderValue.size() == 0)
+    const tagH2StaticName* pStaticName = FindStaticName(strHeaderName);
+    if (pStaticName == nullptr)
     {
-        auto c_iter = sc_mapStaticTable.find(strHeaderName);
-        if (c_iter == sc_mapStaticTable.end())
-        {
-            return(0);
-        }
-        return(c_iter->second);
+        return(0);
     }
-    else
+    for (size_t i = pStaticName->ucFirstIndex; i < (size_t)pStaticName->ucFirstIndex + pStaticName->ucIndexNum; ++i)
     {
-        auto c_iter = sc_mapStaticTable.find(strHeaderName + " " + strHeaderValue);
-        if (c_iter == sc_mapStaticTable.end())
+        if (sc_vecStaticTable[i].second == strHeaderValue)
         {
-            return(0);
+            return(i);
         }
-        return(c_iter->second);
     }
+    return(0);
+}
+
+E_H2_PSEUDO_HEADER Http2Header::GetPseudoHeader(const std::string& strHeaderName)
+{
+    if (strHeaderName.empty() || strHeaderName[0] != ':')
+    {
+        return(H2_PSEUDO_NONE);
+    }
+    const tagH2StaticName* pStaticName = FindStaticName(strHeaderName);
+    return((pStaticName == nullptr) ? H2_PSEUDO_NONE : pStaticName->ePseudoHeader);
 }
 
 } /* namespace neb */
@@ -45,11 +45,23 @@ enum E_H2_HEADER_TYPE
     H2_HEADER_PSEUDO        = 0x01,
     H2_HEADER_NORMAL        = 0x02,
     H2_HEADER_TRAILER       = 0x04,
+    H2_HEADER_LITERAL       = 0x08,     ///< 不引用也不更新动态表（延后发送的header block须与动态表状态无关）
+};
+
+enum E_H2_PSEUDO_HEADER
+{
+    H2_PSEUDO_NONE          = 0,
+    H2_PSEUDO_AUTHORITY     = 1,
+    H2_PSEUDO_METHOD        = 2,
+    H2_PSEUDO_PATH          = 3,
+    H2_PSEUDO_SCHEME        = 4,
+    H2_PSEUDO_STATUS        = 5,
 };
 
 class Http2Header
 {
 public:
+    Http2Header();
     Http2Header(const std::string& strName, const std::string& strValue);
     Http2Header(const Http2Header& rHeader) = delete;
     Http2Header(Http2Header&& rHeader);
@@ -73,6 +85,11 @@ public:
         return(m_uiHpackSize);
     }
 
+    /**
+     * @brief 重新赋值，复用已有的字符串内存
+     */
+    void Assign(const std::string& strName, const std::string& strValue);
+
 private:
     std::string m_strName;
     std::string m_strValue;
@@ -117,12 +134,27 @@ public:
      */
     static bool DecodeStringLiteral(CBuffer* pBuff, std::string& strLiteral, bool& bWithHuffman);
 
-    static size_t GetStaticTableIndex(const std::string& strHeaderName, const std::string& strHeaderValue = "");
+    /**
+     * @brief 按name查找静态表
+     * @return name相同的第一个条目的索引，不存在返回0
+     */
+    static size_t GetStaticTableIndex(const std::string& strHeaderName);
+
+    /**
+     * @brief 按name和value查找静态表
+     * @return name和value都相同的条目的索引，不存在返回0
+     */
+    static size_t GetStaticTableIndex(const std::string& strHeaderName, const std::string& strHeaderValue);
+
+    /**
+     * @brief 伪头部类型
+     * @return 不是伪头部返回H2_PSEUDO_NONE
+     */
+    static E_H2_PSEUDO_HEADER GetPseudoHeader(const std::string& strHeaderName);
 
 public:
     static const size_t sc_uiMaxStaticTableIndex;
     static const std::vector<std::pair<std::string, std::string>> sc_vecStaticTable;
-    static const std::unordered_map<std::string, size_t> sc_mapStaticTable;
 };
 
 } /* namespace neb */
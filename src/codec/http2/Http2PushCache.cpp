@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     Http2PushCache.cpp
+ * @brief    HTTP2 server push的资源缓存
+ * @author   nebim
+ * @date:    2026-10-19
+ * @note
+ * Modify history:
+ ******************************************************************************/
+#include <algorithm>
+#include "Http2PushCache.hpp"
+
+namespace neb
+{
+
+Http2PushCache::Http2PushCache(size_t uiCapacity)
+    : m_uiCapacity(uiCapacity), m_uiBytes(0), m_ullVersionGenerate(0)
+{
+}
+
+Http2PushCache::~Http2PushCache()
+{
+}
+
+bool Http2PushCache::Add(const std::string& strPath, const HttpMsg& oResponse)
+{
+    if (strPath.empty() || strPath[0] != '/')
+    {
+        return(false);
+    }
+    size_t uiBytes = strPath.size() + oResponse.body().size();
+    for (auto iter = oResponse.headers().begin(); iter != oResponse.headers().end(); ++iter)
+    {
+        uiBytes += iter->first.size() + iter->second.size();
+    }
+    if (uiBytes > m_uiCapacity)
+    {
+        return(false);
+    }
+    Remove(strPath);
+    Evict(uiBytes);
+    m_listLru.push_front(strPath);
+    tagResource& stResource = m_mapResource[strPath];
+    stResource.oResponse = oResponse;
+    if (0 == stResource.oResponse.status_code())
+    {
+        stResource.oResponse.set_status_code(200);
+    }
+    stResource.uiBytes = uiBytes;
+    stResource.ullVersion = ++m_ullVersionGenerate;
+    stResource.iterLru = m_listLru.begin();
+    m_uiBytes += uiBytes;
+    return(true);
+}
+
+void Http2PushCache::Remove(const std::string& strPath)
+{
+    auto iter = m_mapResource.find(strPath);
+    if (iter != m_mapResource.end())
+    {
+        m_uiBytes -= iter->second.uiBytes;
+        m_listLru.erase(iter->second.iterLru);
+        m_mapResource.erase(iter);
+    }
+}
+
+const HttpMsg* Http2PushCache::Get(const std::string& strPath, uint64& ullVersion)
+{
+    auto iter = m_mapResource.find(strPath);
+    if (iter == m_mapResource.end())
+    {
+        return(nullptr);
+    }
+    m_listLru.splice(m_listLru.begin(), m_listLru, iter->second.iterLru);
+    ullVersion = iter->second.ullVersion;
+    return(&iter->second.oResponse);
+}
+
+void Http2PushCache::SetCapacity(size_t uiCapacity)
+{
+    m_uiCapacity = uiCapacity;
+    Evict(0);
+}
+
+void Http2PushCache::Evict(size_t uiReserveBytes)
+{
+    while (!m_listLru.empty() && m_uiBytes + uiReserveBytes > m_uiCapacity)
+    {
+        auto iter = m_mapResource.find(m_listLru.back());
+        m_uiBytes -= iter->second.uiBytes;
+        m_mapResource.erase(iter);
+        m_listLru.pop_back();
+    }
+}
+
+void Http2PushCache::GetPreloadPath(const std::string& strLink, std::vector<std::string>& vecPath)
+{
+    size_t uiPos = 0;
+    while (uiPos < strLink.size())
+    {
+        size_t uiUriBegin = strLink.find('<', uiPos);
+        if (uiUriBegin == std::string::npos)
+        {
+            break;
+        }
+        size_t uiUriEnd = strLink.find('>', uiUriBegin);
+        if (uiUriEnd == std::string::npos)
+        {
+            break;
+        }
+        size_t uiLinkEnd = strLink.find(',', uiUriEnd);
+        if (uiLinkEnd == std::string::npos)
+        {
+            uiLinkEnd = strLink.size();
+        }
+        std::string strParams = strLink.substr(uiUriEnd + 1, uiLinkEnd - uiUriEnd - 1);
+        std::transform(strParams.begin(), strParams.end(), strParams.begin(), [](unsigned char c) -> unsigned char { return std::tolower(c); });
+        std::replace(strParams.begin(), strParams.end(), '"', ' ');
+        bool bPreload = false;
+        bool bNoPush = false;
+        size_t uiParamPos = 0;
+        while (uiParamPos < strParams.size())
+        {
+            size_t uiParamEnd = strParams.find(';', uiParamPos);
+            if (uiParamEnd == std::string::npos)
+            {
+                uiParamEnd = strParams.size();
+            }
+            // 参数为name或name=value，参数名须完全匹配，如"relation=preload"不是rel
+            size_t uiNameEnd = strParams.find('=', uiParamPos);
+            if (uiNameEnd == std::string::npos || uiNameEnd > uiParamEnd)
+            {
+                uiNameEnd = uiParamEnd;
+            }
+            size_t uiBegin = strParams.find_first_not_of(' ', uiParamPos);
+            if (uiBegin < uiNameEnd)
+            {
+                size_t uiLast = strParams.find_last_not_of(' ', uiNameEnd - 1);
+                std::string strName = strParams.substr(uiBegin, uiLast - uiBegin + 1);
+                if ("nopush" == strName)
+                {
+                    bNoPush = true;
+                }
+                else if ("rel" == strName && uiNameEnd < uiParamEnd)
+                {
+                    // rel可以是空格分隔的多个关系类型，如rel="preload prefetch"
+                    std::string strRel = " " + strParams.substr(uiNameEnd + 1, uiParamEnd - uiNameEnd - 1) + " ";
+                    bPreload = (strRel.find(" preload ") != std::string::npos);
+                }
+            }
+            uiParamPos = uiParamEnd + 1;
+        }
+        if (bPreload && !bNoPush && uiUriEnd - uiUriBegin > 1 && strLink[uiUriBegin + 1] == '/'
+                && (uiUriEnd - uiUriBegin == 2 || strLink[uiUriBegin + 2] != '/'))
+        {
+            vecPath.push_back(strLink.substr(uiUriBegin + 1, uiUriEnd - uiUriBegin - 1));
+        }
+        uiPos = uiLinkEnd + 1;
+    }
+}
+
+} /* namespace neb */
@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     Http2PushCache.hpp
+ * @brief    HTTP2 server push的资源缓存
+ * @author   nebim
+ * @date:    2026-10-19
+ * @note     以请求路径为key缓存可推送的完整响应，按总字节数限制容量，超出时淘汰
+ *           最近最少使用的资源。缓存由业务（Module）写入，框架在发送带link preload
+ *           头的响应时按路径查找并推送，缓存未命中的资源不推送。每次Add()为资源分配
+ *           新的版本号，连接据此判断资源更新后是否需要重新推送。
+ * Modify history:
+ ******************************************************************************/
+#ifndef SRC_CODEC_HTTP2_HTTP2PUSHCACHE_HPP_
+#define SRC_CODEC_HTTP2_HTTP2PUSHCACHE_HPP_
+
+#include <list>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "Definition.hpp"
+#include "pb/http.pb.h"
+
+namespace neb
+{
+
+class Http2PushCache
+{
+public:
+    static const size_t DEFAULT_CAPACITY = 8388608;     ///< 缓存容量默认值（字节）
+
+    Http2PushCache(size_t uiCapacity = DEFAULT_CAPACITY);
+    Http2PushCache(const Http2PushCache&) = delete;
+    Http2PushCache& operator=(const Http2PushCache&) = delete;
+    ~Http2PushCache();
+
+    /**
+     * @brief 缓存（或替换）路径对应的响应
+     * @param strPath 资源的请求路径（以'/'开头，可带query）
+     * @param oResponse 资源的完整响应，status_code为0时视为200
+     * @return 是否缓存成功，路径非法或响应大于缓存容量时失败
+     */
+    bool Add(const std::string& strPath, const HttpMsg& oResponse);
+
+    void Remove(const std::string& strPath);
+
+    /**
+     * @brief 查找路径对应的响应，命中的资源移到最近使用的位置
+     * @param ullVersion 命中时为资源的版本号
+     * @return 缓存的响应，未命中返回nullptr
+     */
+    const HttpMsg* Get(const std::string& strPath, uint64& ullVersion);
+
+    bool Empty() const
+    {
+        return(m_mapResource.empty());
+    }
+
+    void SetCapacity(size_t uiCapacity);
+
+    /**
+     * @brief 从link头中取出需要推送的资源路径
+     * @note 只取rel含preload、未标记nopush的同源路径（以'/'开头且不是"//"开头），
+     * 如"</css/app.css>; rel=preload; as=style, </js/app.js>; rel=preload; as=script"
+     */
+    static void GetPreloadPath(const std::string& strLink, std::vector<std::string>& vecPath);
+
+private:
+    struct tagResource
+    {
+        HttpMsg oResponse;
+        size_t uiBytes = 0;
+        uint64 ullVersion = 0;                  ///< 缓存时分配的版本号，替换资源后变化
+        std::list<std::string>::iterator iterLru;
+    };
+
+    void Evict(size_t uiReserveBytes);
+
+private:
+    size_t m_uiCapacity;
+    size_t m_uiBytes;
+    uint64 m_ullVersionGenerate;                ///< 资源版本号，每次Add()递增
+    std::list<std::string> m_listLru;           ///< 资源路径，表头为最近使用
+    std::unordered_map<std::string, tagResource> m_mapResource;
+};
+
+} /* namespace neb */
+
+#endif /* SRC_CODEC_HTTP2_HTTP2PUSHCACHE_HPP_ */
@@ -10,6 +10,7 @@
 #include "Http2Stream.hpp"
 #include "Http2Frame.hpp"
 #include "CodecHttp2.hpp"
+#include "codec/CodecHttp.hpp"
 
 namespace neb
 {
@@ -35,7 +36,11 @@ E_CODEC_STATUS Http2Stream::Encode(CodecHttp2* pCodecH2,
 {
     tagPriority stPriority;
     std::string strPadding;
-    if (HTTP_REQUEST == oHttpMsg.type())
+    if (oHttpMsg.chunk_notice() && oHttpMsg.encoding() > 0)
+    {
+        ;   // 分段发送的后续数据不再发送伪头部
+    }
+    else if (HTTP_REQUEST == oHttpMsg.type())
     {
         std::string strSchema = oHttpMsg.url().substr(0, oHttpMsg.url().find_first_of(':'));
         if (strSchema.size() > 0)
@@ -247,25 +252,30 @@ E_CODEC_STATUS Http2Stream::Decode(CodecHttp2* pCodecH2,
         LOG4_TRACE("eStatus = %d", eStatus);
         if (CODEC_STATUS_OK == eStatus || CODEC_STATUS_PART_OK == eStatus)
         {
-            if (oHttpMsg.stream_id() & 0x01)
+            bool bEndStream = (H2_FRAME_FLAG_END_STREAM & stFrameHead.ucFlag);
+            bool bHeaderBlock = (H2_FRAME_HEADERS == stFrameHead.ucType
+                    || H2_FRAME_CONTINUATION == stFrameHead.ucType);
+            if (bHeaderBlock && !m_bHeadersReceived)
             {
-                oHttpMsg.set_type(HTTP_REQUEST);
+                m_bHeadersReceived = true;
+                m_oHttpMsg.set_type((m_oHttpMsg.status_code() > 0) ? HTTP_RESPONSE : HTTP_REQUEST);
+                if (HTTP_REQUEST == m_oHttpMsg.type() && CodecHttp::IsChunkNoticePath(
+                        m_oHttpMsg.path().data(), m_oHttpMsg.path().size(), m_oHttpMsg.method()))
+                {
+                    m_bChunkNotice = true;
+                }
             }
-            else
+            if (m_bChunkNotice)
             {
-                oHttpMsg.set_type(HTTP_RESPONSE);
+                if (bHeaderBlock || H2_FRAME_DATA == stFrameHead.ucType)
+                {
+                    return(DecodeChunkNotice(bEndStream, oHttpMsg));
+                }
             }
-            if (pCodecH2->IsChunkNotice())
+            else if (bEndStream)
             {
                 oHttpMsg = std::move(m_oHttpMsg);
-            }
-            else
-            {
-                if (H2_FRAME_FLAG_END_STREAM & stFrameHead.ucFlag)
-                {
-                    oHttpMsg = std::move(m_oHttpMsg);
-                    eStatus = CODEC_STATUS_OK;
-                }
+                eStatus = CODEC_STATUS_OK;
             }
         }
     }
@@ -289,6 +299,27 @@ E_CODEC_STATUS Http2Stream::Decode(CodecHttp2* pCodecH2,
     return(eStatus);
 }
 
+E_CODEC_STATUS Http2Stream::DecodeChunkNotice(bool bEndStream, HttpMsg& oHttpMsg)
+{
+    if (!bEndStream && m_iChunkNoticeSeq > 0 && m_oHttpMsg.body().size() == 0)
+    {
+        return(CODEC_STATUS_PART_OK);   // 空DATA帧无须通知（oHttpMsg的stream_id为0，不会回调业务层）
+    }
+    oHttpMsg = std::move(m_oHttpMsg);
+    oHttpMsg.set_chunk_notice(true);
+    oHttpMsg.set_is_decoding(!bEndStream);
+    oHttpMsg.set_encoding(m_iChunkNoticeSeq++);
+    // 后续分块通知只带路由信息，不含http头
+    m_oHttpMsg.Clear();
+    m_oHttpMsg.set_type(oHttpMsg.type());
+    m_oHttpMsg.set_method(oHttpMsg.method());
+    m_oHttpMsg.set_status_code(oHttpMsg.status_code());
+    m_oHttpMsg.set_url(oHttpMsg.url());
+    m_oHttpMsg.set_path(oHttpMsg.path());
+    m_oHttpMsg.set_stream_id(m_uiStreamId);
+    return(bEndStream ? CODEC_STATUS_OK : CODEC_STATUS_PART_OK);
+}
+
 void Http2Stream::EncodeSetState(const tagH2FrameHead& stFrameHead)
 {
     LOG4_TRACE("stream %u m_eStreamState = %d, stFrameHead.ucType = %u", m_uiStreamId, m_eStreamState, stFrameHead.ucType);
@@ -410,13 +441,12 @@ void Http2Stream::WindowUpdate(int32 iIncrement)
 
 void Http2Stream::ShrinkRecvWindow(CodecHttp2* pCodecH2, uint32 uiStreamId, uint32 uiRecvLength, CBuffer* pBuff)
 {
-    m_uiRecvWindowSize -= uiRecvLength;
-    if (m_uiRecvWindowSize < DEFAULT_SETTINGS_MAX_INITIAL_WINDOW_SIZE / 4)
+    m_uiRecvWindowUnacked += uiRecvLength;
+    if (m_uiRecvWindowUnacked >= m_uiRecvWindowSize / 2)
     {
-        m_pFrame->EncodeWindowUpdate(pCodecH2, uiStreamId,
-                SETTINGS_MAX_INITIAL_WINDOW_SIZE - m_uiRecvWindowSize, pBuff);
+        m_pFrame->EncodeWindowUpdate(pCodecH2, uiStreamId, m_uiRecvWindowUnacked, pBuff);
+        m_uiRecvWindowUnacked = 0;
     }
-    m_uiRecvWindowSize = SETTINGS_MAX_INITIAL_WINDOW_SIZE;
 }
 
 E_CODEC_STATUS Http2Stream::SendWaittingFrameData(CodecHttp2* pCodecH2, CBuffer* pBuff)
@@ -424,5 +454,10 @@ E_CODEC_STATUS Http2Stream::SendWaittingFrameData(CodecHttp2* pCodecH2, CBuffer*
     return(m_pFrame->SendWaittingFrameData(pCodecH2, pBuff));
 }
 
+uint32 Http2Stream::GetWaittingBytes() const
+{
+    return(m_pFrame->GetWaittingBytes());
+}
+
 } /* namespace neb */
 
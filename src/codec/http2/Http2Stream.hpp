@@ -66,6 +66,25 @@ public:
         return(m_bEndHeaders);
     }
 
+    /**
+     * @brief 首个header block（请求头或响应头）是否已接收完毕
+     */
+    bool IsHeadersReceived() const
+    {
+        return(m_bHeadersReceived);
+    }
+
+    /**
+     * @brief 启用分块通知
+     * @note 启用后每个DATA帧和header block解码完毕即返回，而不是等到END_STREAM，用于
+     * gRPC等流式调用。服务端在请求路径为分块通知路径时启用，客户端在请求的chunk_notice
+     * 为true时启用。
+     */
+    void SetChunkNotice(bool bChunkNotice)
+    {
+        m_bChunkNotice = bChunkNotice;
+    }
+
     E_H2_STREAM_STATES GetStreamState()
     {
         return(m_eStreamState);
@@ -81,19 +100,76 @@ public:
         m_eStreamState = eStreamState;
     }
 
+    uint8 GetUrgency() const
+    {
+        return(m_ucUrgency);
+    }
+
+    void SetUrgency(uint8 ucUrgency)
+    {
+        m_ucUrgency = ucUrgency;
+    }
+
+    bool IsWaitting() const
+    {
+        return(m_bWaitting);
+    }
+
+    void SetWaitting(bool bWaitting)
+    {
+        m_bWaitting = bWaitting;
+    }
+
+    uint32 GetWaittingSeq() const
+    {
+        return(m_uiWaittingSeq);
+    }
+
+    void SetWaittingSeq(uint32 uiWaittingSeq)
+    {
+        m_uiWaittingSeq = uiWaittingSeq;
+    }
+
     void EncodeSetState(const tagH2FrameHead& stFrameHead);
 
     void WindowInit(uint32 uiWindowSize);
     void WindowUpdate(int32 iIncrement);
+
+    /**
+     * @brief 设置接收窗口大小（本端通告的SETTINGS_INITIAL_WINDOW_SIZE）
+     */
+    void RecvWindowInit(uint32 uiWindowSize)
+    {
+        m_uiRecvWindowSize = uiWindowSize;
+    }
+
+    /**
+     * @brief 收到DATA帧，已接收的字节数累计到接收窗口的一半时发送WINDOW_UPDATE
+     */
     void ShrinkRecvWindow(CodecHttp2* pCodecH2, uint32 uiStreamId, uint32 uiRecvLength, CBuffer* pBuff);
     E_CODEC_STATUS SendWaittingFrameData(CodecHttp2* pCodecH2, CBuffer* pBuff);
 
+    /**
+     * @brief 因流控窗口不足尚未发送的字节数
+     */
+    uint32 GetWaittingBytes() const;
+
+protected:
+    E_CODEC_STATUS DecodeChunkNotice(bool bEndStream, HttpMsg& oHttpMsg);
+
 private:
     E_H2_STREAM_STATES m_eStreamState;
     uint32 m_uiStreamId;
     int32 m_iSendWindowSize = DEFAULT_SETTINGS_MAX_INITIAL_WINDOW_SIZE;
     uint32 m_uiRecvWindowSize = DEFAULT_SETTINGS_MAX_INITIAL_WINDOW_SIZE;
+    uint32 m_uiRecvWindowUnacked = 0;           ///< 已接收但尚未通过WINDOW_UPDATE归还的字节数
     bool m_bEndHeaders;
+    bool m_bWaitting = false;                   ///< 是否在CodecHttp2的待发送队列中
+    uint32 m_uiWaittingSeq = 0;                 ///< 在待发送队列中有效条目的序号，序号不符的条目已失效
+    bool m_bHeadersReceived = false;            ///< 首个header block是否已接收完毕
+    bool m_bChunkNotice = false;                ///< 是否启用分块通知
+    int32 m_iChunkNoticeSeq = 0;                ///< 分块通知序号（0为http头）
+    uint8 m_ucUrgency = H2_DEFAULT_URGENCY;
     std::unique_ptr<Http2Frame> m_pFrame;
     HttpMsg m_oHttpMsg;
 };
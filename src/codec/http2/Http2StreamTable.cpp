@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     Http2StreamTable.cpp
+ * @brief    HTTP2连接上的stream表
+ * @author   nebim
+ * @date:    2026-10-18
+ * @note
+ * Modify history:
+ ******************************************************************************/
+#include "Http2StreamTable.hpp"
+
+namespace neb
+{
+
+Http2StreamTable::Http2StreamTable()
+    : m_uiMask(INIT_CAPACITY - 1), m_uiSize(0), m_vecSlot(INIT_CAPACITY)
+{
+}
+
+Http2StreamTable::~Http2StreamTable()
+{
+}
+
+bool Http2StreamTable::Insert(uint32 uiStreamId, Http2Stream* pStream)
+{
+    if (pStream == nullptr || Get(uiStreamId) != nullptr)
+    {
+        return(false);
+    }
+    // 负载超过一半时扩容
+    if ((m_uiSize + 1) * 2 > m_vecSlot.size() && m_vecSlot.size() < MAX_CAPACITY)
+    {
+        Grow();
+    }
+    tagSlot& stSlot = m_vecSlot[SlotIndex(uiStreamId)];
+    if (stSlot.pStream == nullptr)
+    {
+        stSlot.uiStreamId = uiStreamId;
+        stSlot.pStream = pStream;
+    }
+    else
+    {
+        m_mapOverflow.insert(std::make_pair(uiStreamId, pStream));
+    }
+    ++m_uiSize;
+    return(true);
+}
+
+Http2Stream* Http2StreamTable::Erase(uint32 uiStreamId)
+{
+    Http2Stream* pStream = nullptr;
+    tagSlot& stSlot = m_vecSlot[SlotIndex(uiStreamId)];
+    if (stSlot.uiStreamId == uiStreamId && stSlot.pStream != nullptr)
+    {
+        pStream = stSlot.pStream;
+        stSlot.pStream = nullptr;
+    }
+    else
+    {
+        auto iter = m_mapOverflow.find(uiStreamId);
+        if (iter == m_mapOverflow.end())
+        {
+            return(nullptr);
+        }
+        pStream = iter->second;
+        m_mapOverflow.erase(iter);
+    }
+    --m_uiSize;
+    return(pStream);
+}
+
+void Http2StreamTable::Clear(std::vector<Http2Stream*>& vecStream)
+{
+    GetAll(vecStream);
+    std::vector<tagSlot> vecSlot(INIT_CAPACITY);
+    m_vecSlot.swap(vecSlot);
+    m_uiMask = INIT_CAPACITY - 1;
+    m_mapOverflow.clear();
+    m_uiSize = 0;
+}
+
+void Http2StreamTable::GetAll(std::vector<Http2Stream*>& vecStream) const
+{
+    vecStream.reserve(vecStream.size() + m_uiSize);
+    for (auto& stSlot : m_vecSlot)
+    {
+        if (stSlot.pStream != nullptr)
+        {
+            vecStream.push_back(stSlot.pStream);
+        }
+    }
+    for (auto& rOverflow : m_mapOverflow)
+    {
+        vecStream.push_back(rOverflow.second);
+    }
+}
+
+void Http2StreamTable::Grow()
+{
+    // 原容量下互不冲突的stream id在翻倍后的容量下仍互不冲突，溢出表中的stream尽量回到槽位
+    std::vector<tagSlot> vecSlot(m_vecSlot.size() * 2);
+    vecSlot.swap(m_vecSlot);
+    m_uiMask = m_vecSlot.size() - 1;
+    for (auto& stSlot : vecSlot)
+    {
+        if (stSlot.pStream != nullptr)
+        {
+            m_vecSlot[SlotIndex(stSlot.uiStreamId)] = stSlot;
+        }
+    }
+    for (auto iter = m_mapOverflow.begin(); iter != m_mapOverflow.end();)
+    {
+        tagSlot& stSlot = m_vecSlot[SlotIndex(iter->first)];
+        if (stSlot.pStream == nullptr)
+        {
+            stSlot.uiStreamId = iter->first;
+            stSlot.pStream = iter->second;
+            iter = m_mapOverflow.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+}
+
+} /* namespace neb */
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     Http2StreamTable.hpp
+ * @brief    HTTP2连接上的stream表
+ * @author   nebim
+ * @date:    2026-10-18
+ * @note     以stream id为下标的环形槽位数组。同一连接上的stream id单调递增（客户端
+ *           发起的为奇数、服务端发起的为偶数），同时存活的stream id集中在最近的一段
+ *           区间内，槽位取stream id去掉奇偶位后的低位，连续的同奇偶stream id占据
+ *           相邻槽位，查找、插入、删除都只访问一个槽位。
+ *           stream数超过容量的一半时容量翻倍（直到上限）；个别长时间存活的stream
+ *           与新stream落在同一槽位时，新stream放入溢出表而不扩容，只有溢出表非空
+ *           时查找才会多查一次哈希表。
+ * Modify history:
+ ******************************************************************************/
+#ifndef SRC_CODEC_HTTP2_HTTP2STREAMTABLE_HPP_
+#define SRC_CODEC_HTTP2_HTTP2STREAMTABLE_HPP_
+
+#include <vector>
+#include <unordered_map>
+#include "Definition.hpp"
+
+namespace neb
+{
+
+class Http2Stream;
+
+class Http2StreamTable
+{
+public:
+    Http2StreamTable();
+    Http2StreamTable(const Http2StreamTable&) = delete;
+    Http2StreamTable& operator=(const Http2StreamTable&) = delete;
+    ~Http2StreamTable();
+
+    /**
+     * @brief 查找stream
+     * @return stream，不存在返回nullptr
+     */
+    Http2Stream* Get(uint32 uiStreamId) const
+    {
+        const tagSlot& stSlot = m_vecSlot[SlotIndex(uiStreamId)];
+        if (stSlot.uiStreamId == uiStreamId && stSlot.pStream != nullptr)
+        {
+            return(stSlot.pStream);
+        }
+        if (m_mapOverflow.empty())
+        {
+            return(nullptr);
+        }
+        auto iter = m_mapOverflow.find(uiStreamId);
+        return((iter == m_mapOverflow.end()) ? nullptr : iter->second);
+    }
+
+    /**
+     * @brief 添加stream（不接管stream的生命周期）
+     * @return 是否添加成功（stream id已存在则失败）
+     */
+    bool Insert(uint32 uiStreamId, Http2Stream* pStream);
+
+    /**
+     * @brief 删除stream（不释放stream）
+     * @return 被删除的stream，不存在返回nullptr
+     */
+    Http2Stream* Erase(uint32 uiStreamId);
+
+    /**
+     * @brief 取出所有stream并清空
+     */
+    void Clear(std::vector<Http2Stream*>& vecStream);
+
+    /**
+     * @brief 所有stream
+     */
+    void GetAll(std::vector<Http2Stream*>& vecStream) const;
+
+    uint32 Size() const
+    {
+        return(m_uiSize);
+    }
+
+protected:
+    uint32 SlotIndex(uint32 uiStreamId) const
+    {
+        return((uiStreamId >> 1) & m_uiMask);
+    }
+
+    struct tagSlot
+    {
+        uint32 uiStreamId = 0;
+        Http2Stream* pStream = nullptr;     ///< 为nullptr表示空槽位
+    };
+
+    void Grow();
+
+private:
+    static const uint32 INIT_CAPACITY = 256;        ///< 必须为2的幂
+    static const uint32 MAX_CAPACITY = 65536;       ///< 必须为2的幂
+    uint32 m_uiMask;
+    uint32 m_uiSize;
+    std::vector<tagSlot> m_vecSlot;
+    std::unordered_map<uint32, Http2Stream*> m_mapOverflow;
+};
+
+} /* namespace neb */
+
+#endif /* SRC_CODEC_HTTP2_HTTP2STREAMTABLE_HPP_ */
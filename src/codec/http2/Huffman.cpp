@@ -73,20 +73,16 @@ const uint8_t Huffman::CODE_LENGTHS[] =
     26, 27, 26, 26, 27, 27, 27, 27, 27, 28, 27, 27, 27, 27, 27, 26
 };
 
+const uint32_t Huffman::EOS_CODE = 0x3fffffff;
+const uint8_t Huffman::EOS_CODE_LENGTH = 30;
+
 Huffman::Huffman()
-    : m_pRoot(nullptr)
 {
-    m_pRoot = new Node();
-    BuildTree();
+    BuildDecodeTable();
 }
 
 Huffman::~Huffman()
 {
-    if (m_pRoot != nullptr)
-    {
-        delete m_pRoot;
-        m_pRoot = nullptr;
-    }
 }
 
 Huffman* Huffman::Instance()
@@ -98,127 +94,157 @@ Huffman* Huffman::Instance()
     return(m_pInstance);
 }
 
+size_t Huffman::EncodedLength(const std::string& strData) const
+{
+    size_t uiBits = 0;
+    for (size_t i = 0; i < strData.size(); ++i)
+    {
+        uiBits += CODE_LENGTHS[(uint8_t)strData[i]];
+    }
+    return((uiBits + 7) >> 3);
+}
+
 void Huffman::Encode(const std::string& strData, CBuffer* pBuff)
 {
-    uint32_t uiCurrent = 0;
+    size_t uiEncodedLength = EncodedLength(strData);
+    if (uiEncodedLength == 0 || !pBuff->EnsureWritableBytes(uiEncodedLength))
+    {
+        return;
+    }
+    uint8_t* pOut = (uint8_t*)pBuff->GetRawWriteBuffer();
+    uint64_t ullCurrent = 0;
     uint32_t uiNotWrittenBits = 0;
-    int iByte = 0;
-    uint32_t uiCode = 0;
-    uint8_t ucBits = 0;
-    uint8_t ucMask = 0xFF;
-
+    uint8_t ucSymbol = 0;
     for (size_t i = 0; i < strData.size(); ++i)
     {
-        iByte = strData[i];
-        uiCode = CODES[iByte];
-        ucBits = CODE_LENGTHS[iByte];
-
-        uiCurrent <<= ucBits;
-        uiCurrent |= uiCode;
-        uiNotWrittenBits += ucBits;
-
-        while (uiNotWrittenBits >= 8)
+        ucSymbol = (uint8_t)strData[i];
+        ullCurrent = (ullCurrent << CODE_LENGTHS[ucSymbol]) | CODES[ucSymbol];
+        uiNotWrittenBits += CODE_LENGTHS[ucSymbol];
+        if (uiNotWrittenBits >= 32)     // 码长不超过30位，寄存器中最多61位
         {
-            uiNotWrittenBits -= 8;
-            pBuff->WriteByte((uiCurrent >> uiNotWrittenBits));
+            uiNotWrittenBits -= 32;
+            uint32_t uiWord = (uint32_t)(ullCurrent >> uiNotWrittenBits);
+            pOut[0] = (uint8_t)(uiWord >> 24);
+            pOut[1] = (uint8_t)(uiWord >> 16);
+            pOut[2] = (uint8_t)(uiWord >> 8);
+            pOut[3] = (uint8_t)uiWord;
+            pOut += 4;
         }
     }
-
+    while (uiNotWrittenBits >= 8)
+    {
+        uiNotWrittenBits -= 8;
+        *pOut++ = (uint8_t)(ullCurrent >> uiNotWrittenBits);
+    }
     if (uiNotWrittenBits > 0)
     {
-        uiCurrent <<= (8 - uiNotWrittenBits);
-        uiCurrent |= (ucMask >> uiNotWrittenBits);
-        pBuff->WriteByte((uiCurrent));
+        // 以EOS码的最高位（全1）填充
+        *pOut++ = (uint8_t)((ullCurrent << (8 - uiNotWrittenBits)) | (0xFF >> uiNotWrittenBits));
     }
+    pBuff->AdvanceWriteIndex(uiEncodedLength);
 }
 
-bool Huffman::Decode(CBuffer* pBuff, int iBuffLength, std::string& strData)
+bool Huffman::Decode(const char* pData, size_t uiDataLen, std::string& strData)
 {
-    Node *pNode = m_pRoot;
-    uint32_t uiCurrent = 0;
-    uint8_t ucBits = 0;
-    char c = 0;
-    for (int i = 0; i < iBuffLength; ++i)
+    const uint8_t* pIn = (const uint8_t*)pData;
+    const uint8_t* pEnd = pIn + uiDataLen;
+    uint8_t ucState = 0;
+    uint8_t ucFlags = HUFFMAN_DECODE_ACCEPTED;
+    // 最短的码为5位，解码结果不超过uiDataLen * 8 / 5字节，先按上限扩容再直接写入，
+    // 每次转移都先写入再按是否产生符号前移，多留1字节
+    size_t uiOriginSize = strData.size();
+    strData.resize(uiOriginSize + uiDataLen * 8 / 5 + 1);
+    char* pOut = &strData[uiOriginSize];
+    char* pOutBegin = pOut;
+    for (; pIn < pEnd; ++pIn)
     {
-        pBuff->ReadByte(c);
-        uiCurrent = (uiCurrent << 8) | (c & 0xFF);
-        ucBits += 8;
-        while (ucBits >= 8)
+        const tagDecodeEntry& stHigh = m_aDecodeTable[ucState][*pIn >> 4];
+        const tagDecodeEntry& stLow = m_aDecodeTable[stHigh.ucState][*pIn & 0x0F];
+        if ((stHigh.ucFlags | stLow.ucFlags) & HUFFMAN_DECODE_FAIL)
         {
-            uint32_t uiChild = (uiCurrent >> (ucBits - 8)) & 0xFF;
-            pNode = pNode->vecChildren[uiChild];
-            if (pNode->vecChildren.size() == 0)
-            {
-                // terminal pNode
-                strData.append(1, pNode->ucSymbol);
-                ucBits -= pNode->ucTerminalBits;
-                pNode = m_pRoot;
-            }
-            else
-            {
-                // non-terminal pNode
-                ucBits -= 8;
-            }
+            strData.resize(uiOriginSize + (pOut - pOutBegin));
+            return(false);
         }
+        *pOut = (char)stHigh.ucSymbol;
+        pOut += (stHigh.ucFlags & HUFFMAN_DECODE_SYMBOL);
+        *pOut = (char)stLow.ucSymbol;
+        pOut += (stLow.ucFlags & HUFFMAN_DECODE_SYMBOL);
+        ucState = stLow.ucState;
+        ucFlags = stLow.ucFlags;
     }
+    strData.resize(uiOriginSize + (pOut - pOutBegin));
+    return(ucFlags & HUFFMAN_DECODE_ACCEPTED);
+}
+
+bool Huffman::Decode(CBuffer* pBuff, int iBuffLength, std::string& strData)
+{
+    bool bResult = Decode(pBuff->GetRawReadBuffer(), iBuffLength, strData);
+    pBuff->AdvanceReadIndex(iBuffLength);
+    return(bResult);
+}
 
-    /* TODO confirm
-       A padding strictly longer than 7 bits MUST be treated as a decoding error.
-       A padding not corresponding to the most significant bits of the code for the EOS symbol MUST be treated as a decoding error.
-       A Huffman-encoded string literal containing the EOS symbol MUST be treated as a decoding error.
-    */
-    while (ucBits > 0)
+void Huffman::BuildDecodeTable()
+{
+    // 先建Huffman树：内部节点编号0~255（0为根），叶子用负数-(symbol + 1)表示，EOS的symbol为256
+    int16_t aChild[sc_uiStateNum][2] = {{0}};
+    uint8_t aDepth[sc_uiStateNum] = {0};
+    bool aAllOnes[sc_uiStateNum] = {true};
+    uint32_t uiNodeNum = 1;
+    for (int iSymbol = 0; iSymbol <= 256; ++iSymbol)
     {
-        uint32_t uiChild = (uiCurrent << (8 - ucBits)) & 0xFF;
-        pNode = pNode->vecChildren[uiChild];
-        if (pNode->vecChildren.size() > 0 || pNode->ucTerminalBits > ucBits)
+        uint32_t uiCode = (iSymbol == 256) ? EOS_CODE : CODES[iSymbol];
+        uint8_t ucLen = (iSymbol == 256) ? EOS_CODE_LENGTH : CODE_LENGTHS[iSymbol];
+        uint32_t uiNode = 0;
+        for (int iBit = ucLen - 1; iBit > 0; --iBit)
         {
-            break;
+            uint32_t uiBranch = (uiCode >> iBit) & 1;
+            if (aChild[uiNode][uiBranch] == 0)
+            {
+                aChild[uiNode][uiBranch] = uiNodeNum;
+                aDepth[uiNodeNum] = aDepth[uiNode] + 1;
+                aAllOnes[uiNodeNum] = aAllOnes[uiNode] && uiBranch;
+                ++uiNodeNum;
+            }
+            uiNode = aChild[uiNode][uiBranch];
         }
-        strData.append(1, pNode->ucSymbol);
-        ucBits -= pNode->ucTerminalBits;
-        pNode = m_pRoot;
+        aChild[uiNode][uiCode & 1] = -(iSymbol + 1);
     }
-    return(true);
-}
 
-void Huffman::BuildTree()
-{
-    uint8_t ucSym = 0;
-    uint32_t uiCode = 0;
-    uint8_t ucLen = 0;
-    for (int i = 0; i < 256; i++)
+    // 再由树生成每个状态（内部节点）读入4位后的转移
+    for (uint32_t uiState = 0; uiState < sc_uiStateNum; ++uiState)
     {
-        ucSym = i;
-        uiCode = CODES[i];
-        ucLen = CODE_LENGTHS[i];
-        Node* pTerminal = new Node(ucSym, ucLen);
-
-        Node* pCurrent = m_pRoot;
-        while (ucLen > 8)
+        for (uint32_t uiNibble = 0; uiNibble < 16; ++uiNibble)
         {
-            ucLen -= 8;
-            int i = ((uiCode >> ucLen) & 0xFF);
-            if (pCurrent->vecChildren.size() > 0)
+            tagDecodeEntry& stEntry = m_aDecodeTable[uiState][uiNibble];
+            stEntry.ucState = 0;
+            stEntry.ucFlags = 0;
+            stEntry.ucSymbol = 0;
+            int iNode = uiState;
+            for (int iBit = 3; iBit >= 0; --iBit)
             {
-                if (pCurrent->vecChildren[i] == nullptr)
+                iNode = aChild[iNode][(uiNibble >> iBit) & 1];
+                if (iNode < 0)
                 {
-                    pCurrent->vecChildren[i] = new Node();
+                    if (iNode == -257)
+                    {
+                        stEntry.ucFlags = HUFFMAN_DECODE_FAIL;
+                        break;
+                    }
+                    stEntry.ucFlags |= HUFFMAN_DECODE_SYMBOL;
+                    stEntry.ucSymbol = (uint8_t)(-iNode - 1);
+                    iNode = 0;
                 }
-                pCurrent = pCurrent->vecChildren[i];
             }
-            else    // Impossible to reach
+            if (stEntry.ucFlags & HUFFMAN_DECODE_FAIL)
             {
-                ; //error
+                continue;
+            }
+            stEntry.ucState = (uint8_t)iNode;
+            // 结束时未完成的码只能是不超过7位的EOS码前缀（全1）
+            if (iNode == 0 || (aAllOnes[iNode] && aDepth[iNode] <= 7))
+            {
+                stEntry.ucFlags |= HUFFMAN_DECODE_ACCEPTED;
             }
-        }
-
-        uint8_t ucShift = 8 - ucLen;
-        uint32_t uiStart = (uiCode << ucShift) & 0xFF;
-        uint32_t uiEnd = 1 << ucShift;
-        for (uint32_t i = uiStart; i < uiStart + uiEnd; i++)
-        {
-            pCurrent->vecChildren[i] = pTerminal;
         }
     }
 }
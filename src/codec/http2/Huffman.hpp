@@ -11,71 +11,11 @@
 #define SRC_CODEC_HTTP2_HUFFMAN_HPP_
 
 #include <string>
-#include <vector>
 #include "util/CBuffer.hpp"
 
 namespace neb
 {
 
-struct Node
-{
-    // Terminal nodes have a symbol.
-    uint8_t ucSymbol;
-    // Number of bits represented in the terminal node.
-    uint8_t ucTerminalBits;
-    // size() = 0 if terminal.
-    std::vector<Node*> vecChildren;
-
-    Node()
-    {
-        ucSymbol = 0;
-        ucTerminalBits = 0;
-        vecChildren.resize(256, nullptr);
-    }
-
-    Node(uint8_t ucSym, uint8_t ucBits)
-    {
-        ucSymbol = ucSym;
-        uint8_t b = ucBits & 0x07;
-        ucTerminalBits = (b == 0) ? 8 : b;
-    }
-
-    Node(const Node& stNode) = delete;
-
-    Node(Node&& stNode)
-    {
-        ucSymbol = stNode.ucSymbol;
-        stNode.ucSymbol = 0;
-        ucTerminalBits = stNode.ucTerminalBits;
-        stNode.ucTerminalBits = 0;
-        vecChildren = std::move(stNode.vecChildren);
-    }
-
-    virtual ~Node()
-    {
-        for (auto it = vecChildren.begin(); it != vecChildren.end(); ++it)
-        {
-            if (*it != nullptr)
-            {
-                delete (*it);
-            }
-        }
-        vecChildren.clear();
-    }
-
-    Node& operator=(const Node& stNode) = delete;
-
-    Node& operator=(Node&& stNode)
-    {
-        ucSymbol = stNode.ucSymbol;
-        stNode.ucSymbol = 0;
-        ucTerminalBits = stNode.ucTerminalBits;
-        stNode.ucTerminalBits = 0;
-        vecChildren = std::move(stNode.vecChildren);
-        return(*this);
-    }
-};
-
 class Huffman
 {
 public:
@@ -83,19 +23,61 @@ public:
 
     static Huffman* Instance();
 
+    /**
+     * @brief Huffman编码后的字节数
+     */
+    size_t EncodedLength(const std::string& strData) const;
+
+    /**
+     * @brief Huffman编码，结果追加到pBuff
+     * @note 编码位累积在64位寄存器中，每满32位整体写出，写缓冲区只预留一次。
+     */
     void Encode(const std::string& strData, CBuffer* pBuff);
+
+    /**
+     * @brief Huffman解码
+     * @note 按4位（半字节）查状态转移表，每次转移最多产生一个符号（最短的码为5位）。
+     * 填充超过7位、填充不是EOS码的最高位或者出现EOS均视为解码错误（rfc7541 5.2）。
+     * @param pData 待解码数据
+     * @param uiDataLen 待解码数据长度
+     * @param strData 解码结果（追加）
+     * @return 是否解码成功
+     */
+    bool Decode(const char* pData, size_t uiDataLen, std::string& strData);
+
+    /**
+     * @brief Huffman解码，从pBuff读取iBuffLength字节
+     */
     bool Decode(CBuffer* pBuff, int iBuffLength, std::string& strData);
 
 protected:
-    void BuildTree();
+    void BuildDecodeTable();
 
 private:
     Huffman();
-    Node* m_pRoot;
+
+    enum E_HUFFMAN_DECODE_FLAG
+    {
+        HUFFMAN_DECODE_SYMBOL       = 0x01,     ///< 本次转移产生一个符号
+        HUFFMAN_DECODE_ACCEPTED     = 0x02,     ///< 转移后的状态可以作为结束状态
+        HUFFMAN_DECODE_FAIL         = 0x04,     ///< 出现EOS
+    };
+
+    struct tagDecodeEntry
+    {
+        uint8_t ucState;        ///< 转移后的状态（Huffman树的内部节点编号）
+        uint8_t ucFlags;
+        uint8_t ucSymbol;
+    };
+
+    static const uint32_t sc_uiStateNum = 256;  ///< 257个叶子（含EOS）的Huffman树恰好有256个内部节点
+    tagDecodeEntry m_aDecodeTable[sc_uiStateNum][16];
 
     static Huffman* m_pInstance;
     static const uint32_t CODES[];
     static const uint8_t CODE_LENGTHS[];
+    static const uint32_t EOS_CODE;
+    static const uint8_t EOS_CODE_LENGTH;
 };
 
 } /* namespace neb */
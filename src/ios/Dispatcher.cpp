@@ -17,16 +17,23 @@
 #include "actor/Actor.hpp"
 #include "actor/step/Step.hpp"
 #include "actor/step/RedisStep.hpp"
+#include "actor/context/Context.hpp"
 #include "actor/session/sys_session/manager/SessionManager.hpp"
+#include "codec/http2/H2Comm.hpp"
 
 namespace neb
 {
 
 Dispatcher::Dispatcher(Labor* pLabor, std::shared_ptr<NetLogger> pLogger)
    : m_pErrBuff(NULL), m_pLabor(pLabor), m_loop(NULL), m_iClientNum(0), m_lLastCheckNodeTime(0),
-     m_pLogger(pLogger), m_pSessionNode(nullptr)
+     m_pLogger(pLogger), m_pSessionNode(nullptr), m_pArenaBlock(NULL), m_pArena(nullptr), m_pPrepareWatcher(NULL)
 {
     m_pErrBuff = (char*)malloc(gc_iErrBuffLen);
+    m_pArenaBlock = (char*)malloc(gc_iArenaBlockSize);
+    google::protobuf::ArenaOptions oArenaOptions;
+    oArenaOptions.initial_block = m_pArenaBlock;
+    oArenaOptions.initial_block_size = gc_iArenaBlockSize;
+    m_pArena = new google::protobuf::Arena(oArenaOptions);
 
     m_loop = ev_loop_new(EVFLAG_FORKCHECK | EVFLAG_SIGNALFD);
 }
@@ -46,6 +53,7 @@ void Dispatcher::IoCallback(struct ev_loop* loop, struct ev_io* watcher, int rev
         if (revents & EV_READ)
         {
             pDispatcher->OnIoRead(pSharedChannel);
+            pDispatcher->ResetArena();
         }
         if ((revents & EV_WRITE) && (CHANNEL_STATUS_CLOSED != pChannel->m_pImpl->GetChannelStatus())) // the channel maybe closed by OnIoRead()
         {
@@ -118,6 +126,17 @@ void Dispatcher::ClientConnFrequencyTimeoutCallback(struct ev_loop* loop, ev_tim
     }
 }
 
+void Dispatcher::PrepareCallback(struct ev_loop* loop, ev_prepare* watcher, int revents)
+{
+    if (watcher->data != NULL)
+    {
+        Dispatcher* pDispatcher = (Dispatcher*)(watcher->data);
+        pDispatcher->OnFlush();
+        // 定时器、信号等非读事件回调中分配的Arena消息在本轮事件循环结束时释放
+        pDispatcher->ResetArena();
+    }
+}
+
 bool Dispatcher::OnIoRead(std::shared_ptr<SocketChannel> pChannel)
 {
     LOG4_TRACE("fd[%d]", pChannel->m_pImpl->GetFd());
@@ -166,7 +185,7 @@ bool Dispatcher::DataRecvAndHandle(std::shared_ptr<SocketChannel> pChannel)
         case CODEC_HTTP2:
             for (int i = 0; ; ++i)
             {
-                HttpMsg oHttpMsg;
+                HttpMsg& oHttpMsg = *google::protobuf::Arena::CreateMessage<HttpMsg>(m_pArena);
                 if (0 == i)
                 {
                     eCodecStatus = pChannel->m_pImpl->Recv(oHttpMsg);
@@ -179,7 +198,12 @@ bool Dispatcher::DataRecvAndHandle(std::shared_ptr<SocketChannel> pChannel)
                 if (CODEC_STATUS_OK == eCodecStatus
                         || CODEC_STATUS_PART_OK == eCodecStatus)
                 {
-                    if (oHttpMsg.http_major() > 1)
+                    const NativeHttpMsg* pNativeMsg = pChannel->m_pImpl->TakeNativeHttpMsg();
+                    if (pNativeMsg != nullptr)
+                    {
+                        m_pLabor->GetActorBuilder()->OnMessage(pChannel, *pNativeMsg);
+                    }
+                    else if (oHttpMsg.http_major() > 1)
                     {
                         if (oHttpMsg.stream_id() > 0)
                         {
@@ -200,11 +224,21 @@ bool Dispatcher::DataRecvAndHandle(std::shared_ptr<SocketChannel> pChannel)
                     break;
                 }
             }
+            if (CODEC_HTTP2 == pChannel->GetCodecType())
+            {
+                OnHttp2StreamReset(pChannel);
+                OnHttp2StreamWritable(pChannel);
+            }
+            if (CODEC_STATUS_PAUSE == eCodecStatus && pChannel->IsClient()
+                    && CODEC_HTTP2 == pChannel->GetCodecType())
+            {
+                SendHttp2Pending(pChannel);
+            }
             break;
         case CODEC_RESP:
             for (int i = 0; ; ++i)
             {
-                RedisMsg oRedisMsg;
+                RedisMsg& oRedisMsg = *google::protobuf::Arena::CreateMessage<RedisMsg>(m_pArena);
                 if (0 == i)
                 {
                     eCodecStatus = pChannel->m_pImpl->Recv(oRedisMsg);
@@ -229,7 +263,6 @@ bool Dispatcher::DataRecvAndHandle(std::shared_ptr<SocketChannel> pChannel)
             CBuffer oBuff;
             for (int i = 0; ; ++i)
             {
-                RedisMsg oRedisMsg;
                 if (0 == i)
                 {
                     eCodecStatus = pChannel->m_pImpl->Recv(oBuff);
@@ -253,8 +286,8 @@ bool Dispatcher::DataRecvAndHandle(std::shared_ptr<SocketChannel> pChannel)
         default:
             for (int i = 0; ; ++i)
             {
-                MsgHead oMsgHead;
-                MsgBody oMsgBody;
+                MsgHead& oMsgHead = *google::protobuf::Arena::CreateMessage<MsgHead>(m_pArena);
+                MsgBody& oMsgBody = *google::protobuf::Arena::CreateMessage<MsgBody>(m_pArena);
                 if (0 == i)
                 {
                     eCodecStatus = pChannel->m_pImpl->Recv(oMsgHead, oMsgBody);
@@ -335,12 +368,17 @@ bool Dispatcher::DataFetchAndHandle(std::shared_ptr<SocketChannel> pChannel)
         case CODEC_HTTP:
         case CODEC_HTTP2:
             {
-                HttpMsg oHttpMsg;
+                HttpMsg& oHttpMsg = *google::protobuf::Arena::CreateMessage<HttpMsg>(m_pArena);
                 eCodecStatus = pChannel->m_pImpl->Fetch(oHttpMsg);
                 while (CODEC_STATUS_OK == eCodecStatus
                         || CODEC_STATUS_PART_OK == eCodecStatus)
                 {
-                    if (oHttpMsg.http_major() > 1)
+                    const NativeHttpMsg* pNativeMsg = pChannel->m_pImpl->TakeNativeHttpMsg();
+                    if (pNativeMsg != nullptr)
+                    {
+                        m_pLabor->GetActorBuilder()->OnMessage(pChannel, *pNativeMsg);
+                    }
+                    else if (oHttpMsg.http_major() > 1)
                     {
                         if (oHttpMsg.stream_id() > 0)
                         {
@@ -357,12 +395,22 @@ bool Dispatcher::DataFetchAndHandle(std::shared_ptr<SocketChannel> pChannel)
                 {
                     m_pLabor->GetActorBuilder()->OnMessage(pChannel, oHttpMsg);
                 }
+                if (CODEC_HTTP2 == pChannel->GetCodecType())
+                {
+                    OnHttp2StreamReset(pChannel);
+                    OnHttp2StreamWritable(pChannel);
+                }
+                if (CODEC_STATUS_PAUSE == eCodecStatus && pChannel->IsClient()
+                        && CODEC_HTTP2 == pChannel->GetCodecType())
+                {
+                    SendHttp2Pending(pChannel);
+                }
             }
             break;
         case CODEC_RESP:
             for (int i = 0; ; ++i)
             {
-                RedisMsg oRedisMsg;
+                RedisMsg& oRedisMsg = *google::protobuf::Arena::CreateMessage<RedisMsg>(m_pArena);
                 eCodecStatus = pChannel->m_pImpl->Fetch(oRedisMsg);
                 if (CODEC_STATUS_OK == eCodecStatus)
                 {
@@ -379,7 +427,6 @@ bool Dispatcher::DataFetchAndHandle(std::shared_ptr<SocketChannel> pChannel)
             CBuffer oBuff;
             for (int i = 0; ; ++i)
             {
-                RedisMsg oRedisMsg;
                 eCodecStatus = pChannel->m_pImpl->Fetch(oBuff);
                 if (CODEC_STATUS_OK == eCodecStatus)
                 {
@@ -395,8 +442,8 @@ bool Dispatcher::DataFetchAndHandle(std::shared_ptr<SocketChannel> pChannel)
         default:
             for (int i = 0; ; ++i)
             {
-                MsgHead oMsgHead;
-                MsgBody oMsgBody;
+                MsgHead& oMsgHead = *google::protobuf::Arena::CreateMessage<MsgHead>(m_pArena);
+                MsgBody& oMsgBody = *google::protobuf::Arena::CreateMessage<MsgBody>(m_pArena);
                 eCodecStatus = pChannel->m_pImpl->Fetch(oMsgHead, oMsgBody);
                 if (CODEC_STATUS_OK == eCodecStatus)
                 {
@@ -640,6 +687,46 @@ bool Dispatcher::OnIoWrite(std::shared_ptr<SocketChannel> pChannel)
     return(true);
 }
 
+void Dispatcher::OnFlush()
+{
+    if (m_vecFlushChannel.empty())
+    {
+        return;
+    }
+    std::vector<std::shared_ptr<SocketChannel> > vecFlushChannel;
+    vecFlushChannel.swap(m_vecFlushChannel);    // 发送失败的回调处理中可能再次登记
+    for (auto& pChannel : vecFlushChannel)
+    {
+        if (!pChannel->m_pImpl->IsFlushPending()
+                || CHANNEL_STATUS_CLOSED == pChannel->m_pImpl->GetChannelStatus())
+        {
+            continue;
+        }
+        E_CODEC_STATUS eCodecStatus = pChannel->m_pImpl->Send();
+        LOG4_TRACE("fd[%d] flush status %d", pChannel->m_pImpl->GetFd(), eCodecStatus);
+        switch (eCodecStatus)
+        {
+            case CODEC_STATUS_OK:
+                break;
+            case CODEC_STATUS_PAUSE:
+            case CODEC_STATUS_WANT_WRITE:
+            case CODEC_STATUS_PART_OK:
+                AddIoWriteEvent(pChannel);
+                break;
+            case CODEC_STATUS_WANT_READ:
+                RemoveIoWriteEvent(pChannel);
+                break;
+            default:
+                DiscardSocketChannel(pChannel);
+        }
+    }
+    if (m_vecFlushChannel.empty())
+    {
+        vecFlushChannel.clear();
+        vecFlushChannel.swap(m_vecFlushChannel);    // 复用已分配的内存
+    }
+}
+
 bool Dispatcher::OnIoError(std::shared_ptr<SocketChannel> pChannel)
 {
     LOG4_TRACE(" ");
@@ -716,6 +803,14 @@ void Dispatcher::EventRun()
     ev_run (m_loop, 0);
 }
 
+void Dispatcher::ResetArena()
+{
+    if (m_pArena->SpaceUsed() > 0)
+    {
+        m_pArena->Reset();
+    }
+}
+
 bool Dispatcher::AddIoTimeout(std::shared_ptr<SocketChannel> pChannel, ev_tstamp dTimeout)
 {
     LOG4_TRACE("%d, %u", pChannel->m_pImpl->GetFd(), pChannel->m_pImpl->GetSequence());
@@ -1005,6 +1100,174 @@ void Dispatcher::DelNamedSocketChannel(const std::string& strIdentify)
     }
 }
 
+bool Dispatcher::SendMultiplex(const std::string& strHost, int iPort, bool bWithSsl, const HttpMsg& oHttpMsg, uint32 uiStepSeq)
+{
+    LOG4_TRACE("host %s port %d", strHost.c_str(), iPort);
+    std::string strIdentify = bWithSsl ? "h2://" : "h2c://";
+    strIdentify.append(strHost);
+    strIdentify.append(":");
+    strIdentify.append(std::to_string(iPort));
+    uint32 uiChannelNum = 0;
+    auto named_iter = m_mapNamedSocketChannel.find(strIdentify);
+    if (named_iter != m_mapNamedSocketChannel.end())
+    {
+        // 优先用满已有连接的并发stream，连接数尽量少
+        std::shared_ptr<SocketChannel> pAvailableChannel;
+        for (auto channel_iter = named_iter->second.begin();
+                channel_iter != named_iter->second.end(); ++channel_iter)
+        {
+            if ((*channel_iter)->m_pImpl->IsHttp2StreamAvailable())
+            {
+                pAvailableChannel = *channel_iter;
+                break;
+            }
+        }
+        if (pAvailableChannel != nullptr)
+        {
+            return(SendTo(pAvailableChannel, oHttpMsg, uiStepSeq));
+        }
+        uiChannelNum = named_iter->second.size();
+    }
+    if (uiChannelNum < HTTP2_UPSTREAM_CONNECTION_NUM)
+    {
+        return(AutoSend(strIdentify, strHost, iPort, 0, CODEC_HTTP2, bWithSsl, true, oHttpMsg, uiStepSeq));
+    }
+
+    tagHttp2Upstream& stUpstream = m_mapHttp2Upstream[strIdentify];
+    if (stUpstream.dequePending.size() >= HTTP2_UPSTREAM_PENDING_MAX)
+    {
+        LOG4_WARNING("too many pending requests to %s!", strIdentify.c_str());
+        return(false);
+    }
+    stUpstream.strHost = strHost;
+    stUpstream.iPort = iPort;
+    stUpstream.bWithSsl = bWithSsl;
+    stUpstream.dequePending.emplace_back();
+    stUpstream.dequePending.back().uiStepSeq = uiStepSeq;
+    stUpstream.dequePending.back().oHttpMsg = oHttpMsg;
+    LOG4_TRACE("%s is saturated, %u requests pending.", strIdentify.c_str(), (uint32)stUpstream.dequePending.size());
+    return(true);
+}
+
+void Dispatcher::SendHttp2Pending(std::shared_ptr<SocketChannel> pChannel)
+{
+    auto upstream_iter = m_mapHttp2Upstream.find(pChannel->m_pImpl->GetIdentify());
+    if (upstream_iter == m_mapHttp2Upstream.end())
+    {
+        return;
+    }
+    // 发送失败时连接被关闭，排队的请求由RedispatchHttp2Pending()转移，队列随之清空
+    auto& dequePending = upstream_iter->second.dequePending;
+    while (!dequePending.empty() && pChannel->m_pImpl->IsHttp2StreamAvailable())
+    {
+        tagHttp2PendingRequest stRequest = std::move(dequePending.front());
+        dequePending.pop_front();
+        if (IsHttp2PendingExpired(pChannel, stRequest))
+        {
+            continue;
+        }
+        SendTo(pChannel, stRequest.oHttpMsg, stRequest.uiStepSeq);
+    }
+}
+
+void Dispatcher::OnHttp2StreamReset(std::shared_ptr<SocketChannel> pChannel)
+{
+    std::vector<std::pair<uint32, uint32> > vecResetStream;
+    if (!pChannel->m_pImpl->TakeHttp2ResetStreams(vecResetStream))
+    {
+        return;
+    }
+    for (auto& rResetStream : vecResetStream)
+    {
+        if (pChannel->IsClient())
+        {
+            uint32 uiStepSeq = pChannel->m_pImpl->PopStepSeq(rResetStream.first);
+            if (0 == uiStepSeq)
+            {
+                continue;
+            }
+            int iErrno = ERR_STREAM_ERROR;
+            switch (rResetStream.second)
+            {
+                case H2_ERR_CANCEL:
+                    iErrno = ERR_STREAM_RESET;
+                    break;
+                case H2_ERR_REFUSED_STREAM:
+                    iErrno = ERR_STREAM_REFUSED;
+                    break;
+                default:
+                    break;
+            }
+            char szErrMsg[64];
+            snprintf(szErrMsg, sizeof(szErrMsg), "stream reset by peer, http2 error code %u.", rResetStream.second);
+            m_pLabor->GetActorBuilder()->OnError(pChannel, uiStepSeq, iErrno, szErrMsg);
+        }
+        else
+        {
+            m_pLabor->GetActorBuilder()->OnStreamReset(pChannel, rResetStream.first);
+        }
+    }
+}
+
+void Dispatcher::OnHttp2StreamWritable(std::shared_ptr<SocketChannel> pChannel)
+{
+    std::vector<uint32> vecStreamId;
+    if (!pChannel->m_pImpl->TakeHttp2WritableStreams(vecStreamId) || pChannel->IsClient())
+    {
+        return;     // 本端发起的stream一次发出整个请求，不通知
+    }
+    for (auto uiStreamId : vecStreamId)
+    {
+        m_pLabor->GetActorBuilder()->OnStreamWritable(pChannel, uiStreamId);
+    }
+}
+
+void Dispatcher::RedispatchHttp2Pending(std::shared_ptr<SocketChannel> pChannel)
+{
+    auto upstream_iter = m_mapHttp2Upstream.find(pChannel->m_pImpl->GetIdentify());
+    if (upstream_iter == m_mapHttp2Upstream.end() || upstream_iter->second.dequePending.empty())
+    {
+        return;
+    }
+    // 连接关闭后排队的请求重新选择连接（必要时新建连接）发送
+    std::deque<tagHttp2PendingRequest> dequePending;
+    dequePending.swap(upstream_iter->second.dequePending);
+    std::string strHost = upstream_iter->second.strHost;
+    int iPort = upstream_iter->second.iPort;
+    bool bWithSsl = upstream_iter->second.bWithSsl;
+    for (auto& stRequest : dequePending)
+    {
+        if (IsHttp2PendingExpired(pChannel, stRequest))
+        {
+            continue;
+        }
+        SendMultiplex(strHost, iPort, bWithSsl, stRequest.oHttpMsg, stRequest.uiStepSeq);
+    }
+}
+
+bool Dispatcher::IsHttp2PendingExpired(std::shared_ptr<SocketChannel> pChannel, const tagHttp2PendingRequest& stRequest)
+{
+    if (stRequest.uiStepSeq == 0)
+    {
+        return(false);
+    }
+    // 排队期间Step已超时或被删除，请求无人等待响应，不再发送
+    std::shared_ptr<Step> pStep = m_pLabor->GetActorBuilder()->GetStep(stRequest.uiStepSeq);
+    if (nullptr == pStep)
+    {
+        LOG4_TRACE("step %u is gone, drop its pending request.", stRequest.uiStepSeq);
+        return(true);
+    }
+    // 上游请求已被取消，下游stream在编码时才登记到Context，排队中的请求须在这里放弃
+    if (nullptr != pStep->GetContext() && pStep->GetContext()->IsCancelled())
+    {
+        LOG4_TRACE("context of step %u is cancelled, drop its pending request.", stRequest.uiStepSeq);
+        m_pLabor->GetActorBuilder()->OnError(pChannel, stRequest.uiStepSeq, ERR_STREAM_RESET, "upstream stream cancelled by peer");
+        return(true);
+    }
+    return(false);
+}
+
 void Dispatcher::SetChannelIdentify(std::shared_ptr<SocketChannel> pChannel, const std::string& strIdentify)
 {
     pChannel->m_pImpl->SetIdentify(strIdentify);
@@ -1082,6 +1345,17 @@ bool Dispatcher::AddEvent(ev_idle* idle_watcher, idle_callback pFunc)
     return(true);
 }
 
+bool Dispatcher::AddEvent(ev_prepare* prepare_watcher, prepare_callback pFunc)
+{
+    if (NULL == prepare_watcher)
+    {
+        return(false);
+    }
+    ev_prepare_init (prepare_watcher, pFunc);
+    ev_prepare_start (m_loop, prepare_watcher);
+    return(true);
+}
+
 bool Dispatcher::RefreshEvent(ev_timer* timer_watcher, ev_tstamp dTimeout)
 {
     if (NULL == timer_watcher)
@@ -1196,6 +1470,11 @@ bool Dispatcher::CreateListenFd(const std::string& strHost, int32 iPort, int& iF
     return(true);
 }
 
+void Dispatcher::AddFlushChannel(std::shared_ptr<SocketChannel> pChannel)
+{
+    m_vecFlushChannel.push_back(pChannel);
+}
+
 std::shared_ptr<SocketChannel> Dispatcher::GetChannel(int iFd)
 {
     auto iter = m_mapSocketChannel.find(iFd);
@@ -1226,13 +1505,32 @@ bool Dispatcher::Init()
     Codec::AddAutoSwitchCodecType(CODEC_PROTO);
     Codec::AddAutoSwitchCodecType(CODEC_RESP);
     Codec::AddAutoSwitchCodecType(CODEC_PRIVATE);
+    m_pPrepareWatcher = (ev_prepare*)malloc(sizeof(ev_prepare));
+    if (m_pPrepareWatcher == NULL)
+    {
+        LOG4_ERROR("malloc ev_prepare error!");
+        return(false);
+    }
+    m_pPrepareWatcher->data = (void*)this;
+    AddEvent(m_pPrepareWatcher, PrepareCallback);
     return(true);
 }
 
 void Dispatcher::Destroy()
 {
+    m_vecFlushChannel.clear();
     m_mapSocketChannel.clear();
     m_mapNamedSocketChannel.clear();
+    m_mapHttp2Upstream.clear();
+    if (m_pPrepareWatcher != NULL)
+    {
+        if (m_loop != NULL)
+        {
+            ev_prepare_stop(m_loop, m_pPrepareWatcher);
+        }
+        free(m_pPrepareWatcher);
+        m_pPrepareWatcher = NULL;
+    }
     if (m_loop != NULL)
     {
         ev_loop_destroy(m_loop);
@@ -1243,6 +1541,16 @@ void Dispatcher::Destroy()
         free(m_pErrBuff);
         m_pErrBuff = NULL;
     }
+    if (m_pArena != nullptr)
+    {
+        delete m_pArena;        // 须先于initial block释放
+        m_pArena = nullptr;
+    }
+    if (m_pArenaBlock != NULL)
+    {
+        free(m_pArenaBlock);
+        m_pArenaBlock = NULL;
+    }
     m_pLabor = nullptr;
 }
 
@@ -1324,6 +1632,10 @@ bool Dispatcher::DiscardSocketChannel(std::shared_ptr<SocketChannel> pChannel, b
         {
             m_pLabor->GetActorBuilder()->ChannelNotice(pChannel, pChannel->m_pImpl->GetIdentify(), pChannel->m_pImpl->GetClientData());
         }
+        if (!pChannel->IsClient() && CODEC_HTTP2 == pChannel->m_pImpl->GetCodecType())
+        {
+            m_pLabor->GetActorBuilder()->OnHttp2ChannelClosed(pChannel);
+        }
         ev_io_stop (m_loop, pChannel->m_pImpl->MutableIoWatcher());
         if (nullptr != pChannel->m_pImpl->MutableTimerWatcher())
         {
@@ -1352,6 +1664,10 @@ bool Dispatcher::DiscardSocketChannel(std::shared_ptr<SocketChannel> pChannel, b
             LOG4_TRACE("erase channel %d channel_seq %u from m_mapSocketChannel.",
                     pChannel->m_pImpl->GetFd(), pChannel->m_pImpl->GetSequence());
         }
+        if (pChannel->IsClient() && CODEC_HTTP2 == pChannel->m_pImpl->GetCodecType())
+        {
+            RedispatchHttp2Pending(pChannel);
+        }
         return(true);
     }
     else
@@ -41,10 +41,13 @@ extern "C" {
 #endif
 
 #include <string>
+#include <deque>
 #include <unordered_map>
+#include <vector>
 #include <sstream>
 #include <memory>
 
+#include <google/protobuf/arena.h>
 #include "util/process_helper.h"
 #include "pb/msg.pb.h"
 #include "channel/SocketChannel.hpp"
@@ -65,6 +68,7 @@ struct tagClientConnWatcherData;
 typedef void (*signal_callback)(struct ev_loop*,ev_signal*,int);
 typedef void (*timer_callback)(struct ev_loop*,ev_timer*,int);
 typedef void (*idle_callback)(struct ev_loop*,ev_idle*,int);
+typedef void (*prepare_callback)(struct ev_loop*,ev_prepare*,int);
 
 class Dispatcher
 {
@@ -86,6 +90,20 @@ public:
         }
     };
 
+    struct tagHttp2PendingRequest
+    {
+        uint32 uiStepSeq = 0;
+        HttpMsg oHttpMsg;
+    };
+
+    struct tagHttp2Upstream
+    {
+        std::string strHost;
+        int iPort = 0;
+        bool bWithSsl = false;
+        std::deque<tagHttp2PendingRequest> dequePending;    ///< 所有连接的并发stream都已用满时排队的请求
+    };
+
     Dispatcher(Labor* pLabor, std::shared_ptr<NetLogger> pLogger);
     virtual ~Dispatcher();
     bool Init();
@@ -96,6 +114,7 @@ public:
     static void PeriodicTaskCallback(struct ev_loop* loop, ev_timer* watcher, int revents);
     static void SignalCallback(struct ev_loop* loop, struct ev_signal* watcher, int revents);
     static void ClientConnFrequencyTimeoutCallback(struct ev_loop* loop, ev_timer* watcher, int revents);
+    static void PrepareCallback(struct ev_loop* loop, ev_prepare* watcher, int revents);
 
     bool OnIoRead(std::shared_ptr<SocketChannel> pChannel);
     bool DataRecvAndHandle(std::shared_ptr<SocketChannel> pChannel);
@@ -105,6 +124,7 @@ public:
     bool OnIoError(std::shared_ptr<SocketChannel> pChannel);
     bool OnIoTimeout(std::shared_ptr<SocketChannel> pChannel);
     bool OnClientConnFrequencyTimeout(tagClientConnWatcherData* pData, ev_timer* watcher);
+    void OnFlush();
 
     template <typename ...Targs>
     void Logger(int iLogLevel, const char* szFileName, unsigned int uiFileLine, const char* szFunction, Targs&&... args);
@@ -132,6 +152,14 @@ public:
             bool bWithSsl, bool bPipeline, const std::string& strFactor, Targs&&... args);
     template <typename ...Targs>
     bool Broadcast(const std::string& strNodeType, E_CODEC_TYPE eCodecType, bool bWithSsl, bool bPipeline, Targs&&... args);
+
+    /**
+     * @brief 经http2连接复用发送请求
+     * @note 同一对端最多建立HTTP2_UPSTREAM_CONNECTION_NUM个连接，请求作为新stream在已有
+     *       连接上发出；所有连接的活跃stream数都达到对端SETTINGS_MAX_CONCURRENT_STREAMS时
+     *       请求排队，待有stream结束后依次发出。响应按stream id回调到对应的Step。
+     */
+    bool SendMultiplex(const std::string& strHost, int iPort, bool bWithSsl, const HttpMsg& oHttpMsg, uint32 uiStepSeq);
     bool AutoSend(const std::string& strIdentify, int32 iCmd, uint32 uiSeq, const MsgBody& oMsgBody, E_CODEC_TYPE eCodecType = CODEC_NEBULA);
     bool SendDataReport(int32 iCmd, uint32 uiSeq, const MsgBody& oMsgBody);
     std::shared_ptr<SocketChannel> StressSend(const std::string& strIdentify, int32 iCmd, uint32 uiSeq, const MsgBody& oMsgBody, E_CODEC_TYPE eCodecType = CODEC_NEBULA);
@@ -167,6 +195,23 @@ public:
     bool DiscardSocketChannel(std::shared_ptr<SocketChannel> pChannel, bool bChannelNotice = true);
     bool CreateListenFd(const std::string& strHost, int32 iPort, int& iFd, int& iFamily);
     std::shared_ptr<SocketChannel> GetChannel(int iFd);
+
+    /**
+     * @brief 登记待合并发送的通道
+     * @note 开启deferred_flush时由SocketChannelImpl调用，登记的通道在本轮事件循环
+     *       进入等待之前（ev_prepare）统一发送。
+     */
+    void AddFlushChannel(std::shared_ptr<SocketChannel> pChannel);
+
+    /**
+     * @brief 获取当前批次消息处理所用的Arena
+     * @note 在Arena上分配的消息在本批次消息处理完毕（IoCallback返回前）后统一释放，
+     *       定时器等其他回调中分配的消息在本轮事件循环结束时释放，不可在异步回调中持有。
+     */
+    google::protobuf::Arena* GetArena()
+    {
+        return(m_pArena);
+    }
     int SendFd(int iSocketFd, int iSendFd, int iAiFamily, int iCodecType);
 
 protected:
@@ -177,6 +222,7 @@ protected:
     bool AddEvent(ev_signal* signal_watcher, signal_callback pFunc, int iSignum);
     bool AddEvent(ev_timer* timer_watcher, timer_callback pFunc, ev_tstamp dTimeout);
     bool AddEvent(ev_idle* idle_watcher, idle_callback pFunc);
+    bool AddEvent(ev_prepare* prepare_watcher, prepare_callback pFunc);
     bool RefreshEvent(ev_timer* timer_watcher, ev_tstamp dTimeout);
     bool DelEvent(ev_io* io_watcher);
     bool DelEvent(ev_timer* timer_watcher);
@@ -188,8 +234,26 @@ protected:
     bool AcceptServerConn(int iFd);
     void CheckFailedNode();
     void EvBreak();
+    void ResetArena();
+    void SendHttp2Pending(std::shared_ptr<SocketChannel> pChannel);
+    /**
+     * @brief 处理解码过程中被对端重置的HTTP2 stream
+     * @note 本端发起的stream按RST_STREAM的错误码以ERR_STREAM_RESET（CANCEL）、ERR_STREAM_REFUSED
+     * （REFUSED_STREAM）或ERR_STREAM_ERROR回调Step::ErrBack()，对端发起的stream取消绑定的Context及其下游stream。
+     */
+    void OnHttp2StreamReset(std::shared_ptr<SocketChannel> pChannel);
+
+    /**
+     * @brief 通知待发送数据已全部发出的HTTP2 stream可继续发送
+     */
+    void OnHttp2StreamWritable(std::shared_ptr<SocketChannel> pChannel);
+    void RedispatchHttp2Pending(std::shared_ptr<SocketChannel> pChannel);
+    bool IsHttp2PendingExpired(std::shared_ptr<SocketChannel> pChannel, const tagHttp2PendingRequest& stRequest);
 
 private:
+    static const uint32 HTTP2_UPSTREAM_CONNECTION_NUM = 4;      ///< 每个对端的http2连接数上限
+    static const uint32 HTTP2_UPSTREAM_PENDING_MAX = 10000;     ///< 每个对端排队请求数上限
+
     char* m_pErrBuff;
     Labor* m_pLabor;
     struct ev_loop* m_loop;
@@ -198,6 +262,11 @@ private:
     std::shared_ptr<NetLogger> m_pLogger;
     std::unique_ptr<Nodes> m_pSessionNode;
     std::shared_ptr<SocketChannel> m_pLastActivityChannel;  // 最近一个发送或接收过数据的channel
+    char* m_pArenaBlock;                        ///< Arena的初始内存块，Reset()后复用，稳态下收包处理无需malloc
+    google::protobuf::Arena* m_pArena;          ///< 每批次消息（一次IoCallback）处理的Arena
+    ev_prepare* m_pPrepareWatcher;              ///< 每轮事件循环阻塞前的watcher：合并发送、重置Arena
+
+    std::vector<std::shared_ptr<SocketChannel> > m_vecFlushChannel;     ///< 待合并发送的通道
 
     // Channel
     std::unordered_map<int32, std::shared_ptr<SocketChannel> > m_mapSocketChannel;
@@ -206,6 +275,7 @@ private:
     std::unordered_map<std::string, std::unordered_set<std::shared_ptr<SocketChannel> > > m_mapNamedSocketChannel;      ///< key为Identify，连接存在时，if(http连接)set.size()>=1;else set.size()==1;
     std::unordered_map<int32, std::shared_ptr<SocketChannel> > m_mapLoaderAndWorkerChannel;     ///< Loader和Worker之间通信通道
     std::unordered_map<int32, std::shared_ptr<SocketChannel> >::iterator m_iterLoaderAndWorkerChannel;
+    std::unordered_map<std::string, tagHttp2Upstream> m_mapHttp2Upstream;      ///< key为http2连接的Identify（h2://host:port或h2c://host:port）
 
     std::unordered_map<std::string, uint32> m_mapClientConnFrequency;   ///< 客户端连接频率
 
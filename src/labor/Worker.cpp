@@ -125,6 +125,7 @@ bool Worker::Init(CJsonObject& oJsonConf)
         ngx_setproctitle(szProcessName);
     }
     oJsonConf.Get("io_timeout", m_stNodeInfo.dIoTimeout);
+    oJsonConf.Get("deferred_flush", m_stNodeInfo.bDeferredFlush);
     if (!oJsonConf.Get("step_timeout", m_stNodeInfo.dStepTimeout))
     {
         m_stNodeInfo.dStepTimeout = 0.5;
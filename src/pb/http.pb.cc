@@ -1,494 +1,499 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: http.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "http.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
-
-namespace {
-
-const ::google::protobuf::Descriptor* HttpMsg_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  HttpMsg_reflection_ = NULL;
-const ::google::protobuf::Descriptor* HttpMsg_Header_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  HttpMsg_Header_reflection_ = NULL;
-const ::google::protobuf::Descriptor* HttpMsg_Upgrade_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  HttpMsg_Upgrade_reflection_ = NULL;
-const ::google::protobuf::Descriptor* HttpMsg_HeadersEntry_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* HttpMsg_ParamsEntry_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* HttpMsg_SettingsEntry_descriptor_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_http_2eproto() GOOGLE_ATTRIBUTE_COLD;
-void protobuf_AssignDesc_http_2eproto() {
-  protobuf_AddDesc_http_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "http.proto");
-  GOOGLE_CHECK(file != NULL);
-  HttpMsg_descriptor_ = file->message_type(0);
-  static const int HttpMsg_offsets_[30] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, http_major_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, http_minor_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, content_length_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, method_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, status_code_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, encoding_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, url_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, headers_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, body_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, params_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, upgrade_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, keep_alive_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, path_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, is_decoding_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, chunk_notice_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, stream_id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, pseudo_header_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, trailer_header_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, hpack_data_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, adding_without_index_headers_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, deleting_without_index_headers_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, adding_never_index_headers_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, deleting_never_index_headers_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, dynamic_table_update_size_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, with_huffman_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, headers_frame_padding_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, data_frame_padding_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, push_promise_frame_padding_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, settings_),
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+PROTOBUF_CONSTEXPR HttpMsg_Header::HttpMsg_Header(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HttpMsg_HeaderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HttpMsg_HeaderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HttpMsg_HeaderDefaultTypeInternal() {}
+  union {
+    HttpMsg_Header _instance;
   };
-  HttpMsg_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      HttpMsg_descriptor_,
-      HttpMsg::default_instance_,
-      HttpMsg_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(HttpMsg),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg, _is_default_instance_));
-  HttpMsg_Header_descriptor_ = HttpMsg_descriptor_->nested_type(0);
-  static const int HttpMsg_Header_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg_Header, name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg_Header, value_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HttpMsg_HeaderDefaultTypeInternal _HttpMsg_Header_default_instance_;
+PROTOBUF_CONSTEXPR HttpMsg_Upgrade::HttpMsg_Upgrade(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.protocol_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.is_upgrade_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HttpMsg_UpgradeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HttpMsg_UpgradeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HttpMsg_UpgradeDefaultTypeInternal() {}
+  union {
+    HttpMsg_Upgrade _instance;
   };
-  HttpMsg_Header_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      HttpMsg_Header_descriptor_,
-      HttpMsg_Header::default_instance_,
-      HttpMsg_Header_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(HttpMsg_Header),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg_Header, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg_Header, _is_default_instance_));
-  HttpMsg_Upgrade_descriptor_ = HttpMsg_descriptor_->nested_type(1);
-  static const int HttpMsg_Upgrade_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg_Upgrade, is_upgrade_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg_Upgrade, protocol_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HttpMsg_UpgradeDefaultTypeInternal _HttpMsg_Upgrade_default_instance_;
+PROTOBUF_CONSTEXPR HttpMsg_HeadersEntry_DoNotUse::HttpMsg_HeadersEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct HttpMsg_HeadersEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HttpMsg_HeadersEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HttpMsg_HeadersEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    HttpMsg_HeadersEntry_DoNotUse _instance;
   };
-  HttpMsg_Upgrade_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      HttpMsg_Upgrade_descriptor_,
-      HttpMsg_Upgrade::default_instance_,
-      HttpMsg_Upgrade_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(HttpMsg_Upgrade),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg_Upgrade, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HttpMsg_Upgrade, _is_default_instance_));
-  HttpMsg_HeadersEntry_descriptor_ = HttpMsg_descriptor_->nested_type(2);
-  HttpMsg_ParamsEntry_descriptor_ = HttpMsg_descriptor_->nested_type(3);
-  HttpMsg_SettingsEntry_descriptor_ = HttpMsg_descriptor_->nested_type(4);
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_http_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      HttpMsg_descriptor_, &HttpMsg::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      HttpMsg_Header_descriptor_, &HttpMsg_Header::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      HttpMsg_Upgrade_descriptor_, &HttpMsg_Upgrade::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-        HttpMsg_HeadersEntry_descriptor_,
-        ::google::protobuf::internal::MapEntry<
-            ::std::string,
-            ::std::string,
-            ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-            ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-            0>::CreateDefaultInstance(
-                HttpMsg_HeadersEntry_descriptor_));
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-        HttpMsg_ParamsEntry_descriptor_,
-        ::google::protobuf::internal::MapEntry<
-            ::std::string,
-            ::std::string,
-            ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-            ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-            0>::CreateDefaultInstance(
-                HttpMsg_ParamsEntry_descriptor_));
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-        HttpMsg_SettingsEntry_descriptor_,
-        ::google::protobuf::internal::MapEntry<
-            ::google::protobuf::uint32,
-            ::google::protobuf::uint32,
-            ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
-            ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
-            0>::CreateDefaultInstance(
-                HttpMsg_SettingsEntry_descriptor_));
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_http_2eproto() {
-  delete HttpMsg::default_instance_;
-  delete HttpMsg_reflection_;
-  delete HttpMsg_Header::default_instance_;
-  delete HttpMsg_Header_reflection_;
-  delete HttpMsg_Upgrade::default_instance_;
-  delete HttpMsg_Upgrade_reflection_;
-}
-
-void protobuf_AddDesc_http_2eproto() GOOGLE_ATTRIBUTE_COLD;
-void protobuf_AddDesc_http_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\nhttp.proto\"\241\010\n\007HttpMsg\022\014\n\004type\030\001 \001(\005\022\022"
-    "\n\nhttp_major\030\002 \001(\005\022\022\n\nhttp_minor\030\003 \001(\005\022\026"
-    "\n\016content_length\030\004 \001(\005\022\016\n\006method\030\005 \001(\005\022\023"
-    "\n\013status_code\030\006 \001(\005\022\020\n\010encoding\030\007 \001(\005\022\013\n"
-    "\003url\030\010 \001(\t\022&\n\007headers\030\t \003(\0132\025.HttpMsg.He"
-    "adersEntry\022\014\n\004body\030\n \001(\014\022$\n\006params\030\013 \003(\013"
-    "2\024.HttpMsg.ParamsEntry\022!\n\007upgrade\030\014 \001(\0132"
-    "\020.HttpMsg.Upgrade\022\022\n\nkeep_alive\030\r \001(\002\022\014\n"
-    "\004path\030\016 \001(\t\022\023\n\013is_decoding\030\017 \001(\010\022\024\n\014chun"
-    "k_notice\030\023 \001(\010\022\021\n\tstream_id\030\024 \001(\r\022&\n\rpse"
-    "udo_header\030\025 \003(\0132\017.HttpMsg.Header\022\'\n\016tra"
-    "iler_header\030\026 \003(\0132\017.HttpMsg.Header\022\022\n\nhp"
-    "ack_data\030\027 \001(\t\022$\n\034adding_without_index_h"
-    "eaders\030\030 \003(\t\022&\n\036deleting_without_index_h"
-    "eaders\030\031 \003(\t\022\"\n\032adding_never_index_heade"
-    "rs\030\032 \003(\t\022$\n\034deleting_never_index_headers"
-    "\030\033 \003(\t\022!\n\031dynamic_table_update_size\030\034 \001("
-    "\r\022\024\n\014with_huffman\030\035 \001(\010\022\035\n\025headers_frame"
-    "_padding\030\036 \001(\t\022\032\n\022data_frame_padding\030\037 \001"
-    "(\t\022\"\n\032push_promise_frame_padding\030  \001(\t\022("
-    "\n\010settings\030! \003(\0132\026.HttpMsg.SettingsEntry"
-    "\032%\n\006Header\022\014\n\004name\030\001 \001(\t\022\r\n\005value\030\002 \001(\t\032"
-    "/\n\007Upgrade\022\022\n\nis_upgrade\030\001 \001(\010\022\020\n\010protoc"
-    "ol\030\002 \001(\t\032.\n\014HeadersEntry\022\013\n\003key\030\001 \001(\t\022\r\n"
-    "\005value\030\002 \001(\t:\0028\001\032-\n\013ParamsEntry\022\013\n\003key\030\001"
-    " \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\032/\n\rSettingsEntry"
-    "\022\013\n\003key\030\001 \001(\r\022\r\n\005value\030\002 \001(\r:\0028\001b\006proto3", 1080);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "http.proto", &protobuf_RegisterTypes);
-  HttpMsg::default_instance_ = new HttpMsg();
-  HttpMsg_Header::default_instance_ = new HttpMsg_Header();
-  HttpMsg_Upgrade::default_instance_ = new HttpMsg_Upgrade();
-  HttpMsg::default_instance_->InitAsDefaultInstance();
-  HttpMsg_Header::default_instance_->InitAsDefaultInstance();
-  HttpMsg_Upgrade::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_http_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_http_2eproto {
-  StaticDescriptorInitializer_http_2eproto() {
-    protobuf_AddDesc_http_2eproto();
-  }
-} static_descriptor_initializer_http_2eproto_;
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HttpMsg_HeadersEntry_DoNotUseDefaultTypeInternal _HttpMsg_HeadersEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR HttpMsg_ParamsEntry_DoNotUse::HttpMsg_ParamsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct HttpMsg_ParamsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HttpMsg_ParamsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HttpMsg_ParamsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    HttpMsg_ParamsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HttpMsg_ParamsEntry_DoNotUseDefaultTypeInternal _HttpMsg_ParamsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR HttpMsg_SettingsEntry_DoNotUse::HttpMsg_SettingsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct HttpMsg_SettingsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HttpMsg_SettingsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HttpMsg_SettingsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    HttpMsg_SettingsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HttpMsg_SettingsEntry_DoNotUseDefaultTypeInternal _HttpMsg_SettingsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR HttpMsg::HttpMsg(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.headers_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.params_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.pseudo_header_)*/{}
+  , /*decltype(_impl_.trailer_header_)*/{}
+  , /*decltype(_impl_.adding_without_index_headers_)*/{}
+  , /*decltype(_impl_.deleting_without_index_headers_)*/{}
+  , /*decltype(_impl_.adding_never_index_headers_)*/{}
+  , /*decltype(_impl_.deleting_never_index_headers_)*/{}
+  , /*decltype(_impl_.settings_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.url_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.body_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.hpack_data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.headers_frame_padding_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.data_frame_padding_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.push_promise_frame_padding_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.upgrade_)*/nullptr
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.http_major_)*/0
+  , /*decltype(_impl_.http_minor_)*/0
+  , /*decltype(_impl_.content_length_)*/0
+  , /*decltype(_impl_.method_)*/0
+  , /*decltype(_impl_.status_code_)*/0
+  , /*decltype(_impl_.encoding_)*/0
+  , /*decltype(_impl_.keep_alive_)*/0
+  , /*decltype(_impl_.stream_id_)*/0u
+  , /*decltype(_impl_.is_decoding_)*/false
+  , /*decltype(_impl_.chunk_notice_)*/false
+  , /*decltype(_impl_.with_huffman_)*/false
+  , /*decltype(_impl_.dynamic_table_update_size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HttpMsgDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HttpMsgDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HttpMsgDefaultTypeInternal() {}
+  union {
+    HttpMsg _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HttpMsgDefaultTypeInternal _HttpMsg_default_instance_;
+static ::_pb::Metadata file_level_metadata_http_2eproto[6];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_http_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_http_2eproto = nullptr;
+
+const uint32_t TableStruct_http_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::HttpMsg_Header, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HttpMsg_Header, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg_Header, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::HttpMsg_Upgrade, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HttpMsg_Upgrade, _impl_.is_upgrade_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg_Upgrade, _impl_.protocol_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg_HeadersEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg_HeadersEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HttpMsg_HeadersEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg_HeadersEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::HttpMsg_ParamsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg_ParamsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HttpMsg_ParamsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg_ParamsEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::HttpMsg_SettingsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg_SettingsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HttpMsg_SettingsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg_SettingsEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.http_major_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.http_minor_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.content_length_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.method_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.status_code_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.encoding_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.url_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.headers_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.body_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.params_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.upgrade_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.keep_alive_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.path_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.is_decoding_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.chunk_notice_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.stream_id_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.pseudo_header_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.trailer_header_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.hpack_data_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.adding_without_index_headers_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.deleting_without_index_headers_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.adding_never_index_headers_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.deleting_never_index_headers_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.dynamic_table_update_size_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.with_huffman_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.headers_frame_padding_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.data_frame_padding_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.push_promise_frame_padding_),
+  PROTOBUF_FIELD_OFFSET(::HttpMsg, _impl_.settings_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::HttpMsg_Header)},
+  { 8, -1, -1, sizeof(::HttpMsg_Upgrade)},
+  { 16, 24, -1, sizeof(::HttpMsg_HeadersEntry_DoNotUse)},
+  { 26, 34, -1, sizeof(::HttpMsg_ParamsEntry_DoNotUse)},
+  { 36, 44, -1, sizeof(::HttpMsg_SettingsEntry_DoNotUse)},
+  { 46, -1, -1, sizeof(::HttpMsg)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::_HttpMsg_Header_default_instance_._instance,
+  &::_HttpMsg_Upgrade_default_instance_._instance,
+  &::_HttpMsg_HeadersEntry_DoNotUse_default_instance_._instance,
+  &::_HttpMsg_ParamsEntry_DoNotUse_default_instance_._instance,
+  &::_HttpMsg_SettingsEntry_DoNotUse_default_instance_._instance,
+  &::_HttpMsg_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_http_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\nhttp.proto\"\241\010\n\007HttpMsg\022\014\n\004type\030\001 \001(\005\022\022"
+  "\n\nhttp_major\030\002 \001(\005\022\022\n\nhttp_minor\030\003 \001(\005\022\026"
+  "\n\016content_length\030\004 \001(\005\022\016\n\006method\030\005 \001(\005\022\023"
+  "\n\013status_code\030\006 \001(\005\022\020\n\010encoding\030\007 \001(\005\022\013\n"
+  "\003url\030\010 \001(\t\022&\n\007headers\030\t \003(\0132\025.HttpMsg.He"
+  "adersEntry\022\014\n\004body\030\n \001(\014\022$\n\006params\030\013 \003(\013"
+  "2\024.HttpMsg.ParamsEntry\022!\n\007upgrade\030\014 \001(\0132"
+  "\020.HttpMsg.Upgrade\022\022\n\nkeep_alive\030\r \001(\002\022\014\n"
+  "\004path\030\016 \001(\t\022\023\n\013is_decoding\030\017 \001(\010\022\024\n\014chun"
+  "k_notice\030\023 \001(\010\022\021\n\tstream_id\030\024 \001(\r\022&\n\rpse"
+  "udo_header\030\025 \003(\0132\017.HttpMsg.Header\022\'\n\016tra"
+  "iler_header\030\026 \003(\0132\017.HttpMsg.Header\022\022\n\nhp"
+  "ack_data\030\027 \001(\t\022$\n\034adding_without_index_h"
+  "eaders\030\030 \003(\t\022&\n\036deleting_without_index_h"
+  "eaders\030\031 \003(\t\022\"\n\032adding_never_index_heade"
+  "rs\030\032 \003(\t\022$\n\034deleting_never_index_headers"
+  "\030\033 \003(\t\022!\n\031dynamic_table_update_size\030\034 \001("
+  "\r\022\024\n\014with_huffman\030\035 \001(\010\022\035\n\025headers_frame"
+  "_padding\030\036 \001(\t\022\032\n\022data_frame_padding\030\037 \001"
+  "(\t\022\"\n\032push_promise_frame_padding\030  \001(\t\022("
+  "\n\010settings\030! \003(\0132\026.HttpMsg.SettingsEntry"
+  "\032%\n\006Header\022\014\n\004name\030\001 \001(\t\022\r\n\005value\030\002 \001(\t\032"
+  "/\n\007Upgrade\022\022\n\nis_upgrade\030\001 \001(\010\022\020\n\010protoc"
+  "ol\030\002 \001(\t\032.\n\014HeadersEntry\022\013\n\003key\030\001 \001(\t\022\r\n"
+  "\005value\030\002 \001(\t:\0028\001\032-\n\013ParamsEntry\022\013\n\003key\030\001"
+  " \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\032/\n\rSettingsEntry"
+  "\022\013\n\003key\030\001 \001(\r\022\r\n\005value\030\002 \001(\r:\0028\001B\003\370\001\001b\006p"
+  "roto3"
+  ;
+static ::_pbi::once_flag descriptor_table_http_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_http_2eproto = {
+    false, false, 1085, descriptor_table_protodef_http_2eproto,
+    "http.proto",
+    &descriptor_table_http_2eproto_once, nullptr, 0, 6,
+    schemas, file_default_instances, TableStruct_http_2eproto::offsets,
+    file_level_metadata_http_2eproto, file_level_enum_descriptors_http_2eproto,
+    file_level_service_descriptors_http_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_http_2eproto_getter() {
+  return &descriptor_table_http_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_http_2eproto(&descriptor_table_http_2eproto);
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int HttpMsg_Header::kNameFieldNumber;
-const int HttpMsg_Header::kValueFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-HttpMsg_Header::HttpMsg_Header()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:HttpMsg.Header)
-}
+class HttpMsg_Header::_Internal {
+ public:
+};
 
-void HttpMsg_Header::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
+HttpMsg_Header::HttpMsg_Header(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HttpMsg.Header)
 }
-
 HttpMsg_Header::HttpMsg_Header(const HttpMsg_Header& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HttpMsg_Header* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
   // @@protoc_insertion_point(copy_constructor:HttpMsg.Header)
 }
 
-void HttpMsg_Header::SharedCtor() {
-    _is_default_instance_ = false;
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void HttpMsg_Header::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 HttpMsg_Header::~HttpMsg_Header() {
   // @@protoc_insertion_point(destructor:HttpMsg.Header)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void HttpMsg_Header::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  value_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != default_instance_) {
-  }
+inline void HttpMsg_Header::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.value_.Destroy();
 }
 
 void HttpMsg_Header::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* HttpMsg_Header::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return HttpMsg_Header_descriptor_;
-}
-
-const HttpMsg_Header& HttpMsg_Header::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_http_2eproto();
-  return *default_instance_;
-}
-
-HttpMsg_Header* HttpMsg_Header::default_instance_ = NULL;
-
-HttpMsg_Header* HttpMsg_Header::New(::google::protobuf::Arena* arena) const {
-  HttpMsg_Header* n = new HttpMsg_Header;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void HttpMsg_Header::Clear() {
 // @@protoc_insertion_point(message_clear_start:HttpMsg.Header)
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-
-bool HttpMsg_Header::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:HttpMsg.Header)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional string name = 1;
-      case 1: {
-        if (tag == 10) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "HttpMsg.Header.name"));
-        } else {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HttpMsg_Header::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "HttpMsg.Header.name"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_value;
-        break;
-      }
-
-      // optional string value = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_value:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_value()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->value().data(), this->value().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "HttpMsg.Header.value"));
-        } else {
+        continue;
+      // string value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "HttpMsg.Header.value"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:HttpMsg.Header)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:HttpMsg.Header)
-  return false;
-#undef DO_
-}
-
-void HttpMsg_Header::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:HttpMsg.Header)
-  // optional string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "HttpMsg.Header.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->name(), output);
-  }
-
-  // optional string value = 2;
-  if (this->value().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->value().data(), this->value().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "HttpMsg.Header.value");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->value(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:HttpMsg.Header)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* HttpMsg_Header::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
+uint8_t* HttpMsg_Header::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:HttpMsg.Header)
-  // optional string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "HttpMsg.Header.name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
-  // optional string value = 2;
-  if (this->value().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->value().data(), this->value().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  // string value = 2;
+  if (!this->_internal_value().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "HttpMsg.Header.value");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->value(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_value(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:HttpMsg.Header)
   return target;
 }
 
-int HttpMsg_Header::ByteSize() const {
+size_t HttpMsg_Header::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:HttpMsg.Header)
-  int total_size = 0;
+  size_t total_size = 0;
 
-  // optional string name = 1;
-  if (this->name().size() > 0) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
-  // optional string value = 2;
-  if (this->value().size() > 0) {
+  // string value = 2;
+  if (!this->_internal_value().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->value());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void HttpMsg_Header::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:HttpMsg.Header)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const HttpMsg_Header* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const HttpMsg_Header>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:HttpMsg.Header)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:HttpMsg.Header)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HttpMsg_Header::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HttpMsg_Header::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HttpMsg_Header::GetClassData() const { return &_class_data_; }
 
-void HttpMsg_Header::MergeFrom(const HttpMsg_Header& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:HttpMsg.Header)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  if (from.name().size() > 0) {
 
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  if (from.value().size() > 0) {
+void HttpMsg_Header::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HttpMsg_Header*>(&to_msg);
+  auto& from = static_cast<const HttpMsg_Header&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:HttpMsg.Header)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    value_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.value_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-}
-
-void HttpMsg_Header::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:HttpMsg.Header)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void HttpMsg_Header::CopyFrom(const HttpMsg_Header& from) {
@@ -499,269 +504,229 @@ void HttpMsg_Header::CopyFrom(const HttpMsg_Header& from) {
 }
 
 bool HttpMsg_Header::IsInitialized() const {
-
   return true;
 }
 
-void HttpMsg_Header::Swap(HttpMsg_Header* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void HttpMsg_Header::InternalSwap(HttpMsg_Header* other) {
-  name_.Swap(&other->name_);
-  value_.Swap(&other->value_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata HttpMsg_Header::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = HttpMsg_Header_descriptor_;
-  metadata.reflection = HttpMsg_Header_reflection_;
-  return metadata;
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HttpMsg_Header::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_http_2eproto_getter, &descriptor_table_http_2eproto_once,
+      file_level_metadata_http_2eproto[0]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int HttpMsg_Upgrade::kIsUpgradeFieldNumber;
-const int HttpMsg_Upgrade::kProtocolFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-HttpMsg_Upgrade::HttpMsg_Upgrade()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:HttpMsg.Upgrade)
-}
+class HttpMsg_Upgrade::_Internal {
+ public:
+};
 
-void HttpMsg_Upgrade::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
+HttpMsg_Upgrade::HttpMsg_Upgrade(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HttpMsg.Upgrade)
 }
-
 HttpMsg_Upgrade::HttpMsg_Upgrade(const HttpMsg_Upgrade& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HttpMsg_Upgrade* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.protocol_){}
+    , decltype(_impl_.is_upgrade_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.protocol_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.protocol_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_protocol().empty()) {
+    _this->_impl_.protocol_.Set(from._internal_protocol(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.is_upgrade_ = from._impl_.is_upgrade_;
   // @@protoc_insertion_point(copy_constructor:HttpMsg.Upgrade)
 }
 
-void HttpMsg_Upgrade::SharedCtor() {
-    _is_default_instance_ = false;
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  is_upgrade_ = false;
-  protocol_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void HttpMsg_Upgrade::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.protocol_){}
+    , decltype(_impl_.is_upgrade_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.protocol_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.protocol_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 HttpMsg_Upgrade::~HttpMsg_Upgrade() {
   // @@protoc_insertion_point(destructor:HttpMsg.Upgrade)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void HttpMsg_Upgrade::SharedDtor() {
-  protocol_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != default_instance_) {
-  }
+inline void HttpMsg_Upgrade::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.protocol_.Destroy();
 }
 
 void HttpMsg_Upgrade::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* HttpMsg_Upgrade::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return HttpMsg_Upgrade_descriptor_;
-}
-
-const HttpMsg_Upgrade& HttpMsg_Upgrade::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_http_2eproto();
-  return *default_instance_;
-}
-
-HttpMsg_Upgrade* HttpMsg_Upgrade::default_instance_ = NULL;
-
-HttpMsg_Upgrade* HttpMsg_Upgrade::New(::google::protobuf::Arena* arena) const {
-  HttpMsg_Upgrade* n = new HttpMsg_Upgrade;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void HttpMsg_Upgrade::Clear() {
 // @@protoc_insertion_point(message_clear_start:HttpMsg.Upgrade)
-  is_upgrade_ = false;
-  protocol_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-
-bool HttpMsg_Upgrade::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:HttpMsg.Upgrade)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional bool is_upgrade = 1;
-      case 1: {
-        if (tag == 8) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &is_upgrade_)));
-
-        } else {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.protocol_.ClearToEmpty();
+  _impl_.is_upgrade_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HttpMsg_Upgrade::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool is_upgrade = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.is_upgrade_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_protocol;
-        break;
-      }
-
-      // optional string protocol = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_protocol:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_protocol()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->protocol().data(), this->protocol().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "HttpMsg.Upgrade.protocol"));
-        } else {
+        continue;
+      // string protocol = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_protocol();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "HttpMsg.Upgrade.protocol"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:HttpMsg.Upgrade)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:HttpMsg.Upgrade)
-  return false;
-#undef DO_
-}
-
-void HttpMsg_Upgrade::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:HttpMsg.Upgrade)
-  // optional bool is_upgrade = 1;
-  if (this->is_upgrade() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->is_upgrade(), output);
-  }
-
-  // optional string protocol = 2;
-  if (this->protocol().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->protocol().data(), this->protocol().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "HttpMsg.Upgrade.protocol");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->protocol(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:HttpMsg.Upgrade)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* HttpMsg_Upgrade::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
+uint8_t* HttpMsg_Upgrade::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:HttpMsg.Upgrade)
-  // optional bool is_upgrade = 1;
-  if (this->is_upgrade() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->is_upgrade(), target);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool is_upgrade = 1;
+  if (this->_internal_is_upgrade() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_is_upgrade(), target);
   }
 
-  // optional string protocol = 2;
-  if (this->protocol().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->protocol().data(), this->protocol().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  // string protocol = 2;
+  if (!this->_internal_protocol().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_protocol().data(), static_cast<int>(this->_internal_protocol().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "HttpMsg.Upgrade.protocol");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->protocol(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_protocol(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:HttpMsg.Upgrade)
   return target;
 }
 
-int HttpMsg_Upgrade::ByteSize() const {
+size_t HttpMsg_Upgrade::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:HttpMsg.Upgrade)
-  int total_size = 0;
+  size_t total_size = 0;
 
-  // optional bool is_upgrade = 1;
-  if (this->is_upgrade() != 0) {
-    total_size += 1 + 1;
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // optional string protocol = 2;
-  if (this->protocol().size() > 0) {
+  // string protocol = 2;
+  if (!this->_internal_protocol().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->protocol());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_protocol());
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void HttpMsg_Upgrade::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:HttpMsg.Upgrade)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const HttpMsg_Upgrade* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const HttpMsg_Upgrade>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:HttpMsg.Upgrade)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:HttpMsg.Upgrade)
-    MergeFrom(*source);
+  // bool is_upgrade = 1;
+  if (this->_internal_is_upgrade() != 0) {
+    total_size += 1 + 1;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void HttpMsg_Upgrade::MergeFrom(const HttpMsg_Upgrade& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:HttpMsg.Upgrade)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  if (from.is_upgrade() != 0) {
-    set_is_upgrade(from.is_upgrade());
-  }
-  if (from.protocol().size() > 0) {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HttpMsg_Upgrade::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HttpMsg_Upgrade::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HttpMsg_Upgrade::GetClassData() const { return &_class_data_; }
 
-    protocol_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.protocol_);
-  }
-}
 
-void HttpMsg_Upgrade::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:HttpMsg.Upgrade)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void HttpMsg_Upgrade::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HttpMsg_Upgrade*>(&to_msg);
+  auto& from = static_cast<const HttpMsg_Upgrade&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:HttpMsg.Upgrade)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_protocol().empty()) {
+    _this->_internal_set_protocol(from._internal_protocol());
+  }
+  if (from._internal_is_upgrade() != 0) {
+    _this->_internal_set_is_upgrade(from._internal_is_upgrade());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void HttpMsg_Upgrade::CopyFrom(const HttpMsg_Upgrade& from) {
@@ -772,1805 +737,1280 @@ void HttpMsg_Upgrade::CopyFrom(const HttpMsg_Upgrade& from) {
 }
 
 bool HttpMsg_Upgrade::IsInitialized() const {
-
   return true;
 }
 
-void HttpMsg_Upgrade::Swap(HttpMsg_Upgrade* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void HttpMsg_Upgrade::InternalSwap(HttpMsg_Upgrade* other) {
-  std::swap(is_upgrade_, other->is_upgrade_);
-  protocol_.Swap(&other->protocol_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.protocol_, lhs_arena,
+      &other->_impl_.protocol_, rhs_arena
+  );
+  swap(_impl_.is_upgrade_, other->_impl_.is_upgrade_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HttpMsg_Upgrade::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_http_2eproto_getter, &descriptor_table_http_2eproto_once,
+      file_level_metadata_http_2eproto[1]);
 }
 
-::google::protobuf::Metadata HttpMsg_Upgrade::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = HttpMsg_Upgrade_descriptor_;
-  metadata.reflection = HttpMsg_Upgrade_reflection_;
-  return metadata;
+// ===================================================================
+
+HttpMsg_HeadersEntry_DoNotUse::HttpMsg_HeadersEntry_DoNotUse() {}
+HttpMsg_HeadersEntry_DoNotUse::HttpMsg_HeadersEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void HttpMsg_HeadersEntry_DoNotUse::MergeFrom(const HttpMsg_HeadersEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata HttpMsg_HeadersEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_http_2eproto_getter, &descriptor_table_http_2eproto_once,
+      file_level_metadata_http_2eproto[2]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int HttpMsg::kTypeFieldNumber;
-const int HttpMsg::kHttpMajorFieldNumber;
-const int HttpMsg::kHttpMinorFieldNumber;
-const int HttpMsg::kContentLengthFieldNumber;
-const int HttpMsg::kMethodFieldNumber;
-const int HttpMsg::kStatusCodeFieldNumber;
-const int HttpMsg::kEncodingFieldNumber;
-const int HttpMsg::kUrlFieldNumber;
-const int HttpMsg::kHeadersFieldNumber;
-const int HttpMsg::kBodyFieldNumber;
-const int HttpMsg::kParamsFieldNumber;
-const int HttpMsg::kUpgradeFieldNumber;
-const int HttpMsg::kKeepAliveFieldNumber;
-const int HttpMsg::kPathFieldNumber;
-const int HttpMsg::kIsDecodingFieldNumber;
-const int HttpMsg::kChunkNoticeFieldNumber;
-const int HttpMsg::kStreamIdFieldNumber;
-const int HttpMsg::kPseudoHeaderFieldNumber;
-const int HttpMsg::kTrailerHeaderFieldNumber;
-const int HttpMsg::kHpackDataFieldNumber;
-const int HttpMsg::kAddingWithoutIndexHeadersFieldNumber;
-const int HttpMsg::kDeletingWithoutIndexHeadersFieldNumber;
-const int HttpMsg::kAddingNeverIndexHeadersFieldNumber;
-const int HttpMsg::kDeletingNeverIndexHeadersFieldNumber;
-const int HttpMsg::kDynamicTableUpdateSizeFieldNumber;
-const int HttpMsg::kWithHuffmanFieldNumber;
-const int HttpMsg::kHeadersFramePaddingFieldNumber;
-const int HttpMsg::kDataFramePaddingFieldNumber;
-const int HttpMsg::kPushPromiseFramePaddingFieldNumber;
-const int HttpMsg::kSettingsFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-HttpMsg::HttpMsg()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:HttpMsg)
+HttpMsg_ParamsEntry_DoNotUse::HttpMsg_ParamsEntry_DoNotUse() {}
+HttpMsg_ParamsEntry_DoNotUse::HttpMsg_ParamsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void HttpMsg_ParamsEntry_DoNotUse::MergeFrom(const HttpMsg_ParamsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata HttpMsg_ParamsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_http_2eproto_getter, &descriptor_table_http_2eproto_once,
+      file_level_metadata_http_2eproto[3]);
 }
 
-void HttpMsg::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
-  upgrade_ = const_cast< ::HttpMsg_Upgrade*>(&::HttpMsg_Upgrade::default_instance());
+// ===================================================================
+
+HttpMsg_SettingsEntry_DoNotUse::HttpMsg_SettingsEntry_DoNotUse() {}
+HttpMsg_SettingsEntry_DoNotUse::HttpMsg_SettingsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void HttpMsg_SettingsEntry_DoNotUse::MergeFrom(const HttpMsg_SettingsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
 }
+::PROTOBUF_NAMESPACE_ID::Metadata HttpMsg_SettingsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_http_2eproto_getter, &descriptor_table_http_2eproto_once,
+      file_level_metadata_http_2eproto[4]);
+}
+
+// ===================================================================
+
+class HttpMsg::_Internal {
+ public:
+  static const ::HttpMsg_Upgrade& upgrade(const HttpMsg* msg);
+};
 
+const ::HttpMsg_Upgrade&
+HttpMsg::_Internal::upgrade(const HttpMsg* msg) {
+  return *msg->_impl_.upgrade_;
+}
+HttpMsg::HttpMsg(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &HttpMsg::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:HttpMsg)
+}
 HttpMsg::HttpMsg(const HttpMsg& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HttpMsg* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.headers_)*/{}
+    , /*decltype(_impl_.params_)*/{}
+    , decltype(_impl_.pseudo_header_){from._impl_.pseudo_header_}
+    , decltype(_impl_.trailer_header_){from._impl_.trailer_header_}
+    , decltype(_impl_.adding_without_index_headers_){from._impl_.adding_without_index_headers_}
+    , decltype(_impl_.deleting_without_index_headers_){from._impl_.deleting_without_index_headers_}
+    , decltype(_impl_.adding_never_index_headers_){from._impl_.adding_never_index_headers_}
+    , decltype(_impl_.deleting_never_index_headers_){from._impl_.deleting_never_index_headers_}
+    , /*decltype(_impl_.settings_)*/{}
+    , decltype(_impl_.url_){}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.path_){}
+    , decltype(_impl_.hpack_data_){}
+    , decltype(_impl_.headers_frame_padding_){}
+    , decltype(_impl_.data_frame_padding_){}
+    , decltype(_impl_.push_promise_frame_padding_){}
+    , decltype(_impl_.upgrade_){nullptr}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.http_major_){}
+    , decltype(_impl_.http_minor_){}
+    , decltype(_impl_.content_length_){}
+    , decltype(_impl_.method_){}
+    , decltype(_impl_.status_code_){}
+    , decltype(_impl_.encoding_){}
+    , decltype(_impl_.keep_alive_){}
+    , decltype(_impl_.stream_id_){}
+    , decltype(_impl_.is_decoding_){}
+    , decltype(_impl_.chunk_notice_){}
+    , decltype(_impl_.with_huffman_){}
+    , decltype(_impl_.dynamic_table_update_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.headers_.MergeFrom(from._impl_.headers_);
+  _this->_impl_.params_.MergeFrom(from._impl_.params_);
+  _this->_impl_.settings_.MergeFrom(from._impl_.settings_);
+  _impl_.url_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.url_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_url().empty()) {
+    _this->_impl_.url_.Set(from._internal_url(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_body().empty()) {
+    _this->_impl_.body_.Set(from._internal_body(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_path().empty()) {
+    _this->_impl_.path_.Set(from._internal_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.hpack_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hpack_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_hpack_data().empty()) {
+    _this->_impl_.hpack_data_.Set(from._internal_hpack_data(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.headers_frame_padding_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.headers_frame_padding_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_headers_frame_padding().empty()) {
+    _this->_impl_.headers_frame_padding_.Set(from._internal_headers_frame_padding(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.data_frame_padding_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_frame_padding_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data_frame_padding().empty()) {
+    _this->_impl_.data_frame_padding_.Set(from._internal_data_frame_padding(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.push_promise_frame_padding_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.push_promise_frame_padding_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_push_promise_frame_padding().empty()) {
+    _this->_impl_.push_promise_frame_padding_.Set(from._internal_push_promise_frame_padding(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_upgrade()) {
+    _this->_impl_.upgrade_ = new ::HttpMsg_Upgrade(*from._impl_.upgrade_);
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.dynamic_table_update_size_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.dynamic_table_update_size_));
   // @@protoc_insertion_point(copy_constructor:HttpMsg)
 }
 
-void HttpMsg::SharedCtor() {
-    _is_default_instance_ = false;
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  type_ = 0;
-  http_major_ = 0;
-  http_minor_ = 0;
-  content_length_ = 0;
-  method_ = 0;
-  status_code_ = 0;
-  encoding_ = 0;
-  url_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  headers_.SetAssignDescriptorCallback(
-      protobuf_AssignDescriptorsOnce);
-  headers_.SetEntryDescriptor(
-      &::HttpMsg_HeadersEntry_descriptor_);
-  body_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  params_.SetAssignDescriptorCallback(
-      protobuf_AssignDescriptorsOnce);
-  params_.SetEntryDescriptor(
-      &::HttpMsg_ParamsEntry_descriptor_);
-  upgrade_ = NULL;
-  keep_alive_ = 0;
-  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  is_decoding_ = false;
-  chunk_notice_ = false;
-  stream_id_ = 0u;
-  hpack_data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  dynamic_table_update_size_ = 0u;
-  with_huffman_ = false;
-  headers_frame_padding_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  data_frame_padding_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  push_promise_frame_padding_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  settings_.SetAssignDescriptorCallback(
-      protobuf_AssignDescriptorsOnce);
-  settings_.SetEntryDescriptor(
-      &::HttpMsg_SettingsEntry_descriptor_);
+inline void HttpMsg::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.headers_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_.params_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.pseudo_header_){arena}
+    , decltype(_impl_.trailer_header_){arena}
+    , decltype(_impl_.adding_without_index_headers_){arena}
+    , decltype(_impl_.deleting_without_index_headers_){arena}
+    , decltype(_impl_.adding_never_index_headers_){arena}
+    , decltype(_impl_.deleting_never_index_headers_){arena}
+    , /*decltype(_impl_.settings_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.url_){}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.path_){}
+    , decltype(_impl_.hpack_data_){}
+    , decltype(_impl_.headers_frame_padding_){}
+    , decltype(_impl_.data_frame_padding_){}
+    , decltype(_impl_.push_promise_frame_padding_){}
+    , decltype(_impl_.upgrade_){nullptr}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.http_major_){0}
+    , decltype(_impl_.http_minor_){0}
+    , decltype(_impl_.content_length_){0}
+    , decltype(_impl_.method_){0}
+    , decltype(_impl_.status_code_){0}
+    , decltype(_impl_.encoding_){0}
+    , decltype(_impl_.keep_alive_){0}
+    , decltype(_impl_.stream_id_){0u}
+    , decltype(_impl_.is_decoding_){false}
+    , decltype(_impl_.chunk_notice_){false}
+    , decltype(_impl_.with_huffman_){false}
+    , decltype(_impl_.dynamic_table_update_size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.url_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.url_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.hpack_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hpack_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.headers_frame_padding_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.headers_frame_padding_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.data_frame_padding_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_frame_padding_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.push_promise_frame_padding_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.push_promise_frame_padding_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 HttpMsg::~HttpMsg() {
   // @@protoc_insertion_point(destructor:HttpMsg)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
   SharedDtor();
 }
 
-void HttpMsg::SharedDtor() {
-  url_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  body_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  hpack_data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  headers_frame_padding_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  data_frame_padding_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  push_promise_frame_padding_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != default_instance_) {
-    delete upgrade_;
-  }
+inline void HttpMsg::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.headers_.Destruct();
+  _impl_.headers_.~MapField();
+  _impl_.params_.Destruct();
+  _impl_.params_.~MapField();
+  _impl_.pseudo_header_.~RepeatedPtrField();
+  _impl_.trailer_header_.~RepeatedPtrField();
+  _impl_.adding_without_index_headers_.~RepeatedPtrField();
+  _impl_.deleting_without_index_headers_.~RepeatedPtrField();
+  _impl_.adding_never_index_headers_.~RepeatedPtrField();
+  _impl_.deleting_never_index_headers_.~RepeatedPtrField();
+  _impl_.settings_.Destruct();
+  _impl_.settings_.~MapField();
+  _impl_.url_.Destroy();
+  _impl_.body_.Destroy();
+  _impl_.path_.Destroy();
+  _impl_.hpack_data_.Destroy();
+  _impl_.headers_frame_padding_.Destroy();
+  _impl_.data_frame_padding_.Destroy();
+  _impl_.push_promise_frame_padding_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.upgrade_;
+}
+
+void HttpMsg::ArenaDtor(void* object) {
+  HttpMsg* _this = reinterpret_cast< HttpMsg* >(object);
+  _this->_impl_.headers_.Destruct();
+  _this->_impl_.params_.Destruct();
+  _this->_impl_.settings_.Destruct();
 }
-
 void HttpMsg::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* HttpMsg::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return HttpMsg_descriptor_;
-}
-
-const HttpMsg& HttpMsg::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_http_2eproto();
-  return *default_instance_;
-}
-
-HttpMsg* HttpMsg::default_instance_ = NULL;
-
-HttpMsg* HttpMsg::New(::google::protobuf::Arena* arena) const {
-  HttpMsg* n = new HttpMsg;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void HttpMsg::Clear() {
 // @@protoc_insertion_point(message_clear_start:HttpMsg)
-#if defined(__clang__)
-#define ZR_HELPER_(f) \
-  _Pragma("clang diagnostic push") \
-  _Pragma("clang diagnostic ignored \"-Winvalid-offsetof\"") \
-  __builtin_offsetof(HttpMsg, f) \
-  _Pragma("clang diagnostic pop")
-#else
-#define ZR_HELPER_(f) reinterpret_cast<char*>(\
-  &reinterpret_cast<HttpMsg*>(16)->f)
-#endif
-
-#define ZR_(first, last) do {\
-  ::memset(&first, 0,\
-           ZR_HELPER_(last) - ZR_HELPER_(first) + sizeof(last));\
-} while (0)
-
-  ZR_(type_, status_code_);
-  encoding_ = 0;
-  url_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ZR_(is_decoding_, chunk_notice_);
-  body_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == NULL && upgrade_ != NULL) delete upgrade_;
-  upgrade_ = NULL;
-  keep_alive_ = 0;
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  stream_id_ = 0u;
-  hpack_data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  dynamic_table_update_size_ = 0u;
-  with_huffman_ = false;
-  headers_frame_padding_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  data_frame_padding_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  push_promise_frame_padding_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-
-#undef ZR_HELPER_
-#undef ZR_
-
-  headers_.Clear();
-  params_.Clear();
-  pseudo_header_.Clear();
-  trailer_header_.Clear();
-  adding_without_index_headers_.Clear();
-  deleting_without_index_headers_.Clear();
-  adding_never_index_headers_.Clear();
-  deleting_never_index_headers_.Clear();
-  settings_.Clear();
-}
-
-bool HttpMsg::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:HttpMsg)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(16383);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional int32 type = 1;
-      case 1: {
-        if (tag == 8) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &type_)));
-
-        } else {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.headers_.Clear();
+  _impl_.params_.Clear();
+  _impl_.pseudo_header_.Clear();
+  _impl_.trailer_header_.Clear();
+  _impl_.adding_without_index_headers_.Clear();
+  _impl_.deleting_without_index_headers_.Clear();
+  _impl_.adding_never_index_headers_.Clear();
+  _impl_.deleting_never_index_headers_.Clear();
+  _impl_.settings_.Clear();
+  _impl_.url_.ClearToEmpty();
+  _impl_.body_.ClearToEmpty();
+  _impl_.path_.ClearToEmpty();
+  _impl_.hpack_data_.ClearToEmpty();
+  _impl_.headers_frame_padding_.ClearToEmpty();
+  _impl_.data_frame_padding_.ClearToEmpty();
+  _impl_.push_promise_frame_padding_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.upgrade_ != nullptr) {
+    delete _impl_.upgrade_;
+  }
+  _impl_.upgrade_ = nullptr;
+  ::memset(&_impl_.type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.dynamic_table_update_size_) -
+      reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.dynamic_table_update_size_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HttpMsg::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(16)) goto parse_http_major;
-        break;
-      }
-
-      // optional int32 http_major = 2;
-      case 2: {
-        if (tag == 16) {
-         parse_http_major:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &http_major_)));
-
-        } else {
+        continue;
+      // int32 http_major = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.http_major_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(24)) goto parse_http_minor;
-        break;
-      }
-
-      // optional int32 http_minor = 3;
-      case 3: {
-        if (tag == 24) {
-         parse_http_minor:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &http_minor_)));
-
-        } else {
+        continue;
+      // int32 http_minor = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.http_minor_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(32)) goto parse_content_length;
-        break;
-      }
-
-      // optional int32 content_length = 4;
-      case 4: {
-        if (tag == 32) {
-         parse_content_length:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &content_length_)));
-
-        } else {
+        continue;
+      // int32 content_length = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.content_length_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(40)) goto parse_method;
-        break;
-      }
-
-      // optional int32 method = 5;
-      case 5: {
-        if (tag == 40) {
-         parse_method:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &method_)));
-
-        } else {
+        continue;
+      // int32 method = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.method_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(48)) goto parse_status_code;
-        break;
-      }
-
-      // optional int32 status_code = 6;
-      case 6: {
-        if (tag == 48) {
-         parse_status_code:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &status_code_)));
-
-        } else {
+        continue;
+      // int32 status_code = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.status_code_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(56)) goto parse_encoding;
-        break;
-      }
-
-      // optional int32 encoding = 7;
-      case 7: {
-        if (tag == 56) {
-         parse_encoding:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &encoding_)));
-
-        } else {
+        continue;
+      // int32 encoding = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.encoding_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(66)) goto parse_url;
-        break;
-      }
-
-      // optional string url = 8;
-      case 8: {
-        if (tag == 66) {
-         parse_url:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_url()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->url().data(), this->url().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "HttpMsg.url"));
-        } else {
+        continue;
+      // string url = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_url();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "HttpMsg.url"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(74)) goto parse_headers;
-        break;
-      }
-
+        continue;
       // map<string, string> headers = 9;
-      case 9: {
-        if (tag == 74) {
-         parse_headers:
-          DO_(input->IncrementRecursionDepth());
-         parse_loop_headers:
-          HttpMsg_HeadersEntry::Parser< ::google::protobuf::internal::MapField<
-              ::std::string, ::std::string,
-              ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-              ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-              0 >,
-            ::google::protobuf::Map< ::std::string, ::std::string > > parser(&headers_);
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-              input, &parser));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            parser.key().data(), parser.key().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "HttpMsg.HeadersEntry.key"));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            parser.value().data(), parser.value().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "HttpMsg.HeadersEntry.value"));
-        } else {
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.headers_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(74)) goto parse_loop_headers;
-        input->UnsafeDecrementRecursionDepth();
-        if (input->ExpectTag(82)) goto parse_body;
-        break;
-      }
-
-      // optional bytes body = 10;
-      case 10: {
-        if (tag == 82) {
-         parse_body:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_body()));
-        } else {
+        continue;
+      // bytes body = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_body();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(90)) goto parse_params;
-        break;
-      }
-
+        continue;
       // map<string, string> params = 11;
-      case 11: {
-        if (tag == 90) {
-         parse_params:
-          DO_(input->IncrementRecursionDepth());
-         parse_loop_params:
-          HttpMsg_ParamsEntry::Parser< ::google::protobuf::internal::MapField<
-              ::std::string, ::std::string,
-              ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-              ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-              0 >,
-            ::google::protobuf::Map< ::std::string, ::std::string > > parser(&params_);
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-              input, &parser));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            parser.key().data(), parser.key().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "HttpMsg.ParamsEntry.key"));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            parser.value().data(), parser.value().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "HttpMsg.ParamsEntry.value"));
-        } else {
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.params_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<90>(ptr));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(90)) goto parse_loop_params;
-        input->UnsafeDecrementRecursionDepth();
-        if (input->ExpectTag(98)) goto parse_upgrade;
-        break;
-      }
-
-      // optional .HttpMsg.Upgrade upgrade = 12;
-      case 12: {
-        if (tag == 98) {
-         parse_upgrade:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_upgrade()));
-        } else {
+        continue;
+      // .HttpMsg.Upgrade upgrade = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_upgrade(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(109)) goto parse_keep_alive;
-        break;
-      }
-
-      // optional float keep_alive = 13;
-      case 13: {
-        if (tag == 109) {
-         parse_keep_alive:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &keep_alive_)));
-
-        } else {
+        continue;
+      // float keep_alive = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 109)) {
+          _impl_.keep_alive_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(114)) goto parse_path;
-        break;
-      }
-
-      // optional string path = 14;
-      case 14: {
-        if (tag == 114) {
-         parse_path:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_path()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->path().data(), this->path().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "HttpMsg.path"));
-        } else {
+        continue;
+      // string path = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          auto str = _internal_mutable_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "HttpMsg.path"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(120)) goto parse_is_decoding;
-        break;
-      }
-
-      // optional bool is_decoding = 15;
-      case 15: {
-        if (tag == 120) {
-         parse_is_decoding:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &is_decoding_)));
-
-        } else {
+        continue;
+      // bool is_decoding = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _impl_.is_decoding_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(152)) goto parse_chunk_notice;
-        break;
-      }
-
-      // optional bool chunk_notice = 19;
-      case 19: {
-        if (tag == 152) {
-         parse_chunk_notice:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &chunk_notice_)));
-
-        } else {
+        continue;
+      // bool chunk_notice = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 152)) {
+          _impl_.chunk_notice_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(160)) goto parse_stream_id;
-        break;
-      }
-
-      // optional uint32 stream_id = 20;
-      case 20: {
-        if (tag == 160) {
-         parse_stream_id:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &stream_id_)));
-
-        } else {
+        continue;
+      // uint32 stream_id = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 160)) {
+          _impl_.stream_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(170)) goto parse_pseudo_header;
-        break;
-      }
-
+        continue;
       // repeated .HttpMsg.Header pseudo_header = 21;
-      case 21: {
-        if (tag == 170) {
-         parse_pseudo_header:
-          DO_(input->IncrementRecursionDepth());
-         parse_loop_pseudo_header:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
-                input, add_pseudo_header()));
-        } else {
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 170)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_pseudo_header(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<170>(ptr));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(170)) goto parse_loop_pseudo_header;
-        if (input->ExpectTag(178)) goto parse_loop_trailer_header;
-        input->UnsafeDecrementRecursionDepth();
-        break;
-      }
-
+        continue;
       // repeated .HttpMsg.Header trailer_header = 22;
-      case 22: {
-        if (tag == 178) {
-          DO_(input->IncrementRecursionDepth());
-         parse_loop_trailer_header:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
-                input, add_trailer_header()));
-        } else {
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 178)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_trailer_header(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<178>(ptr));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(178)) goto parse_loop_trailer_header;
-        input->UnsafeDecrementRecursionDepth();
-        if (input->ExpectTag(186)) goto parse_hpack_data;
-        break;
-      }
-
-      // optional string hpack_data = 23;
-      case 23: {
-        if (tag == 186) {
-         parse_hpack_data:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_hpack_data()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->hpack_data().data(), this->hpack_data().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "HttpMsg.hpack_data"));
-        } else {
+        continue;
+      // string hpack_data = 23;
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 186)) {
+          auto str = _internal_mutable_hpack_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "HttpMsg.hpack_data"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(194)) goto parse_adding_without_index_headers;
-        break;
-      }
-
+        continue;
       // repeated string adding_without_index_headers = 24;
-      case 24: {
-        if (tag == 194) {
-         parse_adding_without_index_headers:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_adding_without_index_headers()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->adding_without_index_headers(this->adding_without_index_headers_size() - 1).data(),
-            this->adding_without_index_headers(this->adding_without_index_headers_size() - 1).length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "HttpMsg.adding_without_index_headers"));
-        } else {
+      case 24:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 194)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            auto str = _internal_add_adding_without_index_headers();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "HttpMsg.adding_without_index_headers"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<194>(ptr));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(194)) goto parse_adding_without_index_headers;
-        if (input->ExpectTag(202)) goto parse_deleting_without_index_headers;
-        break;
-      }
-
+        continue;
       // repeated string deleting_without_index_headers = 25;
-      case 25: {
-        if (tag == 202) {
-         parse_deleting_without_index_headers:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_deleting_without_index_headers()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->deleting_without_index_headers(this->deleting_without_index_headers_size() - 1).data(),
-            this->deleting_without_index_headers(this->deleting_without_index_headers_size() - 1).length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "HttpMsg.deleting_without_index_headers"));
-        } else {
+      case 25:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 202)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            auto str = _internal_add_deleting_without_index_headers();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "HttpMsg.deleting_without_index_headers"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<202>(ptr));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(202)) goto parse_deleting_without_index_headers;
-        if (input->ExpectTag(210)) goto parse_adding_never_index_headers;
-        break;
-      }
-
+        continue;
       // repeated string adding_never_index_headers = 26;
-      case 26: {
-        if (tag == 210) {
-         parse_adding_never_index_headers:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_adding_never_index_headers()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->adding_never_index_headers(this->adding_never_index_headers_size() - 1).data(),
-            this->adding_never_index_headers(this->adding_never_index_headers_size() - 1).length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "HttpMsg.adding_never_index_headers"));
-        } else {
+      case 26:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 210)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            auto str = _internal_add_adding_never_index_headers();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "HttpMsg.adding_never_index_headers"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<210>(ptr));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(210)) goto parse_adding_never_index_headers;
-        if (input->ExpectTag(218)) goto parse_deleting_never_index_headers;
-        break;
-      }
-
+        continue;
       // repeated string deleting_never_index_headers = 27;
-      case 27: {
-        if (tag == 218) {
-         parse_deleting_never_index_headers:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_deleting_never_index_headers()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->deleting_never_index_headers(this->deleting_never_index_headers_size() - 1).data(),
-            this->deleting_never_index_headers(this->deleting_never_index_headers_size() - 1).length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "HttpMsg.deleting_never_index_headers"));
-        } else {
+      case 27:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 218)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            auto str = _internal_add_deleting_never_index_headers();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "HttpMsg.deleting_never_index_headers"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<218>(ptr));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(218)) goto parse_deleting_never_index_headers;
-        if (input->ExpectTag(224)) goto parse_dynamic_table_update_size;
-        break;
-      }
-
-      // optional uint32 dynamic_table_update_size = 28;
-      case 28: {
-        if (tag == 224) {
-         parse_dynamic_table_update_size:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &dynamic_table_update_size_)));
-
-        } else {
+        continue;
+      // uint32 dynamic_table_update_size = 28;
+      case 28:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 224)) {
+          _impl_.dynamic_table_update_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(232)) goto parse_with_huffman;
-        break;
-      }
-
-      // optional bool with_huffman = 29;
-      case 29: {
-        if (tag == 232) {
-         parse_with_huffman:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &with_huffman_)));
-
-        } else {
+        continue;
+      // bool with_huffman = 29;
+      case 29:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 232)) {
+          _impl_.with_huffman_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(242)) goto parse_headers_frame_padding;
-        break;
-      }
-
-      // optional string headers_frame_padding = 30;
-      case 30: {
-        if (tag == 242) {
-         parse_headers_frame_padding:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_headers_frame_padding()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->headers_frame_padding().data(), this->headers_frame_padding().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "HttpMsg.headers_frame_padding"));
-        } else {
+        continue;
+      // string headers_frame_padding = 30;
+      case 30:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 242)) {
+          auto str = _internal_mutable_headers_frame_padding();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "HttpMsg.headers_frame_padding"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(250)) goto parse_data_frame_padding;
-        break;
-      }
-
-      // optional string data_frame_padding = 31;
-      case 31: {
-        if (tag == 250) {
-         parse_data_frame_padding:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_data_frame_padding()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->data_frame_padding().data(), this->data_frame_padding().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "HttpMsg.data_frame_padding"));
-        } else {
+        continue;
+      // string data_frame_padding = 31;
+      case 31:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 250)) {
+          auto str = _internal_mutable_data_frame_padding();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "HttpMsg.data_frame_padding"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(258)) goto parse_push_promise_frame_padding;
-        break;
-      }
-
-      // optional string push_promise_frame_padding = 32;
-      case 32: {
-        if (tag == 258) {
-         parse_push_promise_frame_padding:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_push_promise_frame_padding()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->push_promise_frame_padding().data(), this->push_promise_frame_padding().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "HttpMsg.push_promise_frame_padding"));
-        } else {
+        continue;
+      // string push_promise_frame_padding = 32;
+      case 32:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 2)) {
+          auto str = _internal_mutable_push_promise_frame_padding();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "HttpMsg.push_promise_frame_padding"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(266)) goto parse_settings;
-        break;
-      }
-
+        continue;
       // map<uint32, uint32> settings = 33;
-      case 33: {
-        if (tag == 266) {
-         parse_settings:
-          DO_(input->IncrementRecursionDepth());
-         parse_loop_settings:
-          HttpMsg_SettingsEntry::Parser< ::google::protobuf::internal::MapField<
-              ::google::protobuf::uint32, ::google::protobuf::uint32,
-              ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
-              ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
-              0 >,
-            ::google::protobuf::Map< ::google::protobuf::uint32, ::google::protobuf::uint32 > > parser(&settings_);
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-              input, &parser));
-        } else {
+      case 33:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(&_impl_.settings_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<266>(ptr));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(266)) goto parse_loop_settings;
-        input->UnsafeDecrementRecursionDepth();
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:HttpMsg)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:HttpMsg)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void HttpMsg::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:HttpMsg)
-  // optional int32 type = 1;
-  if (this->type() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->type(), output);
+uint8_t* HttpMsg::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HttpMsg)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 type = 1;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_type(), target);
   }
 
-  // optional int32 http_major = 2;
-  if (this->http_major() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->http_major(), output);
+  // int32 http_major = 2;
+  if (this->_internal_http_major() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_http_major(), target);
   }
 
-  // optional int32 http_minor = 3;
-  if (this->http_minor() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->http_minor(), output);
+  // int32 http_minor = 3;
+  if (this->_internal_http_minor() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_http_minor(), target);
   }
 
-  // optional int32 content_length = 4;
-  if (this->content_length() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(4, this->content_length(), output);
+  // int32 content_length = 4;
+  if (this->_internal_content_length() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_content_length(), target);
   }
 
-  // optional int32 method = 5;
-  if (this->method() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(5, this->method(), output);
+  // int32 method = 5;
+  if (this->_internal_method() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_method(), target);
   }
 
-  // optional int32 status_code = 6;
-  if (this->status_code() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(6, this->status_code(), output);
+  // int32 status_code = 6;
+  if (this->_internal_status_code() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_status_code(), target);
   }
 
-  // optional int32 encoding = 7;
-  if (this->encoding() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(7, this->encoding(), output);
+  // int32 encoding = 7;
+  if (this->_internal_encoding() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_encoding(), target);
   }
 
-  // optional string url = 8;
-  if (this->url().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->url().data(), this->url().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  // string url = 8;
+  if (!this->_internal_url().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_url().data(), static_cast<int>(this->_internal_url().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "HttpMsg.url");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      8, this->url(), output);
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_url(), target);
   }
 
   // map<string, string> headers = 9;
-  if (!this->headers().empty()) {
-    typedef ::google::protobuf::Map< ::std::string, ::std::string >::const_pointer
-        ConstPtr;
-    typedef ConstPtr SortItem;
-    typedef ::google::protobuf::internal::CompareByDerefFirst<SortItem> Less;
-    struct Utf8Check {
-      static void Check(ConstPtr p) {
-        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          p->first.data(), p->first.length(),
-          ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-          "HttpMsg.HeadersEntry.key");
-        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          p->second.data(), p->second.length(),
-          ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-          "HttpMsg.HeadersEntry.value");
-      }
+  if (!this->_internal_headers().empty()) {
+    using MapType = ::_pb::Map<std::string, std::string>;
+    using WireHelper = HttpMsg_HeadersEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_headers();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "HttpMsg.HeadersEntry.key");
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.second.data(), static_cast<int>(entry.second.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "HttpMsg.HeadersEntry.value");
     };
 
-    if (output->IsSerializationDeterminstic() &&
-        this->headers().size() > 1) {
-      ::google::protobuf::scoped_array<SortItem> items(
-          new SortItem[this->headers().size()]);
-      typedef ::google::protobuf::Map< ::std::string, ::std::string >::size_type size_type;
-      size_type n = 0;
-      for (::google::protobuf::Map< ::std::string, ::std::string >::const_iterator
-          it = this->headers().begin();
-          it != this->headers().end(); ++it, ++n) {
-        items[n] = SortItem(&*it);
-      }
-      ::std::sort(&items[0], &items[n], Less());
-      ::google::protobuf::scoped_ptr<HttpMsg_HeadersEntry> entry;
-      for (size_type i = 0; i < n; i++) {
-        entry.reset(headers_.NewEntryWrapper(
-            items[i]->first, items[i]->second));
-        ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-            9, *entry, output);
-        Utf8Check::Check(items[i]);
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(9, entry.first, entry.second, target, stream);
+        check_utf8(entry);
       }
     } else {
-      ::google::protobuf::scoped_ptr<HttpMsg_HeadersEntry> entry;
-      for (::google::protobuf::Map< ::std::string, ::std::string >::const_iterator
-          it = this->headers().begin();
-          it != this->headers().end(); ++it) {
-        entry.reset(headers_.NewEntryWrapper(
-            it->first, it->second));
-        ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-            9, *entry, output);
-        Utf8Check::Check(&*it);
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(9, entry.first, entry.second, target, stream);
+        check_utf8(entry);
       }
     }
   }
 
-  // optional bytes body = 10;
-  if (this->body().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      10, this->body(), output);
+  // bytes body = 10;
+  if (!this->_internal_body().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        10, this->_internal_body(), target);
   }
 
   // map<string, string> params = 11;
-  if (!this->params().empty()) {
-    typedef ::google::protobuf::Map< ::std::string, ::std::string >::const_pointer
-        ConstPtr;
-    typedef ConstPtr SortItem;
-    typedef ::google::protobuf::internal::CompareByDerefFirst<SortItem> Less;
-    struct Utf8Check {
-      static void Check(ConstPtr p) {
-        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          p->first.data(), p->first.length(),
-          ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-          "HttpMsg.ParamsEntry.key");
-        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          p->second.data(), p->second.length(),
-          ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-          "HttpMsg.ParamsEntry.value");
-      }
+  if (!this->_internal_params().empty()) {
+    using MapType = ::_pb::Map<std::string, std::string>;
+    using WireHelper = HttpMsg_ParamsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_params();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "HttpMsg.ParamsEntry.key");
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.second.data(), static_cast<int>(entry.second.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "HttpMsg.ParamsEntry.value");
     };
 
-    if (output->IsSerializationDeterminstic() &&
-        this->params().size() > 1) {
-      ::google::protobuf::scoped_array<SortItem> items(
-          new SortItem[this->params().size()]);
-      typedef ::google::protobuf::Map< ::std::string, ::std::string >::size_type size_type;
-      size_type n = 0;
-      for (::google::protobuf::Map< ::std::string, ::std::string >::const_iterator
-          it = this->params().begin();
-          it != this->params().end(); ++it, ++n) {
-        items[n] = SortItem(&*it);
-      }
-      ::std::sort(&items[0], &items[n], Less());
-      ::google::protobuf::scoped_ptr<HttpMsg_ParamsEntry> entry;
-      for (size_type i = 0; i < n; i++) {
-        entry.reset(params_.NewEntryWrapper(
-            items[i]->first, items[i]->second));
-        ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-            11, *entry, output);
-        Utf8Check::Check(items[i]);
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(11, entry.first, entry.second, target, stream);
+        check_utf8(entry);
       }
     } else {
-      ::google::protobuf::scoped_ptr<HttpMsg_ParamsEntry> entry;
-      for (::google::protobuf::Map< ::std::string, ::std::string >::const_iterator
-          it = this->params().begin();
-          it != this->params().end(); ++it) {
-        entry.reset(params_.NewEntryWrapper(
-            it->first, it->second));
-        ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-            11, *entry, output);
-        Utf8Check::Check(&*it);
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(11, entry.first, entry.second, target, stream);
+        check_utf8(entry);
       }
     }
   }
 
-  // optional .HttpMsg.Upgrade upgrade = 12;
-  if (this->has_upgrade()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      12, *this->upgrade_, output);
+  // .HttpMsg.Upgrade upgrade = 12;
+  if (this->_internal_has_upgrade()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, _Internal::upgrade(this),
+        _Internal::upgrade(this).GetCachedSize(), target, stream);
   }
 
-  // optional float keep_alive = 13;
-  if (this->keep_alive() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(13, this->keep_alive(), output);
+  // float keep_alive = 13;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_keep_alive = this->_internal_keep_alive();
+  uint32_t raw_keep_alive;
+  memcpy(&raw_keep_alive, &tmp_keep_alive, sizeof(tmp_keep_alive));
+  if (raw_keep_alive != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(13, this->_internal_keep_alive(), target);
   }
 
-  // optional string path = 14;
-  if (this->path().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->path().data(), this->path().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  // string path = 14;
+  if (!this->_internal_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_path().data(), static_cast<int>(this->_internal_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "HttpMsg.path");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      14, this->path(), output);
+    target = stream->WriteStringMaybeAliased(
+        14, this->_internal_path(), target);
   }
 
-  // optional bool is_decoding = 15;
-  if (this->is_decoding() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(15, this->is_decoding(), output);
+  // bool is_decoding = 15;
+  if (this->_internal_is_decoding() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(15, this->_internal_is_decoding(), target);
   }
 
-  // optional bool chunk_notice = 19;
-  if (this->chunk_notice() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(19, this->chunk_notice(), output);
+  // bool chunk_notice = 19;
+  if (this->_internal_chunk_notice() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(19, this->_internal_chunk_notice(), target);
   }
 
-  // optional uint32 stream_id = 20;
-  if (this->stream_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(20, this->stream_id(), output);
+  // uint32 stream_id = 20;
+  if (this->_internal_stream_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(20, this->_internal_stream_id(), target);
   }
 
   // repeated .HttpMsg.Header pseudo_header = 21;
-  for (unsigned int i = 0, n = this->pseudo_header_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      21, this->pseudo_header(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_pseudo_header_size()); i < n; i++) {
+    const auto& repfield = this->_internal_pseudo_header(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(21, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // repeated .HttpMsg.Header trailer_header = 22;
-  for (unsigned int i = 0, n = this->trailer_header_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      22, this->trailer_header(i), output);
-  }
-
-  // optional string hpack_data = 23;
-  if (this->hpack_data().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->hpack_data().data(), this->hpack_data().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_trailer_header_size()); i < n; i++) {
+    const auto& repfield = this->_internal_trailer_header(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(22, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // string hpack_data = 23;
+  if (!this->_internal_hpack_data().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_hpack_data().data(), static_cast<int>(this->_internal_hpack_data().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "HttpMsg.hpack_data");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      23, this->hpack_data(), output);
+    target = stream->WriteStringMaybeAliased(
+        23, this->_internal_hpack_data(), target);
   }
 
   // repeated string adding_without_index_headers = 24;
-  for (int i = 0; i < this->adding_without_index_headers_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->adding_without_index_headers(i).data(), this->adding_without_index_headers(i).length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  for (int i = 0, n = this->_internal_adding_without_index_headers_size(); i < n; i++) {
+    const auto& s = this->_internal_adding_without_index_headers(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "HttpMsg.adding_without_index_headers");
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      24, this->adding_without_index_headers(i), output);
+    target = stream->WriteString(24, s, target);
   }
 
   // repeated string deleting_without_index_headers = 25;
-  for (int i = 0; i < this->deleting_without_index_headers_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->deleting_without_index_headers(i).data(), this->deleting_without_index_headers(i).length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  for (int i = 0, n = this->_internal_deleting_without_index_headers_size(); i < n; i++) {
+    const auto& s = this->_internal_deleting_without_index_headers(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "HttpMsg.deleting_without_index_headers");
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      25, this->deleting_without_index_headers(i), output);
+    target = stream->WriteString(25, s, target);
   }
 
   // repeated string adding_never_index_headers = 26;
-  for (int i = 0; i < this->adding_never_index_headers_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->adding_never_index_headers(i).data(), this->adding_never_index_headers(i).length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  for (int i = 0, n = this->_internal_adding_never_index_headers_size(); i < n; i++) {
+    const auto& s = this->_internal_adding_never_index_headers(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "HttpMsg.adding_never_index_headers");
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      26, this->adding_never_index_headers(i), output);
+    target = stream->WriteString(26, s, target);
   }
 
   // repeated string deleting_never_index_headers = 27;
-  for (int i = 0; i < this->deleting_never_index_headers_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->deleting_never_index_headers(i).data(), this->deleting_never_index_headers(i).length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  for (int i = 0, n = this->_internal_deleting_never_index_headers_size(); i < n; i++) {
+    const auto& s = this->_internal_deleting_never_index_headers(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "HttpMsg.deleting_never_index_headers");
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      27, this->deleting_never_index_headers(i), output);
+    target = stream->WriteString(27, s, target);
   }
 
-  // optional uint32 dynamic_table_update_size = 28;
-  if (this->dynamic_table_update_size() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(28, this->dynamic_table_update_size(), output);
+  // uint32 dynamic_table_update_size = 28;
+  if (this->_internal_dynamic_table_update_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(28, this->_internal_dynamic_table_update_size(), target);
   }
 
-  // optional bool with_huffman = 29;
-  if (this->with_huffman() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(29, this->with_huffman(), output);
+  // bool with_huffman = 29;
+  if (this->_internal_with_huffman() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(29, this->_internal_with_huffman(), target);
   }
 
-  // optional string headers_frame_padding = 30;
-  if (this->headers_frame_padding().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->headers_frame_padding().data(), this->headers_frame_padding().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  // string headers_frame_padding = 30;
+  if (!this->_internal_headers_frame_padding().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_headers_frame_padding().data(), static_cast<int>(this->_internal_headers_frame_padding().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "HttpMsg.headers_frame_padding");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      30, this->headers_frame_padding(), output);
+    target = stream->WriteStringMaybeAliased(
+        30, this->_internal_headers_frame_padding(), target);
   }
 
-  // optional string data_frame_padding = 31;
-  if (this->data_frame_padding().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->data_frame_padding().data(), this->data_frame_padding().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  // string data_frame_padding = 31;
+  if (!this->_internal_data_frame_padding().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_data_frame_padding().data(), static_cast<int>(this->_internal_data_frame_padding().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "HttpMsg.data_frame_padding");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      31, this->data_frame_padding(), output);
+    target = stream->WriteStringMaybeAliased(
+        31, this->_internal_data_frame_padding(), target);
   }
 
-  // optional string push_promise_frame_padding = 32;
-  if (this->push_promise_frame_padding().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->push_promise_frame_padding().data(), this->push_promise_frame_padding().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  // string push_promise_frame_padding = 32;
+  if (!this->_internal_push_promise_frame_padding().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_push_promise_frame_padding().data(), static_cast<int>(this->_internal_push_promise_frame_padding().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "HttpMsg.push_promise_frame_padding");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      32, this->push_promise_frame_padding(), output);
+    target = stream->WriteStringMaybeAliased(
+        32, this->_internal_push_promise_frame_padding(), target);
   }
 
   // map<uint32, uint32> settings = 33;
-  if (!this->settings().empty()) {
-    typedef ::google::protobuf::Map< ::google::protobuf::uint32, ::google::protobuf::uint32 >::const_pointer
-        ConstPtr;
-    typedef ::google::protobuf::internal::SortItem< ::google::protobuf::uint32, ConstPtr > SortItem;
-    typedef ::google::protobuf::internal::CompareByFirstField<SortItem> Less;
-
-    if (output->IsSerializationDeterminstic() &&
-        this->settings().size() > 1) {
-      ::google::protobuf::scoped_array<SortItem> items(
-          new SortItem[this->settings().size()]);
-      typedef ::google::protobuf::Map< ::google::protobuf::uint32, ::google::protobuf::uint32 >::size_type size_type;
-      size_type n = 0;
-      for (::google::protobuf::Map< ::google::protobuf::uint32, ::google::protobuf::uint32 >::const_iterator
-          it = this->settings().begin();
-          it != this->settings().end(); ++it, ++n) {
-        items[n] = SortItem(&*it);
-      }
-      ::std::sort(&items[0], &items[n], Less());
-      ::google::protobuf::scoped_ptr<HttpMsg_SettingsEntry> entry;
-      for (size_type i = 0; i < n; i++) {
-        entry.reset(settings_.NewEntryWrapper(
-            items[i].second->first, items[i].second->second));
-        ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-            33, *entry, output);
+  if (!this->_internal_settings().empty()) {
+    using MapType = ::_pb::Map<uint32_t, uint32_t>;
+    using WireHelper = HttpMsg_SettingsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_settings();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(33, entry.first, entry.second, target, stream);
       }
     } else {
-      ::google::protobuf::scoped_ptr<HttpMsg_SettingsEntry> entry;
-      for (::google::protobuf::Map< ::google::protobuf::uint32, ::google::protobuf::uint32 >::const_iterator
-          it = this->settings().begin();
-          it != this->settings().end(); ++it) {
-        entry.reset(settings_.NewEntryWrapper(
-            it->first, it->second));
-        ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-            33, *entry, output);
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(33, entry.first, entry.second, target, stream);
       }
     }
   }
 
-  // @@protoc_insertion_point(serialize_end:HttpMsg)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HttpMsg)
+  return target;
 }
 
-::google::protobuf::uint8* HttpMsg::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:HttpMsg)
-  // optional int32 type = 1;
-  if (this->type() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->type(), target);
+size_t HttpMsg::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HttpMsg)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, string> headers = 9;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_headers_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_headers().begin();
+      it != this->_internal_headers().end(); ++it) {
+    total_size += HttpMsg_HeadersEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
   }
 
-  // optional int32 http_major = 2;
-  if (this->http_major() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->http_major(), target);
+  // map<string, string> params = 11;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_params_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_params().begin();
+      it != this->_internal_params().end(); ++it) {
+    total_size += HttpMsg_ParamsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
   }
 
-  // optional int32 http_minor = 3;
-  if (this->http_minor() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->http_minor(), target);
+  // repeated .HttpMsg.Header pseudo_header = 21;
+  total_size += 2UL * this->_internal_pseudo_header_size();
+  for (const auto& msg : this->_impl_.pseudo_header_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // optional int32 content_length = 4;
-  if (this->content_length() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(4, this->content_length(), target);
+  // repeated .HttpMsg.Header trailer_header = 22;
+  total_size += 2UL * this->_internal_trailer_header_size();
+  for (const auto& msg : this->_impl_.trailer_header_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // optional int32 method = 5;
-  if (this->method() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(5, this->method(), target);
+  // repeated string adding_without_index_headers = 24;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.adding_without_index_headers_.size());
+  for (int i = 0, n = _impl_.adding_without_index_headers_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.adding_without_index_headers_.Get(i));
   }
 
-  // optional int32 status_code = 6;
-  if (this->status_code() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(6, this->status_code(), target);
+  // repeated string deleting_without_index_headers = 25;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.deleting_without_index_headers_.size());
+  for (int i = 0, n = _impl_.deleting_without_index_headers_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.deleting_without_index_headers_.Get(i));
   }
 
-  // optional int32 encoding = 7;
-  if (this->encoding() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(7, this->encoding(), target);
+  // repeated string adding_never_index_headers = 26;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.adding_never_index_headers_.size());
+  for (int i = 0, n = _impl_.adding_never_index_headers_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.adding_never_index_headers_.Get(i));
   }
 
-  // optional string url = 8;
-  if (this->url().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->url().data(), this->url().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "HttpMsg.url");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        8, this->url(), target);
+  // repeated string deleting_never_index_headers = 27;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.deleting_never_index_headers_.size());
+  for (int i = 0, n = _impl_.deleting_never_index_headers_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.deleting_never_index_headers_.Get(i));
   }
 
-  // map<string, string> headers = 9;
-  if (!this->headers().empty()) {
-    typedef ::google::protobuf::Map< ::std::string, ::std::string >::const_pointer
-        ConstPtr;
-    typedef ConstPtr SortItem;
-    typedef ::google::protobuf::internal::CompareByDerefFirst<SortItem> Less;
-    struct Utf8Check {
-      static void Check(ConstPtr p) {
-        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          p->first.data(), p->first.length(),
-          ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-          "HttpMsg.HeadersEntry.key");
-        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          p->second.data(), p->second.length(),
-          ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-          "HttpMsg.HeadersEntry.value");
-      }
-    };
+  // map<uint32, uint32> settings = 33;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_settings_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint32_t >::const_iterator
+      it = this->_internal_settings().begin();
+      it != this->_internal_settings().end(); ++it) {
+    total_size += HttpMsg_SettingsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
 
-    if (deterministic &&
-        this->headers().size() > 1) {
-      ::google::protobuf::scoped_array<SortItem> items(
-          new SortItem[this->headers().size()]);
-      typedef ::google::protobuf::Map< ::std::string, ::std::string >::size_type size_type;
-      size_type n = 0;
-      for (::google::protobuf::Map< ::std::string, ::std::string >::const_iterator
-          it = this->headers().begin();
-          it != this->headers().end(); ++it, ++n) {
-        items[n] = SortItem(&*it);
-      }
-      ::std::sort(&items[0], &items[n], Less());
-      ::google::protobuf::scoped_ptr<HttpMsg_HeadersEntry> entry;
-      for (size_type i = 0; i < n; i++) {
-        entry.reset(headers_.NewEntryWrapper(
-            items[i]->first, items[i]->second));
-        target = ::google::protobuf::internal::WireFormatLite::
-                   InternalWriteMessageNoVirtualToArray(
-                       9, *entry, deterministic, target);
-;
-        Utf8Check::Check(items[i]);
-      }
-    } else {
-      ::google::protobuf::scoped_ptr<HttpMsg_HeadersEntry> entry;
-      for (::google::protobuf::Map< ::std::string, ::std::string >::const_iterator
-          it = this->headers().begin();
-          it != this->headers().end(); ++it) {
-        entry.reset(headers_.NewEntryWrapper(
-            it->first, it->second));
-        target = ::google::protobuf::internal::WireFormatLite::
-                   InternalWriteMessageNoVirtualToArray(
-                       9, *entry, deterministic, target);
-;
-        Utf8Check::Check(&*it);
-      }
-    }
-  }
-
-  // optional bytes body = 10;
-  if (this->body().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        10, this->body(), target);
-  }
-
-  // map<string, string> params = 11;
-  if (!this->params().empty()) {
-    typedef ::google::protobuf::Map< ::std::string, ::std::string >::const_pointer
-        ConstPtr;
-    typedef ConstPtr SortItem;
-    typedef ::google::protobuf::internal::CompareByDerefFirst<SortItem> Less;
-    struct Utf8Check {
-      static void Check(ConstPtr p) {
-        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          p->first.data(), p->first.length(),
-          ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-          "HttpMsg.ParamsEntry.key");
-        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          p->second.data(), p->second.length(),
-          ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-          "HttpMsg.ParamsEntry.value");
-      }
-    };
-
-    if (deterministic &&
-        this->params().size() > 1) {
-      ::google::protobuf::scoped_array<SortItem> items(
-          new SortItem[this->params().size()]);
-      typedef ::google::protobuf::Map< ::std::string, ::std::string >::size_type size_type;
-      size_type n = 0;
-      for (::google::protobuf::Map< ::std::string, ::std::string >::const_iterator
-          it = this->params().begin();
-          it != this->params().end(); ++it, ++n) {
-        items[n] = SortItem(&*it);
-      }
-      ::std::sort(&items[0], &items[n], Less());
-      ::google::protobuf::scoped_ptr<HttpMsg_ParamsEntry> entry;
-      for (size_type i = 0; i < n; i++) {
-        entry.reset(params_.NewEntryWrapper(
-            items[i]->first, items[i]->second));
-        target = ::google::protobuf::internal::WireFormatLite::
-                   InternalWriteMessageNoVirtualToArray(
-                       11, *entry, deterministic, target);
-;
-        Utf8Check::Check(items[i]);
-      }
-    } else {
-      ::google::protobuf::scoped_ptr<HttpMsg_ParamsEntry> entry;
-      for (::google::protobuf::Map< ::std::string, ::std::string >::const_iterator
-          it = this->params().begin();
-          it != this->params().end(); ++it) {
-        entry.reset(params_.NewEntryWrapper(
-            it->first, it->second));
-        target = ::google::protobuf::internal::WireFormatLite::
-                   InternalWriteMessageNoVirtualToArray(
-                       11, *entry, deterministic, target);
-;
-        Utf8Check::Check(&*it);
-      }
-    }
-  }
-
-  // optional .HttpMsg.Upgrade upgrade = 12;
-  if (this->has_upgrade()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        12, *this->upgrade_, false, target);
-  }
-
-  // optional float keep_alive = 13;
-  if (this->keep_alive() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(13, this->keep_alive(), target);
-  }
-
-  // optional string path = 14;
-  if (this->path().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->path().data(), this->path().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "HttpMsg.path");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        14, this->path(), target);
-  }
-
-  // optional bool is_decoding = 15;
-  if (this->is_decoding() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(15, this->is_decoding(), target);
-  }
-
-  // optional bool chunk_notice = 19;
-  if (this->chunk_notice() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(19, this->chunk_notice(), target);
-  }
-
-  // optional uint32 stream_id = 20;
-  if (this->stream_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(20, this->stream_id(), target);
-  }
-
-  // repeated .HttpMsg.Header pseudo_header = 21;
-  for (unsigned int i = 0, n = this->pseudo_header_size(); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        21, this->pseudo_header(i), false, target);
-  }
-
-  // repeated .HttpMsg.Header trailer_header = 22;
-  for (unsigned int i = 0, n = this->trailer_header_size(); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        22, this->trailer_header(i), false, target);
-  }
-
-  // optional string hpack_data = 23;
-  if (this->hpack_data().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->hpack_data().data(), this->hpack_data().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "HttpMsg.hpack_data");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        23, this->hpack_data(), target);
-  }
-
-  // repeated string adding_without_index_headers = 24;
-  for (int i = 0; i < this->adding_without_index_headers_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->adding_without_index_headers(i).data(), this->adding_without_index_headers(i).length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "HttpMsg.adding_without_index_headers");
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(24, this->adding_without_index_headers(i), target);
-  }
-
-  // repeated string deleting_without_index_headers = 25;
-  for (int i = 0; i < this->deleting_without_index_headers_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->deleting_without_index_headers(i).data(), this->deleting_without_index_headers(i).length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "HttpMsg.deleting_without_index_headers");
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(25, this->deleting_without_index_headers(i), target);
-  }
-
-  // repeated string adding_never_index_headers = 26;
-  for (int i = 0; i < this->adding_never_index_headers_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->adding_never_index_headers(i).data(), this->adding_never_index_headers(i).length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "HttpMsg.adding_never_index_headers");
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(26, this->adding_never_index_headers(i), target);
-  }
-
-  // repeated string deleting_never_index_headers = 27;
-  for (int i = 0; i < this->deleting_never_index_headers_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->deleting_never_index_headers(i).data(), this->deleting_never_index_headers(i).length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "HttpMsg.deleting_never_index_headers");
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(27, this->deleting_never_index_headers(i), target);
-  }
-
-  // optional uint32 dynamic_table_update_size = 28;
-  if (this->dynamic_table_update_size() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(28, this->dynamic_table_update_size(), target);
-  }
-
-  // optional bool with_huffman = 29;
-  if (this->with_huffman() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(29, this->with_huffman(), target);
-  }
-
-  // optional string headers_frame_padding = 30;
-  if (this->headers_frame_padding().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->headers_frame_padding().data(), this->headers_frame_padding().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "HttpMsg.headers_frame_padding");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        30, this->headers_frame_padding(), target);
-  }
-
-  // optional string data_frame_padding = 31;
-  if (this->data_frame_padding().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->data_frame_padding().data(), this->data_frame_padding().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "HttpMsg.data_frame_padding");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        31, this->data_frame_padding(), target);
-  }
-
-  // optional string push_promise_frame_padding = 32;
-  if (this->push_promise_frame_padding().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->push_promise_frame_padding().data(), this->push_promise_frame_padding().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "HttpMsg.push_promise_frame_padding");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        32, this->push_promise_frame_padding(), target);
-  }
-
-  // map<uint32, uint32> settings = 33;
-  if (!this->settings().empty()) {
-    typedef ::google::protobuf::Map< ::google::protobuf::uint32, ::google::protobuf::uint32 >::const_pointer
-        ConstPtr;
-    typedef ::google::protobuf::internal::SortItem< ::google::protobuf::uint32, ConstPtr > SortItem;
-    typedef ::google::protobuf::internal::CompareByFirstField<SortItem> Less;
-
-    if (deterministic &&
-        this->settings().size() > 1) {
-      ::google::protobuf::scoped_array<SortItem> items(
-          new SortItem[this->settings().size()]);
-      typedef ::google::protobuf::Map< ::google::protobuf::uint32, ::google::protobuf::uint32 >::size_type size_type;
-      size_type n = 0;
-      for (::google::protobuf::Map< ::google::protobuf::uint32, ::google::protobuf::uint32 >::const_iterator
-          it = this->settings().begin();
-          it != this->settings().end(); ++it, ++n) {
-        items[n] = SortItem(&*it);
-      }
-      ::std::sort(&items[0], &items[n], Less());
-      ::google::protobuf::scoped_ptr<HttpMsg_SettingsEntry> entry;
-      for (size_type i = 0; i < n; i++) {
-        entry.reset(settings_.NewEntryWrapper(
-            items[i].second->first, items[i].second->second));
-        target = ::google::protobuf::internal::WireFormatLite::
-                   InternalWriteMessageNoVirtualToArray(
-                       33, *entry, deterministic, target);
-;
-      }
-    } else {
-      ::google::protobuf::scoped_ptr<HttpMsg_SettingsEntry> entry;
-      for (::google::protobuf::Map< ::google::protobuf::uint32, ::google::protobuf::uint32 >::const_iterator
-          it = this->settings().begin();
-          it != this->settings().end(); ++it) {
-        entry.reset(settings_.NewEntryWrapper(
-            it->first, it->second));
-        target = ::google::protobuf::internal::WireFormatLite::
-                   InternalWriteMessageNoVirtualToArray(
-                       33, *entry, deterministic, target);
-;
-      }
-    }
-  }
-
-  // @@protoc_insertion_point(serialize_to_array_end:HttpMsg)
-  return target;
-}
-
-int HttpMsg::ByteSize() const {
-// @@protoc_insertion_point(message_byte_size_start:HttpMsg)
-  int total_size = 0;
-
-  // optional int32 type = 1;
-  if (this->type() != 0) {
+  // string url = 8;
+  if (!this->_internal_url().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->type());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_url());
   }
 
-  // optional int32 http_major = 2;
-  if (this->http_major() != 0) {
+  // bytes body = 10;
+  if (!this->_internal_body().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->http_major());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_body());
   }
 
-  // optional int32 http_minor = 3;
-  if (this->http_minor() != 0) {
+  // string path = 14;
+  if (!this->_internal_path().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->http_minor());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_path());
   }
 
-  // optional int32 content_length = 4;
-  if (this->content_length() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->content_length());
+  // string hpack_data = 23;
+  if (!this->_internal_hpack_data().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_hpack_data());
   }
 
-  // optional int32 method = 5;
-  if (this->method() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->method());
+  // string headers_frame_padding = 30;
+  if (!this->_internal_headers_frame_padding().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_headers_frame_padding());
   }
 
-  // optional int32 status_code = 6;
-  if (this->status_code() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->status_code());
+  // string data_frame_padding = 31;
+  if (!this->_internal_data_frame_padding().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_data_frame_padding());
   }
 
-  // optional int32 encoding = 7;
-  if (this->encoding() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->encoding());
+  // string push_promise_frame_padding = 32;
+  if (!this->_internal_push_promise_frame_padding().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_push_promise_frame_padding());
   }
 
-  // optional string url = 8;
-  if (this->url().size() > 0) {
+  // .HttpMsg.Upgrade upgrade = 12;
+  if (this->_internal_has_upgrade()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->url());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.upgrade_);
   }
 
-  // optional bytes body = 10;
-  if (this->body().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->body());
+  // int32 type = 1;
+  if (this->_internal_type() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_type());
   }
 
-  // optional .HttpMsg.Upgrade upgrade = 12;
-  if (this->has_upgrade()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->upgrade_);
+  // int32 http_major = 2;
+  if (this->_internal_http_major() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_http_major());
   }
 
-  // optional float keep_alive = 13;
-  if (this->keep_alive() != 0) {
-    total_size += 1 + 4;
+  // int32 http_minor = 3;
+  if (this->_internal_http_minor() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_http_minor());
   }
 
-  // optional string path = 14;
-  if (this->path().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->path());
+  // int32 content_length = 4;
+  if (this->_internal_content_length() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_content_length());
   }
 
-  // optional bool is_decoding = 15;
-  if (this->is_decoding() != 0) {
-    total_size += 1 + 1;
+  // int32 method = 5;
+  if (this->_internal_method() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_method());
   }
 
-  // optional bool chunk_notice = 19;
-  if (this->chunk_notice() != 0) {
-    total_size += 2 + 1;
+  // int32 status_code = 6;
+  if (this->_internal_status_code() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_status_code());
   }
 
-  // optional uint32 stream_id = 20;
-  if (this->stream_id() != 0) {
-    total_size += 2 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->stream_id());
+  // int32 encoding = 7;
+  if (this->_internal_encoding() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_encoding());
   }
 
-  // optional string hpack_data = 23;
-  if (this->hpack_data().size() > 0) {
-    total_size += 2 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->hpack_data());
+  // float keep_alive = 13;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_keep_alive = this->_internal_keep_alive();
+  uint32_t raw_keep_alive;
+  memcpy(&raw_keep_alive, &tmp_keep_alive, sizeof(tmp_keep_alive));
+  if (raw_keep_alive != 0) {
+    total_size += 1 + 4;
   }
 
-  // optional uint32 dynamic_table_update_size = 28;
-  if (this->dynamic_table_update_size() != 0) {
+  // uint32 stream_id = 20;
+  if (this->_internal_stream_id() != 0) {
     total_size += 2 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->dynamic_table_update_size());
+      ::_pbi::WireFormatLite::UInt32Size(
+        this->_internal_stream_id());
   }
 
-  // optional bool with_huffman = 29;
-  if (this->with_huffman() != 0) {
-    total_size += 2 + 1;
+  // bool is_decoding = 15;
+  if (this->_internal_is_decoding() != 0) {
+    total_size += 1 + 1;
   }
 
-  // optional string headers_frame_padding = 30;
-  if (this->headers_frame_padding().size() > 0) {
-    total_size += 2 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->headers_frame_padding());
+  // bool chunk_notice = 19;
+  if (this->_internal_chunk_notice() != 0) {
+    total_size += 2 + 1;
   }
 
-  // optional string data_frame_padding = 31;
-  if (this->data_frame_padding().size() > 0) {
-    total_size += 2 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->data_frame_padding());
+  // bool with_huffman = 29;
+  if (this->_internal_with_huffman() != 0) {
+    total_size += 2 + 1;
   }
 
-  // optional string push_promise_frame_padding = 32;
-  if (this->push_promise_frame_padding().size() > 0) {
+  // uint32 dynamic_table_update_size = 28;
+  if (this->_internal_dynamic_table_update_size() != 0) {
     total_size += 2 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->push_promise_frame_padding());
-  }
-
-  // map<string, string> headers = 9;
-  total_size += 1 * this->headers_size();
-  {
-    ::google::protobuf::scoped_ptr<HttpMsg_HeadersEntry> entry;
-    for (::google::protobuf::Map< ::std::string, ::std::string >::const_iterator
-        it = this->headers().begin();
-        it != this->headers().end(); ++it) {
-      entry.reset(headers_.NewEntryWrapper(it->first, it->second));
-      total_size += ::google::protobuf::internal::WireFormatLite::
-          MessageSizeNoVirtual(*entry);
-    }
-  }
-
-  // map<string, string> params = 11;
-  total_size += 1 * this->params_size();
-  {
-    ::google::protobuf::scoped_ptr<HttpMsg_ParamsEntry> entry;
-    for (::google::protobuf::Map< ::std::string, ::std::string >::const_iterator
-        it = this->params().begin();
-        it != this->params().end(); ++it) {
-      entry.reset(params_.NewEntryWrapper(it->first, it->second));
-      total_size += ::google::protobuf::internal::WireFormatLite::
-          MessageSizeNoVirtual(*entry);
-    }
-  }
-
-  // repeated .HttpMsg.Header pseudo_header = 21;
-  total_size += 2 * this->pseudo_header_size();
-  for (int i = 0; i < this->pseudo_header_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->pseudo_header(i));
-  }
-
-  // repeated .HttpMsg.Header trailer_header = 22;
-  total_size += 2 * this->trailer_header_size();
-  for (int i = 0; i < this->trailer_header_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->trailer_header(i));
-  }
-
-  // repeated string adding_without_index_headers = 24;
-  total_size += 2 * this->adding_without_index_headers_size();
-  for (int i = 0; i < this->adding_without_index_headers_size(); i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-      this->adding_without_index_headers(i));
+      ::_pbi::WireFormatLite::UInt32Size(
+        this->_internal_dynamic_table_update_size());
   }
 
-  // repeated string deleting_without_index_headers = 25;
-  total_size += 2 * this->deleting_without_index_headers_size();
-  for (int i = 0; i < this->deleting_without_index_headers_size(); i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-      this->deleting_without_index_headers(i));
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
-  // repeated string adding_never_index_headers = 26;
-  total_size += 2 * this->adding_never_index_headers_size();
-  for (int i = 0; i < this->adding_never_index_headers_size(); i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-      this->adding_never_index_headers(i));
-  }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HttpMsg::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HttpMsg::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HttpMsg::GetClassData() const { return &_class_data_; }
 
-  // repeated string deleting_never_index_headers = 27;
-  total_size += 2 * this->deleting_never_index_headers_size();
-  for (int i = 0; i < this->deleting_never_index_headers_size(); i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-      this->deleting_never_index_headers(i));
-  }
 
-  // map<uint32, uint32> settings = 33;
-  total_size += 2 * this->settings_size();
-  {
-    ::google::protobuf::scoped_ptr<HttpMsg_SettingsEntry> entry;
-    for (::google::protobuf::Map< ::google::protobuf::uint32, ::google::protobuf::uint32 >::const_iterator
-        it = this->settings().begin();
-        it != this->settings().end(); ++it) {
-      entry.reset(settings_.NewEntryWrapper(it->first, it->second));
-      total_size += ::google::protobuf::internal::WireFormatLite::
-          MessageSizeNoVirtual(*entry);
-    }
-  }
+void HttpMsg::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HttpMsg*>(&to_msg);
+  auto& from = static_cast<const HttpMsg&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:HttpMsg)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void HttpMsg::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:HttpMsg)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const HttpMsg* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const HttpMsg>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:HttpMsg)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:HttpMsg)
-    MergeFrom(*source);
+  _this->_impl_.headers_.MergeFrom(from._impl_.headers_);
+  _this->_impl_.params_.MergeFrom(from._impl_.params_);
+  _this->_impl_.pseudo_header_.MergeFrom(from._impl_.pseudo_header_);
+  _this->_impl_.trailer_header_.MergeFrom(from._impl_.trailer_header_);
+  _this->_impl_.adding_without_index_headers_.MergeFrom(from._impl_.adding_without_index_headers_);
+  _this->_impl_.deleting_without_index_headers_.MergeFrom(from._impl_.deleting_without_index_headers_);
+  _this->_impl_.adding_never_index_headers_.MergeFrom(from._impl_.adding_never_index_headers_);
+  _this->_impl_.deleting_never_index_headers_.MergeFrom(from._impl_.deleting_never_index_headers_);
+  _this->_impl_.settings_.MergeFrom(from._impl_.settings_);
+  if (!from._internal_url().empty()) {
+    _this->_internal_set_url(from._internal_url());
   }
-}
-
-void HttpMsg::MergeFrom(const HttpMsg& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:HttpMsg)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  headers_.MergeFrom(from.headers_);
-  params_.MergeFrom(from.params_);
-  pseudo_header_.MergeFrom(from.pseudo_header_);
-  trailer_header_.MergeFrom(from.trailer_header_);
-  adding_without_index_headers_.MergeFrom(from.adding_without_index_headers_);
-  deleting_without_index_headers_.MergeFrom(from.deleting_without_index_headers_);
-  adding_never_index_headers_.MergeFrom(from.adding_never_index_headers_);
-  deleting_never_index_headers_.MergeFrom(from.deleting_never_index_headers_);
-  settings_.MergeFrom(from.settings_);
-  if (from.type() != 0) {
-    set_type(from.type());
-  }
-  if (from.http_major() != 0) {
-    set_http_major(from.http_major());
+  if (!from._internal_body().empty()) {
+    _this->_internal_set_body(from._internal_body());
   }
-  if (from.http_minor() != 0) {
-    set_http_minor(from.http_minor());
+  if (!from._internal_path().empty()) {
+    _this->_internal_set_path(from._internal_path());
   }
-  if (from.content_length() != 0) {
-    set_content_length(from.content_length());
+  if (!from._internal_hpack_data().empty()) {
+    _this->_internal_set_hpack_data(from._internal_hpack_data());
   }
-  if (from.method() != 0) {
-    set_method(from.method());
+  if (!from._internal_headers_frame_padding().empty()) {
+    _this->_internal_set_headers_frame_padding(from._internal_headers_frame_padding());
   }
-  if (from.status_code() != 0) {
-    set_status_code(from.status_code());
+  if (!from._internal_data_frame_padding().empty()) {
+    _this->_internal_set_data_frame_padding(from._internal_data_frame_padding());
   }
-  if (from.encoding() != 0) {
-    set_encoding(from.encoding());
+  if (!from._internal_push_promise_frame_padding().empty()) {
+    _this->_internal_set_push_promise_frame_padding(from._internal_push_promise_frame_padding());
   }
-  if (from.url().size() > 0) {
-
-    url_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.url_);
+  if (from._internal_has_upgrade()) {
+    _this->_internal_mutable_upgrade()->::HttpMsg_Upgrade::MergeFrom(
+        from._internal_upgrade());
   }
-  if (from.body().size() > 0) {
-
-    body_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.body_);
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
   }
-  if (from.has_upgrade()) {
-    mutable_upgrade()->::HttpMsg_Upgrade::MergeFrom(from.upgrade());
+  if (from._internal_http_major() != 0) {
+    _this->_internal_set_http_major(from._internal_http_major());
   }
-  if (from.keep_alive() != 0) {
-    set_keep_alive(from.keep_alive());
+  if (from._internal_http_minor() != 0) {
+    _this->_internal_set_http_minor(from._internal_http_minor());
   }
-  if (from.path().size() > 0) {
-
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  if (from._internal_content_length() != 0) {
+    _this->_internal_set_content_length(from._internal_content_length());
   }
-  if (from.is_decoding() != 0) {
-    set_is_decoding(from.is_decoding());
+  if (from._internal_method() != 0) {
+    _this->_internal_set_method(from._internal_method());
   }
-  if (from.chunk_notice() != 0) {
-    set_chunk_notice(from.chunk_notice());
+  if (from._internal_status_code() != 0) {
+    _this->_internal_set_status_code(from._internal_status_code());
   }
-  if (from.stream_id() != 0) {
-    set_stream_id(from.stream_id());
+  if (from._internal_encoding() != 0) {
+    _this->_internal_set_encoding(from._internal_encoding());
   }
-  if (from.hpack_data().size() > 0) {
-
-    hpack_data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.hpack_data_);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_keep_alive = from._internal_keep_alive();
+  uint32_t raw_keep_alive;
+  memcpy(&raw_keep_alive, &tmp_keep_alive, sizeof(tmp_keep_alive));
+  if (raw_keep_alive != 0) {
+    _this->_internal_set_keep_alive(from._internal_keep_alive());
   }
-  if (from.dynamic_table_update_size() != 0) {
-    set_dynamic_table_update_size(from.dynamic_table_update_size());
+  if (from._internal_stream_id() != 0) {
+    _this->_internal_set_stream_id(from._internal_stream_id());
   }
-  if (from.with_huffman() != 0) {
-    set_with_huffman(from.with_huffman());
+  if (from._internal_is_decoding() != 0) {
+    _this->_internal_set_is_decoding(from._internal_is_decoding());
   }
-  if (from.headers_frame_padding().size() > 0) {
-
-    headers_frame_padding_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.headers_frame_padding_);
+  if (from._internal_chunk_notice() != 0) {
+    _this->_internal_set_chunk_notice(from._internal_chunk_notice());
   }
-  if (from.data_frame_padding().size() > 0) {
-
-    data_frame_padding_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_frame_padding_);
+  if (from._internal_with_huffman() != 0) {
+    _this->_internal_set_with_huffman(from._internal_with_huffman());
   }
-  if (from.push_promise_frame_padding().size() > 0) {
-
-    push_promise_frame_padding_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.push_promise_frame_padding_);
+  if (from._internal_dynamic_table_update_size() != 0) {
+    _this->_internal_set_dynamic_table_update_size(from._internal_dynamic_table_update_size());
   }
-}
-
-void HttpMsg::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:HttpMsg)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void HttpMsg::CopyFrom(const HttpMsg& from) {
@@ -2581,1078 +2021,92 @@ void HttpMsg::CopyFrom(const HttpMsg& from) {
 }
 
 bool HttpMsg::IsInitialized() const {
-
   return true;
 }
 
-void HttpMsg::Swap(HttpMsg* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void HttpMsg::InternalSwap(HttpMsg* other) {
-  std::swap(type_, other->type_);
-  std::swap(http_major_, other->http_major_);
-  std::swap(http_minor_, other->http_minor_);
-  std::swap(content_length_, other->content_length_);
-  std::swap(method_, other->method_);
-  std::swap(status_code_, other->status_code_);
-  std::swap(encoding_, other->encoding_);
-  url_.Swap(&other->url_);
-  headers_.Swap(&other->headers_);
-  body_.Swap(&other->body_);
-  params_.Swap(&other->params_);
-  std::swap(upgrade_, other->upgrade_);
-  std::swap(keep_alive_, other->keep_alive_);
-  path_.Swap(&other->path_);
-  std::swap(is_decoding_, other->is_decoding_);
-  std::swap(chunk_notice_, other->chunk_notice_);
-  std::swap(stream_id_, other->stream_id_);
-  pseudo_header_.UnsafeArenaSwap(&other->pseudo_header_);
-  trailer_header_.UnsafeArenaSwap(&other->trailer_header_);
-  hpack_data_.Swap(&other->hpack_data_);
-  adding_without_index_headers_.UnsafeArenaSwap(&other->adding_without_index_headers_);
-  deleting_without_index_headers_.UnsafeArenaSwap(&other->deleting_without_index_headers_);
-  adding_never_index_headers_.UnsafeArenaSwap(&other->adding_never_index_headers_);
-  deleting_never_index_headers_.UnsafeArenaSwap(&other->deleting_never_index_headers_);
-  std::swap(dynamic_table_update_size_, other->dynamic_table_update_size_);
-  std::swap(with_huffman_, other->with_huffman_);
-  headers_frame_padding_.Swap(&other->headers_frame_padding_);
-  data_frame_padding_.Swap(&other->data_frame_padding_);
-  push_promise_frame_padding_.Swap(&other->push_promise_frame_padding_);
-  settings_.Swap(&other->settings_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata HttpMsg::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = HttpMsg_descriptor_;
-  metadata.reflection = HttpMsg_reflection_;
-  return metadata;
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// HttpMsg_Header
-
-// optional string name = 1;
-void HttpMsg_Header::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& HttpMsg_Header::name() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.Header.name)
-  return name_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void HttpMsg_Header::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HttpMsg.Header.name)
-}
- void HttpMsg_Header::set_name(const char* value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HttpMsg.Header.name)
-}
- void HttpMsg_Header::set_name(const char* value, size_t size) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.Header.name)
-}
- ::std::string* HttpMsg_Header::mutable_name() {
-  
-  // @@protoc_insertion_point(field_mutable:HttpMsg.Header.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* HttpMsg_Header::release_name() {
-  // @@protoc_insertion_point(field_release:HttpMsg.Header.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void HttpMsg_Header::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
-    
-  } else {
-    
-  }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
-  // @@protoc_insertion_point(field_set_allocated:HttpMsg.Header.name)
-}
-
-// optional string value = 2;
-void HttpMsg_Header::clear_value() {
-  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& HttpMsg_Header::value() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.Header.value)
-  return value_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void HttpMsg_Header::set_value(const ::std::string& value) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HttpMsg.Header.value)
-}
- void HttpMsg_Header::set_value(const char* value) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HttpMsg.Header.value)
-}
- void HttpMsg_Header::set_value(const char* value, size_t size) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.Header.value)
-}
- ::std::string* HttpMsg_Header::mutable_value() {
-  
-  // @@protoc_insertion_point(field_mutable:HttpMsg.Header.value)
-  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* HttpMsg_Header::release_value() {
-  // @@protoc_insertion_point(field_release:HttpMsg.Header.value)
-  
-  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void HttpMsg_Header::set_allocated_value(::std::string* value) {
-  if (value != NULL) {
-    
-  } else {
-    
-  }
-  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set_allocated:HttpMsg.Header.value)
-}
-
-// -------------------------------------------------------------------
-
-// HttpMsg_Upgrade
-
-// optional bool is_upgrade = 1;
-void HttpMsg_Upgrade::clear_is_upgrade() {
-  is_upgrade_ = false;
-}
- bool HttpMsg_Upgrade::is_upgrade() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.Upgrade.is_upgrade)
-  return is_upgrade_;
-}
- void HttpMsg_Upgrade::set_is_upgrade(bool value) {
-  
-  is_upgrade_ = value;
-  // @@protoc_insertion_point(field_set:HttpMsg.Upgrade.is_upgrade)
-}
-
-// optional string protocol = 2;
-void HttpMsg_Upgrade::clear_protocol() {
-  protocol_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& HttpMsg_Upgrade::protocol() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.Upgrade.protocol)
-  return protocol_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void HttpMsg_Upgrade::set_protocol(const ::std::string& value) {
-  
-  protocol_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HttpMsg.Upgrade.protocol)
-}
- void HttpMsg_Upgrade::set_protocol(const char* value) {
-  
-  protocol_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HttpMsg.Upgrade.protocol)
-}
- void HttpMsg_Upgrade::set_protocol(const char* value, size_t size) {
-  
-  protocol_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.Upgrade.protocol)
-}
- ::std::string* HttpMsg_Upgrade::mutable_protocol() {
-  
-  // @@protoc_insertion_point(field_mutable:HttpMsg.Upgrade.protocol)
-  return protocol_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* HttpMsg_Upgrade::release_protocol() {
-  // @@protoc_insertion_point(field_release:HttpMsg.Upgrade.protocol)
-  
-  return protocol_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void HttpMsg_Upgrade::set_allocated_protocol(::std::string* protocol) {
-  if (protocol != NULL) {
-    
-  } else {
-    
-  }
-  protocol_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), protocol);
-  // @@protoc_insertion_point(field_set_allocated:HttpMsg.Upgrade.protocol)
-}
-
-// -------------------------------------------------------------------
-
-// HttpMsg
-
-// optional int32 type = 1;
-void HttpMsg::clear_type() {
-  type_ = 0;
-}
- ::google::protobuf::int32 HttpMsg::type() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.type)
-  return type_;
-}
- void HttpMsg::set_type(::google::protobuf::int32 value) {
-  
-  type_ = value;
-  // @@protoc_insertion_point(field_set:HttpMsg.type)
-}
-
-// optional int32 http_major = 2;
-void HttpMsg::clear_http_major() {
-  http_major_ = 0;
-}
- ::google::protobuf::int32 HttpMsg::http_major() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.http_major)
-  return http_major_;
-}
- void HttpMsg::set_http_major(::google::protobuf::int32 value) {
-  
-  http_major_ = value;
-  // @@protoc_insertion_point(field_set:HttpMsg.http_major)
-}
-
-// optional int32 http_minor = 3;
-void HttpMsg::clear_http_minor() {
-  http_minor_ = 0;
-}
- ::google::protobuf::int32 HttpMsg::http_minor() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.http_minor)
-  return http_minor_;
-}
- void HttpMsg::set_http_minor(::google::protobuf::int32 value) {
-  
-  http_minor_ = value;
-  // @@protoc_insertion_point(field_set:HttpMsg.http_minor)
-}
-
-// optional int32 content_length = 4;
-void HttpMsg::clear_content_length() {
-  content_length_ = 0;
-}
- ::google::protobuf::int32 HttpMsg::content_length() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.content_length)
-  return content_length_;
-}
- void HttpMsg::set_content_length(::google::protobuf::int32 value) {
-  
-  content_length_ = value;
-  // @@protoc_insertion_point(field_set:HttpMsg.content_length)
-}
-
-// optional int32 method = 5;
-void HttpMsg::clear_method() {
-  method_ = 0;
-}
- ::google::protobuf::int32 HttpMsg::method() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.method)
-  return method_;
-}
- void HttpMsg::set_method(::google::protobuf::int32 value) {
-  
-  method_ = value;
-  // @@protoc_insertion_point(field_set:HttpMsg.method)
-}
-
-// optional int32 status_code = 6;
-void HttpMsg::clear_status_code() {
-  status_code_ = 0;
-}
- ::google::protobuf::int32 HttpMsg::status_code() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.status_code)
-  return status_code_;
-}
- void HttpMsg::set_status_code(::google::protobuf::int32 value) {
-  
-  status_code_ = value;
-  // @@protoc_insertion_point(field_set:HttpMsg.status_code)
-}
-
-// optional int32 encoding = 7;
-void HttpMsg::clear_encoding() {
-  encoding_ = 0;
-}
- ::google::protobuf::int32 HttpMsg::encoding() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.encoding)
-  return encoding_;
-}
- void HttpMsg::set_encoding(::google::protobuf::int32 value) {
-  
-  encoding_ = value;
-  // @@protoc_insertion_point(field_set:HttpMsg.encoding)
-}
-
-// optional string url = 8;
-void HttpMsg::clear_url() {
-  url_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& HttpMsg::url() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.url)
-  return url_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void HttpMsg::set_url(const ::std::string& value) {
-  
-  url_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HttpMsg.url)
-}
- void HttpMsg::set_url(const char* value) {
-  
-  url_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HttpMsg.url)
-}
- void HttpMsg::set_url(const char* value, size_t size) {
-  
-  url_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.url)
-}
- ::std::string* HttpMsg::mutable_url() {
-  
-  // @@protoc_insertion_point(field_mutable:HttpMsg.url)
-  return url_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* HttpMsg::release_url() {
-  // @@protoc_insertion_point(field_release:HttpMsg.url)
-  
-  return url_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void HttpMsg::set_allocated_url(::std::string* url) {
-  if (url != NULL) {
-    
-  } else {
-    
-  }
-  url_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), url);
-  // @@protoc_insertion_point(field_set_allocated:HttpMsg.url)
-}
-
-// map<string, string> headers = 9;
-int HttpMsg::headers_size() const {
-  return headers_.size();
-}
-void HttpMsg::clear_headers() {
-  headers_.Clear();
-}
- const ::google::protobuf::Map< ::std::string, ::std::string >&
-HttpMsg::headers() const {
-  // @@protoc_insertion_point(field_map:HttpMsg.headers)
-  return headers_.GetMap();
-}
- ::google::protobuf::Map< ::std::string, ::std::string >*
-HttpMsg::mutable_headers() {
-  // @@protoc_insertion_point(field_mutable_map:HttpMsg.headers)
-  return headers_.MutableMap();
-}
-
-// optional bytes body = 10;
-void HttpMsg::clear_body() {
-  body_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& HttpMsg::body() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.body)
-  return body_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void HttpMsg::set_body(const ::std::string& value) {
-  
-  body_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HttpMsg.body)
-}
- void HttpMsg::set_body(const char* value) {
-  
-  body_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HttpMsg.body)
-}
- void HttpMsg::set_body(const void* value, size_t size) {
-  
-  body_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.body)
-}
- ::std::string* HttpMsg::mutable_body() {
-  
-  // @@protoc_insertion_point(field_mutable:HttpMsg.body)
-  return body_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* HttpMsg::release_body() {
-  // @@protoc_insertion_point(field_release:HttpMsg.body)
-  
-  return body_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void HttpMsg::set_allocated_body(::std::string* body) {
-  if (body != NULL) {
-    
-  } else {
-    
-  }
-  body_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), body);
-  // @@protoc_insertion_point(field_set_allocated:HttpMsg.body)
-}
-
-// map<string, string> params = 11;
-int HttpMsg::params_size() const {
-  return params_.size();
-}
-void HttpMsg::clear_params() {
-  params_.Clear();
-}
- const ::google::protobuf::Map< ::std::string, ::std::string >&
-HttpMsg::params() const {
-  // @@protoc_insertion_point(field_map:HttpMsg.params)
-  return params_.GetMap();
-}
- ::google::protobuf::Map< ::std::string, ::std::string >*
-HttpMsg::mutable_params() {
-  // @@protoc_insertion_point(field_mutable_map:HttpMsg.params)
-  return params_.MutableMap();
-}
-
-// optional .HttpMsg.Upgrade upgrade = 12;
-bool HttpMsg::has_upgrade() const {
-  return !_is_default_instance_ && upgrade_ != NULL;
-}
-void HttpMsg::clear_upgrade() {
-  if (GetArenaNoVirtual() == NULL && upgrade_ != NULL) delete upgrade_;
-  upgrade_ = NULL;
-}
-const ::HttpMsg_Upgrade& HttpMsg::upgrade() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.upgrade)
-  return upgrade_ != NULL ? *upgrade_ : *default_instance_->upgrade_;
-}
-::HttpMsg_Upgrade* HttpMsg::mutable_upgrade() {
-  
-  if (upgrade_ == NULL) {
-    upgrade_ = new ::HttpMsg_Upgrade;
-  }
-  // @@protoc_insertion_point(field_mutable:HttpMsg.upgrade)
-  return upgrade_;
-}
-::HttpMsg_Upgrade* HttpMsg::release_upgrade() {
-  // @@protoc_insertion_point(field_release:HttpMsg.upgrade)
-  
-  ::HttpMsg_Upgrade* temp = upgrade_;
-  upgrade_ = NULL;
-  return temp;
-}
-void HttpMsg::set_allocated_upgrade(::HttpMsg_Upgrade* upgrade) {
-  delete upgrade_;
-  upgrade_ = upgrade;
-  if (upgrade) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:HttpMsg.upgrade)
-}
-
-// optional float keep_alive = 13;
-void HttpMsg::clear_keep_alive() {
-  keep_alive_ = 0;
-}
- float HttpMsg::keep_alive() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.keep_alive)
-  return keep_alive_;
-}
- void HttpMsg::set_keep_alive(float value) {
-  
-  keep_alive_ = value;
-  // @@protoc_insertion_point(field_set:HttpMsg.keep_alive)
-}
-
-// optional string path = 14;
-void HttpMsg::clear_path() {
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& HttpMsg::path() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.path)
-  return path_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void HttpMsg::set_path(const ::std::string& value) {
-  
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HttpMsg.path)
-}
- void HttpMsg::set_path(const char* value) {
-  
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HttpMsg.path)
-}
- void HttpMsg::set_path(const char* value, size_t size) {
-  
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.path)
-}
- ::std::string* HttpMsg::mutable_path() {
-  
-  // @@protoc_insertion_point(field_mutable:HttpMsg.path)
-  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* HttpMsg::release_path() {
-  // @@protoc_insertion_point(field_release:HttpMsg.path)
-  
-  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void HttpMsg::set_allocated_path(::std::string* path) {
-  if (path != NULL) {
-    
-  } else {
-    
-  }
-  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
-  // @@protoc_insertion_point(field_set_allocated:HttpMsg.path)
-}
-
-// optional bool is_decoding = 15;
-void HttpMsg::clear_is_decoding() {
-  is_decoding_ = false;
-}
- bool HttpMsg::is_decoding() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.is_decoding)
-  return is_decoding_;
-}
- void HttpMsg::set_is_decoding(bool value) {
-  
-  is_decoding_ = value;
-  // @@protoc_insertion_point(field_set:HttpMsg.is_decoding)
-}
-
-// optional bool chunk_notice = 19;
-void HttpMsg::clear_chunk_notice() {
-  chunk_notice_ = false;
-}
- bool HttpMsg::chunk_notice() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.chunk_notice)
-  return chunk_notice_;
-}
- void HttpMsg::set_chunk_notice(bool value) {
-  
-  chunk_notice_ = value;
-  // @@protoc_insertion_point(field_set:HttpMsg.chunk_notice)
-}
-
-// optional uint32 stream_id = 20;
-void HttpMsg::clear_stream_id() {
-  stream_id_ = 0u;
-}
- ::google::protobuf::uint32 HttpMsg::stream_id() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.stream_id)
-  return stream_id_;
-}
- void HttpMsg::set_stream_id(::google::protobuf::uint32 value) {
-  
-  stream_id_ = value;
-  // @@protoc_insertion_point(field_set:HttpMsg.stream_id)
-}
-
-// repeated .HttpMsg.Header pseudo_header = 21;
-int HttpMsg::pseudo_header_size() const {
-  return pseudo_header_.size();
-}
-void HttpMsg::clear_pseudo_header() {
-  pseudo_header_.Clear();
-}
-const ::HttpMsg_Header& HttpMsg::pseudo_header(int index) const {
-  // @@protoc_insertion_point(field_get:HttpMsg.pseudo_header)
-  return pseudo_header_.Get(index);
-}
-::HttpMsg_Header* HttpMsg::mutable_pseudo_header(int index) {
-  // @@protoc_insertion_point(field_mutable:HttpMsg.pseudo_header)
-  return pseudo_header_.Mutable(index);
-}
-::HttpMsg_Header* HttpMsg::add_pseudo_header() {
-  // @@protoc_insertion_point(field_add:HttpMsg.pseudo_header)
-  return pseudo_header_.Add();
-}
-::google::protobuf::RepeatedPtrField< ::HttpMsg_Header >*
-HttpMsg::mutable_pseudo_header() {
-  // @@protoc_insertion_point(field_mutable_list:HttpMsg.pseudo_header)
-  return &pseudo_header_;
-}
-const ::google::protobuf::RepeatedPtrField< ::HttpMsg_Header >&
-HttpMsg::pseudo_header() const {
-  // @@protoc_insertion_point(field_list:HttpMsg.pseudo_header)
-  return pseudo_header_;
-}
-
-// repeated .HttpMsg.Header trailer_header = 22;
-int HttpMsg::trailer_header_size() const {
-  return trailer_header_.size();
-}
-void HttpMsg::clear_trailer_header() {
-  trailer_header_.Clear();
-}
-const ::HttpMsg_Header& HttpMsg::trailer_header(int index) const {
-  // @@protoc_insertion_point(field_get:HttpMsg.trailer_header)
-  return trailer_header_.Get(index);
-}
-::HttpMsg_Header* HttpMsg::mutable_trailer_header(int index) {
-  // @@protoc_insertion_point(field_mutable:HttpMsg.trailer_header)
-  return trailer_header_.Mutable(index);
-}
-::HttpMsg_Header* HttpMsg::add_trailer_header() {
-  // @@protoc_insertion_point(field_add:HttpMsg.trailer_header)
-  return trailer_header_.Add();
-}
-::google::protobuf::RepeatedPtrField< ::HttpMsg_Header >*
-HttpMsg::mutable_trailer_header() {
-  // @@protoc_insertion_point(field_mutable_list:HttpMsg.trailer_header)
-  return &trailer_header_;
-}
-const ::google::protobuf::RepeatedPtrField< ::HttpMsg_Header >&
-HttpMsg::trailer_header() const {
-  // @@protoc_insertion_point(field_list:HttpMsg.trailer_header)
-  return trailer_header_;
-}
-
-// optional string hpack_data = 23;
-void HttpMsg::clear_hpack_data() {
-  hpack_data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& HttpMsg::hpack_data() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.hpack_data)
-  return hpack_data_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void HttpMsg::set_hpack_data(const ::std::string& value) {
-  
-  hpack_data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HttpMsg.hpack_data)
-}
- void HttpMsg::set_hpack_data(const char* value) {
-  
-  hpack_data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HttpMsg.hpack_data)
-}
- void HttpMsg::set_hpack_data(const char* value, size_t size) {
-  
-  hpack_data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.hpack_data)
-}
- ::std::string* HttpMsg::mutable_hpack_data() {
-  
-  // @@protoc_insertion_point(field_mutable:HttpMsg.hpack_data)
-  return hpack_data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* HttpMsg::release_hpack_data() {
-  // @@protoc_insertion_point(field_release:HttpMsg.hpack_data)
-  
-  return hpack_data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void HttpMsg::set_allocated_hpack_data(::std::string* hpack_data) {
-  if (hpack_data != NULL) {
-    
-  } else {
-    
-  }
-  hpack_data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), hpack_data);
-  // @@protoc_insertion_point(field_set_allocated:HttpMsg.hpack_data)
-}
-
-// repeated string adding_without_index_headers = 24;
-int HttpMsg::adding_without_index_headers_size() const {
-  return adding_without_index_headers_.size();
-}
-void HttpMsg::clear_adding_without_index_headers() {
-  adding_without_index_headers_.Clear();
-}
- const ::std::string& HttpMsg::adding_without_index_headers(int index) const {
-  // @@protoc_insertion_point(field_get:HttpMsg.adding_without_index_headers)
-  return adding_without_index_headers_.Get(index);
-}
- ::std::string* HttpMsg::mutable_adding_without_index_headers(int index) {
-  // @@protoc_insertion_point(field_mutable:HttpMsg.adding_without_index_headers)
-  return adding_without_index_headers_.Mutable(index);
-}
- void HttpMsg::set_adding_without_index_headers(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:HttpMsg.adding_without_index_headers)
-  adding_without_index_headers_.Mutable(index)->assign(value);
-}
- void HttpMsg::set_adding_without_index_headers(int index, const char* value) {
-  adding_without_index_headers_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:HttpMsg.adding_without_index_headers)
-}
- void HttpMsg::set_adding_without_index_headers(int index, const char* value, size_t size) {
-  adding_without_index_headers_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.adding_without_index_headers)
-}
- ::std::string* HttpMsg::add_adding_without_index_headers() {
-  // @@protoc_insertion_point(field_add_mutable:HttpMsg.adding_without_index_headers)
-  return adding_without_index_headers_.Add();
-}
- void HttpMsg::add_adding_without_index_headers(const ::std::string& value) {
-  adding_without_index_headers_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:HttpMsg.adding_without_index_headers)
-}
- void HttpMsg::add_adding_without_index_headers(const char* value) {
-  adding_without_index_headers_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:HttpMsg.adding_without_index_headers)
-}
- void HttpMsg::add_adding_without_index_headers(const char* value, size_t size) {
-  adding_without_index_headers_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:HttpMsg.adding_without_index_headers)
-}
- const ::google::protobuf::RepeatedPtrField< ::std::string>&
-HttpMsg::adding_without_index_headers() const {
-  // @@protoc_insertion_point(field_list:HttpMsg.adding_without_index_headers)
-  return adding_without_index_headers_;
-}
- ::google::protobuf::RepeatedPtrField< ::std::string>*
-HttpMsg::mutable_adding_without_index_headers() {
-  // @@protoc_insertion_point(field_mutable_list:HttpMsg.adding_without_index_headers)
-  return &adding_without_index_headers_;
-}
-
-// repeated string deleting_without_index_headers = 25;
-int HttpMsg::deleting_without_index_headers_size() const {
-  return deleting_without_index_headers_.size();
-}
-void HttpMsg::clear_deleting_without_index_headers() {
-  deleting_without_index_headers_.Clear();
-}
- const ::std::string& HttpMsg::deleting_without_index_headers(int index) const {
-  // @@protoc_insertion_point(field_get:HttpMsg.deleting_without_index_headers)
-  return deleting_without_index_headers_.Get(index);
-}
- ::std::string* HttpMsg::mutable_deleting_without_index_headers(int index) {
-  // @@protoc_insertion_point(field_mutable:HttpMsg.deleting_without_index_headers)
-  return deleting_without_index_headers_.Mutable(index);
-}
- void HttpMsg::set_deleting_without_index_headers(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:HttpMsg.deleting_without_index_headers)
-  deleting_without_index_headers_.Mutable(index)->assign(value);
-}
- void HttpMsg::set_deleting_without_index_headers(int index, const char* value) {
-  deleting_without_index_headers_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:HttpMsg.deleting_without_index_headers)
-}
- void HttpMsg::set_deleting_without_index_headers(int index, const char* value, size_t size) {
-  deleting_without_index_headers_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.deleting_without_index_headers)
-}
- ::std::string* HttpMsg::add_deleting_without_index_headers() {
-  // @@protoc_insertion_point(field_add_mutable:HttpMsg.deleting_without_index_headers)
-  return deleting_without_index_headers_.Add();
-}
- void HttpMsg::add_deleting_without_index_headers(const ::std::string& value) {
-  deleting_without_index_headers_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:HttpMsg.deleting_without_index_headers)
-}
- void HttpMsg::add_deleting_without_index_headers(const char* value) {
-  deleting_without_index_headers_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:HttpMsg.deleting_without_index_headers)
-}
- void HttpMsg::add_deleting_without_index_headers(const char* value, size_t size) {
-  deleting_without_index_headers_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:HttpMsg.deleting_without_index_headers)
-}
- const ::google::protobuf::RepeatedPtrField< ::std::string>&
-HttpMsg::deleting_without_index_headers() const {
-  // @@protoc_insertion_point(field_list:HttpMsg.deleting_without_index_headers)
-  return deleting_without_index_headers_;
-}
- ::google::protobuf::RepeatedPtrField< ::std::string>*
-HttpMsg::mutable_deleting_without_index_headers() {
-  // @@protoc_insertion_point(field_mutable_list:HttpMsg.deleting_without_index_headers)
-  return &deleting_without_index_headers_;
-}
-
-// repeated string adding_never_index_headers = 26;
-int HttpMsg::adding_never_index_headers_size() const {
-  return adding_never_index_headers_.size();
-}
-void HttpMsg::clear_adding_never_index_headers() {
-  adding_never_index_headers_.Clear();
-}
- const ::std::string& HttpMsg::adding_never_index_headers(int index) const {
-  // @@protoc_insertion_point(field_get:HttpMsg.adding_never_index_headers)
-  return adding_never_index_headers_.Get(index);
-}
- ::std::string* HttpMsg::mutable_adding_never_index_headers(int index) {
-  // @@protoc_insertion_point(field_mutable:HttpMsg.adding_never_index_headers)
-  return adding_never_index_headers_.Mutable(index);
-}
- void HttpMsg::set_adding_never_index_headers(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:HttpMsg.adding_never_index_headers)
-  adding_never_index_headers_.Mutable(index)->assign(value);
-}
- void HttpMsg::set_adding_never_index_headers(int index, const char* value) {
-  adding_never_index_headers_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:HttpMsg.adding_never_index_headers)
-}
- void HttpMsg::set_adding_never_index_headers(int index, const char* value, size_t size) {
-  adding_never_index_headers_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.adding_never_index_headers)
-}
- ::std::string* HttpMsg::add_adding_never_index_headers() {
-  // @@protoc_insertion_point(field_add_mutable:HttpMsg.adding_never_index_headers)
-  return adding_never_index_headers_.Add();
-}
- void HttpMsg::add_adding_never_index_headers(const ::std::string& value) {
-  adding_never_index_headers_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:HttpMsg.adding_never_index_headers)
-}
- void HttpMsg::add_adding_never_index_headers(const char* value) {
-  adding_never_index_headers_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:HttpMsg.adding_never_index_headers)
-}
- void HttpMsg::add_adding_never_index_headers(const char* value, size_t size) {
-  adding_never_index_headers_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:HttpMsg.adding_never_index_headers)
-}
- const ::google::protobuf::RepeatedPtrField< ::std::string>&
-HttpMsg::adding_never_index_headers() const {
-  // @@protoc_insertion_point(field_list:HttpMsg.adding_never_index_headers)
-  return adding_never_index_headers_;
-}
- ::google::protobuf::RepeatedPtrField< ::std::string>*
-HttpMsg::mutable_adding_never_index_headers() {
-  // @@protoc_insertion_point(field_mutable_list:HttpMsg.adding_never_index_headers)
-  return &adding_never_index_headers_;
-}
-
-// repeated string deleting_never_index_headers = 27;
-int HttpMsg::deleting_never_index_headers_size() const {
-  return deleting_never_index_headers_.size();
-}
-void HttpMsg::clear_deleting_never_index_headers() {
-  deleting_never_index_headers_.Clear();
-}
- const ::std::string& HttpMsg::deleting_never_index_headers(int index) const {
-  // @@protoc_insertion_point(field_get:HttpMsg.deleting_never_index_headers)
-  return deleting_never_index_headers_.Get(index);
-}
- ::std::string* HttpMsg::mutable_deleting_never_index_headers(int index) {
-  // @@protoc_insertion_point(field_mutable:HttpMsg.deleting_never_index_headers)
-  return deleting_never_index_headers_.Mutable(index);
-}
- void HttpMsg::set_deleting_never_index_headers(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:HttpMsg.deleting_never_index_headers)
-  deleting_never_index_headers_.Mutable(index)->assign(value);
-}
- void HttpMsg::set_deleting_never_index_headers(int index, const char* value) {
-  deleting_never_index_headers_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:HttpMsg.deleting_never_index_headers)
-}
- void HttpMsg::set_deleting_never_index_headers(int index, const char* value, size_t size) {
-  deleting_never_index_headers_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.deleting_never_index_headers)
-}
- ::std::string* HttpMsg::add_deleting_never_index_headers() {
-  // @@protoc_insertion_point(field_add_mutable:HttpMsg.deleting_never_index_headers)
-  return deleting_never_index_headers_.Add();
-}
- void HttpMsg::add_deleting_never_index_headers(const ::std::string& value) {
-  deleting_never_index_headers_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:HttpMsg.deleting_never_index_headers)
-}
- void HttpMsg::add_deleting_never_index_headers(const char* value) {
-  deleting_never_index_headers_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:HttpMsg.deleting_never_index_headers)
-}
- void HttpMsg::add_deleting_never_index_headers(const char* value, size_t size) {
-  deleting_never_index_headers_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:HttpMsg.deleting_never_index_headers)
-}
- const ::google::protobuf::RepeatedPtrField< ::std::string>&
-HttpMsg::deleting_never_index_headers() const {
-  // @@protoc_insertion_point(field_list:HttpMsg.deleting_never_index_headers)
-  return deleting_never_index_headers_;
-}
- ::google::protobuf::RepeatedPtrField< ::std::string>*
-HttpMsg::mutable_deleting_never_index_headers() {
-  // @@protoc_insertion_point(field_mutable_list:HttpMsg.deleting_never_index_headers)
-  return &deleting_never_index_headers_;
-}
-
-// optional uint32 dynamic_table_update_size = 28;
-void HttpMsg::clear_dynamic_table_update_size() {
-  dynamic_table_update_size_ = 0u;
-}
- ::google::protobuf::uint32 HttpMsg::dynamic_table_update_size() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.dynamic_table_update_size)
-  return dynamic_table_update_size_;
-}
- void HttpMsg::set_dynamic_table_update_size(::google::protobuf::uint32 value) {
-  
-  dynamic_table_update_size_ = value;
-  // @@protoc_insertion_point(field_set:HttpMsg.dynamic_table_update_size)
-}
-
-// optional bool with_huffman = 29;
-void HttpMsg::clear_with_huffman() {
-  with_huffman_ = false;
-}
- bool HttpMsg::with_huffman() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.with_huffman)
-  return with_huffman_;
-}
- void HttpMsg::set_with_huffman(bool value) {
-  
-  with_huffman_ = value;
-  // @@protoc_insertion_point(field_set:HttpMsg.with_huffman)
-}
-
-// optional string headers_frame_padding = 30;
-void HttpMsg::clear_headers_frame_padding() {
-  headers_frame_padding_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& HttpMsg::headers_frame_padding() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.headers_frame_padding)
-  return headers_frame_padding_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void HttpMsg::set_headers_frame_padding(const ::std::string& value) {
-  
-  headers_frame_padding_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HttpMsg.headers_frame_padding)
-}
- void HttpMsg::set_headers_frame_padding(const char* value) {
-  
-  headers_frame_padding_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HttpMsg.headers_frame_padding)
-}
- void HttpMsg::set_headers_frame_padding(const char* value, size_t size) {
-  
-  headers_frame_padding_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.headers_frame_padding)
-}
- ::std::string* HttpMsg::mutable_headers_frame_padding() {
-  
-  // @@protoc_insertion_point(field_mutable:HttpMsg.headers_frame_padding)
-  return headers_frame_padding_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* HttpMsg::release_headers_frame_padding() {
-  // @@protoc_insertion_point(field_release:HttpMsg.headers_frame_padding)
-  
-  return headers_frame_padding_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void HttpMsg::set_allocated_headers_frame_padding(::std::string* headers_frame_padding) {
-  if (headers_frame_padding != NULL) {
-    
-  } else {
-    
-  }
-  headers_frame_padding_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), headers_frame_padding);
-  // @@protoc_insertion_point(field_set_allocated:HttpMsg.headers_frame_padding)
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.headers_.InternalSwap(&other->_impl_.headers_);
+  _impl_.params_.InternalSwap(&other->_impl_.params_);
+  _impl_.pseudo_header_.InternalSwap(&other->_impl_.pseudo_header_);
+  _impl_.trailer_header_.InternalSwap(&other->_impl_.trailer_header_);
+  _impl_.adding_without_index_headers_.InternalSwap(&other->_impl_.adding_without_index_headers_);
+  _impl_.deleting_without_index_headers_.InternalSwap(&other->_impl_.deleting_without_index_headers_);
+  _impl_.adding_never_index_headers_.InternalSwap(&other->_impl_.adding_never_index_headers_);
+  _impl_.deleting_never_index_headers_.InternalSwap(&other->_impl_.deleting_never_index_headers_);
+  _impl_.settings_.InternalSwap(&other->_impl_.settings_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.url_, lhs_arena,
+      &other->_impl_.url_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.body_, lhs_arena,
+      &other->_impl_.body_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.path_, lhs_arena,
+      &other->_impl_.path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.hpack_data_, lhs_arena,
+      &other->_impl_.hpack_data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.headers_frame_padding_, lhs_arena,
+      &other->_impl_.headers_frame_padding_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_frame_padding_, lhs_arena,
+      &other->_impl_.data_frame_padding_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.push_promise_frame_padding_, lhs_arena,
+      &other->_impl_.push_promise_frame_padding_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HttpMsg, _impl_.dynamic_table_update_size_)
+      + sizeof(HttpMsg::_impl_.dynamic_table_update_size_)
+      - PROTOBUF_FIELD_OFFSET(HttpMsg, _impl_.upgrade_)>(
+          reinterpret_cast<char*>(&_impl_.upgrade_),
+          reinterpret_cast<char*>(&other->_impl_.upgrade_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HttpMsg::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_http_2eproto_getter, &descriptor_table_http_2eproto_once,
+      file_level_metadata_http_2eproto[5]);
 }
 
-// optional string data_frame_padding = 31;
-void HttpMsg::clear_data_frame_padding() {
-  data_frame_padding_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& HttpMsg::data_frame_padding() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.data_frame_padding)
-  return data_frame_padding_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void HttpMsg::set_data_frame_padding(const ::std::string& value) {
-  
-  data_frame_padding_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HttpMsg.data_frame_padding)
-}
- void HttpMsg::set_data_frame_padding(const char* value) {
-  
-  data_frame_padding_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HttpMsg.data_frame_padding)
-}
- void HttpMsg::set_data_frame_padding(const char* value, size_t size) {
-  
-  data_frame_padding_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.data_frame_padding)
-}
- ::std::string* HttpMsg::mutable_data_frame_padding() {
-  
-  // @@protoc_insertion_point(field_mutable:HttpMsg.data_frame_padding)
-  return data_frame_padding_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* HttpMsg::release_data_frame_padding() {
-  // @@protoc_insertion_point(field_release:HttpMsg.data_frame_padding)
-  
-  return data_frame_padding_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void HttpMsg::set_allocated_data_frame_padding(::std::string* data_frame_padding) {
-  if (data_frame_padding != NULL) {
-    
-  } else {
-    
-  }
-  data_frame_padding_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data_frame_padding);
-  // @@protoc_insertion_point(field_set_allocated:HttpMsg.data_frame_padding)
-}
-
-// optional string push_promise_frame_padding = 32;
-void HttpMsg::clear_push_promise_frame_padding() {
-  push_promise_frame_padding_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& HttpMsg::push_promise_frame_padding() const {
-  // @@protoc_insertion_point(field_get:HttpMsg.push_promise_frame_padding)
-  return push_promise_frame_padding_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void HttpMsg::set_push_promise_frame_padding(const ::std::string& value) {
-  
-  push_promise_frame_padding_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HttpMsg.push_promise_frame_padding)
-}
- void HttpMsg::set_push_promise_frame_padding(const char* value) {
-  
-  push_promise_frame_padding_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HttpMsg.push_promise_frame_padding)
-}
- void HttpMsg::set_push_promise_frame_padding(const char* value, size_t size) {
-  
-  push_promise_frame_padding_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.push_promise_frame_padding)
-}
- ::std::string* HttpMsg::mutable_push_promise_frame_padding() {
-  
-  // @@protoc_insertion_point(field_mutable:HttpMsg.push_promise_frame_padding)
-  return push_promise_frame_padding_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* HttpMsg::release_push_promise_frame_padding() {
-  // @@protoc_insertion_point(field_release:HttpMsg.push_promise_frame_padding)
-  
-  return push_promise_frame_padding_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// @@protoc_insertion_point(namespace_scope)
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::HttpMsg_Header*
+Arena::CreateMaybeMessage< ::HttpMsg_Header >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HttpMsg_Header >(arena);
 }
- void HttpMsg::set_allocated_push_promise_frame_padding(::std::string* push_promise_frame_padding) {
-  if (push_promise_frame_padding != NULL) {
-    
-  } else {
-    
-  }
-  push_promise_frame_padding_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), push_promise_frame_padding);
-  // @@protoc_insertion_point(field_set_allocated:HttpMsg.push_promise_frame_padding)
+template<> PROTOBUF_NOINLINE ::HttpMsg_Upgrade*
+Arena::CreateMaybeMessage< ::HttpMsg_Upgrade >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HttpMsg_Upgrade >(arena);
 }
-
-// map<uint32, uint32> settings = 33;
-int HttpMsg::settings_size() const {
-  return settings_.size();
+template<> PROTOBUF_NOINLINE ::HttpMsg_HeadersEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::HttpMsg_HeadersEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HttpMsg_HeadersEntry_DoNotUse >(arena);
 }
-void HttpMsg::clear_settings() {
-  settings_.Clear();
+template<> PROTOBUF_NOINLINE ::HttpMsg_ParamsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::HttpMsg_ParamsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HttpMsg_ParamsEntry_DoNotUse >(arena);
 }
- const ::google::protobuf::Map< ::google::protobuf::uint32, ::google::protobuf::uint32 >&
-HttpMsg::settings() const {
-  // @@protoc_insertion_point(field_map:HttpMsg.settings)
-  return settings_.GetMap();
+template<> PROTOBUF_NOINLINE ::HttpMsg_SettingsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::HttpMsg_SettingsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HttpMsg_SettingsEntry_DoNotUse >(arena);
 }
- ::google::protobuf::Map< ::google::protobuf::uint32, ::google::protobuf::uint32 >*
-HttpMsg::mutable_settings() {
-  // @@protoc_insertion_point(field_mutable_map:HttpMsg.settings)
-  return settings_.MutableMap();
+template<> PROTOBUF_NOINLINE ::HttpMsg*
+Arena::CreateMaybeMessage< ::HttpMsg >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HttpMsg >(arena);
 }
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
-// @@protoc_insertion_point(namespace_scope)
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
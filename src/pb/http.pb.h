@@ -1,295 +1,611 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: http.proto
 
-#ifndef PROTOBUF_http_2eproto__INCLUDED
-#define PROTOBUF_http_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_http_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_http_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3000000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3000000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
-#include <google/protobuf/map.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
 #include <google/protobuf/map_field_inl.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
-// Internal implementation detail -- do not call these.
-void protobuf_AddDesc_http_2eproto();
-void protobuf_AssignDesc_http_2eproto();
-void protobuf_ShutdownFile_http_2eproto();
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_http_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_http_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_http_2eproto;
 class HttpMsg;
+struct HttpMsgDefaultTypeInternal;
+extern HttpMsgDefaultTypeInternal _HttpMsg_default_instance_;
 class HttpMsg_Header;
+struct HttpMsg_HeaderDefaultTypeInternal;
+extern HttpMsg_HeaderDefaultTypeInternal _HttpMsg_Header_default_instance_;
+class HttpMsg_HeadersEntry_DoNotUse;
+struct HttpMsg_HeadersEntry_DoNotUseDefaultTypeInternal;
+extern HttpMsg_HeadersEntry_DoNotUseDefaultTypeInternal _HttpMsg_HeadersEntry_DoNotUse_default_instance_;
+class HttpMsg_ParamsEntry_DoNotUse;
+struct HttpMsg_ParamsEntry_DoNotUseDefaultTypeInternal;
+extern HttpMsg_ParamsEntry_DoNotUseDefaultTypeInternal _HttpMsg_ParamsEntry_DoNotUse_default_instance_;
+class HttpMsg_SettingsEntry_DoNotUse;
+struct HttpMsg_SettingsEntry_DoNotUseDefaultTypeInternal;
+extern HttpMsg_SettingsEntry_DoNotUseDefaultTypeInternal _HttpMsg_SettingsEntry_DoNotUse_default_instance_;
 class HttpMsg_Upgrade;
+struct HttpMsg_UpgradeDefaultTypeInternal;
+extern HttpMsg_UpgradeDefaultTypeInternal _HttpMsg_Upgrade_default_instance_;
+PROTOBUF_NAMESPACE_OPEN
+template<> ::HttpMsg* Arena::CreateMaybeMessage<::HttpMsg>(Arena*);
+template<> ::HttpMsg_Header* Arena::CreateMaybeMessage<::HttpMsg_Header>(Arena*);
+template<> ::HttpMsg_HeadersEntry_DoNotUse* Arena::CreateMaybeMessage<::HttpMsg_HeadersEntry_DoNotUse>(Arena*);
+template<> ::HttpMsg_ParamsEntry_DoNotUse* Arena::CreateMaybeMessage<::HttpMsg_ParamsEntry_DoNotUse>(Arena*);
+template<> ::HttpMsg_SettingsEntry_DoNotUse* Arena::CreateMaybeMessage<::HttpMsg_SettingsEntry_DoNotUse>(Arena*);
+template<> ::HttpMsg_Upgrade* Arena::CreateMaybeMessage<::HttpMsg_Upgrade>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
 
 // ===================================================================
 
-class HttpMsg_Header : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:HttpMsg.Header) */ {
+class HttpMsg_Header final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:HttpMsg.Header) */ {
  public:
-  HttpMsg_Header();
-  virtual ~HttpMsg_Header();
+  inline HttpMsg_Header() : HttpMsg_Header(nullptr) {}
+  ~HttpMsg_Header() override;
+  explicit PROTOBUF_CONSTEXPR HttpMsg_Header(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   HttpMsg_Header(const HttpMsg_Header& from);
+  HttpMsg_Header(HttpMsg_Header&& from) noexcept
+    : HttpMsg_Header() {
+    *this = ::std::move(from);
+  }
 
   inline HttpMsg_Header& operator=(const HttpMsg_Header& from) {
     CopyFrom(from);
     return *this;
   }
+  inline HttpMsg_Header& operator=(HttpMsg_Header&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const HttpMsg_Header& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HttpMsg_Header& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HttpMsg_Header* internal_default_instance() {
+    return reinterpret_cast<const HttpMsg_Header*>(
+               &_HttpMsg_Header_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(HttpMsg_Header* other);
+  friend void swap(HttpMsg_Header& a, HttpMsg_Header& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HttpMsg_Header* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HttpMsg_Header* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline HttpMsg_Header* New() const { return New(NULL); }
-
-  HttpMsg_Header* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  HttpMsg_Header* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HttpMsg_Header>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const HttpMsg_Header& from);
-  void MergeFrom(const HttpMsg_Header& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HttpMsg_Header& from) {
+    HttpMsg_Header::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(HttpMsg_Header* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HttpMsg.Header";
   }
+  protected:
+  explicit HttpMsg_Header(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string name = 1;
+  enum : int {
+    kNameFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // string name = 1;
   void clear_name();
-  static const int kNameFieldNumber = 1;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
-
-  // optional string value = 2;
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string value = 2;
   void clear_value();
-  static const int kValueFieldNumber = 2;
-  const ::std::string& value() const;
-  void set_value(const ::std::string& value);
-  void set_value(const char* value);
-  void set_value(const char* value, size_t size);
-  ::std::string* mutable_value();
-  ::std::string* release_value();
-  void set_allocated_value(::std::string* value);
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
 
   // @@protoc_insertion_point(class_scope:HttpMsg.Header)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  ::google::protobuf::internal::ArenaStringPtr value_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_http_2eproto();
-  friend void protobuf_AssignDesc_http_2eproto();
-  friend void protobuf_ShutdownFile_http_2eproto();
-
-  void InitAsDefaultInstance();
-  static HttpMsg_Header* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_http_2eproto;
 };
 // -------------------------------------------------------------------
 
-class HttpMsg_Upgrade : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:HttpMsg.Upgrade) */ {
+class HttpMsg_Upgrade final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:HttpMsg.Upgrade) */ {
  public:
-  HttpMsg_Upgrade();
-  virtual ~HttpMsg_Upgrade();
+  inline HttpMsg_Upgrade() : HttpMsg_Upgrade(nullptr) {}
+  ~HttpMsg_Upgrade() override;
+  explicit PROTOBUF_CONSTEXPR HttpMsg_Upgrade(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   HttpMsg_Upgrade(const HttpMsg_Upgrade& from);
+  HttpMsg_Upgrade(HttpMsg_Upgrade&& from) noexcept
+    : HttpMsg_Upgrade() {
+    *this = ::std::move(from);
+  }
 
   inline HttpMsg_Upgrade& operator=(const HttpMsg_Upgrade& from) {
     CopyFrom(from);
     return *this;
   }
+  inline HttpMsg_Upgrade& operator=(HttpMsg_Upgrade&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const HttpMsg_Upgrade& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HttpMsg_Upgrade& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HttpMsg_Upgrade* internal_default_instance() {
+    return reinterpret_cast<const HttpMsg_Upgrade*>(
+               &_HttpMsg_Upgrade_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(HttpMsg_Upgrade* other);
+  friend void swap(HttpMsg_Upgrade& a, HttpMsg_Upgrade& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HttpMsg_Upgrade* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HttpMsg_Upgrade* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline HttpMsg_Upgrade* New() const { return New(NULL); }
-
-  HttpMsg_Upgrade* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  HttpMsg_Upgrade* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HttpMsg_Upgrade>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const HttpMsg_Upgrade& from);
-  void MergeFrom(const HttpMsg_Upgrade& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HttpMsg_Upgrade& from) {
+    HttpMsg_Upgrade::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(HttpMsg_Upgrade* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HttpMsg.Upgrade";
   }
+  protected:
+  explicit HttpMsg_Upgrade(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional bool is_upgrade = 1;
+  enum : int {
+    kProtocolFieldNumber = 2,
+    kIsUpgradeFieldNumber = 1,
+  };
+  // string protocol = 2;
+  void clear_protocol();
+  const std::string& protocol() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_protocol(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_protocol();
+  PROTOBUF_NODISCARD std::string* release_protocol();
+  void set_allocated_protocol(std::string* protocol);
+  private:
+  const std::string& _internal_protocol() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_protocol(const std::string& value);
+  std::string* _internal_mutable_protocol();
+  public:
+
+  // bool is_upgrade = 1;
   void clear_is_upgrade();
-  static const int kIsUpgradeFieldNumber = 1;
   bool is_upgrade() const;
   void set_is_upgrade(bool value);
-
-  // optional string protocol = 2;
-  void clear_protocol();
-  static const int kProtocolFieldNumber = 2;
-  const ::std::string& protocol() const;
-  void set_protocol(const ::std::string& value);
-  void set_protocol(const char* value);
-  void set_protocol(const char* value, size_t size);
-  ::std::string* mutable_protocol();
-  ::std::string* release_protocol();
-  void set_allocated_protocol(::std::string* protocol);
+  private:
+  bool _internal_is_upgrade() const;
+  void _internal_set_is_upgrade(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:HttpMsg.Upgrade)
  private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr protocol_;
+    bool is_upgrade_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_http_2eproto;
+};
+// -------------------------------------------------------------------
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr protocol_;
-  bool is_upgrade_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_http_2eproto();
-  friend void protobuf_AssignDesc_http_2eproto();
-  friend void protobuf_ShutdownFile_http_2eproto();
-
-  void InitAsDefaultInstance();
-  static HttpMsg_Upgrade* default_instance_;
+class HttpMsg_HeadersEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<HttpMsg_HeadersEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<HttpMsg_HeadersEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  HttpMsg_HeadersEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR HttpMsg_HeadersEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit HttpMsg_HeadersEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const HttpMsg_HeadersEntry_DoNotUse& other);
+  static const HttpMsg_HeadersEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const HttpMsg_HeadersEntry_DoNotUse*>(&_HttpMsg_HeadersEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "HttpMsg.HeadersEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "HttpMsg.HeadersEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_http_2eproto;
 };
+
 // -------------------------------------------------------------------
 
-class HttpMsg : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:HttpMsg) */ {
+class HttpMsg_ParamsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<HttpMsg_ParamsEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<HttpMsg_ParamsEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  HttpMsg_ParamsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR HttpMsg_ParamsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit HttpMsg_ParamsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const HttpMsg_ParamsEntry_DoNotUse& other);
+  static const HttpMsg_ParamsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const HttpMsg_ParamsEntry_DoNotUse*>(&_HttpMsg_ParamsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "HttpMsg.ParamsEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "HttpMsg.ParamsEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_http_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class HttpMsg_SettingsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<HttpMsg_SettingsEntry_DoNotUse, 
+    uint32_t, uint32_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<HttpMsg_SettingsEntry_DoNotUse, 
+    uint32_t, uint32_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32> SuperType;
+  HttpMsg_SettingsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR HttpMsg_SettingsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit HttpMsg_SettingsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const HttpMsg_SettingsEntry_DoNotUse& other);
+  static const HttpMsg_SettingsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const HttpMsg_SettingsEntry_DoNotUse*>(&_HttpMsg_SettingsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_http_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class HttpMsg final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:HttpMsg) */ {
  public:
-  HttpMsg();
-  virtual ~HttpMsg();
+  inline HttpMsg() : HttpMsg(nullptr) {}
+  ~HttpMsg() override;
+  explicit PROTOBUF_CONSTEXPR HttpMsg(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   HttpMsg(const HttpMsg& from);
+  HttpMsg(HttpMsg&& from) noexcept
+    : HttpMsg() {
+    *this = ::std::move(from);
+  }
 
   inline HttpMsg& operator=(const HttpMsg& from) {
     CopyFrom(from);
     return *this;
   }
+  inline HttpMsg& operator=(HttpMsg&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const HttpMsg& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HttpMsg& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HttpMsg* internal_default_instance() {
+    return reinterpret_cast<const HttpMsg*>(
+               &_HttpMsg_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
 
-  void Swap(HttpMsg* other);
+  friend void swap(HttpMsg& a, HttpMsg& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HttpMsg* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HttpMsg* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline HttpMsg* New() const { return New(NULL); }
-
-  HttpMsg* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  HttpMsg* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HttpMsg>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const HttpMsg& from);
-  void MergeFrom(const HttpMsg& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HttpMsg& from) {
+    HttpMsg::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(HttpMsg* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HttpMsg";
   }
+  protected:
+  explicit HttpMsg(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -298,451 +614,617 @@ class HttpMsg : public ::google::protobuf::Message /* @@protoc_insertion_point(c
 
   // accessors -------------------------------------------------------
 
-  // optional int32 type = 1;
-  void clear_type();
-  static const int kTypeFieldNumber = 1;
-  ::google::protobuf::int32 type() const;
-  void set_type(::google::protobuf::int32 value);
-
-  // optional int32 http_major = 2;
-  void clear_http_major();
-  static const int kHttpMajorFieldNumber = 2;
-  ::google::protobuf::int32 http_major() const;
-  void set_http_major(::google::protobuf::int32 value);
-
-  // optional int32 http_minor = 3;
-  void clear_http_minor();
-  static const int kHttpMinorFieldNumber = 3;
-  ::google::protobuf::int32 http_minor() const;
-  void set_http_minor(::google::protobuf::int32 value);
-
-  // optional int32 content_length = 4;
-  void clear_content_length();
-  static const int kContentLengthFieldNumber = 4;
-  ::google::protobuf::int32 content_length() const;
-  void set_content_length(::google::protobuf::int32 value);
-
-  // optional int32 method = 5;
-  void clear_method();
-  static const int kMethodFieldNumber = 5;
-  ::google::protobuf::int32 method() const;
-  void set_method(::google::protobuf::int32 value);
-
-  // optional int32 status_code = 6;
-  void clear_status_code();
-  static const int kStatusCodeFieldNumber = 6;
-  ::google::protobuf::int32 status_code() const;
-  void set_status_code(::google::protobuf::int32 value);
-
-  // optional int32 encoding = 7;
-  void clear_encoding();
-  static const int kEncodingFieldNumber = 7;
-  ::google::protobuf::int32 encoding() const;
-  void set_encoding(::google::protobuf::int32 value);
-
-  // optional string url = 8;
-  void clear_url();
-  static const int kUrlFieldNumber = 8;
-  const ::std::string& url() const;
-  void set_url(const ::std::string& value);
-  void set_url(const char* value);
-  void set_url(const char* value, size_t size);
-  ::std::string* mutable_url();
-  ::std::string* release_url();
-  void set_allocated_url(::std::string* url);
-
+  enum : int {
+    kHeadersFieldNumber = 9,
+    kParamsFieldNumber = 11,
+    kPseudoHeaderFieldNumber = 21,
+    kTrailerHeaderFieldNumber = 22,
+    kAddingWithoutIndexHeadersFieldNumber = 24,
+    kDeletingWithoutIndexHeadersFieldNumber = 25,
+    kAddingNeverIndexHeadersFieldNumber = 26,
+    kDeletingNeverIndexHeadersFieldNumber = 27,
+    kSettingsFieldNumber = 33,
+    kUrlFieldNumber = 8,
+    kBodyFieldNumber = 10,
+    kPathFieldNumber = 14,
+    kHpackDataFieldNumber = 23,
+    kHeadersFramePaddingFieldNumber = 30,
+    kDataFramePaddingFieldNumber = 31,
+    kPushPromiseFramePaddingFieldNumber = 32,
+    kUpgradeFieldNumber = 12,
+    kTypeFieldNumber = 1,
+    kHttpMajorFieldNumber = 2,
+    kHttpMinorFieldNumber = 3,
+    kContentLengthFieldNumber = 4,
+    kMethodFieldNumber = 5,
+    kStatusCodeFieldNumber = 6,
+    kEncodingFieldNumber = 7,
+    kKeepAliveFieldNumber = 13,
+    kStreamIdFieldNumber = 20,
+    kIsDecodingFieldNumber = 15,
+    kChunkNoticeFieldNumber = 19,
+    kWithHuffmanFieldNumber = 29,
+    kDynamicTableUpdateSizeFieldNumber = 28,
+  };
   // map<string, string> headers = 9;
   int headers_size() const;
+  private:
+  int _internal_headers_size() const;
+  public:
   void clear_headers();
-  static const int kHeadersFieldNumber = 9;
-  const ::google::protobuf::Map< ::std::string, ::std::string >&
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_headers() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_headers();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
       headers() const;
-  ::google::protobuf::Map< ::std::string, ::std::string >*
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
       mutable_headers();
 
-  // optional bytes body = 10;
-  void clear_body();
-  static const int kBodyFieldNumber = 10;
-  const ::std::string& body() const;
-  void set_body(const ::std::string& value);
-  void set_body(const char* value);
-  void set_body(const void* value, size_t size);
-  ::std::string* mutable_body();
-  ::std::string* release_body();
-  void set_allocated_body(::std::string* body);
-
   // map<string, string> params = 11;
   int params_size() const;
+  private:
+  int _internal_params_size() const;
+  public:
   void clear_params();
-  static const int kParamsFieldNumber = 11;
-  const ::google::protobuf::Map< ::std::string, ::std::string >&
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_params() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_params();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
       params() const;
-  ::google::protobuf::Map< ::std::string, ::std::string >*
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
       mutable_params();
 
-  // optional .HttpMsg.Upgrade upgrade = 12;
-  bool has_upgrade() const;
-  void clear_upgrade();
-  static const int kUpgradeFieldNumber = 12;
-  const ::HttpMsg_Upgrade& upgrade() const;
-  ::HttpMsg_Upgrade* mutable_upgrade();
-  ::HttpMsg_Upgrade* release_upgrade();
-  void set_allocated_upgrade(::HttpMsg_Upgrade* upgrade);
-
-  // optional float keep_alive = 13;
-  void clear_keep_alive();
-  static const int kKeepAliveFieldNumber = 13;
-  float keep_alive() const;
-  void set_keep_alive(float value);
-
-  // optional string path = 14;
-  void clear_path();
-  static const int kPathFieldNumber = 14;
-  const ::std::string& path() const;
-  void set_path(const ::std::string& value);
-  void set_path(const char* value);
-  void set_path(const char* value, size_t size);
-  ::std::string* mutable_path();
-  ::std::string* release_path();
-  void set_allocated_path(::std::string* path);
-
-  // optional bool is_decoding = 15;
-  void clear_is_decoding();
-  static const int kIsDecodingFieldNumber = 15;
-  bool is_decoding() const;
-  void set_is_decoding(bool value);
-
-  // optional bool chunk_notice = 19;
-  void clear_chunk_notice();
-  static const int kChunkNoticeFieldNumber = 19;
-  bool chunk_notice() const;
-  void set_chunk_notice(bool value);
-
-  // optional uint32 stream_id = 20;
-  void clear_stream_id();
-  static const int kStreamIdFieldNumber = 20;
-  ::google::protobuf::uint32 stream_id() const;
-  void set_stream_id(::google::protobuf::uint32 value);
-
   // repeated .HttpMsg.Header pseudo_header = 21;
   int pseudo_header_size() const;
+  private:
+  int _internal_pseudo_header_size() const;
+  public:
   void clear_pseudo_header();
-  static const int kPseudoHeaderFieldNumber = 21;
-  const ::HttpMsg_Header& pseudo_header(int index) const;
   ::HttpMsg_Header* mutable_pseudo_header(int index);
-  ::HttpMsg_Header* add_pseudo_header();
-  ::google::protobuf::RepeatedPtrField< ::HttpMsg_Header >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HttpMsg_Header >*
       mutable_pseudo_header();
-  const ::google::protobuf::RepeatedPtrField< ::HttpMsg_Header >&
+  private:
+  const ::HttpMsg_Header& _internal_pseudo_header(int index) const;
+  ::HttpMsg_Header* _internal_add_pseudo_header();
+  public:
+  const ::HttpMsg_Header& pseudo_header(int index) const;
+  ::HttpMsg_Header* add_pseudo_header();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HttpMsg_Header >&
       pseudo_header() const;
 
   // repeated .HttpMsg.Header trailer_header = 22;
   int trailer_header_size() const;
+  private:
+  int _internal_trailer_header_size() const;
+  public:
   void clear_trailer_header();
-  static const int kTrailerHeaderFieldNumber = 22;
-  const ::HttpMsg_Header& trailer_header(int index) const;
   ::HttpMsg_Header* mutable_trailer_header(int index);
-  ::HttpMsg_Header* add_trailer_header();
-  ::google::protobuf::RepeatedPtrField< ::HttpMsg_Header >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HttpMsg_Header >*
       mutable_trailer_header();
-  const ::google::protobuf::RepeatedPtrField< ::HttpMsg_Header >&
+  private:
+  const ::HttpMsg_Header& _internal_trailer_header(int index) const;
+  ::HttpMsg_Header* _internal_add_trailer_header();
+  public:
+  const ::HttpMsg_Header& trailer_header(int index) const;
+  ::HttpMsg_Header* add_trailer_header();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HttpMsg_Header >&
       trailer_header() const;
 
-  // optional string hpack_data = 23;
-  void clear_hpack_data();
-  static const int kHpackDataFieldNumber = 23;
-  const ::std::string& hpack_data() const;
-  void set_hpack_data(const ::std::string& value);
-  void set_hpack_data(const char* value);
-  void set_hpack_data(const char* value, size_t size);
-  ::std::string* mutable_hpack_data();
-  ::std::string* release_hpack_data();
-  void set_allocated_hpack_data(::std::string* hpack_data);
-
   // repeated string adding_without_index_headers = 24;
   int adding_without_index_headers_size() const;
+  private:
+  int _internal_adding_without_index_headers_size() const;
+  public:
   void clear_adding_without_index_headers();
-  static const int kAddingWithoutIndexHeadersFieldNumber = 24;
-  const ::std::string& adding_without_index_headers(int index) const;
-  ::std::string* mutable_adding_without_index_headers(int index);
-  void set_adding_without_index_headers(int index, const ::std::string& value);
+  const std::string& adding_without_index_headers(int index) const;
+  std::string* mutable_adding_without_index_headers(int index);
+  void set_adding_without_index_headers(int index, const std::string& value);
+  void set_adding_without_index_headers(int index, std::string&& value);
   void set_adding_without_index_headers(int index, const char* value);
   void set_adding_without_index_headers(int index, const char* value, size_t size);
-  ::std::string* add_adding_without_index_headers();
-  void add_adding_without_index_headers(const ::std::string& value);
+  std::string* add_adding_without_index_headers();
+  void add_adding_without_index_headers(const std::string& value);
+  void add_adding_without_index_headers(std::string&& value);
   void add_adding_without_index_headers(const char* value);
   void add_adding_without_index_headers(const char* value, size_t size);
-  const ::google::protobuf::RepeatedPtrField< ::std::string>& adding_without_index_headers() const;
-  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_adding_without_index_headers();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& adding_without_index_headers() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_adding_without_index_headers();
+  private:
+  const std::string& _internal_adding_without_index_headers(int index) const;
+  std::string* _internal_add_adding_without_index_headers();
+  public:
 
   // repeated string deleting_without_index_headers = 25;
   int deleting_without_index_headers_size() const;
+  private:
+  int _internal_deleting_without_index_headers_size() const;
+  public:
   void clear_deleting_without_index_headers();
-  static const int kDeletingWithoutIndexHeadersFieldNumber = 25;
-  const ::std::string& deleting_without_index_headers(int index) const;
-  ::std::string* mutable_deleting_without_index_headers(int index);
-  void set_deleting_without_index_headers(int index, const ::std::string& value);
+  const std::string& deleting_without_index_headers(int index) const;
+  std::string* mutable_deleting_without_index_headers(int index);
+  void set_deleting_without_index_headers(int index, const std::string& value);
+  void set_deleting_without_index_headers(int index, std::string&& value);
   void set_deleting_without_index_headers(int index, const char* value);
   void set_deleting_without_index_headers(int index, const char* value, size_t size);
-  ::std::string* add_deleting_without_index_headers();
-  void add_deleting_without_index_headers(const ::std::string& value);
+  std::string* add_deleting_without_index_headers();
+  void add_deleting_without_index_headers(const std::string& value);
+  void add_deleting_without_index_headers(std::string&& value);
   void add_deleting_without_index_headers(const char* value);
   void add_deleting_without_index_headers(const char* value, size_t size);
-  const ::google::protobuf::RepeatedPtrField< ::std::string>& deleting_without_index_headers() const;
-  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_deleting_without_index_headers();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& deleting_without_index_headers() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_deleting_without_index_headers();
+  private:
+  const std::string& _internal_deleting_without_index_headers(int index) const;
+  std::string* _internal_add_deleting_without_index_headers();
+  public:
 
   // repeated string adding_never_index_headers = 26;
   int adding_never_index_headers_size() const;
+  private:
+  int _internal_adding_never_index_headers_size() const;
+  public:
   void clear_adding_never_index_headers();
-  static const int kAddingNeverIndexHeadersFieldNumber = 26;
-  const ::std::string& adding_never_index_headers(int index) const;
-  ::std::string* mutable_adding_never_index_headers(int index);
-  void set_adding_never_index_headers(int index, const ::std::string& value);
+  const std::string& adding_never_index_headers(int index) const;
+  std::string* mutable_adding_never_index_headers(int index);
+  void set_adding_never_index_headers(int index, const std::string& value);
+  void set_adding_never_index_headers(int index, std::string&& value);
   void set_adding_never_index_headers(int index, const char* value);
   void set_adding_never_index_headers(int index, const char* value, size_t size);
-  ::std::string* add_adding_never_index_headers();
-  void add_adding_never_index_headers(const ::std::string& value);
+  std::string* add_adding_never_index_headers();
+  void add_adding_never_index_headers(const std::string& value);
+  void add_adding_never_index_headers(std::string&& value);
   void add_adding_never_index_headers(const char* value);
   void add_adding_never_index_headers(const char* value, size_t size);
-  const ::google::protobuf::RepeatedPtrField< ::std::string>& adding_never_index_headers() const;
-  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_adding_never_index_headers();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& adding_never_index_headers() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_adding_never_index_headers();
+  private:
+  const std::string& _internal_adding_never_index_headers(int index) const;
+  std::string* _internal_add_adding_never_index_headers();
+  public:
 
   // repeated string deleting_never_index_headers = 27;
   int deleting_never_index_headers_size() const;
+  private:
+  int _internal_deleting_never_index_headers_size() const;
+  public:
   void clear_deleting_never_index_headers();
-  static const int kDeletingNeverIndexHeadersFieldNumber = 27;
-  const ::std::string& deleting_never_index_headers(int index) const;
-  ::std::string* mutable_deleting_never_index_headers(int index);
-  void set_deleting_never_index_headers(int index, const ::std::string& value);
+  const std::string& deleting_never_index_headers(int index) const;
+  std::string* mutable_deleting_never_index_headers(int index);
+  void set_deleting_never_index_headers(int index, const std::string& value);
+  void set_deleting_never_index_headers(int index, std::string&& value);
   void set_deleting_never_index_headers(int index, const char* value);
   void set_deleting_never_index_headers(int index, const char* value, size_t size);
-  ::std::string* add_deleting_never_index_headers();
-  void add_deleting_never_index_headers(const ::std::string& value);
+  std::string* add_deleting_never_index_headers();
+  void add_deleting_never_index_headers(const std::string& value);
+  void add_deleting_never_index_headers(std::string&& value);
   void add_deleting_never_index_headers(const char* value);
   void add_deleting_never_index_headers(const char* value, size_t size);
-  const ::google::protobuf::RepeatedPtrField< ::std::string>& deleting_never_index_headers() const;
-  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_deleting_never_index_headers();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& deleting_never_index_headers() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_deleting_never_index_headers();
+  private:
+  const std::string& _internal_deleting_never_index_headers(int index) const;
+  std::string* _internal_add_deleting_never_index_headers();
+  public:
 
-  // optional uint32 dynamic_table_update_size = 28;
-  void clear_dynamic_table_update_size();
-  static const int kDynamicTableUpdateSizeFieldNumber = 28;
-  ::google::protobuf::uint32 dynamic_table_update_size() const;
-  void set_dynamic_table_update_size(::google::protobuf::uint32 value);
+  // map<uint32, uint32> settings = 33;
+  int settings_size() const;
+  private:
+  int _internal_settings_size() const;
+  public:
+  void clear_settings();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint32_t >&
+      _internal_settings() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint32_t >*
+      _internal_mutable_settings();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint32_t >&
+      settings() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint32_t >*
+      mutable_settings();
 
-  // optional bool with_huffman = 29;
-  void clear_with_huffman();
-  static const int kWithHuffmanFieldNumber = 29;
-  bool with_huffman() const;
-  void set_with_huffman(bool value);
+  // string url = 8;
+  void clear_url();
+  const std::string& url() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_url(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_url();
+  PROTOBUF_NODISCARD std::string* release_url();
+  void set_allocated_url(std::string* url);
+  private:
+  const std::string& _internal_url() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_url(const std::string& value);
+  std::string* _internal_mutable_url();
+  public:
+
+  // bytes body = 10;
+  void clear_body();
+  const std::string& body() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_body(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_body();
+  PROTOBUF_NODISCARD std::string* release_body();
+  void set_allocated_body(std::string* body);
+  private:
+  const std::string& _internal_body() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_body(const std::string& value);
+  std::string* _internal_mutable_body();
+  public:
+
+  // string path = 14;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // string hpack_data = 23;
+  void clear_hpack_data();
+  const std::string& hpack_data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hpack_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hpack_data();
+  PROTOBUF_NODISCARD std::string* release_hpack_data();
+  void set_allocated_hpack_data(std::string* hpack_data);
+  private:
+  const std::string& _internal_hpack_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hpack_data(const std::string& value);
+  std::string* _internal_mutable_hpack_data();
+  public:
 
-  // optional string headers_frame_padding = 30;
+  // string headers_frame_padding = 30;
   void clear_headers_frame_padding();
-  static const int kHeadersFramePaddingFieldNumber = 30;
-  const ::std::string& headers_frame_padding() const;
-  void set_headers_frame_padding(const ::std::string& value);
-  void set_headers_frame_padding(const char* value);
-  void set_headers_frame_padding(const char* value, size_t size);
-  ::std::string* mutable_headers_frame_padding();
-  ::std::string* release_headers_frame_padding();
-  void set_allocated_headers_frame_padding(::std::string* headers_frame_padding);
-
-  // optional string data_frame_padding = 31;
+  const std::string& headers_frame_padding() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_headers_frame_padding(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_headers_frame_padding();
+  PROTOBUF_NODISCARD std::string* release_headers_frame_padding();
+  void set_allocated_headers_frame_padding(std::string* headers_frame_padding);
+  private:
+  const std::string& _internal_headers_frame_padding() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_headers_frame_padding(const std::string& value);
+  std::string* _internal_mutable_headers_frame_padding();
+  public:
+
+  // string data_frame_padding = 31;
   void clear_data_frame_padding();
-  static const int kDataFramePaddingFieldNumber = 31;
-  const ::std::string& data_frame_padding() const;
-  void set_data_frame_padding(const ::std::string& value);
-  void set_data_frame_padding(const char* value);
-  void set_data_frame_padding(const char* value, size_t size);
-  ::std::string* mutable_data_frame_padding();
-  ::std::string* release_data_frame_padding();
-  void set_allocated_data_frame_padding(::std::string* data_frame_padding);
-
-  // optional string push_promise_frame_padding = 32;
+  const std::string& data_frame_padding() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data_frame_padding(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data_frame_padding();
+  PROTOBUF_NODISCARD std::string* release_data_frame_padding();
+  void set_allocated_data_frame_padding(std::string* data_frame_padding);
+  private:
+  const std::string& _internal_data_frame_padding() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data_frame_padding(const std::string& value);
+  std::string* _internal_mutable_data_frame_padding();
+  public:
+
+  // string push_promise_frame_padding = 32;
   void clear_push_promise_frame_padding();
-  static const int kPushPromiseFramePaddingFieldNumber = 32;
-  const ::std::string& push_promise_frame_padding() const;
-  void set_push_promise_frame_padding(const ::std::string& value);
-  void set_push_promise_frame_padding(const char* value);
-  void set_push_promise_frame_padding(const char* value, size_t size);
-  ::std::string* mutable_push_promise_frame_padding();
-  ::std::string* release_push_promise_frame_padding();
-  void set_allocated_push_promise_frame_padding(::std::string* push_promise_frame_padding);
+  const std::string& push_promise_frame_padding() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_push_promise_frame_padding(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_push_promise_frame_padding();
+  PROTOBUF_NODISCARD std::string* release_push_promise_frame_padding();
+  void set_allocated_push_promise_frame_padding(std::string* push_promise_frame_padding);
+  private:
+  const std::string& _internal_push_promise_frame_padding() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_push_promise_frame_padding(const std::string& value);
+  std::string* _internal_mutable_push_promise_frame_padding();
+  public:
 
-  // map<uint32, uint32> settings = 33;
-  int settings_size() const;
-  void clear_settings();
-  static const int kSettingsFieldNumber = 33;
-  const ::google::protobuf::Map< ::google::protobuf::uint32, ::google::protobuf::uint32 >&
-      settings() const;
-  ::google::protobuf::Map< ::google::protobuf::uint32, ::google::protobuf::uint32 >*
-      mutable_settings();
+  // .HttpMsg.Upgrade upgrade = 12;
+  bool has_upgrade() const;
+  private:
+  bool _internal_has_upgrade() const;
+  public:
+  void clear_upgrade();
+  const ::HttpMsg_Upgrade& upgrade() const;
+  PROTOBUF_NODISCARD ::HttpMsg_Upgrade* release_upgrade();
+  ::HttpMsg_Upgrade* mutable_upgrade();
+  void set_allocated_upgrade(::HttpMsg_Upgrade* upgrade);
+  private:
+  const ::HttpMsg_Upgrade& _internal_upgrade() const;
+  ::HttpMsg_Upgrade* _internal_mutable_upgrade();
+  public:
+  void unsafe_arena_set_allocated_upgrade(
+      ::HttpMsg_Upgrade* upgrade);
+  ::HttpMsg_Upgrade* unsafe_arena_release_upgrade();
+
+  // int32 type = 1;
+  void clear_type();
+  int32_t type() const;
+  void set_type(int32_t value);
+  private:
+  int32_t _internal_type() const;
+  void _internal_set_type(int32_t value);
+  public:
+
+  // int32 http_major = 2;
+  void clear_http_major();
+  int32_t http_major() const;
+  void set_http_major(int32_t value);
+  private:
+  int32_t _internal_http_major() const;
+  void _internal_set_http_major(int32_t value);
+  public:
+
+  // int32 http_minor = 3;
+  void clear_http_minor();
+  int32_t http_minor() const;
+  void set_http_minor(int32_t value);
+  private:
+  int32_t _internal_http_minor() const;
+  void _internal_set_http_minor(int32_t value);
+  public:
+
+  // int32 content_length = 4;
+  void clear_content_length();
+  int32_t content_length() const;
+  void set_content_length(int32_t value);
+  private:
+  int32_t _internal_content_length() const;
+  void _internal_set_content_length(int32_t value);
+  public:
+
+  // int32 method = 5;
+  void clear_method();
+  int32_t method() const;
+  void set_method(int32_t value);
+  private:
+  int32_t _internal_method() const;
+  void _internal_set_method(int32_t value);
+  public:
+
+  // int32 status_code = 6;
+  void clear_status_code();
+  int32_t status_code() const;
+  void set_status_code(int32_t value);
+  private:
+  int32_t _internal_status_code() const;
+  void _internal_set_status_code(int32_t value);
+  public:
+
+  // int32 encoding = 7;
+  void clear_encoding();
+  int32_t encoding() const;
+  void set_encoding(int32_t value);
+  private:
+  int32_t _internal_encoding() const;
+  void _internal_set_encoding(int32_t value);
+  public:
+
+  // float keep_alive = 13;
+  void clear_keep_alive();
+  float keep_alive() const;
+  void set_keep_alive(float value);
+  private:
+  float _internal_keep_alive() const;
+  void _internal_set_keep_alive(float value);
+  public:
+
+  // uint32 stream_id = 20;
+  void clear_stream_id();
+  uint32_t stream_id() const;
+  void set_stream_id(uint32_t value);
+  private:
+  uint32_t _internal_stream_id() const;
+  void _internal_set_stream_id(uint32_t value);
+  public:
+
+  // bool is_decoding = 15;
+  void clear_is_decoding();
+  bool is_decoding() const;
+  void set_is_decoding(bool value);
+  private:
+  bool _internal_is_decoding() const;
+  void _internal_set_is_decoding(bool value);
+  public:
+
+  // bool chunk_notice = 19;
+  void clear_chunk_notice();
+  bool chunk_notice() const;
+  void set_chunk_notice(bool value);
+  private:
+  bool _internal_chunk_notice() const;
+  void _internal_set_chunk_notice(bool value);
+  public:
+
+  // bool with_huffman = 29;
+  void clear_with_huffman();
+  bool with_huffman() const;
+  void set_with_huffman(bool value);
+  private:
+  bool _internal_with_huffman() const;
+  void _internal_set_with_huffman(bool value);
+  public:
+
+  // uint32 dynamic_table_update_size = 28;
+  void clear_dynamic_table_update_size();
+  uint32_t dynamic_table_update_size() const;
+  void set_dynamic_table_update_size(uint32_t value);
+  private:
+  uint32_t _internal_dynamic_table_update_size() const;
+  void _internal_set_dynamic_table_update_size(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:HttpMsg)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::int32 type_;
-  ::google::protobuf::int32 http_major_;
-  ::google::protobuf::int32 http_minor_;
-  ::google::protobuf::int32 content_length_;
-  ::google::protobuf::int32 method_;
-  ::google::protobuf::int32 status_code_;
-  ::google::protobuf::internal::ArenaStringPtr url_;
-  typedef ::google::protobuf::internal::MapEntryLite<
-      ::std::string, ::std::string,
-      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-      0 >
-      HttpMsg_HeadersEntry;
-  ::google::protobuf::internal::MapField<
-      ::std::string, ::std::string,
-      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-      0 > headers_;
-  ::google::protobuf::internal::ArenaStringPtr body_;
-  ::google::protobuf::int32 encoding_;
-  float keep_alive_;
-  typedef ::google::protobuf::internal::MapEntryLite<
-      ::std::string, ::std::string,
-      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-      0 >
-      HttpMsg_ParamsEntry;
-  ::google::protobuf::internal::MapField<
-      ::std::string, ::std::string,
-      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-      0 > params_;
-  ::HttpMsg_Upgrade* upgrade_;
-  ::google::protobuf::internal::ArenaStringPtr path_;
-  ::google::protobuf::RepeatedPtrField< ::HttpMsg_Header > pseudo_header_;
-  ::google::protobuf::uint32 stream_id_;
-  bool is_decoding_;
-  bool chunk_notice_;
-  bool with_huffman_;
-  ::google::protobuf::RepeatedPtrField< ::HttpMsg_Header > trailer_header_;
-  ::google::protobuf::internal::ArenaStringPtr hpack_data_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> adding_without_index_headers_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> deleting_without_index_headers_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> adding_never_index_headers_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> deleting_never_index_headers_;
-  ::google::protobuf::internal::ArenaStringPtr headers_frame_padding_;
-  ::google::protobuf::internal::ArenaStringPtr data_frame_padding_;
-  ::google::protobuf::internal::ArenaStringPtr push_promise_frame_padding_;
-  typedef ::google::protobuf::internal::MapEntryLite<
-      ::google::protobuf::uint32, ::google::protobuf::uint32,
-      ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
-      ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
-      0 >
-      HttpMsg_SettingsEntry;
-  ::google::protobuf::internal::MapField<
-      ::google::protobuf::uint32, ::google::protobuf::uint32,
-      ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
-      ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
-      0 > settings_;
-  ::google::protobuf::uint32 dynamic_table_update_size_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_http_2eproto();
-  friend void protobuf_AssignDesc_http_2eproto();
-  friend void protobuf_ShutdownFile_http_2eproto();
-
-  void InitAsDefaultInstance();
-  static HttpMsg* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        HttpMsg_HeadersEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> headers_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        HttpMsg_ParamsEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> params_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HttpMsg_Header > pseudo_header_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HttpMsg_Header > trailer_header_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> adding_without_index_headers_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> deleting_without_index_headers_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> adding_never_index_headers_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> deleting_never_index_headers_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        HttpMsg_SettingsEntry_DoNotUse,
+        uint32_t, uint32_t,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32> settings_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr url_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hpack_data_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr headers_frame_padding_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_frame_padding_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr push_promise_frame_padding_;
+    ::HttpMsg_Upgrade* upgrade_;
+    int32_t type_;
+    int32_t http_major_;
+    int32_t http_minor_;
+    int32_t content_length_;
+    int32_t method_;
+    int32_t status_code_;
+    int32_t encoding_;
+    float keep_alive_;
+    uint32_t stream_id_;
+    bool is_decoding_;
+    bool chunk_notice_;
+    bool with_huffman_;
+    uint32_t dynamic_table_update_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_http_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
-#if !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // HttpMsg_Header
 
-// optional string name = 1;
+// string name = 1;
 inline void HttpMsg_Header::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
-inline const ::std::string& HttpMsg_Header::name() const {
+inline const std::string& HttpMsg_Header::name() const {
   // @@protoc_insertion_point(field_get:HttpMsg.Header.name)
-  return name_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_name();
 }
-inline void HttpMsg_Header::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HttpMsg_Header::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:HttpMsg.Header.name)
 }
-inline void HttpMsg_Header::set_name(const char* value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HttpMsg.Header.name)
+inline std::string* HttpMsg_Header::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:HttpMsg.Header.name)
+  return _s;
 }
-inline void HttpMsg_Header::set_name(const char* value, size_t size) {
+inline const std::string& HttpMsg_Header::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void HttpMsg_Header::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.Header.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* HttpMsg_Header::mutable_name() {
+inline std::string* HttpMsg_Header::_internal_mutable_name() {
   
-  // @@protoc_insertion_point(field_mutable:HttpMsg.Header.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* HttpMsg_Header::release_name() {
+inline std::string* HttpMsg_Header::release_name() {
   // @@protoc_insertion_point(field_release:HttpMsg.Header.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
-inline void HttpMsg_Header::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void HttpMsg_Header::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:HttpMsg.Header.name)
 }
 
-// optional string value = 2;
+// string value = 2;
 inline void HttpMsg_Header::clear_value() {
-  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.value_.ClearToEmpty();
 }
-inline const ::std::string& HttpMsg_Header::value() const {
+inline const std::string& HttpMsg_Header::value() const {
   // @@protoc_insertion_point(field_get:HttpMsg.Header.value)
-  return value_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_value();
 }
-inline void HttpMsg_Header::set_value(const ::std::string& value) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HttpMsg_Header::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:HttpMsg.Header.value)
 }
-inline void HttpMsg_Header::set_value(const char* value) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HttpMsg.Header.value)
+inline std::string* HttpMsg_Header::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:HttpMsg.Header.value)
+  return _s;
+}
+inline const std::string& HttpMsg_Header::_internal_value() const {
+  return _impl_.value_.Get();
 }
-inline void HttpMsg_Header::set_value(const char* value, size_t size) {
+inline void HttpMsg_Header::_internal_set_value(const std::string& value) {
   
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.Header.value)
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* HttpMsg_Header::mutable_value() {
+inline std::string* HttpMsg_Header::_internal_mutable_value() {
   
-  // @@protoc_insertion_point(field_mutable:HttpMsg.Header.value)
-  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* HttpMsg_Header::release_value() {
+inline std::string* HttpMsg_Header::release_value() {
   // @@protoc_insertion_point(field_release:HttpMsg.Header.value)
-  
-  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.value_.Release();
 }
-inline void HttpMsg_Header::set_allocated_value(::std::string* value) {
-  if (value != NULL) {
+inline void HttpMsg_Header::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
     
   } else {
     
   }
-  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:HttpMsg.Header.value)
 }
 
@@ -750,931 +1232,1262 @@ inline void HttpMsg_Header::set_allocated_value(::std::string* value) {
 
 // HttpMsg_Upgrade
 
-// optional bool is_upgrade = 1;
+// bool is_upgrade = 1;
 inline void HttpMsg_Upgrade::clear_is_upgrade() {
-  is_upgrade_ = false;
+  _impl_.is_upgrade_ = false;
+}
+inline bool HttpMsg_Upgrade::_internal_is_upgrade() const {
+  return _impl_.is_upgrade_;
 }
 inline bool HttpMsg_Upgrade::is_upgrade() const {
   // @@protoc_insertion_point(field_get:HttpMsg.Upgrade.is_upgrade)
-  return is_upgrade_;
+  return _internal_is_upgrade();
 }
-inline void HttpMsg_Upgrade::set_is_upgrade(bool value) {
+inline void HttpMsg_Upgrade::_internal_set_is_upgrade(bool value) {
   
-  is_upgrade_ = value;
+  _impl_.is_upgrade_ = value;
+}
+inline void HttpMsg_Upgrade::set_is_upgrade(bool value) {
+  _internal_set_is_upgrade(value);
   // @@protoc_insertion_point(field_set:HttpMsg.Upgrade.is_upgrade)
 }
 
-// optional string protocol = 2;
+// string protocol = 2;
 inline void HttpMsg_Upgrade::clear_protocol() {
-  protocol_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.protocol_.ClearToEmpty();
 }
-inline const ::std::string& HttpMsg_Upgrade::protocol() const {
+inline const std::string& HttpMsg_Upgrade::protocol() const {
   // @@protoc_insertion_point(field_get:HttpMsg.Upgrade.protocol)
-  return protocol_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_protocol();
 }
-inline void HttpMsg_Upgrade::set_protocol(const ::std::string& value) {
-  
-  protocol_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HttpMsg_Upgrade::set_protocol(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.protocol_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:HttpMsg.Upgrade.protocol)
 }
-inline void HttpMsg_Upgrade::set_protocol(const char* value) {
-  
-  protocol_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HttpMsg.Upgrade.protocol)
+inline std::string* HttpMsg_Upgrade::mutable_protocol() {
+  std::string* _s = _internal_mutable_protocol();
+  // @@protoc_insertion_point(field_mutable:HttpMsg.Upgrade.protocol)
+  return _s;
 }
-inline void HttpMsg_Upgrade::set_protocol(const char* value, size_t size) {
+inline const std::string& HttpMsg_Upgrade::_internal_protocol() const {
+  return _impl_.protocol_.Get();
+}
+inline void HttpMsg_Upgrade::_internal_set_protocol(const std::string& value) {
   
-  protocol_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.Upgrade.protocol)
+  _impl_.protocol_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* HttpMsg_Upgrade::mutable_protocol() {
+inline std::string* HttpMsg_Upgrade::_internal_mutable_protocol() {
   
-  // @@protoc_insertion_point(field_mutable:HttpMsg.Upgrade.protocol)
-  return protocol_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.protocol_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* HttpMsg_Upgrade::release_protocol() {
+inline std::string* HttpMsg_Upgrade::release_protocol() {
   // @@protoc_insertion_point(field_release:HttpMsg.Upgrade.protocol)
-  
-  return protocol_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.protocol_.Release();
 }
-inline void HttpMsg_Upgrade::set_allocated_protocol(::std::string* protocol) {
-  if (protocol != NULL) {
+inline void HttpMsg_Upgrade::set_allocated_protocol(std::string* protocol) {
+  if (protocol != nullptr) {
     
   } else {
     
   }
-  protocol_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), protocol);
+  _impl_.protocol_.SetAllocated(protocol, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.protocol_.IsDefault()) {
+    _impl_.protocol_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:HttpMsg.Upgrade.protocol)
 }
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 // HttpMsg
 
-// optional int32 type = 1;
+// int32 type = 1;
 inline void HttpMsg::clear_type() {
-  type_ = 0;
+  _impl_.type_ = 0;
+}
+inline int32_t HttpMsg::_internal_type() const {
+  return _impl_.type_;
 }
-inline ::google::protobuf::int32 HttpMsg::type() const {
+inline int32_t HttpMsg::type() const {
   // @@protoc_insertion_point(field_get:HttpMsg.type)
-  return type_;
+  return _internal_type();
 }
-inline void HttpMsg::set_type(::google::protobuf::int32 value) {
+inline void HttpMsg::_internal_set_type(int32_t value) {
   
-  type_ = value;
+  _impl_.type_ = value;
+}
+inline void HttpMsg::set_type(int32_t value) {
+  _internal_set_type(value);
   // @@protoc_insertion_point(field_set:HttpMsg.type)
 }
 
-// optional int32 http_major = 2;
+// int32 http_major = 2;
 inline void HttpMsg::clear_http_major() {
-  http_major_ = 0;
+  _impl_.http_major_ = 0;
+}
+inline int32_t HttpMsg::_internal_http_major() const {
+  return _impl_.http_major_;
 }
-inline ::google::protobuf::int32 HttpMsg::http_major() const {
+inline int32_t HttpMsg::http_major() const {
   // @@protoc_insertion_point(field_get:HttpMsg.http_major)
-  return http_major_;
+  return _internal_http_major();
 }
-inline void HttpMsg::set_http_major(::google::protobuf::int32 value) {
+inline void HttpMsg::_internal_set_http_major(int32_t value) {
   
-  http_major_ = value;
+  _impl_.http_major_ = value;
+}
+inline void HttpMsg::set_http_major(int32_t value) {
+  _internal_set_http_major(value);
   // @@protoc_insertion_point(field_set:HttpMsg.http_major)
 }
 
-// optional int32 http_minor = 3;
+// int32 http_minor = 3;
 inline void HttpMsg::clear_http_minor() {
-  http_minor_ = 0;
+  _impl_.http_minor_ = 0;
+}
+inline int32_t HttpMsg::_internal_http_minor() const {
+  return _impl_.http_minor_;
 }
-inline ::google::protobuf::int32 HttpMsg::http_minor() const {
+inline int32_t HttpMsg::http_minor() const {
   // @@protoc_insertion_point(field_get:HttpMsg.http_minor)
-  return http_minor_;
+  return _internal_http_minor();
 }
-inline void HttpMsg::set_http_minor(::google::protobuf::int32 value) {
+inline void HttpMsg::_internal_set_http_minor(int32_t value) {
   
-  http_minor_ = value;
+  _impl_.http_minor_ = value;
+}
+inline void HttpMsg::set_http_minor(int32_t value) {
+  _internal_set_http_minor(value);
   // @@protoc_insertion_point(field_set:HttpMsg.http_minor)
 }
 
-// optional int32 content_length = 4;
+// int32 content_length = 4;
 inline void HttpMsg::clear_content_length() {
-  content_length_ = 0;
+  _impl_.content_length_ = 0;
+}
+inline int32_t HttpMsg::_internal_content_length() const {
+  return _impl_.content_length_;
 }
-inline ::google::protobuf::int32 HttpMsg::content_length() const {
+inline int32_t HttpMsg::content_length() const {
   // @@protoc_insertion_point(field_get:HttpMsg.content_length)
-  return content_length_;
+  return _internal_content_length();
 }
-inline void HttpMsg::set_content_length(::google::protobuf::int32 value) {
+inline void HttpMsg::_internal_set_content_length(int32_t value) {
   
-  content_length_ = value;
+  _impl_.content_length_ = value;
+}
+inline void HttpMsg::set_content_length(int32_t value) {
+  _internal_set_content_length(value);
   // @@protoc_insertion_point(field_set:HttpMsg.content_length)
 }
 
-// optional int32 method = 5;
+// int32 method = 5;
 inline void HttpMsg::clear_method() {
-  method_ = 0;
+  _impl_.method_ = 0;
+}
+inline int32_t HttpMsg::_internal_method() const {
+  return _impl_.method_;
 }
-inline ::google::protobuf::int32 HttpMsg::method() const {
+inline int32_t HttpMsg::method() const {
   // @@protoc_insertion_point(field_get:HttpMsg.method)
-  return method_;
+  return _internal_method();
 }
-inline void HttpMsg::set_method(::google::protobuf::int32 value) {
+inline void HttpMsg::_internal_set_method(int32_t value) {
   
-  method_ = value;
+  _impl_.method_ = value;
+}
+inline void HttpMsg::set_method(int32_t value) {
+  _internal_set_method(value);
   // @@protoc_insertion_point(field_set:HttpMsg.method)
 }
 
-// optional int32 status_code = 6;
+// int32 status_code = 6;
 inline void HttpMsg::clear_status_code() {
-  status_code_ = 0;
+  _impl_.status_code_ = 0;
+}
+inline int32_t HttpMsg::_internal_status_code() const {
+  return _impl_.status_code_;
 }
-inline ::google::protobuf::int32 HttpMsg::status_code() const {
+inline int32_t HttpMsg::status_code() const {
   // @@protoc_insertion_point(field_get:HttpMsg.status_code)
-  return status_code_;
+  return _internal_status_code();
 }
-inline void HttpMsg::set_status_code(::google::protobuf::int32 value) {
+inline void HttpMsg::_internal_set_status_code(int32_t value) {
   
-  status_code_ = value;
+  _impl_.status_code_ = value;
+}
+inline void HttpMsg::set_status_code(int32_t value) {
+  _internal_set_status_code(value);
   // @@protoc_insertion_point(field_set:HttpMsg.status_code)
 }
 
-// optional int32 encoding = 7;
+// int32 encoding = 7;
 inline void HttpMsg::clear_encoding() {
-  encoding_ = 0;
+  _impl_.encoding_ = 0;
+}
+inline int32_t HttpMsg::_internal_encoding() const {
+  return _impl_.encoding_;
 }
-inline ::google::protobuf::int32 HttpMsg::encoding() const {
+inline int32_t HttpMsg::encoding() const {
   // @@protoc_insertion_point(field_get:HttpMsg.encoding)
-  return encoding_;
+  return _internal_encoding();
 }
-inline void HttpMsg::set_encoding(::google::protobuf::int32 value) {
+inline void HttpMsg::_internal_set_encoding(int32_t value) {
   
-  encoding_ = value;
+  _impl_.encoding_ = value;
+}
+inline void HttpMsg::set_encoding(int32_t value) {
+  _internal_set_encoding(value);
   // @@protoc_insertion_point(field_set:HttpMsg.encoding)
 }
 
-// optional string url = 8;
+// string url = 8;
 inline void HttpMsg::clear_url() {
-  url_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.url_.ClearToEmpty();
 }
-inline const ::std::string& HttpMsg::url() const {
+inline const std::string& HttpMsg::url() const {
   // @@protoc_insertion_point(field_get:HttpMsg.url)
-  return url_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_url();
 }
-inline void HttpMsg::set_url(const ::std::string& value) {
-  
-  url_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HttpMsg::set_url(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.url_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:HttpMsg.url)
 }
-inline void HttpMsg::set_url(const char* value) {
-  
-  url_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HttpMsg.url)
+inline std::string* HttpMsg::mutable_url() {
+  std::string* _s = _internal_mutable_url();
+  // @@protoc_insertion_point(field_mutable:HttpMsg.url)
+  return _s;
 }
-inline void HttpMsg::set_url(const char* value, size_t size) {
+inline const std::string& HttpMsg::_internal_url() const {
+  return _impl_.url_.Get();
+}
+inline void HttpMsg::_internal_set_url(const std::string& value) {
   
-  url_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.url)
+  _impl_.url_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* HttpMsg::mutable_url() {
+inline std::string* HttpMsg::_internal_mutable_url() {
   
-  // @@protoc_insertion_point(field_mutable:HttpMsg.url)
-  return url_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.url_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* HttpMsg::release_url() {
+inline std::string* HttpMsg::release_url() {
   // @@protoc_insertion_point(field_release:HttpMsg.url)
-  
-  return url_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.url_.Release();
 }
-inline void HttpMsg::set_allocated_url(::std::string* url) {
-  if (url != NULL) {
+inline void HttpMsg::set_allocated_url(std::string* url) {
+  if (url != nullptr) {
     
   } else {
     
   }
-  url_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), url);
+  _impl_.url_.SetAllocated(url, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.url_.IsDefault()) {
+    _impl_.url_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:HttpMsg.url)
 }
 
 // map<string, string> headers = 9;
+inline int HttpMsg::_internal_headers_size() const {
+  return _impl_.headers_.size();
+}
 inline int HttpMsg::headers_size() const {
-  return headers_.size();
+  return _internal_headers_size();
 }
 inline void HttpMsg::clear_headers() {
-  headers_.Clear();
+  _impl_.headers_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+HttpMsg::_internal_headers() const {
+  return _impl_.headers_.GetMap();
 }
-inline const ::google::protobuf::Map< ::std::string, ::std::string >&
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
 HttpMsg::headers() const {
   // @@protoc_insertion_point(field_map:HttpMsg.headers)
-  return headers_.GetMap();
+  return _internal_headers();
 }
-inline ::google::protobuf::Map< ::std::string, ::std::string >*
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+HttpMsg::_internal_mutable_headers() {
+  return _impl_.headers_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
 HttpMsg::mutable_headers() {
   // @@protoc_insertion_point(field_mutable_map:HttpMsg.headers)
-  return headers_.MutableMap();
+  return _internal_mutable_headers();
 }
 
-// optional bytes body = 10;
+// bytes body = 10;
 inline void HttpMsg::clear_body() {
-  body_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.body_.ClearToEmpty();
 }
-inline const ::std::string& HttpMsg::body() const {
+inline const std::string& HttpMsg::body() const {
   // @@protoc_insertion_point(field_get:HttpMsg.body)
-  return body_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_body();
 }
-inline void HttpMsg::set_body(const ::std::string& value) {
-  
-  body_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HttpMsg::set_body(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.body_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:HttpMsg.body)
 }
-inline void HttpMsg::set_body(const char* value) {
-  
-  body_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HttpMsg.body)
+inline std::string* HttpMsg::mutable_body() {
+  std::string* _s = _internal_mutable_body();
+  // @@protoc_insertion_point(field_mutable:HttpMsg.body)
+  return _s;
+}
+inline const std::string& HttpMsg::_internal_body() const {
+  return _impl_.body_.Get();
 }
-inline void HttpMsg::set_body(const void* value, size_t size) {
+inline void HttpMsg::_internal_set_body(const std::string& value) {
   
-  body_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.body)
+  _impl_.body_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* HttpMsg::mutable_body() {
+inline std::string* HttpMsg::_internal_mutable_body() {
   
-  // @@protoc_insertion_point(field_mutable:HttpMsg.body)
-  return body_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.body_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* HttpMsg::release_body() {
+inline std::string* HttpMsg::release_body() {
   // @@protoc_insertion_point(field_release:HttpMsg.body)
-  
-  return body_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.body_.Release();
 }
-inline void HttpMsg::set_allocated_body(::std::string* body) {
-  if (body != NULL) {
+inline void HttpMsg::set_allocated_body(std::string* body) {
+  if (body != nullptr) {
     
   } else {
     
   }
-  body_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), body);
+  _impl_.body_.SetAllocated(body, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:HttpMsg.body)
 }
 
 // map<string, string> params = 11;
+inline int HttpMsg::_internal_params_size() const {
+  return _impl_.params_.size();
+}
 inline int HttpMsg::params_size() const {
-  return params_.size();
+  return _internal_params_size();
 }
 inline void HttpMsg::clear_params() {
-  params_.Clear();
+  _impl_.params_.Clear();
 }
-inline const ::google::protobuf::Map< ::std::string, ::std::string >&
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+HttpMsg::_internal_params() const {
+  return _impl_.params_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
 HttpMsg::params() const {
   // @@protoc_insertion_point(field_map:HttpMsg.params)
-  return params_.GetMap();
+  return _internal_params();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+HttpMsg::_internal_mutable_params() {
+  return _impl_.params_.MutableMap();
 }
-inline ::google::protobuf::Map< ::std::string, ::std::string >*
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
 HttpMsg::mutable_params() {
   // @@protoc_insertion_point(field_mutable_map:HttpMsg.params)
-  return params_.MutableMap();
+  return _internal_mutable_params();
 }
 
-// optional .HttpMsg.Upgrade upgrade = 12;
+// .HttpMsg.Upgrade upgrade = 12;
+inline bool HttpMsg::_internal_has_upgrade() const {
+  return this != internal_default_instance() && _impl_.upgrade_ != nullptr;
+}
 inline bool HttpMsg::has_upgrade() const {
-  return !_is_default_instance_ && upgrade_ != NULL;
+  return _internal_has_upgrade();
 }
 inline void HttpMsg::clear_upgrade() {
-  if (GetArenaNoVirtual() == NULL && upgrade_ != NULL) delete upgrade_;
-  upgrade_ = NULL;
+  if (GetArenaForAllocation() == nullptr && _impl_.upgrade_ != nullptr) {
+    delete _impl_.upgrade_;
+  }
+  _impl_.upgrade_ = nullptr;
+}
+inline const ::HttpMsg_Upgrade& HttpMsg::_internal_upgrade() const {
+  const ::HttpMsg_Upgrade* p = _impl_.upgrade_;
+  return p != nullptr ? *p : reinterpret_cast<const ::HttpMsg_Upgrade&>(
+      ::_HttpMsg_Upgrade_default_instance_);
 }
 inline const ::HttpMsg_Upgrade& HttpMsg::upgrade() const {
   // @@protoc_insertion_point(field_get:HttpMsg.upgrade)
-  return upgrade_ != NULL ? *upgrade_ : *default_instance_->upgrade_;
+  return _internal_upgrade();
 }
-inline ::HttpMsg_Upgrade* HttpMsg::mutable_upgrade() {
-  
-  if (upgrade_ == NULL) {
-    upgrade_ = new ::HttpMsg_Upgrade;
+inline void HttpMsg::unsafe_arena_set_allocated_upgrade(
+    ::HttpMsg_Upgrade* upgrade) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.upgrade_);
   }
-  // @@protoc_insertion_point(field_mutable:HttpMsg.upgrade)
-  return upgrade_;
+  _impl_.upgrade_ = upgrade;
+  if (upgrade) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:HttpMsg.upgrade)
 }
 inline ::HttpMsg_Upgrade* HttpMsg::release_upgrade() {
+  
+  ::HttpMsg_Upgrade* temp = _impl_.upgrade_;
+  _impl_.upgrade_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::HttpMsg_Upgrade* HttpMsg::unsafe_arena_release_upgrade() {
   // @@protoc_insertion_point(field_release:HttpMsg.upgrade)
   
-  ::HttpMsg_Upgrade* temp = upgrade_;
-  upgrade_ = NULL;
+  ::HttpMsg_Upgrade* temp = _impl_.upgrade_;
+  _impl_.upgrade_ = nullptr;
   return temp;
 }
+inline ::HttpMsg_Upgrade* HttpMsg::_internal_mutable_upgrade() {
+  
+  if (_impl_.upgrade_ == nullptr) {
+    auto* p = CreateMaybeMessage<::HttpMsg_Upgrade>(GetArenaForAllocation());
+    _impl_.upgrade_ = p;
+  }
+  return _impl_.upgrade_;
+}
+inline ::HttpMsg_Upgrade* HttpMsg::mutable_upgrade() {
+  ::HttpMsg_Upgrade* _msg = _internal_mutable_upgrade();
+  // @@protoc_insertion_point(field_mutable:HttpMsg.upgrade)
+  return _msg;
+}
 inline void HttpMsg::set_allocated_upgrade(::HttpMsg_Upgrade* upgrade) {
-  delete upgrade_;
-  upgrade_ = upgrade;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.upgrade_;
+  }
   if (upgrade) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(upgrade);
+    if (message_arena != submessage_arena) {
+      upgrade = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, upgrade, submessage_arena);
+    }
     
   } else {
     
   }
+  _impl_.upgrade_ = upgrade;
   // @@protoc_insertion_point(field_set_allocated:HttpMsg.upgrade)
 }
 
-// optional float keep_alive = 13;
+// float keep_alive = 13;
 inline void HttpMsg::clear_keep_alive() {
-  keep_alive_ = 0;
+  _impl_.keep_alive_ = 0;
+}
+inline float HttpMsg::_internal_keep_alive() const {
+  return _impl_.keep_alive_;
 }
 inline float HttpMsg::keep_alive() const {
   // @@protoc_insertion_point(field_get:HttpMsg.keep_alive)
-  return keep_alive_;
+  return _internal_keep_alive();
 }
-inline void HttpMsg::set_keep_alive(float value) {
+inline void HttpMsg::_internal_set_keep_alive(float value) {
   
-  keep_alive_ = value;
+  _impl_.keep_alive_ = value;
+}
+inline void HttpMsg::set_keep_alive(float value) {
+  _internal_set_keep_alive(value);
   // @@protoc_insertion_point(field_set:HttpMsg.keep_alive)
 }
 
-// optional string path = 14;
+// string path = 14;
 inline void HttpMsg::clear_path() {
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.path_.ClearToEmpty();
 }
-inline const ::std::string& HttpMsg::path() const {
+inline const std::string& HttpMsg::path() const {
   // @@protoc_insertion_point(field_get:HttpMsg.path)
-  return path_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_path();
 }
-inline void HttpMsg::set_path(const ::std::string& value) {
-  
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HttpMsg::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:HttpMsg.path)
 }
-inline void HttpMsg::set_path(const char* value) {
-  
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HttpMsg.path)
+inline std::string* HttpMsg::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:HttpMsg.path)
+  return _s;
 }
-inline void HttpMsg::set_path(const char* value, size_t size) {
+inline const std::string& HttpMsg::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void HttpMsg::_internal_set_path(const std::string& value) {
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.path)
+  _impl_.path_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* HttpMsg::mutable_path() {
+inline std::string* HttpMsg::_internal_mutable_path() {
   
-  // @@protoc_insertion_point(field_mutable:HttpMsg.path)
-  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.path_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* HttpMsg::release_path() {
+inline std::string* HttpMsg::release_path() {
   // @@protoc_insertion_point(field_release:HttpMsg.path)
-  
-  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.path_.Release();
 }
-inline void HttpMsg::set_allocated_path(::std::string* path) {
-  if (path != NULL) {
+inline void HttpMsg::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
     
   } else {
     
   }
-  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:HttpMsg.path)
 }
 
-// optional bool is_decoding = 15;
+// bool is_decoding = 15;
 inline void HttpMsg::clear_is_decoding() {
-  is_decoding_ = false;
+  _impl_.is_decoding_ = false;
+}
+inline bool HttpMsg::_internal_is_decoding() const {
+  return _impl_.is_decoding_;
 }
 inline bool HttpMsg::is_decoding() const {
   // @@protoc_insertion_point(field_get:HttpMsg.is_decoding)
-  return is_decoding_;
+  return _internal_is_decoding();
 }
-inline void HttpMsg::set_is_decoding(bool value) {
+inline void HttpMsg::_internal_set_is_decoding(bool value) {
   
-  is_decoding_ = value;
+  _impl_.is_decoding_ = value;
+}
+inline void HttpMsg::set_is_decoding(bool value) {
+  _internal_set_is_decoding(value);
   // @@protoc_insertion_point(field_set:HttpMsg.is_decoding)
 }
 
-// optional bool chunk_notice = 19;
+// bool chunk_notice = 19;
 inline void HttpMsg::clear_chunk_notice() {
-  chunk_notice_ = false;
+  _impl_.chunk_notice_ = false;
+}
+inline bool HttpMsg::_internal_chunk_notice() const {
+  return _impl_.chunk_notice_;
 }
 inline bool HttpMsg::chunk_notice() const {
   // @@protoc_insertion_point(field_get:HttpMsg.chunk_notice)
-  return chunk_notice_;
+  return _internal_chunk_notice();
 }
-inline void HttpMsg::set_chunk_notice(bool value) {
+inline void HttpMsg::_internal_set_chunk_notice(bool value) {
   
-  chunk_notice_ = value;
+  _impl_.chunk_notice_ = value;
+}
+inline void HttpMsg::set_chunk_notice(bool value) {
+  _internal_set_chunk_notice(value);
   // @@protoc_insertion_point(field_set:HttpMsg.chunk_notice)
 }
 
-// optional uint32 stream_id = 20;
+// uint32 stream_id = 20;
 inline void HttpMsg::clear_stream_id() {
-  stream_id_ = 0u;
+  _impl_.stream_id_ = 0u;
 }
-inline ::google::protobuf::uint32 HttpMsg::stream_id() const {
+inline uint32_t HttpMsg::_internal_stream_id() const {
+  return _impl_.stream_id_;
+}
+inline uint32_t HttpMsg::stream_id() const {
   // @@protoc_insertion_point(field_get:HttpMsg.stream_id)
-  return stream_id_;
+  return _internal_stream_id();
 }
-inline void HttpMsg::set_stream_id(::google::protobuf::uint32 value) {
+inline void HttpMsg::_internal_set_stream_id(uint32_t value) {
   
-  stream_id_ = value;
+  _impl_.stream_id_ = value;
+}
+inline void HttpMsg::set_stream_id(uint32_t value) {
+  _internal_set_stream_id(value);
   // @@protoc_insertion_point(field_set:HttpMsg.stream_id)
 }
 
 // repeated .HttpMsg.Header pseudo_header = 21;
+inline int HttpMsg::_internal_pseudo_header_size() const {
+  return _impl_.pseudo_header_.size();
+}
 inline int HttpMsg::pseudo_header_size() const {
-  return pseudo_header_.size();
+  return _internal_pseudo_header_size();
 }
 inline void HttpMsg::clear_pseudo_header() {
-  pseudo_header_.Clear();
+  _impl_.pseudo_header_.Clear();
+}
+inline ::HttpMsg_Header* HttpMsg::mutable_pseudo_header(int index) {
+  // @@protoc_insertion_point(field_mutable:HttpMsg.pseudo_header)
+  return _impl_.pseudo_header_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HttpMsg_Header >*
+HttpMsg::mutable_pseudo_header() {
+  // @@protoc_insertion_point(field_mutable_list:HttpMsg.pseudo_header)
+  return &_impl_.pseudo_header_;
+}
+inline const ::HttpMsg_Header& HttpMsg::_internal_pseudo_header(int index) const {
+  return _impl_.pseudo_header_.Get(index);
 }
 inline const ::HttpMsg_Header& HttpMsg::pseudo_header(int index) const {
   // @@protoc_insertion_point(field_get:HttpMsg.pseudo_header)
-  return pseudo_header_.Get(index);
+  return _internal_pseudo_header(index);
 }
-inline ::HttpMsg_Header* HttpMsg::mutable_pseudo_header(int index) {
-  // @@protoc_insertion_point(field_mutable:HttpMsg.pseudo_header)
-  return pseudo_header_.Mutable(index);
+inline ::HttpMsg_Header* HttpMsg::_internal_add_pseudo_header() {
+  return _impl_.pseudo_header_.Add();
 }
 inline ::HttpMsg_Header* HttpMsg::add_pseudo_header() {
+  ::HttpMsg_Header* _add = _internal_add_pseudo_header();
   // @@protoc_insertion_point(field_add:HttpMsg.pseudo_header)
-  return pseudo_header_.Add();
-}
-inline ::google::protobuf::RepeatedPtrField< ::HttpMsg_Header >*
-HttpMsg::mutable_pseudo_header() {
-  // @@protoc_insertion_point(field_mutable_list:HttpMsg.pseudo_header)
-  return &pseudo_header_;
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::HttpMsg_Header >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HttpMsg_Header >&
 HttpMsg::pseudo_header() const {
   // @@protoc_insertion_point(field_list:HttpMsg.pseudo_header)
-  return pseudo_header_;
+  return _impl_.pseudo_header_;
 }
 
 // repeated .HttpMsg.Header trailer_header = 22;
+inline int HttpMsg::_internal_trailer_header_size() const {
+  return _impl_.trailer_header_.size();
+}
 inline int HttpMsg::trailer_header_size() const {
-  return trailer_header_.size();
+  return _internal_trailer_header_size();
 }
 inline void HttpMsg::clear_trailer_header() {
-  trailer_header_.Clear();
+  _impl_.trailer_header_.Clear();
+}
+inline ::HttpMsg_Header* HttpMsg::mutable_trailer_header(int index) {
+  // @@protoc_insertion_point(field_mutable:HttpMsg.trailer_header)
+  return _impl_.trailer_header_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HttpMsg_Header >*
+HttpMsg::mutable_trailer_header() {
+  // @@protoc_insertion_point(field_mutable_list:HttpMsg.trailer_header)
+  return &_impl_.trailer_header_;
+}
+inline const ::HttpMsg_Header& HttpMsg::_internal_trailer_header(int index) const {
+  return _impl_.trailer_header_.Get(index);
 }
 inline const ::HttpMsg_Header& HttpMsg::trailer_header(int index) const {
   // @@protoc_insertion_point(field_get:HttpMsg.trailer_header)
-  return trailer_header_.Get(index);
+  return _internal_trailer_header(index);
 }
-inline ::HttpMsg_Header* HttpMsg::mutable_trailer_header(int index) {
-  // @@protoc_insertion_point(field_mutable:HttpMsg.trailer_header)
-  return trailer_header_.Mutable(index);
+inline ::HttpMsg_Header* HttpMsg::_internal_add_trailer_header() {
+  return _impl_.trailer_header_.Add();
 }
 inline ::HttpMsg_Header* HttpMsg::add_trailer_header() {
+  ::HttpMsg_Header* _add = _internal_add_trailer_header();
   // @@protoc_insertion_point(field_add:HttpMsg.trailer_header)
-  return trailer_header_.Add();
-}
-inline ::google::protobuf::RepeatedPtrField< ::HttpMsg_Header >*
-HttpMsg::mutable_trailer_header() {
-  // @@protoc_insertion_point(field_mutable_list:HttpMsg.trailer_header)
-  return &trailer_header_;
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::HttpMsg_Header >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HttpMsg_Header >&
 HttpMsg::trailer_header() const {
   // @@protoc_insertion_point(field_list:HttpMsg.trailer_header)
-  return trailer_header_;
+  return _impl_.trailer_header_;
 }
 
-// optional string hpack_data = 23;
+// string hpack_data = 23;
 inline void HttpMsg::clear_hpack_data() {
-  hpack_data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.hpack_data_.ClearToEmpty();
 }
-inline const ::std::string& HttpMsg::hpack_data() const {
+inline const std::string& HttpMsg::hpack_data() const {
   // @@protoc_insertion_point(field_get:HttpMsg.hpack_data)
-  return hpack_data_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_hpack_data();
 }
-inline void HttpMsg::set_hpack_data(const ::std::string& value) {
-  
-  hpack_data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HttpMsg::set_hpack_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.hpack_data_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:HttpMsg.hpack_data)
 }
-inline void HttpMsg::set_hpack_data(const char* value) {
-  
-  hpack_data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HttpMsg.hpack_data)
+inline std::string* HttpMsg::mutable_hpack_data() {
+  std::string* _s = _internal_mutable_hpack_data();
+  // @@protoc_insertion_point(field_mutable:HttpMsg.hpack_data)
+  return _s;
 }
-inline void HttpMsg::set_hpack_data(const char* value, size_t size) {
+inline const std::string& HttpMsg::_internal_hpack_data() const {
+  return _impl_.hpack_data_.Get();
+}
+inline void HttpMsg::_internal_set_hpack_data(const std::string& value) {
   
-  hpack_data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.hpack_data)
+  _impl_.hpack_data_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* HttpMsg::mutable_hpack_data() {
+inline std::string* HttpMsg::_internal_mutable_hpack_data() {
   
-  // @@protoc_insertion_point(field_mutable:HttpMsg.hpack_data)
-  return hpack_data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.hpack_data_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* HttpMsg::release_hpack_data() {
+inline std::string* HttpMsg::release_hpack_data() {
   // @@protoc_insertion_point(field_release:HttpMsg.hpack_data)
-  
-  return hpack_data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.hpack_data_.Release();
 }
-inline void HttpMsg::set_allocated_hpack_data(::std::string* hpack_data) {
-  if (hpack_data != NULL) {
+inline void HttpMsg::set_allocated_hpack_data(std::string* hpack_data) {
+  if (hpack_data != nullptr) {
     
   } else {
     
   }
-  hpack_data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), hpack_data);
+  _impl_.hpack_data_.SetAllocated(hpack_data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hpack_data_.IsDefault()) {
+    _impl_.hpack_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:HttpMsg.hpack_data)
 }
 
 // repeated string adding_without_index_headers = 24;
+inline int HttpMsg::_internal_adding_without_index_headers_size() const {
+  return _impl_.adding_without_index_headers_.size();
+}
 inline int HttpMsg::adding_without_index_headers_size() const {
-  return adding_without_index_headers_.size();
+  return _internal_adding_without_index_headers_size();
 }
 inline void HttpMsg::clear_adding_without_index_headers() {
-  adding_without_index_headers_.Clear();
+  _impl_.adding_without_index_headers_.Clear();
+}
+inline std::string* HttpMsg::add_adding_without_index_headers() {
+  std::string* _s = _internal_add_adding_without_index_headers();
+  // @@protoc_insertion_point(field_add_mutable:HttpMsg.adding_without_index_headers)
+  return _s;
+}
+inline const std::string& HttpMsg::_internal_adding_without_index_headers(int index) const {
+  return _impl_.adding_without_index_headers_.Get(index);
 }
-inline const ::std::string& HttpMsg::adding_without_index_headers(int index) const {
+inline const std::string& HttpMsg::adding_without_index_headers(int index) const {
   // @@protoc_insertion_point(field_get:HttpMsg.adding_without_index_headers)
-  return adding_without_index_headers_.Get(index);
+  return _internal_adding_without_index_headers(index);
 }
-inline ::std::string* HttpMsg::mutable_adding_without_index_headers(int index) {
+inline std::string* HttpMsg::mutable_adding_without_index_headers(int index) {
   // @@protoc_insertion_point(field_mutable:HttpMsg.adding_without_index_headers)
-  return adding_without_index_headers_.Mutable(index);
+  return _impl_.adding_without_index_headers_.Mutable(index);
 }
-inline void HttpMsg::set_adding_without_index_headers(int index, const ::std::string& value) {
+inline void HttpMsg::set_adding_without_index_headers(int index, const std::string& value) {
+  _impl_.adding_without_index_headers_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:HttpMsg.adding_without_index_headers)
+}
+inline void HttpMsg::set_adding_without_index_headers(int index, std::string&& value) {
+  _impl_.adding_without_index_headers_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:HttpMsg.adding_without_index_headers)
-  adding_without_index_headers_.Mutable(index)->assign(value);
 }
 inline void HttpMsg::set_adding_without_index_headers(int index, const char* value) {
-  adding_without_index_headers_.Mutable(index)->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.adding_without_index_headers_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:HttpMsg.adding_without_index_headers)
 }
 inline void HttpMsg::set_adding_without_index_headers(int index, const char* value, size_t size) {
-  adding_without_index_headers_.Mutable(index)->assign(
+  _impl_.adding_without_index_headers_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:HttpMsg.adding_without_index_headers)
 }
-inline ::std::string* HttpMsg::add_adding_without_index_headers() {
-  // @@protoc_insertion_point(field_add_mutable:HttpMsg.adding_without_index_headers)
-  return adding_without_index_headers_.Add();
+inline std::string* HttpMsg::_internal_add_adding_without_index_headers() {
+  return _impl_.adding_without_index_headers_.Add();
 }
-inline void HttpMsg::add_adding_without_index_headers(const ::std::string& value) {
-  adding_without_index_headers_.Add()->assign(value);
+inline void HttpMsg::add_adding_without_index_headers(const std::string& value) {
+  _impl_.adding_without_index_headers_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:HttpMsg.adding_without_index_headers)
+}
+inline void HttpMsg::add_adding_without_index_headers(std::string&& value) {
+  _impl_.adding_without_index_headers_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:HttpMsg.adding_without_index_headers)
 }
 inline void HttpMsg::add_adding_without_index_headers(const char* value) {
-  adding_without_index_headers_.Add()->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.adding_without_index_headers_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:HttpMsg.adding_without_index_headers)
 }
 inline void HttpMsg::add_adding_without_index_headers(const char* value, size_t size) {
-  adding_without_index_headers_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.adding_without_index_headers_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:HttpMsg.adding_without_index_headers)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 HttpMsg::adding_without_index_headers() const {
   // @@protoc_insertion_point(field_list:HttpMsg.adding_without_index_headers)
-  return adding_without_index_headers_;
+  return _impl_.adding_without_index_headers_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 HttpMsg::mutable_adding_without_index_headers() {
   // @@protoc_insertion_point(field_mutable_list:HttpMsg.adding_without_index_headers)
-  return &adding_without_index_headers_;
+  return &_impl_.adding_without_index_headers_;
 }
 
 // repeated string deleting_without_index_headers = 25;
+inline int HttpMsg::_internal_deleting_without_index_headers_size() const {
+  return _impl_.deleting_without_index_headers_.size();
+}
 inline int HttpMsg::deleting_without_index_headers_size() const {
-  return deleting_without_index_headers_.size();
+  return _internal_deleting_without_index_headers_size();
 }
 inline void HttpMsg::clear_deleting_without_index_headers() {
-  deleting_without_index_headers_.Clear();
+  _impl_.deleting_without_index_headers_.Clear();
+}
+inline std::string* HttpMsg::add_deleting_without_index_headers() {
+  std::string* _s = _internal_add_deleting_without_index_headers();
+  // @@protoc_insertion_point(field_add_mutable:HttpMsg.deleting_without_index_headers)
+  return _s;
+}
+inline const std::string& HttpMsg::_internal_deleting_without_index_headers(int index) const {
+  return _impl_.deleting_without_index_headers_.Get(index);
 }
-inline const ::std::string& HttpMsg::deleting_without_index_headers(int index) const {
+inline const std::string& HttpMsg::deleting_without_index_headers(int index) const {
   // @@protoc_insertion_point(field_get:HttpMsg.deleting_without_index_headers)
-  return deleting_without_index_headers_.Get(index);
+  return _internal_deleting_without_index_headers(index);
 }
-inline ::std::string* HttpMsg::mutable_deleting_without_index_headers(int index) {
+inline std::string* HttpMsg::mutable_deleting_without_index_headers(int index) {
   // @@protoc_insertion_point(field_mutable:HttpMsg.deleting_without_index_headers)
-  return deleting_without_index_headers_.Mutable(index);
+  return _impl_.deleting_without_index_headers_.Mutable(index);
+}
+inline void HttpMsg::set_deleting_without_index_headers(int index, const std::string& value) {
+  _impl_.deleting_without_index_headers_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:HttpMsg.deleting_without_index_headers)
 }
-inline void HttpMsg::set_deleting_without_index_headers(int index, const ::std::string& value) {
+inline void HttpMsg::set_deleting_without_index_headers(int index, std::string&& value) {
+  _impl_.deleting_without_index_headers_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:HttpMsg.deleting_without_index_headers)
-  deleting_without_index_headers_.Mutable(index)->assign(value);
 }
 inline void HttpMsg::set_deleting_without_index_headers(int index, const char* value) {
-  deleting_without_index_headers_.Mutable(index)->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.deleting_without_index_headers_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:HttpMsg.deleting_without_index_headers)
 }
 inline void HttpMsg::set_deleting_without_index_headers(int index, const char* value, size_t size) {
-  deleting_without_index_headers_.Mutable(index)->assign(
+  _impl_.deleting_without_index_headers_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:HttpMsg.deleting_without_index_headers)
 }
-inline ::std::string* HttpMsg::add_deleting_without_index_headers() {
-  // @@protoc_insertion_point(field_add_mutable:HttpMsg.deleting_without_index_headers)
-  return deleting_without_index_headers_.Add();
+inline std::string* HttpMsg::_internal_add_deleting_without_index_headers() {
+  return _impl_.deleting_without_index_headers_.Add();
+}
+inline void HttpMsg::add_deleting_without_index_headers(const std::string& value) {
+  _impl_.deleting_without_index_headers_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:HttpMsg.deleting_without_index_headers)
 }
-inline void HttpMsg::add_deleting_without_index_headers(const ::std::string& value) {
-  deleting_without_index_headers_.Add()->assign(value);
+inline void HttpMsg::add_deleting_without_index_headers(std::string&& value) {
+  _impl_.deleting_without_index_headers_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:HttpMsg.deleting_without_index_headers)
 }
 inline void HttpMsg::add_deleting_without_index_headers(const char* value) {
-  deleting_without_index_headers_.Add()->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.deleting_without_index_headers_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:HttpMsg.deleting_without_index_headers)
 }
 inline void HttpMsg::add_deleting_without_index_headers(const char* value, size_t size) {
-  deleting_without_index_headers_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.deleting_without_index_headers_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:HttpMsg.deleting_without_index_headers)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 HttpMsg::deleting_without_index_headers() const {
   // @@protoc_insertion_point(field_list:HttpMsg.deleting_without_index_headers)
-  return deleting_without_index_headers_;
+  return _impl_.deleting_without_index_headers_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 HttpMsg::mutable_deleting_without_index_headers() {
   // @@protoc_insertion_point(field_mutable_list:HttpMsg.deleting_without_index_headers)
-  return &deleting_without_index_headers_;
+  return &_impl_.deleting_without_index_headers_;
 }
 
 // repeated string adding_never_index_headers = 26;
+inline int HttpMsg::_internal_adding_never_index_headers_size() const {
+  return _impl_.adding_never_index_headers_.size();
+}
 inline int HttpMsg::adding_never_index_headers_size() const {
-  return adding_never_index_headers_.size();
+  return _internal_adding_never_index_headers_size();
 }
 inline void HttpMsg::clear_adding_never_index_headers() {
-  adding_never_index_headers_.Clear();
+  _impl_.adding_never_index_headers_.Clear();
 }
-inline const ::std::string& HttpMsg::adding_never_index_headers(int index) const {
+inline std::string* HttpMsg::add_adding_never_index_headers() {
+  std::string* _s = _internal_add_adding_never_index_headers();
+  // @@protoc_insertion_point(field_add_mutable:HttpMsg.adding_never_index_headers)
+  return _s;
+}
+inline const std::string& HttpMsg::_internal_adding_never_index_headers(int index) const {
+  return _impl_.adding_never_index_headers_.Get(index);
+}
+inline const std::string& HttpMsg::adding_never_index_headers(int index) const {
   // @@protoc_insertion_point(field_get:HttpMsg.adding_never_index_headers)
-  return adding_never_index_headers_.Get(index);
+  return _internal_adding_never_index_headers(index);
 }
-inline ::std::string* HttpMsg::mutable_adding_never_index_headers(int index) {
+inline std::string* HttpMsg::mutable_adding_never_index_headers(int index) {
   // @@protoc_insertion_point(field_mutable:HttpMsg.adding_never_index_headers)
-  return adding_never_index_headers_.Mutable(index);
+  return _impl_.adding_never_index_headers_.Mutable(index);
+}
+inline void HttpMsg::set_adding_never_index_headers(int index, const std::string& value) {
+  _impl_.adding_never_index_headers_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:HttpMsg.adding_never_index_headers)
 }
-inline void HttpMsg::set_adding_never_index_headers(int index, const ::std::string& value) {
+inline void HttpMsg::set_adding_never_index_headers(int index, std::string&& value) {
+  _impl_.adding_never_index_headers_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:HttpMsg.adding_never_index_headers)
-  adding_never_index_headers_.Mutable(index)->assign(value);
 }
 inline void HttpMsg::set_adding_never_index_headers(int index, const char* value) {
-  adding_never_index_headers_.Mutable(index)->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.adding_never_index_headers_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:HttpMsg.adding_never_index_headers)
 }
 inline void HttpMsg::set_adding_never_index_headers(int index, const char* value, size_t size) {
-  adding_never_index_headers_.Mutable(index)->assign(
+  _impl_.adding_never_index_headers_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:HttpMsg.adding_never_index_headers)
 }
-inline ::std::string* HttpMsg::add_adding_never_index_headers() {
-  // @@protoc_insertion_point(field_add_mutable:HttpMsg.adding_never_index_headers)
-  return adding_never_index_headers_.Add();
+inline std::string* HttpMsg::_internal_add_adding_never_index_headers() {
+  return _impl_.adding_never_index_headers_.Add();
+}
+inline void HttpMsg::add_adding_never_index_headers(const std::string& value) {
+  _impl_.adding_never_index_headers_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:HttpMsg.adding_never_index_headers)
 }
-inline void HttpMsg::add_adding_never_index_headers(const ::std::string& value) {
-  adding_never_index_headers_.Add()->assign(value);
+inline void HttpMsg::add_adding_never_index_headers(std::string&& value) {
+  _impl_.adding_never_index_headers_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:HttpMsg.adding_never_index_headers)
 }
 inline void HttpMsg::add_adding_never_index_headers(const char* value) {
-  adding_never_index_headers_.Add()->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.adding_never_index_headers_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:HttpMsg.adding_never_index_headers)
 }
 inline void HttpMsg::add_adding_never_index_headers(const char* value, size_t size) {
-  adding_never_index_headers_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.adding_never_index_headers_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:HttpMsg.adding_never_index_headers)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 HttpMsg::adding_never_index_headers() const {
   // @@protoc_insertion_point(field_list:HttpMsg.adding_never_index_headers)
-  return adding_never_index_headers_;
+  return _impl_.adding_never_index_headers_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 HttpMsg::mutable_adding_never_index_headers() {
   // @@protoc_insertion_point(field_mutable_list:HttpMsg.adding_never_index_headers)
-  return &adding_never_index_headers_;
+  return &_impl_.adding_never_index_headers_;
 }
 
 // repeated string deleting_never_index_headers = 27;
+inline int HttpMsg::_internal_deleting_never_index_headers_size() const {
+  return _impl_.deleting_never_index_headers_.size();
+}
 inline int HttpMsg::deleting_never_index_headers_size() const {
-  return deleting_never_index_headers_.size();
+  return _internal_deleting_never_index_headers_size();
 }
 inline void HttpMsg::clear_deleting_never_index_headers() {
-  deleting_never_index_headers_.Clear();
+  _impl_.deleting_never_index_headers_.Clear();
+}
+inline std::string* HttpMsg::add_deleting_never_index_headers() {
+  std::string* _s = _internal_add_deleting_never_index_headers();
+  // @@protoc_insertion_point(field_add_mutable:HttpMsg.deleting_never_index_headers)
+  return _s;
+}
+inline const std::string& HttpMsg::_internal_deleting_never_index_headers(int index) const {
+  return _impl_.deleting_never_index_headers_.Get(index);
 }
-inline const ::std::string& HttpMsg::deleting_never_index_headers(int index) const {
+inline const std::string& HttpMsg::deleting_never_index_headers(int index) const {
   // @@protoc_insertion_point(field_get:HttpMsg.deleting_never_index_headers)
-  return deleting_never_index_headers_.Get(index);
+  return _internal_deleting_never_index_headers(index);
 }
-inline ::std::string* HttpMsg::mutable_deleting_never_index_headers(int index) {
+inline std::string* HttpMsg::mutable_deleting_never_index_headers(int index) {
   // @@protoc_insertion_point(field_mutable:HttpMsg.deleting_never_index_headers)
-  return deleting_never_index_headers_.Mutable(index);
+  return _impl_.deleting_never_index_headers_.Mutable(index);
 }
-inline void HttpMsg::set_deleting_never_index_headers(int index, const ::std::string& value) {
+inline void HttpMsg::set_deleting_never_index_headers(int index, const std::string& value) {
+  _impl_.deleting_never_index_headers_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:HttpMsg.deleting_never_index_headers)
+}
+inline void HttpMsg::set_deleting_never_index_headers(int index, std::string&& value) {
+  _impl_.deleting_never_index_headers_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:HttpMsg.deleting_never_index_headers)
-  deleting_never_index_headers_.Mutable(index)->assign(value);
 }
 inline void HttpMsg::set_deleting_never_index_headers(int index, const char* value) {
-  deleting_never_index_headers_.Mutable(index)->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.deleting_never_index_headers_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:HttpMsg.deleting_never_index_headers)
 }
 inline void HttpMsg::set_deleting_never_index_headers(int index, const char* value, size_t size) {
-  deleting_never_index_headers_.Mutable(index)->assign(
+  _impl_.deleting_never_index_headers_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:HttpMsg.deleting_never_index_headers)
 }
-inline ::std::string* HttpMsg::add_deleting_never_index_headers() {
-  // @@protoc_insertion_point(field_add_mutable:HttpMsg.deleting_never_index_headers)
-  return deleting_never_index_headers_.Add();
+inline std::string* HttpMsg::_internal_add_deleting_never_index_headers() {
+  return _impl_.deleting_never_index_headers_.Add();
 }
-inline void HttpMsg::add_deleting_never_index_headers(const ::std::string& value) {
-  deleting_never_index_headers_.Add()->assign(value);
+inline void HttpMsg::add_deleting_never_index_headers(const std::string& value) {
+  _impl_.deleting_never_index_headers_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:HttpMsg.deleting_never_index_headers)
+}
+inline void HttpMsg::add_deleting_never_index_headers(std::string&& value) {
+  _impl_.deleting_never_index_headers_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:HttpMsg.deleting_never_index_headers)
 }
 inline void HttpMsg::add_deleting_never_index_headers(const char* value) {
-  deleting_never_index_headers_.Add()->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.deleting_never_index_headers_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:HttpMsg.deleting_never_index_headers)
 }
 inline void HttpMsg::add_deleting_never_index_headers(const char* value, size_t size) {
-  deleting_never_index_headers_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.deleting_never_index_headers_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:HttpMsg.deleting_never_index_headers)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 HttpMsg::deleting_never_index_headers() const {
   // @@protoc_insertion_point(field_list:HttpMsg.deleting_never_index_headers)
-  return deleting_never_index_headers_;
+  return _impl_.deleting_never_index_headers_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 HttpMsg::mutable_deleting_never_index_headers() {
   // @@protoc_insertion_point(field_mutable_list:HttpMsg.deleting_never_index_headers)
-  return &deleting_never_index_headers_;
+  return &_impl_.deleting_never_index_headers_;
 }
 
-// optional uint32 dynamic_table_update_size = 28;
+// uint32 dynamic_table_update_size = 28;
 inline void HttpMsg::clear_dynamic_table_update_size() {
-  dynamic_table_update_size_ = 0u;
+  _impl_.dynamic_table_update_size_ = 0u;
+}
+inline uint32_t HttpMsg::_internal_dynamic_table_update_size() const {
+  return _impl_.dynamic_table_update_size_;
 }
-inline ::google::protobuf::uint32 HttpMsg::dynamic_table_update_size() const {
+inline uint32_t HttpMsg::dynamic_table_update_size() const {
   // @@protoc_insertion_point(field_get:HttpMsg.dynamic_table_update_size)
-  return dynamic_table_update_size_;
+  return _internal_dynamic_table_update_size();
 }
-inline void HttpMsg::set_dynamic_table_update_size(::google::protobuf::uint32 value) {
+inline void HttpMsg::_internal_set_dynamic_table_update_size(uint32_t value) {
   
-  dynamic_table_update_size_ = value;
+  _impl_.dynamic_table_update_size_ = value;
+}
+inline void HttpMsg::set_dynamic_table_update_size(uint32_t value) {
+  _internal_set_dynamic_table_update_size(value);
   // @@protoc_insertion_point(field_set:HttpMsg.dynamic_table_update_size)
 }
 
-// optional bool with_huffman = 29;
+// bool with_huffman = 29;
 inline void HttpMsg::clear_with_huffman() {
-  with_huffman_ = false;
+  _impl_.with_huffman_ = false;
+}
+inline bool HttpMsg::_internal_with_huffman() const {
+  return _impl_.with_huffman_;
 }
 inline bool HttpMsg::with_huffman() const {
   // @@protoc_insertion_point(field_get:HttpMsg.with_huffman)
-  return with_huffman_;
+  return _internal_with_huffman();
 }
-inline void HttpMsg::set_with_huffman(bool value) {
+inline void HttpMsg::_internal_set_with_huffman(bool value) {
   
-  with_huffman_ = value;
+  _impl_.with_huffman_ = value;
+}
+inline void HttpMsg::set_with_huffman(bool value) {
+  _internal_set_with_huffman(value);
   // @@protoc_insertion_point(field_set:HttpMsg.with_huffman)
 }
 
-// optional string headers_frame_padding = 30;
+// string headers_frame_padding = 30;
 inline void HttpMsg::clear_headers_frame_padding() {
-  headers_frame_padding_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.headers_frame_padding_.ClearToEmpty();
 }
-inline const ::std::string& HttpMsg::headers_frame_padding() const {
+inline const std::string& HttpMsg::headers_frame_padding() const {
   // @@protoc_insertion_point(field_get:HttpMsg.headers_frame_padding)
-  return headers_frame_padding_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_headers_frame_padding();
 }
-inline void HttpMsg::set_headers_frame_padding(const ::std::string& value) {
-  
-  headers_frame_padding_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HttpMsg::set_headers_frame_padding(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.headers_frame_padding_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:HttpMsg.headers_frame_padding)
 }
-inline void HttpMsg::set_headers_frame_padding(const char* value) {
-  
-  headers_frame_padding_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HttpMsg.headers_frame_padding)
+inline std::string* HttpMsg::mutable_headers_frame_padding() {
+  std::string* _s = _internal_mutable_headers_frame_padding();
+  // @@protoc_insertion_point(field_mutable:HttpMsg.headers_frame_padding)
+  return _s;
+}
+inline const std::string& HttpMsg::_internal_headers_frame_padding() const {
+  return _impl_.headers_frame_padding_.Get();
 }
-inline void HttpMsg::set_headers_frame_padding(const char* value, size_t size) {
+inline void HttpMsg::_internal_set_headers_frame_padding(const std::string& value) {
   
-  headers_frame_padding_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.headers_frame_padding)
+  _impl_.headers_frame_padding_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* HttpMsg::mutable_headers_frame_padding() {
+inline std::string* HttpMsg::_internal_mutable_headers_frame_padding() {
   
-  // @@protoc_insertion_point(field_mutable:HttpMsg.headers_frame_padding)
-  return headers_frame_padding_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.headers_frame_padding_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* HttpMsg::release_headers_frame_padding() {
+inline std::string* HttpMsg::release_headers_frame_padding() {
   // @@protoc_insertion_point(field_release:HttpMsg.headers_frame_padding)
-  
-  return headers_frame_padding_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.headers_frame_padding_.Release();
 }
-inline void HttpMsg::set_allocated_headers_frame_padding(::std::string* headers_frame_padding) {
-  if (headers_frame_padding != NULL) {
+inline void HttpMsg::set_allocated_headers_frame_padding(std::string* headers_frame_padding) {
+  if (headers_frame_padding != nullptr) {
     
   } else {
     
   }
-  headers_frame_padding_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), headers_frame_padding);
+  _impl_.headers_frame_padding_.SetAllocated(headers_frame_padding, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.headers_frame_padding_.IsDefault()) {
+    _impl_.headers_frame_padding_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:HttpMsg.headers_frame_padding)
 }
 
-// optional string data_frame_padding = 31;
+// string data_frame_padding = 31;
 inline void HttpMsg::clear_data_frame_padding() {
-  data_frame_padding_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.data_frame_padding_.ClearToEmpty();
 }
-inline const ::std::string& HttpMsg::data_frame_padding() const {
+inline const std::string& HttpMsg::data_frame_padding() const {
   // @@protoc_insertion_point(field_get:HttpMsg.data_frame_padding)
-  return data_frame_padding_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_data_frame_padding();
 }
-inline void HttpMsg::set_data_frame_padding(const ::std::string& value) {
-  
-  data_frame_padding_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HttpMsg::set_data_frame_padding(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_frame_padding_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:HttpMsg.data_frame_padding)
 }
-inline void HttpMsg::set_data_frame_padding(const char* value) {
-  
-  data_frame_padding_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HttpMsg.data_frame_padding)
+inline std::string* HttpMsg::mutable_data_frame_padding() {
+  std::string* _s = _internal_mutable_data_frame_padding();
+  // @@protoc_insertion_point(field_mutable:HttpMsg.data_frame_padding)
+  return _s;
 }
-inline void HttpMsg::set_data_frame_padding(const char* value, size_t size) {
+inline const std::string& HttpMsg::_internal_data_frame_padding() const {
+  return _impl_.data_frame_padding_.Get();
+}
+inline void HttpMsg::_internal_set_data_frame_padding(const std::string& value) {
   
-  data_frame_padding_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.data_frame_padding)
+  _impl_.data_frame_padding_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* HttpMsg::mutable_data_frame_padding() {
+inline std::string* HttpMsg::_internal_mutable_data_frame_padding() {
   
-  // @@protoc_insertion_point(field_mutable:HttpMsg.data_frame_padding)
-  return data_frame_padding_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_frame_padding_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* HttpMsg::release_data_frame_padding() {
+inline std::string* HttpMsg::release_data_frame_padding() {
   // @@protoc_insertion_point(field_release:HttpMsg.data_frame_padding)
-  
-  return data_frame_padding_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_frame_padding_.Release();
 }
-inline void HttpMsg::set_allocated_data_frame_padding(::std::string* data_frame_padding) {
-  if (data_frame_padding != NULL) {
+inline void HttpMsg::set_allocated_data_frame_padding(std::string* data_frame_padding) {
+  if (data_frame_padding != nullptr) {
     
   } else {
     
   }
-  data_frame_padding_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data_frame_padding);
+  _impl_.data_frame_padding_.SetAllocated(data_frame_padding, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_frame_padding_.IsDefault()) {
+    _impl_.data_frame_padding_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:HttpMsg.data_frame_padding)
 }
 
-// optional string push_promise_frame_padding = 32;
+// string push_promise_frame_padding = 32;
 inline void HttpMsg::clear_push_promise_frame_padding() {
-  push_promise_frame_padding_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.push_promise_frame_padding_.ClearToEmpty();
 }
-inline const ::std::string& HttpMsg::push_promise_frame_padding() const {
+inline const std::string& HttpMsg::push_promise_frame_padding() const {
   // @@protoc_insertion_point(field_get:HttpMsg.push_promise_frame_padding)
-  return push_promise_frame_padding_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_push_promise_frame_padding();
 }
-inline void HttpMsg::set_push_promise_frame_padding(const ::std::string& value) {
-  
-  push_promise_frame_padding_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HttpMsg::set_push_promise_frame_padding(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.push_promise_frame_padding_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:HttpMsg.push_promise_frame_padding)
 }
-inline void HttpMsg::set_push_promise_frame_padding(const char* value) {
-  
-  push_promise_frame_padding_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HttpMsg.push_promise_frame_padding)
+inline std::string* HttpMsg::mutable_push_promise_frame_padding() {
+  std::string* _s = _internal_mutable_push_promise_frame_padding();
+  // @@protoc_insertion_point(field_mutable:HttpMsg.push_promise_frame_padding)
+  return _s;
+}
+inline const std::string& HttpMsg::_internal_push_promise_frame_padding() const {
+  return _impl_.push_promise_frame_padding_.Get();
 }
-inline void HttpMsg::set_push_promise_frame_padding(const char* value, size_t size) {
+inline void HttpMsg::_internal_set_push_promise_frame_padding(const std::string& value) {
   
-  push_promise_frame_padding_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HttpMsg.push_promise_frame_padding)
+  _impl_.push_promise_frame_padding_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* HttpMsg::mutable_push_promise_frame_padding() {
+inline std::string* HttpMsg::_internal_mutable_push_promise_frame_padding() {
   
-  // @@protoc_insertion_point(field_mutable:HttpMsg.push_promise_frame_padding)
-  return push_promise_frame_padding_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.push_promise_frame_padding_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* HttpMsg::release_push_promise_frame_padding() {
+inline std::string* HttpMsg::release_push_promise_frame_padding() {
   // @@protoc_insertion_point(field_release:HttpMsg.push_promise_frame_padding)
-  
-  return push_promise_frame_padding_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.push_promise_frame_padding_.Release();
 }
-inline void HttpMsg::set_allocated_push_promise_frame_padding(::std::string* push_promise_frame_padding) {
-  if (push_promise_frame_padding != NULL) {
+inline void HttpMsg::set_allocated_push_promise_frame_padding(std::string* push_promise_frame_padding) {
+  if (push_promise_frame_padding != nullptr) {
     
   } else {
     
   }
-  push_promise_frame_padding_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), push_promise_frame_padding);
+  _impl_.push_promise_frame_padding_.SetAllocated(push_promise_frame_padding, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.push_promise_frame_padding_.IsDefault()) {
+    _impl_.push_promise_frame_padding_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:HttpMsg.push_promise_frame_padding)
 }
 
 // map<uint32, uint32> settings = 33;
+inline int HttpMsg::_internal_settings_size() const {
+  return _impl_.settings_.size();
+}
 inline int HttpMsg::settings_size() const {
-  return settings_.size();
+  return _internal_settings_size();
 }
 inline void HttpMsg::clear_settings() {
-  settings_.Clear();
+  _impl_.settings_.Clear();
 }
-inline const ::google::protobuf::Map< ::google::protobuf::uint32, ::google::protobuf::uint32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint32_t >&
+HttpMsg::_internal_settings() const {
+  return _impl_.settings_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint32_t >&
 HttpMsg::settings() const {
   // @@protoc_insertion_point(field_map:HttpMsg.settings)
-  return settings_.GetMap();
+  return _internal_settings();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint32_t >*
+HttpMsg::_internal_mutable_settings() {
+  return _impl_.settings_.MutableMap();
 }
-inline ::google::protobuf::Map< ::google::protobuf::uint32, ::google::protobuf::uint32 >*
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint32_t >*
 HttpMsg::mutable_settings() {
   // @@protoc_insertion_point(field_mutable_map:HttpMsg.settings)
-  return settings_.MutableMap();
+  return _internal_mutable_settings();
 }
 
-#endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 // -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
@@ -1682,6 +2495,8 @@ HttpMsg::mutable_settings() {
 
 // @@protoc_insertion_point(namespace_scope)
 
+
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_http_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_http_2eproto
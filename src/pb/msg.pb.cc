@@ -1,471 +1,373 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: msg.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "msg.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
-
-namespace {
-
-const ::google::protobuf::Descriptor* MsgHead_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MsgHead_reflection_ = NULL;
-const ::google::protobuf::Descriptor* MsgBody_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MsgBody_reflection_ = NULL;
-struct MsgBodyOneofInstance {
-  const ::MsgBody_Request* req_target_;
-  const ::MsgBody_Response* rsp_result_;
-}* MsgBody_default_oneof_instance_ = NULL;
-const ::google::protobuf::Descriptor* MsgBody_Request_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MsgBody_Request_reflection_ = NULL;
-const ::google::protobuf::Descriptor* MsgBody_Response_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MsgBody_Response_reflection_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_msg_2eproto() GOOGLE_ATTRIBUTE_COLD;
-void protobuf_AssignDesc_msg_2eproto() {
-  protobuf_AddDesc_msg_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "msg.proto");
-  GOOGLE_CHECK(file != NULL);
-  MsgHead_descriptor_ = file->message_type(0);
-  static const int MsgHead_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MsgHead, cmd_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MsgHead, seq_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MsgHead, len_),
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+PROTOBUF_CONSTEXPR MsgHead::MsgHead(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.cmd_)*/0u
+  , /*decltype(_impl_.seq_)*/0u
+  , /*decltype(_impl_.len_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MsgHeadDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MsgHeadDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MsgHeadDefaultTypeInternal() {}
+  union {
+    MsgHead _instance;
   };
-  MsgHead_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      MsgHead_descriptor_,
-      MsgHead::default_instance_,
-      MsgHead_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(MsgHead),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MsgHead, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MsgHead, _is_default_instance_));
-  MsgBody_descriptor_ = file->message_type(1);
-  static const int MsgBody_offsets_[6] = {
-    PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(MsgBody_default_oneof_instance_, req_target_),
-    PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(MsgBody_default_oneof_instance_, rsp_result_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MsgBody, data_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MsgBody, add_on_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MsgBody, trace_id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MsgBody, msg_type_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MsgHeadDefaultTypeInternal _MsgHead_default_instance_;
+PROTOBUF_CONSTEXPR MsgBody_Request::MsgBody_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.route_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.route_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MsgBody_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MsgBody_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MsgBody_RequestDefaultTypeInternal() {}
+  union {
+    MsgBody_Request _instance;
   };
-  MsgBody_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      MsgBody_descriptor_,
-      MsgBody::default_instance_,
-      MsgBody_offsets_,
-      -1,
-      -1,
-      -1,
-      MsgBody_default_oneof_instance_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MsgBody, _oneof_case_[0]),
-      sizeof(MsgBody),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MsgBody, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MsgBody, _is_default_instance_));
-  MsgBody_Request_descriptor_ = MsgBody_descriptor_->nested_type(0);
-  static const int MsgBody_Request_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MsgBody_Request, route_id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MsgBody_Request, route_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MsgBody_RequestDefaultTypeInternal _MsgBody_Request_default_instance_;
+PROTOBUF_CONSTEXPR MsgBody_Response::MsgBody_Response(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.code_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MsgBody_ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MsgBody_ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MsgBody_ResponseDefaultTypeInternal() {}
+  union {
+    MsgBody_Response _instance;
   };
-  MsgBody_Request_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      MsgBody_Request_descriptor_,
-      MsgBody_Request::default_instance_,
-      MsgBody_Request_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(MsgBody_Request),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MsgBody_Request, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MsgBody_Request, _is_default_instance_));
-  MsgBody_Response_descriptor_ = MsgBody_descriptor_->nested_type(1);
-  static const int MsgBody_Response_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MsgBody_Response, code_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MsgBody_Response, msg_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MsgBody_ResponseDefaultTypeInternal _MsgBody_Response_default_instance_;
+PROTOBUF_CONSTEXPR MsgBody::MsgBody(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.add_on_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.trace_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.msg_type_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct MsgBodyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MsgBodyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MsgBodyDefaultTypeInternal() {}
+  union {
+    MsgBody _instance;
   };
-  MsgBody_Response_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      MsgBody_Response_descriptor_,
-      MsgBody_Response::default_instance_,
-      MsgBody_Response_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(MsgBody_Response),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MsgBody_Response, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MsgBody_Response, _is_default_instance_));
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_msg_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      MsgHead_descriptor_, &MsgHead::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      MsgBody_descriptor_, &MsgBody::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      MsgBody_Request_descriptor_, &MsgBody_Request::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      MsgBody_Response_descriptor_, &MsgBody_Response::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_msg_2eproto() {
-  delete MsgHead::default_instance_;
-  delete MsgHead_reflection_;
-  delete MsgBody::default_instance_;
-  delete MsgBody_default_oneof_instance_;
-  delete MsgBody_reflection_;
-  delete MsgBody_Request::default_instance_;
-  delete MsgBody_Request_reflection_;
-  delete MsgBody_Response::default_instance_;
-  delete MsgBody_Response_reflection_;
-}
-
-void protobuf_AddDesc_msg_2eproto() GOOGLE_ATTRIBUTE_COLD;
-void protobuf_AddDesc_msg_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\tmsg.proto\"0\n\007MsgHead\022\013\n\003cmd\030\001 \001(\007\022\013\n\003s"
-    "eq\030\002 \001(\007\022\013\n\003len\030\003 \001(\017\"\351\001\n\007MsgBody\022&\n\nreq"
-    "_target\030\001 \001(\0132\020.MsgBody.RequestH\000\022\'\n\nrsp"
-    "_result\030\002 \001(\0132\021.MsgBody.ResponseH\000\022\014\n\004da"
-    "ta\030\003 \001(\014\022\016\n\006add_on\030\004 \001(\014\022\020\n\010trace_id\030\005 \001"
-    "(\t\032*\n\007Request\022\020\n\010route_id\030\001 \001(\r\022\r\n\005route"
-    "\030\002 \001(\t\032%\n\010Response\022\014\n\004code\030\001 \001(\005\022\013\n\003msg\030"
-    "\002 \001(\014B\n\n\010msg_typeb\006proto3", 305);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "msg.proto", &protobuf_RegisterTypes);
-  MsgHead::default_instance_ = new MsgHead();
-  MsgBody::default_instance_ = new MsgBody();
-  MsgBody_default_oneof_instance_ = new MsgBodyOneofInstance();
-  MsgBody_Request::default_instance_ = new MsgBody_Request();
-  MsgBody_Response::default_instance_ = new MsgBody_Response();
-  MsgHead::default_instance_->InitAsDefaultInstance();
-  MsgBody::default_instance_->InitAsDefaultInstance();
-  MsgBody_Request::default_instance_->InitAsDefaultInstance();
-  MsgBody_Response::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_msg_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_msg_2eproto {
-  StaticDescriptorInitializer_msg_2eproto() {
-    protobuf_AddDesc_msg_2eproto();
-  }
-} static_descriptor_initializer_msg_2eproto_;
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MsgBodyDefaultTypeInternal _MsgBody_default_instance_;
+static ::_pb::Metadata file_level_metadata_msg_2eproto[4];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_msg_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_msg_2eproto = nullptr;
+
+const uint32_t TableStruct_msg_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::MsgHead, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::MsgHead, _impl_.cmd_),
+  PROTOBUF_FIELD_OFFSET(::MsgHead, _impl_.seq_),
+  PROTOBUF_FIELD_OFFSET(::MsgHead, _impl_.len_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::MsgBody_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::MsgBody_Request, _impl_.route_id_),
+  PROTOBUF_FIELD_OFFSET(::MsgBody_Request, _impl_.route_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::MsgBody_Response, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::MsgBody_Response, _impl_.code_),
+  PROTOBUF_FIELD_OFFSET(::MsgBody_Response, _impl_.msg_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::MsgBody, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::MsgBody, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::MsgBody, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::MsgBody, _impl_.add_on_),
+  PROTOBUF_FIELD_OFFSET(::MsgBody, _impl_.trace_id_),
+  PROTOBUF_FIELD_OFFSET(::MsgBody, _impl_.msg_type_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::MsgHead)},
+  { 9, -1, -1, sizeof(::MsgBody_Request)},
+  { 17, -1, -1, sizeof(::MsgBody_Response)},
+  { 25, -1, -1, sizeof(::MsgBody)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::_MsgHead_default_instance_._instance,
+  &::_MsgBody_Request_default_instance_._instance,
+  &::_MsgBody_Response_default_instance_._instance,
+  &::_MsgBody_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_msg_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\tmsg.proto\"0\n\007MsgHead\022\013\n\003cmd\030\001 \001(\007\022\013\n\003s"
+  "eq\030\002 \001(\007\022\013\n\003len\030\003 \001(\017\"\351\001\n\007MsgBody\022&\n\nreq"
+  "_target\030\001 \001(\0132\020.MsgBody.RequestH\000\022\'\n\nrsp"
+  "_result\030\002 \001(\0132\021.MsgBody.ResponseH\000\022\014\n\004da"
+  "ta\030\003 \001(\014\022\016\n\006add_on\030\004 \001(\014\022\020\n\010trace_id\030\005 \001"
+  "(\t\032*\n\007Request\022\020\n\010route_id\030\001 \001(\r\022\r\n\005route"
+  "\030\002 \001(\t\032%\n\010Response\022\014\n\004code\030\001 \001(\005\022\013\n\003msg\030"
+  "\002 \001(\014B\n\n\010msg_typeB\003\370\001\001b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_msg_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_msg_2eproto = {
+    false, false, 310, descriptor_table_protodef_msg_2eproto,
+    "msg.proto",
+    &descriptor_table_msg_2eproto_once, nullptr, 0, 4,
+    schemas, file_default_instances, TableStruct_msg_2eproto::offsets,
+    file_level_metadata_msg_2eproto, file_level_enum_descriptors_msg_2eproto,
+    file_level_service_descriptors_msg_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_msg_2eproto_getter() {
+  return &descriptor_table_msg_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_msg_2eproto(&descriptor_table_msg_2eproto);
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int MsgHead::kCmdFieldNumber;
-const int MsgHead::kSeqFieldNumber;
-const int MsgHead::kLenFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class MsgHead::_Internal {
+ public:
+};
 
-MsgHead::MsgHead()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:MsgHead)
+MsgHead::MsgHead(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MsgHead)
 }
-
-void MsgHead::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
-}
-
 MsgHead::MsgHead(const MsgHead& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MsgHead* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cmd_){}
+    , decltype(_impl_.seq_){}
+    , decltype(_impl_.len_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.cmd_, &from._impl_.cmd_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.len_) -
+    reinterpret_cast<char*>(&_impl_.cmd_)) + sizeof(_impl_.len_));
   // @@protoc_insertion_point(copy_constructor:MsgHead)
 }
 
-void MsgHead::SharedCtor() {
-    _is_default_instance_ = false;
-  _cached_size_ = 0;
-  cmd_ = 0u;
-  seq_ = 0u;
-  len_ = 0;
+inline void MsgHead::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cmd_){0u}
+    , decltype(_impl_.seq_){0u}
+    , decltype(_impl_.len_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 MsgHead::~MsgHead() {
   // @@protoc_insertion_point(destructor:MsgHead)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void MsgHead::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void MsgHead::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void MsgHead::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* MsgHead::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MsgHead_descriptor_;
-}
-
-const MsgHead& MsgHead::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_msg_2eproto();
-  return *default_instance_;
-}
-
-MsgHead* MsgHead::default_instance_ = NULL;
-
-MsgHead* MsgHead::New(::google::protobuf::Arena* arena) const {
-  MsgHead* n = new MsgHead;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void MsgHead::Clear() {
 // @@protoc_insertion_point(message_clear_start:MsgHead)
-#if defined(__clang__)
-#define ZR_HELPER_(f) \
-  _Pragma("clang diagnostic push") \
-  _Pragma("clang diagnostic ignored \"-Winvalid-offsetof\"") \
-  __builtin_offsetof(MsgHead, f) \
-  _Pragma("clang diagnostic pop")
-#else
-#define ZR_HELPER_(f) reinterpret_cast<char*>(\
-  &reinterpret_cast<MsgHead*>(16)->f)
-#endif
-
-#define ZR_(first, last) do {\
-  ::memset(&first, 0,\
-           ZR_HELPER_(last) - ZR_HELPER_(first) + sizeof(last));\
-} while (0)
-
-  ZR_(cmd_, len_);
-
-#undef ZR_HELPER_
-#undef ZR_
-
-}
-
-bool MsgHead::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:MsgHead)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional fixed32 cmd = 1;
-      case 1: {
-        if (tag == 13) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32>(
-                 input, &cmd_)));
-
-        } else {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.cmd_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.len_) -
+      reinterpret_cast<char*>(&_impl_.cmd_)) + sizeof(_impl_.len_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MsgHead::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // fixed32 cmd = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.cmd_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(21)) goto parse_seq;
-        break;
-      }
-
-      // optional fixed32 seq = 2;
-      case 2: {
-        if (tag == 21) {
-         parse_seq:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32>(
-                 input, &seq_)));
-
-        } else {
+        continue;
+      // fixed32 seq = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.seq_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(29)) goto parse_len;
-        break;
-      }
-
-      // optional sfixed32 len = 3;
-      case 3: {
-        if (tag == 29) {
-         parse_len:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED32>(
-                 input, &len_)));
-
-        } else {
+        continue;
+      // sfixed32 len = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.len_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<int32_t>(ptr);
+          ptr += sizeof(int32_t);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:MsgHead)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:MsgHead)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void MsgHead::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:MsgHead)
-  // optional fixed32 cmd = 1;
-  if (this->cmd() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFixed32(1, this->cmd(), output);
-  }
-
-  // optional fixed32 seq = 2;
-  if (this->seq() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFixed32(2, this->seq(), output);
-  }
+uint8_t* MsgHead::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:MsgHead)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-  // optional sfixed32 len = 3;
-  if (this->len() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteSFixed32(3, this->len(), output);
+  // fixed32 cmd = 1;
+  if (this->_internal_cmd() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(1, this->_internal_cmd(), target);
   }
 
-  // @@protoc_insertion_point(serialize_end:MsgHead)
-}
-
-::google::protobuf::uint8* MsgHead::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:MsgHead)
-  // optional fixed32 cmd = 1;
-  if (this->cmd() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFixed32ToArray(1, this->cmd(), target);
+  // fixed32 seq = 2;
+  if (this->_internal_seq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(2, this->_internal_seq(), target);
   }
 
-  // optional fixed32 seq = 2;
-  if (this->seq() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFixed32ToArray(2, this->seq(), target);
+  // sfixed32 len = 3;
+  if (this->_internal_len() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSFixed32ToArray(3, this->_internal_len(), target);
   }
 
-  // optional sfixed32 len = 3;
-  if (this->len() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteSFixed32ToArray(3, this->len(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-
   // @@protoc_insertion_point(serialize_to_array_end:MsgHead)
   return target;
 }
 
-int MsgHead::ByteSize() const {
+size_t MsgHead::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:MsgHead)
-  int total_size = 0;
+  size_t total_size = 0;
 
-  // optional fixed32 cmd = 1;
-  if (this->cmd() != 0) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // fixed32 cmd = 1;
+  if (this->_internal_cmd() != 0) {
     total_size += 1 + 4;
   }
 
-  // optional fixed32 seq = 2;
-  if (this->seq() != 0) {
+  // fixed32 seq = 2;
+  if (this->_internal_seq() != 0) {
     total_size += 1 + 4;
   }
 
-  // optional sfixed32 len = 3;
-  if (this->len() != 0) {
+  // sfixed32 len = 3;
+  if (this->_internal_len() != 0) {
     total_size += 1 + 4;
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void MsgHead::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:MsgHead)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const MsgHead* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const MsgHead>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:MsgHead)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:MsgHead)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MsgHead::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MsgHead::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MsgHead::GetClassData() const { return &_class_data_; }
 
-void MsgHead::MergeFrom(const MsgHead& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:MsgHead)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  if (from.cmd() != 0) {
-    set_cmd(from.cmd());
+
+void MsgHead::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MsgHead*>(&to_msg);
+  auto& from = static_cast<const MsgHead&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MsgHead)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_cmd() != 0) {
+    _this->_internal_set_cmd(from._internal_cmd());
   }
-  if (from.seq() != 0) {
-    set_seq(from.seq());
+  if (from._internal_seq() != 0) {
+    _this->_internal_set_seq(from._internal_seq());
   }
-  if (from.len() != 0) {
-    set_len(from.len());
+  if (from._internal_len() != 0) {
+    _this->_internal_set_len(from._internal_len());
   }
-}
-
-void MsgHead::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:MsgHead)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MsgHead::CopyFrom(const MsgHead& from) {
@@ -476,318 +378,225 @@ void MsgHead::CopyFrom(const MsgHead& from) {
 }
 
 bool MsgHead::IsInitialized() const {
-
   return true;
 }
 
-void MsgHead::Swap(MsgHead* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void MsgHead::InternalSwap(MsgHead* other) {
-  std::swap(cmd_, other->cmd_);
-  std::swap(seq_, other->seq_);
-  std::swap(len_, other->len_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MsgHead, _impl_.len_)
+      + sizeof(MsgHead::_impl_.len_)
+      - PROTOBUF_FIELD_OFFSET(MsgHead, _impl_.cmd_)>(
+          reinterpret_cast<char*>(&_impl_.cmd_),
+          reinterpret_cast<char*>(&other->_impl_.cmd_));
 }
 
-::google::protobuf::Metadata MsgHead::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MsgHead_descriptor_;
-  metadata.reflection = MsgHead_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata MsgHead::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_msg_2eproto_getter, &descriptor_table_msg_2eproto_once,
+      file_level_metadata_msg_2eproto[0]);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// MsgHead
-
-// optional fixed32 cmd = 1;
-void MsgHead::clear_cmd() {
-  cmd_ = 0u;
-}
- ::google::protobuf::uint32 MsgHead::cmd() const {
-  // @@protoc_insertion_point(field_get:MsgHead.cmd)
-  return cmd_;
-}
- void MsgHead::set_cmd(::google::protobuf::uint32 value) {
-  
-  cmd_ = value;
-  // @@protoc_insertion_point(field_set:MsgHead.cmd)
-}
-
-// optional fixed32 seq = 2;
-void MsgHead::clear_seq() {
-  seq_ = 0u;
-}
- ::google::protobuf::uint32 MsgHead::seq() const {
-  // @@protoc_insertion_point(field_get:MsgHead.seq)
-  return seq_;
-}
- void MsgHead::set_seq(::google::protobuf::uint32 value) {
-  
-  seq_ = value;
-  // @@protoc_insertion_point(field_set:MsgHead.seq)
-}
-
-// optional sfixed32 len = 3;
-void MsgHead::clear_len() {
-  len_ = 0;
-}
- ::google::protobuf::int32 MsgHead::len() const {
-  // @@protoc_insertion_point(field_get:MsgHead.len)
-  return len_;
-}
- void MsgHead::set_len(::google::protobuf::int32 value) {
-  
-  len_ = value;
-  // @@protoc_insertion_point(field_set:MsgHead.len)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int MsgBody_Request::kRouteIdFieldNumber;
-const int MsgBody_Request::kRouteFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-MsgBody_Request::MsgBody_Request()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:MsgBody.Request)
-}
+class MsgBody_Request::_Internal {
+ public:
+};
 
-void MsgBody_Request::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
+MsgBody_Request::MsgBody_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MsgBody.Request)
 }
-
 MsgBody_Request::MsgBody_Request(const MsgBody_Request& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MsgBody_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.route_){}
+    , decltype(_impl_.route_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.route_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.route_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_route().empty()) {
+    _this->_impl_.route_.Set(from._internal_route(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.route_id_ = from._impl_.route_id_;
   // @@protoc_insertion_point(copy_constructor:MsgBody.Request)
 }
 
-void MsgBody_Request::SharedCtor() {
-    _is_default_instance_ = false;
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  route_id_ = 0u;
-  route_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void MsgBody_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.route_){}
+    , decltype(_impl_.route_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.route_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.route_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 MsgBody_Request::~MsgBody_Request() {
   // @@protoc_insertion_point(destructor:MsgBody.Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void MsgBody_Request::SharedDtor() {
-  route_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != default_instance_) {
-  }
+inline void MsgBody_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.route_.Destroy();
 }
 
 void MsgBody_Request::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* MsgBody_Request::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MsgBody_Request_descriptor_;
-}
-
-const MsgBody_Request& MsgBody_Request::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_msg_2eproto();
-  return *default_instance_;
-}
-
-MsgBody_Request* MsgBody_Request::default_instance_ = NULL;
-
-MsgBody_Request* MsgBody_Request::New(::google::protobuf::Arena* arena) const {
-  MsgBody_Request* n = new MsgBody_Request;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void MsgBody_Request::Clear() {
 // @@protoc_insertion_point(message_clear_start:MsgBody.Request)
-  route_id_ = 0u;
-  route_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-
-bool MsgBody_Request::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:MsgBody.Request)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional uint32 route_id = 1;
-      case 1: {
-        if (tag == 8) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &route_id_)));
-
-        } else {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.route_.ClearToEmpty();
+  _impl_.route_id_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MsgBody_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 route_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.route_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_route;
-        break;
-      }
-
-      // optional string route = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_route:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_route()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->route().data(), this->route().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "MsgBody.Request.route"));
-        } else {
+        continue;
+      // string route = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_route();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MsgBody.Request.route"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:MsgBody.Request)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:MsgBody.Request)
-  return false;
-#undef DO_
-}
-
-void MsgBody_Request::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:MsgBody.Request)
-  // optional uint32 route_id = 1;
-  if (this->route_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->route_id(), output);
-  }
-
-  // optional string route = 2;
-  if (this->route().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->route().data(), this->route().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "MsgBody.Request.route");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->route(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:MsgBody.Request)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* MsgBody_Request::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
+uint8_t* MsgBody_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:MsgBody.Request)
-  // optional uint32 route_id = 1;
-  if (this->route_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->route_id(), target);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 route_id = 1;
+  if (this->_internal_route_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_route_id(), target);
   }
 
-  // optional string route = 2;
-  if (this->route().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->route().data(), this->route().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  // string route = 2;
+  if (!this->_internal_route().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_route().data(), static_cast<int>(this->_internal_route().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "MsgBody.Request.route");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->route(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_route(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:MsgBody.Request)
   return target;
 }
 
-int MsgBody_Request::ByteSize() const {
+size_t MsgBody_Request::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:MsgBody.Request)
-  int total_size = 0;
+  size_t total_size = 0;
 
-  // optional uint32 route_id = 1;
-  if (this->route_id() != 0) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string route = 2;
+  if (!this->_internal_route().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->route_id());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_route());
   }
 
-  // optional string route = 2;
-  if (this->route().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->route());
+  // uint32 route_id = 1;
+  if (this->_internal_route_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_route_id());
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void MsgBody_Request::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:MsgBody.Request)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const MsgBody_Request* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const MsgBody_Request>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:MsgBody.Request)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:MsgBody.Request)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MsgBody_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MsgBody_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MsgBody_Request::GetClassData() const { return &_class_data_; }
 
-void MsgBody_Request::MergeFrom(const MsgBody_Request& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:MsgBody.Request)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  if (from.route_id() != 0) {
-    set_route_id(from.route_id());
-  }
-  if (from.route().size() > 0) {
 
-    route_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.route_);
-  }
-}
+void MsgBody_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MsgBody_Request*>(&to_msg);
+  auto& from = static_cast<const MsgBody_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MsgBody.Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void MsgBody_Request::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:MsgBody.Request)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_route().empty()) {
+    _this->_internal_set_route(from._internal_route());
+  }
+  if (from._internal_route_id() != 0) {
+    _this->_internal_set_route_id(from._internal_route_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MsgBody_Request::CopyFrom(const MsgBody_Request& from) {
@@ -798,259 +607,221 @@ void MsgBody_Request::CopyFrom(const MsgBody_Request& from) {
 }
 
 bool MsgBody_Request::IsInitialized() const {
-
   return true;
 }
 
-void MsgBody_Request::Swap(MsgBody_Request* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void MsgBody_Request::InternalSwap(MsgBody_Request* other) {
-  std::swap(route_id_, other->route_id_);
-  route_.Swap(&other->route_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.route_, lhs_arena,
+      &other->_impl_.route_, rhs_arena
+  );
+  swap(_impl_.route_id_, other->_impl_.route_id_);
 }
 
-::google::protobuf::Metadata MsgBody_Request::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MsgBody_Request_descriptor_;
-  metadata.reflection = MsgBody_Request_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata MsgBody_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_msg_2eproto_getter, &descriptor_table_msg_2eproto_once,
+      file_level_metadata_msg_2eproto[1]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int MsgBody_Response::kCodeFieldNumber;
-const int MsgBody_Response::kMsgFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-MsgBody_Response::MsgBody_Response()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:MsgBody.Response)
-}
+class MsgBody_Response::_Internal {
+ public:
+};
 
-void MsgBody_Response::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
+MsgBody_Response::MsgBody_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MsgBody.Response)
 }
-
 MsgBody_Response::MsgBody_Response(const MsgBody_Response& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MsgBody_Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , decltype(_impl_.code_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_msg().empty()) {
+    _this->_impl_.msg_.Set(from._internal_msg(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.code_ = from._impl_.code_;
   // @@protoc_insertion_point(copy_constructor:MsgBody.Response)
 }
 
-void MsgBody_Response::SharedCtor() {
-    _is_default_instance_ = false;
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  code_ = 0;
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void MsgBody_Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , decltype(_impl_.code_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 MsgBody_Response::~MsgBody_Response() {
   // @@protoc_insertion_point(destructor:MsgBody.Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void MsgBody_Response::SharedDtor() {
-  msg_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != default_instance_) {
-  }
+inline void MsgBody_Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.msg_.Destroy();
 }
 
 void MsgBody_Response::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* MsgBody_Response::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MsgBody_Response_descriptor_;
-}
-
-const MsgBody_Response& MsgBody_Response::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_msg_2eproto();
-  return *default_instance_;
-}
-
-MsgBody_Response* MsgBody_Response::default_instance_ = NULL;
-
-MsgBody_Response* MsgBody_Response::New(::google::protobuf::Arena* arena) const {
-  MsgBody_Response* n = new MsgBody_Response;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void MsgBody_Response::Clear() {
 // @@protoc_insertion_point(message_clear_start:MsgBody.Response)
-  code_ = 0;
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-
-bool MsgBody_Response::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:MsgBody.Response)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional int32 code = 1;
-      case 1: {
-        if (tag == 8) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &code_)));
-
-        } else {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.msg_.ClearToEmpty();
+  _impl_.code_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MsgBody_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 code = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.code_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_msg;
-        break;
-      }
-
-      // optional bytes msg = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_msg:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_msg()));
-        } else {
+        continue;
+      // bytes msg = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_msg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:MsgBody.Response)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:MsgBody.Response)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void MsgBody_Response::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:MsgBody.Response)
-  // optional int32 code = 1;
-  if (this->code() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->code(), output);
-  }
+uint8_t* MsgBody_Response::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:MsgBody.Response)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-  // optional bytes msg = 2;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      2, this->msg(), output);
+  // int32 code = 1;
+  if (this->_internal_code() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_code(), target);
   }
 
-  // @@protoc_insertion_point(serialize_end:MsgBody.Response)
-}
-
-::google::protobuf::uint8* MsgBody_Response::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:MsgBody.Response)
-  // optional int32 code = 1;
-  if (this->code() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->code(), target);
+  // bytes msg = 2;
+  if (!this->_internal_msg().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_msg(), target);
   }
 
-  // optional bytes msg = 2;
-  if (this->msg().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        2, this->msg(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-
   // @@protoc_insertion_point(serialize_to_array_end:MsgBody.Response)
   return target;
 }
 
-int MsgBody_Response::ByteSize() const {
+size_t MsgBody_Response::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:MsgBody.Response)
-  int total_size = 0;
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // optional int32 code = 1;
-  if (this->code() != 0) {
+  // bytes msg = 2;
+  if (!this->_internal_msg().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->code());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_msg());
   }
 
-  // optional bytes msg = 2;
-  if (this->msg().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->msg());
+  // int32 code = 1;
+  if (this->_internal_code() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_code());
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void MsgBody_Response::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:MsgBody.Response)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const MsgBody_Response* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const MsgBody_Response>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:MsgBody.Response)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:MsgBody.Response)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MsgBody_Response::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MsgBody_Response::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MsgBody_Response::GetClassData() const { return &_class_data_; }
 
-void MsgBody_Response::MergeFrom(const MsgBody_Response& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:MsgBody.Response)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  if (from.code() != 0) {
-    set_code(from.code());
-  }
-  if (from.msg().size() > 0) {
 
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
-  }
-}
+void MsgBody_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MsgBody_Response*>(&to_msg);
+  auto& from = static_cast<const MsgBody_Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MsgBody.Response)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void MsgBody_Response::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:MsgBody.Response)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_msg().empty()) {
+    _this->_internal_set_msg(from._internal_msg());
+  }
+  if (from._internal_code() != 0) {
+    _this->_internal_set_code(from._internal_code());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MsgBody_Response::CopyFrom(const MsgBody_Response& from) {
@@ -1061,427 +832,434 @@ void MsgBody_Response::CopyFrom(const MsgBody_Response& from) {
 }
 
 bool MsgBody_Response::IsInitialized() const {
-
   return true;
 }
 
-void MsgBody_Response::Swap(MsgBody_Response* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void MsgBody_Response::InternalSwap(MsgBody_Response* other) {
-  std::swap(code_, other->code_);
-  msg_.Swap(&other->msg_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_, lhs_arena,
+      &other->_impl_.msg_, rhs_arena
+  );
+  swap(_impl_.code_, other->_impl_.code_);
 }
 
-::google::protobuf::Metadata MsgBody_Response::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MsgBody_Response_descriptor_;
-  metadata.reflection = MsgBody_Response_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata MsgBody_Response::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_msg_2eproto_getter, &descriptor_table_msg_2eproto_once,
+      file_level_metadata_msg_2eproto[2]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int MsgBody::kReqTargetFieldNumber;
-const int MsgBody::kRspResultFieldNumber;
-const int MsgBody::kDataFieldNumber;
-const int MsgBody::kAddOnFieldNumber;
-const int MsgBody::kTraceIdFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class MsgBody::_Internal {
+ public:
+  static const ::MsgBody_Request& req_target(const MsgBody* msg);
+  static const ::MsgBody_Response& rsp_result(const MsgBody* msg);
+};
 
-MsgBody::MsgBody()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:MsgBody)
+const ::MsgBody_Request&
+MsgBody::_Internal::req_target(const MsgBody* msg) {
+  return *msg->_impl_.msg_type_.req_target_;
 }
-
-void MsgBody::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
-  MsgBody_default_oneof_instance_->req_target_ = const_cast< ::MsgBody_Request*>(&::MsgBody_Request::default_instance());
-  MsgBody_default_oneof_instance_->rsp_result_ = const_cast< ::MsgBody_Response*>(&::MsgBody_Response::default_instance());
+const ::MsgBody_Response&
+MsgBody::_Internal::rsp_result(const MsgBody* msg) {
+  return *msg->_impl_.msg_type_.rsp_result_;
+}
+void MsgBody::set_allocated_req_target(::MsgBody_Request* req_target) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg_type();
+  if (req_target) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(req_target);
+    if (message_arena != submessage_arena) {
+      req_target = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, req_target, submessage_arena);
+    }
+    set_has_req_target();
+    _impl_.msg_type_.req_target_ = req_target;
+  }
+  // @@protoc_insertion_point(field_set_allocated:MsgBody.req_target)
+}
+void MsgBody::set_allocated_rsp_result(::MsgBody_Response* rsp_result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg_type();
+  if (rsp_result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rsp_result);
+    if (message_arena != submessage_arena) {
+      rsp_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rsp_result, submessage_arena);
+    }
+    set_has_rsp_result();
+    _impl_.msg_type_.rsp_result_ = rsp_result;
+  }
+  // @@protoc_insertion_point(field_set_allocated:MsgBody.rsp_result)
+}
+MsgBody::MsgBody(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MsgBody)
 }
-
 MsgBody::MsgBody(const MsgBody& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MsgBody* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.add_on_){}
+    , decltype(_impl_.trace_id_){}
+    , decltype(_impl_.msg_type_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.add_on_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.add_on_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_add_on().empty()) {
+    _this->_impl_.add_on_.Set(from._internal_add_on(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.trace_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.trace_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_trace_id().empty()) {
+    _this->_impl_.trace_id_.Set(from._internal_trace_id(), 
+      _this->GetArenaForAllocation());
+  }
+  clear_has_msg_type();
+  switch (from.msg_type_case()) {
+    case kReqTarget: {
+      _this->_internal_mutable_req_target()->::MsgBody_Request::MergeFrom(
+          from._internal_req_target());
+      break;
+    }
+    case kRspResult: {
+      _this->_internal_mutable_rsp_result()->::MsgBody_Response::MergeFrom(
+          from._internal_rsp_result());
+      break;
+    }
+    case MSG_TYPE_NOT_SET: {
+      break;
+    }
+  }
   // @@protoc_insertion_point(copy_constructor:MsgBody)
 }
 
-void MsgBody::SharedCtor() {
-    _is_default_instance_ = false;
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  add_on_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  trace_id_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void MsgBody::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.add_on_){}
+    , decltype(_impl_.trace_id_){}
+    , decltype(_impl_.msg_type_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.add_on_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.add_on_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.trace_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.trace_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   clear_has_msg_type();
 }
 
 MsgBody::~MsgBody() {
   // @@protoc_insertion_point(destructor:MsgBody)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void MsgBody::SharedDtor() {
-  data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  add_on_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  trace_id_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void MsgBody::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
+  _impl_.add_on_.Destroy();
+  _impl_.trace_id_.Destroy();
   if (has_msg_type()) {
     clear_msg_type();
   }
-  if (this != default_instance_) {
-  }
 }
 
 void MsgBody::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* MsgBody::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MsgBody_descriptor_;
-}
-
-const MsgBody& MsgBody::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_msg_2eproto();
-  return *default_instance_;
-}
-
-MsgBody* MsgBody::default_instance_ = NULL;
-
-MsgBody* MsgBody::New(::google::protobuf::Arena* arena) const {
-  MsgBody* n = new MsgBody;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void MsgBody::clear_msg_type() {
 // @@protoc_insertion_point(one_of_clear_start:MsgBody)
-  switch(msg_type_case()) {
+  switch (msg_type_case()) {
     case kReqTarget: {
-      delete msg_type_.req_target_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_type_.req_target_;
+      }
       break;
     }
     case kRspResult: {
-      delete msg_type_.rsp_result_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_type_.rsp_result_;
+      }
       break;
     }
     case MSG_TYPE_NOT_SET: {
       break;
     }
   }
-  _oneof_case_[0] = MSG_TYPE_NOT_SET;
+  _impl_._oneof_case_[0] = MSG_TYPE_NOT_SET;
 }
 
 
 void MsgBody::Clear() {
 // @@protoc_insertion_point(message_clear_start:MsgBody)
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  add_on_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  trace_id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_msg_type();
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-bool MsgBody::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:MsgBody)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional .MsgBody.Request req_target = 1;
-      case 1: {
-        if (tag == 10) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_req_target()));
-        } else {
+  _impl_.data_.ClearToEmpty();
+  _impl_.add_on_.ClearToEmpty();
+  _impl_.trace_id_.ClearToEmpty();
+  clear_msg_type();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MsgBody::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .MsgBody.Request req_target = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_req_target(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_rsp_result;
-        break;
-      }
-
-      // optional .MsgBody.Response rsp_result = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_rsp_result:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_rsp_result()));
-        } else {
+        continue;
+      // .MsgBody.Response rsp_result = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_rsp_result(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(26)) goto parse_data;
-        break;
-      }
-
-      // optional bytes data = 3;
-      case 3: {
-        if (tag == 26) {
-         parse_data:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_data()));
-        } else {
+        continue;
+      // bytes data = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(34)) goto parse_add_on;
-        break;
-      }
-
-      // optional bytes add_on = 4;
-      case 4: {
-        if (tag == 34) {
-         parse_add_on:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_add_on()));
-        } else {
+        continue;
+      // bytes add_on = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_add_on();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(42)) goto parse_trace_id;
-        break;
-      }
-
-      // optional string trace_id = 5;
-      case 5: {
-        if (tag == 42) {
-         parse_trace_id:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_trace_id()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->trace_id().data(), this->trace_id().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "MsgBody.trace_id"));
-        } else {
+        continue;
+      // string trace_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_trace_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MsgBody.trace_id"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:MsgBody)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:MsgBody)
-  return false;
-#undef DO_
-}
-
-void MsgBody::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:MsgBody)
-  // optional .MsgBody.Request req_target = 1;
-  if (has_req_target()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, *msg_type_.req_target_, output);
-  }
-
-  // optional .MsgBody.Response rsp_result = 2;
-  if (has_rsp_result()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, *msg_type_.rsp_result_, output);
-  }
-
-  // optional bytes data = 3;
-  if (this->data().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      3, this->data(), output);
-  }
-
-  // optional bytes add_on = 4;
-  if (this->add_on().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      4, this->add_on(), output);
-  }
-
-  // optional string trace_id = 5;
-  if (this->trace_id().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->trace_id().data(), this->trace_id().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "MsgBody.trace_id");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      5, this->trace_id(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:MsgBody)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* MsgBody::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
+uint8_t* MsgBody::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:MsgBody)
-  // optional .MsgBody.Request req_target = 1;
-  if (has_req_target()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        1, *msg_type_.req_target_, false, target);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .MsgBody.Request req_target = 1;
+  if (_internal_has_req_target()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::req_target(this),
+        _Internal::req_target(this).GetCachedSize(), target, stream);
   }
 
-  // optional .MsgBody.Response rsp_result = 2;
-  if (has_rsp_result()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        2, *msg_type_.rsp_result_, false, target);
+  // .MsgBody.Response rsp_result = 2;
+  if (_internal_has_rsp_result()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::rsp_result(this),
+        _Internal::rsp_result(this).GetCachedSize(), target, stream);
   }
 
-  // optional bytes data = 3;
-  if (this->data().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        3, this->data(), target);
+  // bytes data = 3;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_data(), target);
   }
 
-  // optional bytes add_on = 4;
-  if (this->add_on().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        4, this->add_on(), target);
+  // bytes add_on = 4;
+  if (!this->_internal_add_on().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_add_on(), target);
   }
 
-  // optional string trace_id = 5;
-  if (this->trace_id().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->trace_id().data(), this->trace_id().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  // string trace_id = 5;
+  if (!this->_internal_trace_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_trace_id().data(), static_cast<int>(this->_internal_trace_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "MsgBody.trace_id");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        5, this->trace_id(), target);
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_trace_id(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:MsgBody)
   return target;
 }
 
-int MsgBody::ByteSize() const {
+size_t MsgBody::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:MsgBody)
-  int total_size = 0;
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // optional bytes data = 3;
-  if (this->data().size() > 0) {
+  // bytes data = 3;
+  if (!this->_internal_data().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->data());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
   }
 
-  // optional bytes add_on = 4;
-  if (this->add_on().size() > 0) {
+  // bytes add_on = 4;
+  if (!this->_internal_add_on().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->add_on());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_add_on());
   }
 
-  // optional string trace_id = 5;
-  if (this->trace_id().size() > 0) {
+  // string trace_id = 5;
+  if (!this->_internal_trace_id().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->trace_id());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_trace_id());
   }
 
   switch (msg_type_case()) {
-    // optional .MsgBody.Request req_target = 1;
+    // .MsgBody.Request req_target = 1;
     case kReqTarget: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          *msg_type_.req_target_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_type_.req_target_);
       break;
     }
-    // optional .MsgBody.Response rsp_result = 2;
+    // .MsgBody.Response rsp_result = 2;
     case kRspResult: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          *msg_type_.rsp_result_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_type_.rsp_result_);
       break;
     }
     case MSG_TYPE_NOT_SET: {
       break;
     }
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void MsgBody::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:MsgBody)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MsgBody::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MsgBody::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MsgBody::GetClassData() const { return &_class_data_; }
+
+
+void MsgBody::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MsgBody*>(&to_msg);
+  auto& from = static_cast<const MsgBody&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MsgBody)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
   }
-  const MsgBody* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const MsgBody>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:MsgBody)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:MsgBody)
-    MergeFrom(*source);
+  if (!from._internal_add_on().empty()) {
+    _this->_internal_set_add_on(from._internal_add_on());
   }
-}
-
-void MsgBody::MergeFrom(const MsgBody& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:MsgBody)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  if (!from._internal_trace_id().empty()) {
+    _this->_internal_set_trace_id(from._internal_trace_id());
   }
   switch (from.msg_type_case()) {
     case kReqTarget: {
-      mutable_req_target()->::MsgBody_Request::MergeFrom(from.req_target());
+      _this->_internal_mutable_req_target()->::MsgBody_Request::MergeFrom(
+          from._internal_req_target());
       break;
     }
     case kRspResult: {
-      mutable_rsp_result()->::MsgBody_Response::MergeFrom(from.rsp_result());
+      _this->_internal_mutable_rsp_result()->::MsgBody_Response::MergeFrom(
+          from._internal_rsp_result());
       break;
     }
     case MSG_TYPE_NOT_SET: {
       break;
     }
   }
-  if (from.data().size() > 0) {
-
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
-  }
-  if (from.add_on().size() > 0) {
-
-    add_on_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.add_on_);
-  }
-  if (from.trace_id().size() > 0) {
-
-    trace_id_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.trace_id_);
-  }
-}
-
-void MsgBody::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:MsgBody)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MsgBody::CopyFrom(const MsgBody& from) {
@@ -1492,398 +1270,55 @@ void MsgBody::CopyFrom(const MsgBody& from) {
 }
 
 bool MsgBody::IsInitialized() const {
-
   return true;
 }
 
-void MsgBody::Swap(MsgBody* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void MsgBody::InternalSwap(MsgBody* other) {
-  data_.Swap(&other->data_);
-  add_on_.Swap(&other->add_on_);
-  trace_id_.Swap(&other->trace_id_);
-  std::swap(msg_type_, other->msg_type_);
-  std::swap(_oneof_case_[0], other->_oneof_case_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata MsgBody::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MsgBody_descriptor_;
-  metadata.reflection = MsgBody_reflection_;
-  return metadata;
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// MsgBody_Request
-
-// optional uint32 route_id = 1;
-void MsgBody_Request::clear_route_id() {
-  route_id_ = 0u;
-}
- ::google::protobuf::uint32 MsgBody_Request::route_id() const {
-  // @@protoc_insertion_point(field_get:MsgBody.Request.route_id)
-  return route_id_;
-}
- void MsgBody_Request::set_route_id(::google::protobuf::uint32 value) {
-  
-  route_id_ = value;
-  // @@protoc_insertion_point(field_set:MsgBody.Request.route_id)
-}
-
-// optional string route = 2;
-void MsgBody_Request::clear_route() {
-  route_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& MsgBody_Request::route() const {
-  // @@protoc_insertion_point(field_get:MsgBody.Request.route)
-  return route_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void MsgBody_Request::set_route(const ::std::string& value) {
-  
-  route_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:MsgBody.Request.route)
-}
- void MsgBody_Request::set_route(const char* value) {
-  
-  route_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:MsgBody.Request.route)
-}
- void MsgBody_Request::set_route(const char* value, size_t size) {
-  
-  route_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:MsgBody.Request.route)
-}
- ::std::string* MsgBody_Request::mutable_route() {
-  
-  // @@protoc_insertion_point(field_mutable:MsgBody.Request.route)
-  return route_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* MsgBody_Request::release_route() {
-  // @@protoc_insertion_point(field_release:MsgBody.Request.route)
-  
-  return route_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void MsgBody_Request::set_allocated_route(::std::string* route) {
-  if (route != NULL) {
-    
-  } else {
-    
-  }
-  route_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), route);
-  // @@protoc_insertion_point(field_set_allocated:MsgBody.Request.route)
-}
-
-// -------------------------------------------------------------------
-
-// MsgBody_Response
-
-// optional int32 code = 1;
-void MsgBody_Response::clear_code() {
-  code_ = 0;
-}
- ::google::protobuf::int32 MsgBody_Response::code() const {
-  // @@protoc_insertion_point(field_get:MsgBody.Response.code)
-  return code_;
-}
- void MsgBody_Response::set_code(::google::protobuf::int32 value) {
-  
-  code_ = value;
-  // @@protoc_insertion_point(field_set:MsgBody.Response.code)
-}
-
-// optional bytes msg = 2;
-void MsgBody_Response::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& MsgBody_Response::msg() const {
-  // @@protoc_insertion_point(field_get:MsgBody.Response.msg)
-  return msg_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void MsgBody_Response::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:MsgBody.Response.msg)
-}
- void MsgBody_Response::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:MsgBody.Response.msg)
-}
- void MsgBody_Response::set_msg(const void* value, size_t size) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:MsgBody.Response.msg)
-}
- ::std::string* MsgBody_Response::mutable_msg() {
-  
-  // @@protoc_insertion_point(field_mutable:MsgBody.Response.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* MsgBody_Response::release_msg() {
-  // @@protoc_insertion_point(field_release:MsgBody.Response.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void MsgBody_Response::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
-    
-  } else {
-    
-  }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
-  // @@protoc_insertion_point(field_set_allocated:MsgBody.Response.msg)
-}
-
-// -------------------------------------------------------------------
-
-// MsgBody
-
-// optional .MsgBody.Request req_target = 1;
-bool MsgBody::has_req_target() const {
-  return msg_type_case() == kReqTarget;
-}
-void MsgBody::set_has_req_target() {
-  _oneof_case_[0] = kReqTarget;
-}
-void MsgBody::clear_req_target() {
-  if (has_req_target()) {
-    delete msg_type_.req_target_;
-    clear_has_msg_type();
-  }
-}
- const ::MsgBody_Request& MsgBody::req_target() const {
-  // @@protoc_insertion_point(field_get:MsgBody.req_target)
-  return has_req_target()
-      ? *msg_type_.req_target_
-      : ::MsgBody_Request::default_instance();
-}
-::MsgBody_Request* MsgBody::mutable_req_target() {
-  if (!has_req_target()) {
-    clear_msg_type();
-    set_has_req_target();
-    msg_type_.req_target_ = new ::MsgBody_Request;
-  }
-  // @@protoc_insertion_point(field_mutable:MsgBody.req_target)
-  return msg_type_.req_target_;
-}
-::MsgBody_Request* MsgBody::release_req_target() {
-  // @@protoc_insertion_point(field_release:MsgBody.req_target)
-  if (has_req_target()) {
-    clear_has_msg_type();
-    ::MsgBody_Request* temp = msg_type_.req_target_;
-    msg_type_.req_target_ = NULL;
-    return temp;
-  } else {
-    return NULL;
-  }
-}
-void MsgBody::set_allocated_req_target(::MsgBody_Request* req_target) {
-  clear_msg_type();
-  if (req_target) {
-    set_has_req_target();
-    msg_type_.req_target_ = req_target;
-  }
-  // @@protoc_insertion_point(field_set_allocated:MsgBody.req_target)
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.add_on_, lhs_arena,
+      &other->_impl_.add_on_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.trace_id_, lhs_arena,
+      &other->_impl_.trace_id_, rhs_arena
+  );
+  swap(_impl_.msg_type_, other->_impl_.msg_type_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MsgBody::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_msg_2eproto_getter, &descriptor_table_msg_2eproto_once,
+      file_level_metadata_msg_2eproto[3]);
 }
 
-// optional .MsgBody.Response rsp_result = 2;
-bool MsgBody::has_rsp_result() const {
-  return msg_type_case() == kRspResult;
-}
-void MsgBody::set_has_rsp_result() {
-  _oneof_case_[0] = kRspResult;
-}
-void MsgBody::clear_rsp_result() {
-  if (has_rsp_result()) {
-    delete msg_type_.rsp_result_;
-    clear_has_msg_type();
-  }
-}
- const ::MsgBody_Response& MsgBody::rsp_result() const {
-  // @@protoc_insertion_point(field_get:MsgBody.rsp_result)
-  return has_rsp_result()
-      ? *msg_type_.rsp_result_
-      : ::MsgBody_Response::default_instance();
-}
-::MsgBody_Response* MsgBody::mutable_rsp_result() {
-  if (!has_rsp_result()) {
-    clear_msg_type();
-    set_has_rsp_result();
-    msg_type_.rsp_result_ = new ::MsgBody_Response;
-  }
-  // @@protoc_insertion_point(field_mutable:MsgBody.rsp_result)
-  return msg_type_.rsp_result_;
-}
-::MsgBody_Response* MsgBody::release_rsp_result() {
-  // @@protoc_insertion_point(field_release:MsgBody.rsp_result)
-  if (has_rsp_result()) {
-    clear_has_msg_type();
-    ::MsgBody_Response* temp = msg_type_.rsp_result_;
-    msg_type_.rsp_result_ = NULL;
-    return temp;
-  } else {
-    return NULL;
-  }
-}
-void MsgBody::set_allocated_rsp_result(::MsgBody_Response* rsp_result) {
-  clear_msg_type();
-  if (rsp_result) {
-    set_has_rsp_result();
-    msg_type_.rsp_result_ = rsp_result;
-  }
-  // @@protoc_insertion_point(field_set_allocated:MsgBody.rsp_result)
-}
-
-// optional bytes data = 3;
-void MsgBody::clear_data() {
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& MsgBody::data() const {
-  // @@protoc_insertion_point(field_get:MsgBody.data)
-  return data_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void MsgBody::set_data(const ::std::string& value) {
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:MsgBody.data)
-}
- void MsgBody::set_data(const char* value) {
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:MsgBody.data)
-}
- void MsgBody::set_data(const void* value, size_t size) {
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:MsgBody.data)
-}
- ::std::string* MsgBody::mutable_data() {
-  
-  // @@protoc_insertion_point(field_mutable:MsgBody.data)
-  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* MsgBody::release_data() {
-  // @@protoc_insertion_point(field_release:MsgBody.data)
-  
-  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void MsgBody::set_allocated_data(::std::string* data) {
-  if (data != NULL) {
-    
-  } else {
-    
-  }
-  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
-  // @@protoc_insertion_point(field_set_allocated:MsgBody.data)
-}
-
-// optional bytes add_on = 4;
-void MsgBody::clear_add_on() {
-  add_on_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& MsgBody::add_on() const {
-  // @@protoc_insertion_point(field_get:MsgBody.add_on)
-  return add_on_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void MsgBody::set_add_on(const ::std::string& value) {
-  
-  add_on_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:MsgBody.add_on)
-}
- void MsgBody::set_add_on(const char* value) {
-  
-  add_on_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:MsgBody.add_on)
-}
- void MsgBody::set_add_on(const void* value, size_t size) {
-  
-  add_on_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:MsgBody.add_on)
-}
- ::std::string* MsgBody::mutable_add_on() {
-  
-  // @@protoc_insertion_point(field_mutable:MsgBody.add_on)
-  return add_on_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* MsgBody::release_add_on() {
-  // @@protoc_insertion_point(field_release:MsgBody.add_on)
-  
-  return add_on_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void MsgBody::set_allocated_add_on(::std::string* add_on) {
-  if (add_on != NULL) {
-    
-  } else {
-    
-  }
-  add_on_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), add_on);
-  // @@protoc_insertion_point(field_set_allocated:MsgBody.add_on)
-}
-
-// optional string trace_id = 5;
-void MsgBody::clear_trace_id() {
-  trace_id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& MsgBody::trace_id() const {
-  // @@protoc_insertion_point(field_get:MsgBody.trace_id)
-  return trace_id_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void MsgBody::set_trace_id(const ::std::string& value) {
-  
-  trace_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:MsgBody.trace_id)
-}
- void MsgBody::set_trace_id(const char* value) {
-  
-  trace_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:MsgBody.trace_id)
-}
- void MsgBody::set_trace_id(const char* value, size_t size) {
-  
-  trace_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:MsgBody.trace_id)
-}
- ::std::string* MsgBody::mutable_trace_id() {
-  
-  // @@protoc_insertion_point(field_mutable:MsgBody.trace_id)
-  return trace_id_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* MsgBody::release_trace_id() {
-  // @@protoc_insertion_point(field_release:MsgBody.trace_id)
-  
-  return trace_id_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void MsgBody::set_allocated_trace_id(::std::string* trace_id) {
-  if (trace_id != NULL) {
-    
-  } else {
-    
-  }
-  trace_id_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), trace_id);
-  // @@protoc_insertion_point(field_set_allocated:MsgBody.trace_id)
+// @@protoc_insertion_point(namespace_scope)
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::MsgHead*
+Arena::CreateMaybeMessage< ::MsgHead >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::MsgHead >(arena);
 }
-
-bool MsgBody::has_msg_type() const {
-  return msg_type_case() != MSG_TYPE_NOT_SET;
+template<> PROTOBUF_NOINLINE ::MsgBody_Request*
+Arena::CreateMaybeMessage< ::MsgBody_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::MsgBody_Request >(arena);
 }
-void MsgBody::clear_has_msg_type() {
-  _oneof_case_[0] = MSG_TYPE_NOT_SET;
+template<> PROTOBUF_NOINLINE ::MsgBody_Response*
+Arena::CreateMaybeMessage< ::MsgBody_Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::MsgBody_Response >(arena);
 }
-MsgBody::MsgTypeCase MsgBody::msg_type_case() const {
-  return MsgBody::MsgTypeCase(_oneof_case_[0]);
+template<> PROTOBUF_NOINLINE ::MsgBody*
+Arena::CreateMaybeMessage< ::MsgBody >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::MsgBody >(arena);
 }
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
-// @@protoc_insertion_point(namespace_scope)
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
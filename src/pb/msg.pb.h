@@ -1,391 +1,689 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: msg.proto
 
-#ifndef PROTOBUF_msg_2eproto__INCLUDED
-#define PROTOBUF_msg_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_msg_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_msg_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3000000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3000000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
-// Internal implementation detail -- do not call these.
-void protobuf_AddDesc_msg_2eproto();
-void protobuf_AssignDesc_msg_2eproto();
-void protobuf_ShutdownFile_msg_2eproto();
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_msg_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_msg_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_msg_2eproto;
 class MsgBody;
+struct MsgBodyDefaultTypeInternal;
+extern MsgBodyDefaultTypeInternal _MsgBody_default_instance_;
 class MsgBody_Request;
+struct MsgBody_RequestDefaultTypeInternal;
+extern MsgBody_RequestDefaultTypeInternal _MsgBody_Request_default_instance_;
 class MsgBody_Response;
+struct MsgBody_ResponseDefaultTypeInternal;
+extern MsgBody_ResponseDefaultTypeInternal _MsgBody_Response_default_instance_;
 class MsgHead;
+struct MsgHeadDefaultTypeInternal;
+extern MsgHeadDefaultTypeInternal _MsgHead_default_instance_;
+PROTOBUF_NAMESPACE_OPEN
+template<> ::MsgBody* Arena::CreateMaybeMessage<::MsgBody>(Arena*);
+template<> ::MsgBody_Request* Arena::CreateMaybeMessage<::MsgBody_Request>(Arena*);
+template<> ::MsgBody_Response* Arena::CreateMaybeMessage<::MsgBody_Response>(Arena*);
+template<> ::MsgHead* Arena::CreateMaybeMessage<::MsgHead>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
 
 // ===================================================================
 
-class MsgHead : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:MsgHead) */ {
+class MsgHead final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MsgHead) */ {
  public:
-  MsgHead();
-  virtual ~MsgHead();
+  inline MsgHead() : MsgHead(nullptr) {}
+  ~MsgHead() override;
+  explicit PROTOBUF_CONSTEXPR MsgHead(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MsgHead(const MsgHead& from);
+  MsgHead(MsgHead&& from) noexcept
+    : MsgHead() {
+    *this = ::std::move(from);
+  }
 
   inline MsgHead& operator=(const MsgHead& from) {
     CopyFrom(from);
     return *this;
   }
+  inline MsgHead& operator=(MsgHead&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MsgHead& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MsgHead& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MsgHead* internal_default_instance() {
+    return reinterpret_cast<const MsgHead*>(
+               &_MsgHead_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(MsgHead* other);
+  friend void swap(MsgHead& a, MsgHead& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MsgHead* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MsgHead* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline MsgHead* New() const { return New(NULL); }
-
-  MsgHead* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  MsgHead* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MsgHead>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MsgHead& from);
-  void MergeFrom(const MsgHead& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MsgHead& from) {
+    MsgHead::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(MsgHead* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MsgHead";
   }
+  protected:
+  explicit MsgHead(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional fixed32 cmd = 1;
+  enum : int {
+    kCmdFieldNumber = 1,
+    kSeqFieldNumber = 2,
+    kLenFieldNumber = 3,
+  };
+  // fixed32 cmd = 1;
   void clear_cmd();
-  static const int kCmdFieldNumber = 1;
-  ::google::protobuf::uint32 cmd() const;
-  void set_cmd(::google::protobuf::uint32 value);
+  uint32_t cmd() const;
+  void set_cmd(uint32_t value);
+  private:
+  uint32_t _internal_cmd() const;
+  void _internal_set_cmd(uint32_t value);
+  public:
 
-  // optional fixed32 seq = 2;
+  // fixed32 seq = 2;
   void clear_seq();
-  static const int kSeqFieldNumber = 2;
-  ::google::protobuf::uint32 seq() const;
-  void set_seq(::google::protobuf::uint32 value);
+  uint32_t seq() const;
+  void set_seq(uint32_t value);
+  private:
+  uint32_t _internal_seq() const;
+  void _internal_set_seq(uint32_t value);
+  public:
 
-  // optional sfixed32 len = 3;
+  // sfixed32 len = 3;
   void clear_len();
-  static const int kLenFieldNumber = 3;
-  ::google::protobuf::int32 len() const;
-  void set_len(::google::protobuf::int32 value);
+  int32_t len() const;
+  void set_len(int32_t value);
+  private:
+  int32_t _internal_len() const;
+  void _internal_set_len(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:MsgHead)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::uint32 cmd_;
-  ::google::protobuf::uint32 seq_;
-  ::google::protobuf::int32 len_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_msg_2eproto();
-  friend void protobuf_AssignDesc_msg_2eproto();
-  friend void protobuf_ShutdownFile_msg_2eproto();
-
-  void InitAsDefaultInstance();
-  static MsgHead* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t cmd_;
+    uint32_t seq_;
+    int32_t len_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_msg_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MsgBody_Request : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:MsgBody.Request) */ {
+class MsgBody_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MsgBody.Request) */ {
  public:
-  MsgBody_Request();
-  virtual ~MsgBody_Request();
+  inline MsgBody_Request() : MsgBody_Request(nullptr) {}
+  ~MsgBody_Request() override;
+  explicit PROTOBUF_CONSTEXPR MsgBody_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MsgBody_Request(const MsgBody_Request& from);
+  MsgBody_Request(MsgBody_Request&& from) noexcept
+    : MsgBody_Request() {
+    *this = ::std::move(from);
+  }
 
   inline MsgBody_Request& operator=(const MsgBody_Request& from) {
     CopyFrom(from);
     return *this;
   }
+  inline MsgBody_Request& operator=(MsgBody_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MsgBody_Request& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MsgBody_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MsgBody_Request* internal_default_instance() {
+    return reinterpret_cast<const MsgBody_Request*>(
+               &_MsgBody_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(MsgBody_Request* other);
+  friend void swap(MsgBody_Request& a, MsgBody_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MsgBody_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MsgBody_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline MsgBody_Request* New() const { return New(NULL); }
-
-  MsgBody_Request* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  MsgBody_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MsgBody_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MsgBody_Request& from);
-  void MergeFrom(const MsgBody_Request& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MsgBody_Request& from) {
+    MsgBody_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(MsgBody_Request* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MsgBody.Request";
   }
+  protected:
+  explicit MsgBody_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional uint32 route_id = 1;
-  void clear_route_id();
-  static const int kRouteIdFieldNumber = 1;
-  ::google::protobuf::uint32 route_id() const;
-  void set_route_id(::google::protobuf::uint32 value);
-
-  // optional string route = 2;
+  enum : int {
+    kRouteFieldNumber = 2,
+    kRouteIdFieldNumber = 1,
+  };
+  // string route = 2;
   void clear_route();
-  static const int kRouteFieldNumber = 2;
-  const ::std::string& route() const;
-  void set_route(const ::std::string& value);
-  void set_route(const char* value);
-  void set_route(const char* value, size_t size);
-  ::std::string* mutable_route();
-  ::std::string* release_route();
-  void set_allocated_route(::std::string* route);
+  const std::string& route() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_route(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_route();
+  PROTOBUF_NODISCARD std::string* release_route();
+  void set_allocated_route(std::string* route);
+  private:
+  const std::string& _internal_route() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_route(const std::string& value);
+  std::string* _internal_mutable_route();
+  public:
+
+  // uint32 route_id = 1;
+  void clear_route_id();
+  uint32_t route_id() const;
+  void set_route_id(uint32_t value);
+  private:
+  uint32_t _internal_route_id() const;
+  void _internal_set_route_id(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:MsgBody.Request)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr route_;
-  ::google::protobuf::uint32 route_id_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_msg_2eproto();
-  friend void protobuf_AssignDesc_msg_2eproto();
-  friend void protobuf_ShutdownFile_msg_2eproto();
-
-  void InitAsDefaultInstance();
-  static MsgBody_Request* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr route_;
+    uint32_t route_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_msg_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MsgBody_Response : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:MsgBody.Response) */ {
+class MsgBody_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MsgBody.Response) */ {
  public:
-  MsgBody_Response();
-  virtual ~MsgBody_Response();
+  inline MsgBody_Response() : MsgBody_Response(nullptr) {}
+  ~MsgBody_Response() override;
+  explicit PROTOBUF_CONSTEXPR MsgBody_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MsgBody_Response(const MsgBody_Response& from);
+  MsgBody_Response(MsgBody_Response&& from) noexcept
+    : MsgBody_Response() {
+    *this = ::std::move(from);
+  }
 
   inline MsgBody_Response& operator=(const MsgBody_Response& from) {
     CopyFrom(from);
     return *this;
   }
+  inline MsgBody_Response& operator=(MsgBody_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MsgBody_Response& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MsgBody_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MsgBody_Response* internal_default_instance() {
+    return reinterpret_cast<const MsgBody_Response*>(
+               &_MsgBody_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  void Swap(MsgBody_Response* other);
+  friend void swap(MsgBody_Response& a, MsgBody_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MsgBody_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MsgBody_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline MsgBody_Response* New() const { return New(NULL); }
-
-  MsgBody_Response* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  MsgBody_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MsgBody_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MsgBody_Response& from);
-  void MergeFrom(const MsgBody_Response& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MsgBody_Response& from) {
+    MsgBody_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(MsgBody_Response* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MsgBody.Response";
   }
+  protected:
+  explicit MsgBody_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional int32 code = 1;
-  void clear_code();
-  static const int kCodeFieldNumber = 1;
-  ::google::protobuf::int32 code() const;
-  void set_code(::google::protobuf::int32 value);
-
-  // optional bytes msg = 2;
+  enum : int {
+    kMsgFieldNumber = 2,
+    kCodeFieldNumber = 1,
+  };
+  // bytes msg = 2;
   void clear_msg();
-  static const int kMsgFieldNumber = 2;
-  const ::std::string& msg() const;
-  void set_msg(const ::std::string& value);
-  void set_msg(const char* value);
-  void set_msg(const void* value, size_t size);
-  ::std::string* mutable_msg();
-  ::std::string* release_msg();
-  void set_allocated_msg(::std::string* msg);
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
+
+  // int32 code = 1;
+  void clear_code();
+  int32_t code() const;
+  void set_code(int32_t value);
+  private:
+  int32_t _internal_code() const;
+  void _internal_set_code(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:MsgBody.Response)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr msg_;
-  ::google::protobuf::int32 code_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_msg_2eproto();
-  friend void protobuf_AssignDesc_msg_2eproto();
-  friend void protobuf_ShutdownFile_msg_2eproto();
-
-  void InitAsDefaultInstance();
-  static MsgBody_Response* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    int32_t code_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_msg_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MsgBody : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:MsgBody) */ {
+class MsgBody final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MsgBody) */ {
  public:
-  MsgBody();
-  virtual ~MsgBody();
+  inline MsgBody() : MsgBody(nullptr) {}
+  ~MsgBody() override;
+  explicit PROTOBUF_CONSTEXPR MsgBody(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MsgBody(const MsgBody& from);
+  MsgBody(MsgBody&& from) noexcept
+    : MsgBody() {
+    *this = ::std::move(from);
+  }
 
   inline MsgBody& operator=(const MsgBody& from) {
     CopyFrom(from);
     return *this;
   }
+  inline MsgBody& operator=(MsgBody&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MsgBody& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MsgBody& default_instance() {
+    return *internal_default_instance();
+  }
   enum MsgTypeCase {
     kReqTarget = 1,
     kRspResult = 2,
     MSG_TYPE_NOT_SET = 0,
   };
 
-  void Swap(MsgBody* other);
+  static inline const MsgBody* internal_default_instance() {
+    return reinterpret_cast<const MsgBody*>(
+               &_MsgBody_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
 
-  // implements Message ----------------------------------------------
+  friend void swap(MsgBody& a, MsgBody& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MsgBody* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MsgBody* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-  inline MsgBody* New() const { return New(NULL); }
+  // implements Message ----------------------------------------------
 
-  MsgBody* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  MsgBody* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MsgBody>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MsgBody& from);
-  void MergeFrom(const MsgBody& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MsgBody& from) {
+    MsgBody::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(MsgBody* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MsgBody";
   }
+  protected:
+  explicit MsgBody(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -394,134 +692,190 @@ class MsgBody : public ::google::protobuf::Message /* @@protoc_insertion_point(c
 
   // accessors -------------------------------------------------------
 
-  // optional .MsgBody.Request req_target = 1;
+  enum : int {
+    kDataFieldNumber = 3,
+    kAddOnFieldNumber = 4,
+    kTraceIdFieldNumber = 5,
+    kReqTargetFieldNumber = 1,
+    kRspResultFieldNumber = 2,
+  };
+  // bytes data = 3;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // bytes add_on = 4;
+  void clear_add_on();
+  const std::string& add_on() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_add_on(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_add_on();
+  PROTOBUF_NODISCARD std::string* release_add_on();
+  void set_allocated_add_on(std::string* add_on);
+  private:
+  const std::string& _internal_add_on() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_add_on(const std::string& value);
+  std::string* _internal_mutable_add_on();
+  public:
+
+  // string trace_id = 5;
+  void clear_trace_id();
+  const std::string& trace_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_trace_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_trace_id();
+  PROTOBUF_NODISCARD std::string* release_trace_id();
+  void set_allocated_trace_id(std::string* trace_id);
+  private:
+  const std::string& _internal_trace_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_trace_id(const std::string& value);
+  std::string* _internal_mutable_trace_id();
+  public:
+
+  // .MsgBody.Request req_target = 1;
   bool has_req_target() const;
+  private:
+  bool _internal_has_req_target() const;
+  public:
   void clear_req_target();
-  static const int kReqTargetFieldNumber = 1;
   const ::MsgBody_Request& req_target() const;
+  PROTOBUF_NODISCARD ::MsgBody_Request* release_req_target();
   ::MsgBody_Request* mutable_req_target();
-  ::MsgBody_Request* release_req_target();
   void set_allocated_req_target(::MsgBody_Request* req_target);
+  private:
+  const ::MsgBody_Request& _internal_req_target() const;
+  ::MsgBody_Request* _internal_mutable_req_target();
+  public:
+  void unsafe_arena_set_allocated_req_target(
+      ::MsgBody_Request* req_target);
+  ::MsgBody_Request* unsafe_arena_release_req_target();
 
-  // optional .MsgBody.Response rsp_result = 2;
+  // .MsgBody.Response rsp_result = 2;
   bool has_rsp_result() const;
+  private:
+  bool _internal_has_rsp_result() const;
+  public:
   void clear_rsp_result();
-  static const int kRspResultFieldNumber = 2;
   const ::MsgBody_Response& rsp_result() const;
+  PROTOBUF_NODISCARD ::MsgBody_Response* release_rsp_result();
   ::MsgBody_Response* mutable_rsp_result();
-  ::MsgBody_Response* release_rsp_result();
   void set_allocated_rsp_result(::MsgBody_Response* rsp_result);
+  private:
+  const ::MsgBody_Response& _internal_rsp_result() const;
+  ::MsgBody_Response* _internal_mutable_rsp_result();
+  public:
+  void unsafe_arena_set_allocated_rsp_result(
+      ::MsgBody_Response* rsp_result);
+  ::MsgBody_Response* unsafe_arena_release_rsp_result();
 
-  // optional bytes data = 3;
-  void clear_data();
-  static const int kDataFieldNumber = 3;
-  const ::std::string& data() const;
-  void set_data(const ::std::string& value);
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
-  ::std::string* mutable_data();
-  ::std::string* release_data();
-  void set_allocated_data(::std::string* data);
-
-  // optional bytes add_on = 4;
-  void clear_add_on();
-  static const int kAddOnFieldNumber = 4;
-  const ::std::string& add_on() const;
-  void set_add_on(const ::std::string& value);
-  void set_add_on(const char* value);
-  void set_add_on(const void* value, size_t size);
-  ::std::string* mutable_add_on();
-  ::std::string* release_add_on();
-  void set_allocated_add_on(::std::string* add_on);
-
-  // optional string trace_id = 5;
-  void clear_trace_id();
-  static const int kTraceIdFieldNumber = 5;
-  const ::std::string& trace_id() const;
-  void set_trace_id(const ::std::string& value);
-  void set_trace_id(const char* value);
-  void set_trace_id(const char* value, size_t size);
-  ::std::string* mutable_trace_id();
-  ::std::string* release_trace_id();
-  void set_allocated_trace_id(::std::string* trace_id);
-
+  void clear_msg_type();
   MsgTypeCase msg_type_case() const;
   // @@protoc_insertion_point(class_scope:MsgBody)
  private:
-  inline void set_has_req_target();
-  inline void set_has_rsp_result();
+  class _Internal;
+  void set_has_req_target();
+  void set_has_rsp_result();
 
   inline bool has_msg_type() const;
-  void clear_msg_type();
   inline void clear_has_msg_type();
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr data_;
-  ::google::protobuf::internal::ArenaStringPtr add_on_;
-  ::google::protobuf::internal::ArenaStringPtr trace_id_;
-  union MsgTypeUnion {
-    MsgTypeUnion() {}
-    ::MsgBody_Request* req_target_;
-    ::MsgBody_Response* rsp_result_;
-  } msg_type_;
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _oneof_case_[1];
-
-  friend void  protobuf_AddDesc_msg_2eproto();
-  friend void protobuf_AssignDesc_msg_2eproto();
-  friend void protobuf_ShutdownFile_msg_2eproto();
-
-  void InitAsDefaultInstance();
-  static MsgBody* default_instance_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr add_on_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr trace_id_;
+    union MsgTypeUnion {
+      constexpr MsgTypeUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::MsgBody_Request* req_target_;
+      ::MsgBody_Response* rsp_result_;
+    } msg_type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_msg_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
-#if !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // MsgHead
 
-// optional fixed32 cmd = 1;
+// fixed32 cmd = 1;
 inline void MsgHead::clear_cmd() {
-  cmd_ = 0u;
+  _impl_.cmd_ = 0u;
 }
-inline ::google::protobuf::uint32 MsgHead::cmd() const {
+inline uint32_t MsgHead::_internal_cmd() const {
+  return _impl_.cmd_;
+}
+inline uint32_t MsgHead::cmd() const {
   // @@protoc_insertion_point(field_get:MsgHead.cmd)
-  return cmd_;
+  return _internal_cmd();
 }
-inline void MsgHead::set_cmd(::google::protobuf::uint32 value) {
+inline void MsgHead::_internal_set_cmd(uint32_t value) {
   
-  cmd_ = value;
+  _impl_.cmd_ = value;
+}
+inline void MsgHead::set_cmd(uint32_t value) {
+  _internal_set_cmd(value);
   // @@protoc_insertion_point(field_set:MsgHead.cmd)
 }
 
-// optional fixed32 seq = 2;
+// fixed32 seq = 2;
 inline void MsgHead::clear_seq() {
-  seq_ = 0u;
+  _impl_.seq_ = 0u;
 }
-inline ::google::protobuf::uint32 MsgHead::seq() const {
+inline uint32_t MsgHead::_internal_seq() const {
+  return _impl_.seq_;
+}
+inline uint32_t MsgHead::seq() const {
   // @@protoc_insertion_point(field_get:MsgHead.seq)
-  return seq_;
+  return _internal_seq();
 }
-inline void MsgHead::set_seq(::google::protobuf::uint32 value) {
+inline void MsgHead::_internal_set_seq(uint32_t value) {
   
-  seq_ = value;
+  _impl_.seq_ = value;
+}
+inline void MsgHead::set_seq(uint32_t value) {
+  _internal_set_seq(value);
   // @@protoc_insertion_point(field_set:MsgHead.seq)
 }
 
-// optional sfixed32 len = 3;
+// sfixed32 len = 3;
 inline void MsgHead::clear_len() {
-  len_ = 0;
+  _impl_.len_ = 0;
+}
+inline int32_t MsgHead::_internal_len() const {
+  return _impl_.len_;
 }
-inline ::google::protobuf::int32 MsgHead::len() const {
+inline int32_t MsgHead::len() const {
   // @@protoc_insertion_point(field_get:MsgHead.len)
-  return len_;
+  return _internal_len();
 }
-inline void MsgHead::set_len(::google::protobuf::int32 value) {
+inline void MsgHead::_internal_set_len(int32_t value) {
   
-  len_ = value;
+  _impl_.len_ = value;
+}
+inline void MsgHead::set_len(int32_t value) {
+  _internal_set_len(value);
   // @@protoc_insertion_point(field_set:MsgHead.len)
 }
 
@@ -529,61 +883,73 @@ inline void MsgHead::set_len(::google::protobuf::int32 value) {
 
 // MsgBody_Request
 
-// optional uint32 route_id = 1;
+// uint32 route_id = 1;
 inline void MsgBody_Request::clear_route_id() {
-  route_id_ = 0u;
+  _impl_.route_id_ = 0u;
+}
+inline uint32_t MsgBody_Request::_internal_route_id() const {
+  return _impl_.route_id_;
 }
-inline ::google::protobuf::uint32 MsgBody_Request::route_id() const {
+inline uint32_t MsgBody_Request::route_id() const {
   // @@protoc_insertion_point(field_get:MsgBody.Request.route_id)
-  return route_id_;
+  return _internal_route_id();
 }
-inline void MsgBody_Request::set_route_id(::google::protobuf::uint32 value) {
+inline void MsgBody_Request::_internal_set_route_id(uint32_t value) {
   
-  route_id_ = value;
+  _impl_.route_id_ = value;
+}
+inline void MsgBody_Request::set_route_id(uint32_t value) {
+  _internal_set_route_id(value);
   // @@protoc_insertion_point(field_set:MsgBody.Request.route_id)
 }
 
-// optional string route = 2;
+// string route = 2;
 inline void MsgBody_Request::clear_route() {
-  route_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.route_.ClearToEmpty();
 }
-inline const ::std::string& MsgBody_Request::route() const {
+inline const std::string& MsgBody_Request::route() const {
   // @@protoc_insertion_point(field_get:MsgBody.Request.route)
-  return route_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_route();
 }
-inline void MsgBody_Request::set_route(const ::std::string& value) {
-  
-  route_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MsgBody_Request::set_route(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.route_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:MsgBody.Request.route)
 }
-inline void MsgBody_Request::set_route(const char* value) {
-  
-  route_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:MsgBody.Request.route)
+inline std::string* MsgBody_Request::mutable_route() {
+  std::string* _s = _internal_mutable_route();
+  // @@protoc_insertion_point(field_mutable:MsgBody.Request.route)
+  return _s;
 }
-inline void MsgBody_Request::set_route(const char* value, size_t size) {
+inline const std::string& MsgBody_Request::_internal_route() const {
+  return _impl_.route_.Get();
+}
+inline void MsgBody_Request::_internal_set_route(const std::string& value) {
   
-  route_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:MsgBody.Request.route)
+  _impl_.route_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* MsgBody_Request::mutable_route() {
+inline std::string* MsgBody_Request::_internal_mutable_route() {
   
-  // @@protoc_insertion_point(field_mutable:MsgBody.Request.route)
-  return route_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.route_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* MsgBody_Request::release_route() {
+inline std::string* MsgBody_Request::release_route() {
   // @@protoc_insertion_point(field_release:MsgBody.Request.route)
-  
-  return route_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.route_.Release();
 }
-inline void MsgBody_Request::set_allocated_route(::std::string* route) {
-  if (route != NULL) {
+inline void MsgBody_Request::set_allocated_route(std::string* route) {
+  if (route != nullptr) {
     
   } else {
     
   }
-  route_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), route);
+  _impl_.route_.SetAllocated(route, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.route_.IsDefault()) {
+    _impl_.route_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:MsgBody.Request.route)
 }
 
@@ -591,61 +957,73 @@ inline void MsgBody_Request::set_allocated_route(::std::string* route) {
 
 // MsgBody_Response
 
-// optional int32 code = 1;
+// int32 code = 1;
 inline void MsgBody_Response::clear_code() {
-  code_ = 0;
+  _impl_.code_ = 0;
 }
-inline ::google::protobuf::int32 MsgBody_Response::code() const {
+inline int32_t MsgBody_Response::_internal_code() const {
+  return _impl_.code_;
+}
+inline int32_t MsgBody_Response::code() const {
   // @@protoc_insertion_point(field_get:MsgBody.Response.code)
-  return code_;
+  return _internal_code();
 }
-inline void MsgBody_Response::set_code(::google::protobuf::int32 value) {
+inline void MsgBody_Response::_internal_set_code(int32_t value) {
   
-  code_ = value;
+  _impl_.code_ = value;
+}
+inline void MsgBody_Response::set_code(int32_t value) {
+  _internal_set_code(value);
   // @@protoc_insertion_point(field_set:MsgBody.Response.code)
 }
 
-// optional bytes msg = 2;
+// bytes msg = 2;
 inline void MsgBody_Response::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.msg_.ClearToEmpty();
 }
-inline const ::std::string& MsgBody_Response::msg() const {
+inline const std::string& MsgBody_Response::msg() const {
   // @@protoc_insertion_point(field_get:MsgBody.Response.msg)
-  return msg_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_msg();
 }
-inline void MsgBody_Response::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MsgBody_Response::set_msg(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:MsgBody.Response.msg)
 }
-inline void MsgBody_Response::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:MsgBody.Response.msg)
+inline std::string* MsgBody_Response::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:MsgBody.Response.msg)
+  return _s;
+}
+inline const std::string& MsgBody_Response::_internal_msg() const {
+  return _impl_.msg_.Get();
 }
-inline void MsgBody_Response::set_msg(const void* value, size_t size) {
+inline void MsgBody_Response::_internal_set_msg(const std::string& value) {
   
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:MsgBody.Response.msg)
+  _impl_.msg_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* MsgBody_Response::mutable_msg() {
+inline std::string* MsgBody_Response::_internal_mutable_msg() {
   
-  // @@protoc_insertion_point(field_mutable:MsgBody.Response.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* MsgBody_Response::release_msg() {
+inline std::string* MsgBody_Response::release_msg() {
   // @@protoc_insertion_point(field_release:MsgBody.Response.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.msg_.Release();
 }
-inline void MsgBody_Response::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
+inline void MsgBody_Response::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
     
   } else {
     
   }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:MsgBody.Response.msg)
 }
 
@@ -653,231 +1031,301 @@ inline void MsgBody_Response::set_allocated_msg(::std::string* msg) {
 
 // MsgBody
 
-// optional .MsgBody.Request req_target = 1;
-inline bool MsgBody::has_req_target() const {
+// .MsgBody.Request req_target = 1;
+inline bool MsgBody::_internal_has_req_target() const {
   return msg_type_case() == kReqTarget;
 }
+inline bool MsgBody::has_req_target() const {
+  return _internal_has_req_target();
+}
 inline void MsgBody::set_has_req_target() {
-  _oneof_case_[0] = kReqTarget;
+  _impl_._oneof_case_[0] = kReqTarget;
 }
 inline void MsgBody::clear_req_target() {
-  if (has_req_target()) {
-    delete msg_type_.req_target_;
+  if (_internal_has_req_target()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_type_.req_target_;
+    }
     clear_has_msg_type();
   }
 }
-inline  const ::MsgBody_Request& MsgBody::req_target() const {
-  // @@protoc_insertion_point(field_get:MsgBody.req_target)
-  return has_req_target()
-      ? *msg_type_.req_target_
-      : ::MsgBody_Request::default_instance();
-}
-inline ::MsgBody_Request* MsgBody::mutable_req_target() {
-  if (!has_req_target()) {
-    clear_msg_type();
-    set_has_req_target();
-    msg_type_.req_target_ = new ::MsgBody_Request;
-  }
-  // @@protoc_insertion_point(field_mutable:MsgBody.req_target)
-  return msg_type_.req_target_;
-}
 inline ::MsgBody_Request* MsgBody::release_req_target() {
   // @@protoc_insertion_point(field_release:MsgBody.req_target)
-  if (has_req_target()) {
+  if (_internal_has_req_target()) {
+    clear_has_msg_type();
+    ::MsgBody_Request* temp = _impl_.msg_type_.req_target_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_type_.req_target_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::MsgBody_Request& MsgBody::_internal_req_target() const {
+  return _internal_has_req_target()
+      ? *_impl_.msg_type_.req_target_
+      : reinterpret_cast< ::MsgBody_Request&>(::_MsgBody_Request_default_instance_);
+}
+inline const ::MsgBody_Request& MsgBody::req_target() const {
+  // @@protoc_insertion_point(field_get:MsgBody.req_target)
+  return _internal_req_target();
+}
+inline ::MsgBody_Request* MsgBody::unsafe_arena_release_req_target() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:MsgBody.req_target)
+  if (_internal_has_req_target()) {
     clear_has_msg_type();
-    ::MsgBody_Request* temp = msg_type_.req_target_;
-    msg_type_.req_target_ = NULL;
+    ::MsgBody_Request* temp = _impl_.msg_type_.req_target_;
+    _impl_.msg_type_.req_target_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
-inline void MsgBody::set_allocated_req_target(::MsgBody_Request* req_target) {
+inline void MsgBody::unsafe_arena_set_allocated_req_target(::MsgBody_Request* req_target) {
   clear_msg_type();
   if (req_target) {
     set_has_req_target();
-    msg_type_.req_target_ = req_target;
+    _impl_.msg_type_.req_target_ = req_target;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:MsgBody.req_target)
+}
+inline ::MsgBody_Request* MsgBody::_internal_mutable_req_target() {
+  if (!_internal_has_req_target()) {
+    clear_msg_type();
+    set_has_req_target();
+    _impl_.msg_type_.req_target_ = CreateMaybeMessage< ::MsgBody_Request >(GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(field_set_allocated:MsgBody.req_target)
+  return _impl_.msg_type_.req_target_;
+}
+inline ::MsgBody_Request* MsgBody::mutable_req_target() {
+  ::MsgBody_Request* _msg = _internal_mutable_req_target();
+  // @@protoc_insertion_point(field_mutable:MsgBody.req_target)
+  return _msg;
 }
 
-// optional .MsgBody.Response rsp_result = 2;
-inline bool MsgBody::has_rsp_result() const {
+// .MsgBody.Response rsp_result = 2;
+inline bool MsgBody::_internal_has_rsp_result() const {
   return msg_type_case() == kRspResult;
 }
+inline bool MsgBody::has_rsp_result() const {
+  return _internal_has_rsp_result();
+}
 inline void MsgBody::set_has_rsp_result() {
-  _oneof_case_[0] = kRspResult;
+  _impl_._oneof_case_[0] = kRspResult;
 }
 inline void MsgBody::clear_rsp_result() {
-  if (has_rsp_result()) {
-    delete msg_type_.rsp_result_;
+  if (_internal_has_rsp_result()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_type_.rsp_result_;
+    }
     clear_has_msg_type();
   }
 }
-inline  const ::MsgBody_Response& MsgBody::rsp_result() const {
-  // @@protoc_insertion_point(field_get:MsgBody.rsp_result)
-  return has_rsp_result()
-      ? *msg_type_.rsp_result_
-      : ::MsgBody_Response::default_instance();
-}
-inline ::MsgBody_Response* MsgBody::mutable_rsp_result() {
-  if (!has_rsp_result()) {
-    clear_msg_type();
-    set_has_rsp_result();
-    msg_type_.rsp_result_ = new ::MsgBody_Response;
-  }
-  // @@protoc_insertion_point(field_mutable:MsgBody.rsp_result)
-  return msg_type_.rsp_result_;
-}
 inline ::MsgBody_Response* MsgBody::release_rsp_result() {
   // @@protoc_insertion_point(field_release:MsgBody.rsp_result)
-  if (has_rsp_result()) {
+  if (_internal_has_rsp_result()) {
+    clear_has_msg_type();
+    ::MsgBody_Response* temp = _impl_.msg_type_.rsp_result_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_type_.rsp_result_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::MsgBody_Response& MsgBody::_internal_rsp_result() const {
+  return _internal_has_rsp_result()
+      ? *_impl_.msg_type_.rsp_result_
+      : reinterpret_cast< ::MsgBody_Response&>(::_MsgBody_Response_default_instance_);
+}
+inline const ::MsgBody_Response& MsgBody::rsp_result() const {
+  // @@protoc_insertion_point(field_get:MsgBody.rsp_result)
+  return _internal_rsp_result();
+}
+inline ::MsgBody_Response* MsgBody::unsafe_arena_release_rsp_result() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:MsgBody.rsp_result)
+  if (_internal_has_rsp_result()) {
     clear_has_msg_type();
-    ::MsgBody_Response* temp = msg_type_.rsp_result_;
-    msg_type_.rsp_result_ = NULL;
+    ::MsgBody_Response* temp = _impl_.msg_type_.rsp_result_;
+    _impl_.msg_type_.rsp_result_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
-inline void MsgBody::set_allocated_rsp_result(::MsgBody_Response* rsp_result) {
+inline void MsgBody::unsafe_arena_set_allocated_rsp_result(::MsgBody_Response* rsp_result) {
   clear_msg_type();
   if (rsp_result) {
     set_has_rsp_result();
-    msg_type_.rsp_result_ = rsp_result;
+    _impl_.msg_type_.rsp_result_ = rsp_result;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:MsgBody.rsp_result)
+}
+inline ::MsgBody_Response* MsgBody::_internal_mutable_rsp_result() {
+  if (!_internal_has_rsp_result()) {
+    clear_msg_type();
+    set_has_rsp_result();
+    _impl_.msg_type_.rsp_result_ = CreateMaybeMessage< ::MsgBody_Response >(GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(field_set_allocated:MsgBody.rsp_result)
+  return _impl_.msg_type_.rsp_result_;
+}
+inline ::MsgBody_Response* MsgBody::mutable_rsp_result() {
+  ::MsgBody_Response* _msg = _internal_mutable_rsp_result();
+  // @@protoc_insertion_point(field_mutable:MsgBody.rsp_result)
+  return _msg;
 }
 
-// optional bytes data = 3;
+// bytes data = 3;
 inline void MsgBody::clear_data() {
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.data_.ClearToEmpty();
 }
-inline const ::std::string& MsgBody::data() const {
+inline const std::string& MsgBody::data() const {
   // @@protoc_insertion_point(field_get:MsgBody.data)
-  return data_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_data();
 }
-inline void MsgBody::set_data(const ::std::string& value) {
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MsgBody::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:MsgBody.data)
 }
-inline void MsgBody::set_data(const char* value) {
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:MsgBody.data)
+inline std::string* MsgBody::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:MsgBody.data)
+  return _s;
 }
-inline void MsgBody::set_data(const void* value, size_t size) {
+inline const std::string& MsgBody::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void MsgBody::_internal_set_data(const std::string& value) {
   
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:MsgBody.data)
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* MsgBody::mutable_data() {
+inline std::string* MsgBody::_internal_mutable_data() {
   
-  // @@protoc_insertion_point(field_mutable:MsgBody.data)
-  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* MsgBody::release_data() {
+inline std::string* MsgBody::release_data() {
   // @@protoc_insertion_point(field_release:MsgBody.data)
-  
-  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_.Release();
 }
-inline void MsgBody::set_allocated_data(::std::string* data) {
-  if (data != NULL) {
+inline void MsgBody::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
     
   } else {
     
   }
-  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:MsgBody.data)
 }
 
-// optional bytes add_on = 4;
+// bytes add_on = 4;
 inline void MsgBody::clear_add_on() {
-  add_on_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.add_on_.ClearToEmpty();
 }
-inline const ::std::string& MsgBody::add_on() const {
+inline const std::string& MsgBody::add_on() const {
   // @@protoc_insertion_point(field_get:MsgBody.add_on)
-  return add_on_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_add_on();
 }
-inline void MsgBody::set_add_on(const ::std::string& value) {
-  
-  add_on_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MsgBody::set_add_on(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.add_on_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:MsgBody.add_on)
 }
-inline void MsgBody::set_add_on(const char* value) {
-  
-  add_on_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:MsgBody.add_on)
+inline std::string* MsgBody::mutable_add_on() {
+  std::string* _s = _internal_mutable_add_on();
+  // @@protoc_insertion_point(field_mutable:MsgBody.add_on)
+  return _s;
+}
+inline const std::string& MsgBody::_internal_add_on() const {
+  return _impl_.add_on_.Get();
 }
-inline void MsgBody::set_add_on(const void* value, size_t size) {
+inline void MsgBody::_internal_set_add_on(const std::string& value) {
   
-  add_on_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:MsgBody.add_on)
+  _impl_.add_on_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* MsgBody::mutable_add_on() {
+inline std::string* MsgBody::_internal_mutable_add_on() {
   
-  // @@protoc_insertion_point(field_mutable:MsgBody.add_on)
-  return add_on_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.add_on_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* MsgBody::release_add_on() {
+inline std::string* MsgBody::release_add_on() {
   // @@protoc_insertion_point(field_release:MsgBody.add_on)
-  
-  return add_on_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.add_on_.Release();
 }
-inline void MsgBody::set_allocated_add_on(::std::string* add_on) {
-  if (add_on != NULL) {
+inline void MsgBody::set_allocated_add_on(std::string* add_on) {
+  if (add_on != nullptr) {
     
   } else {
     
   }
-  add_on_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), add_on);
+  _impl_.add_on_.SetAllocated(add_on, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.add_on_.IsDefault()) {
+    _impl_.add_on_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:MsgBody.add_on)
 }
 
-// optional string trace_id = 5;
+// string trace_id = 5;
 inline void MsgBody::clear_trace_id() {
-  trace_id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.trace_id_.ClearToEmpty();
 }
-inline const ::std::string& MsgBody::trace_id() const {
+inline const std::string& MsgBody::trace_id() const {
   // @@protoc_insertion_point(field_get:MsgBody.trace_id)
-  return trace_id_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_trace_id();
 }
-inline void MsgBody::set_trace_id(const ::std::string& value) {
-  
-  trace_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MsgBody::set_trace_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.trace_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:MsgBody.trace_id)
 }
-inline void MsgBody::set_trace_id(const char* value) {
-  
-  trace_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:MsgBody.trace_id)
+inline std::string* MsgBody::mutable_trace_id() {
+  std::string* _s = _internal_mutable_trace_id();
+  // @@protoc_insertion_point(field_mutable:MsgBody.trace_id)
+  return _s;
 }
-inline void MsgBody::set_trace_id(const char* value, size_t size) {
+inline const std::string& MsgBody::_internal_trace_id() const {
+  return _impl_.trace_id_.Get();
+}
+inline void MsgBody::_internal_set_trace_id(const std::string& value) {
   
-  trace_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:MsgBody.trace_id)
+  _impl_.trace_id_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* MsgBody::mutable_trace_id() {
+inline std::string* MsgBody::_internal_mutable_trace_id() {
   
-  // @@protoc_insertion_point(field_mutable:MsgBody.trace_id)
-  return trace_id_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.trace_id_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* MsgBody::release_trace_id() {
+inline std::string* MsgBody::release_trace_id() {
   // @@protoc_insertion_point(field_release:MsgBody.trace_id)
-  
-  return trace_id_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.trace_id_.Release();
 }
-inline void MsgBody::set_allocated_trace_id(::std::string* trace_id) {
-  if (trace_id != NULL) {
+inline void MsgBody::set_allocated_trace_id(std::string* trace_id) {
+  if (trace_id != nullptr) {
     
   } else {
     
   }
-  trace_id_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), trace_id);
+  _impl_.trace_id_.SetAllocated(trace_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.trace_id_.IsDefault()) {
+    _impl_.trace_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:MsgBody.trace_id)
 }
 
@@ -885,12 +1333,14 @@ inline bool MsgBody::has_msg_type() const {
   return msg_type_case() != MSG_TYPE_NOT_SET;
 }
 inline void MsgBody::clear_has_msg_type() {
-  _oneof_case_[0] = MSG_TYPE_NOT_SET;
+  _impl_._oneof_case_[0] = MSG_TYPE_NOT_SET;
 }
 inline MsgBody::MsgTypeCase MsgBody::msg_type_case() const {
-  return MsgBody::MsgTypeCase(_oneof_case_[0]);
+  return MsgBody::MsgTypeCase(_impl_._oneof_case_[0]);
 }
-#endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
 // -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
@@ -900,6 +1350,8 @@ inline MsgBody::MsgTypeCase MsgBody::msg_type_case() const {
 
 // @@protoc_insertion_point(namespace_scope)
 
+
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_msg_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_msg_2eproto
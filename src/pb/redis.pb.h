@@ -1,45 +1,61 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: redis.proto
 
-#ifndef PROTOBUF_redis_2eproto__INCLUDED
-#define PROTOBUF_redis_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_redis_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_redis_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3000000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3000000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_redis_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_redis_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_redis_2eproto;
 namespace neb {
-
-// Internal implementation detail -- do not call these.
-void protobuf_AddDesc_redis_2eproto();
-void protobuf_AssignDesc_redis_2eproto();
-void protobuf_ShutdownFile_redis_2eproto();
-
 class RedisReply;
+struct RedisReplyDefaultTypeInternal;
+extern RedisReplyDefaultTypeInternal _RedisReply_default_instance_;
+}  // namespace neb
+PROTOBUF_NAMESPACE_OPEN
+template<> ::neb::RedisReply* Arena::CreateMaybeMessage<::neb::RedisReply>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace neb {
 
-enum E_REDIS_ERR {
+enum E_REDIS_ERR : int {
   REDIS_OK = 0,
   REDIS_ERR_IO = 1,
   REDIS_ERR_OTHER = 2,
@@ -47,25 +63,29 @@ enum E_REDIS_ERR {
   REDIS_ERR_PROTOCOL = 4,
   REDIS_ERR_OOM = 5,
   REDIS_ERR = -1,
-  E_REDIS_ERR_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  E_REDIS_ERR_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  E_REDIS_ERR_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  E_REDIS_ERR_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool E_REDIS_ERR_IsValid(int value);
-const E_REDIS_ERR E_REDIS_ERR_MIN = REDIS_ERR;
-const E_REDIS_ERR E_REDIS_ERR_MAX = REDIS_ERR_OOM;
-const int E_REDIS_ERR_ARRAYSIZE = E_REDIS_ERR_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* E_REDIS_ERR_descriptor();
-inline const ::std::string& E_REDIS_ERR_Name(E_REDIS_ERR value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    E_REDIS_ERR_descriptor(), value);
+constexpr E_REDIS_ERR E_REDIS_ERR_MIN = REDIS_ERR;
+constexpr E_REDIS_ERR E_REDIS_ERR_MAX = REDIS_ERR_OOM;
+constexpr int E_REDIS_ERR_ARRAYSIZE = E_REDIS_ERR_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* E_REDIS_ERR_descriptor();
+template<typename T>
+inline const std::string& E_REDIS_ERR_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, E_REDIS_ERR>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function E_REDIS_ERR_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    E_REDIS_ERR_descriptor(), enum_t_value);
 }
 inline bool E_REDIS_ERR_Parse(
-    const ::std::string& name, E_REDIS_ERR* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<E_REDIS_ERR>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, E_REDIS_ERR* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<E_REDIS_ERR>(
     E_REDIS_ERR_descriptor(), name, value);
 }
-enum E_REDIS_REPLY {
+enum E_REDIS_REPLY : int {
   REDIS_REPLY_UNDEFINE = 0,
   REDIS_REPLY_STRING = 1,
   REDIS_REPLY_ARRAY = 2,
@@ -73,273 +93,388 @@ enum E_REDIS_REPLY {
   REDIS_REPLY_NIL = 4,
   REDIS_REPLY_STATUS = 5,
   REDIS_REPLY_ERROR = 6,
-  E_REDIS_REPLY_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  E_REDIS_REPLY_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  E_REDIS_REPLY_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  E_REDIS_REPLY_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool E_REDIS_REPLY_IsValid(int value);
-const E_REDIS_REPLY E_REDIS_REPLY_MIN = REDIS_REPLY_UNDEFINE;
-const E_REDIS_REPLY E_REDIS_REPLY_MAX = REDIS_REPLY_ERROR;
-const int E_REDIS_REPLY_ARRAYSIZE = E_REDIS_REPLY_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* E_REDIS_REPLY_descriptor();
-inline const ::std::string& E_REDIS_REPLY_Name(E_REDIS_REPLY value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    E_REDIS_REPLY_descriptor(), value);
+constexpr E_REDIS_REPLY E_REDIS_REPLY_MIN = REDIS_REPLY_UNDEFINE;
+constexpr E_REDIS_REPLY E_REDIS_REPLY_MAX = REDIS_REPLY_ERROR;
+constexpr int E_REDIS_REPLY_ARRAYSIZE = E_REDIS_REPLY_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* E_REDIS_REPLY_descriptor();
+template<typename T>
+inline const std::string& E_REDIS_REPLY_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, E_REDIS_REPLY>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function E_REDIS_REPLY_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    E_REDIS_REPLY_descriptor(), enum_t_value);
 }
 inline bool E_REDIS_REPLY_Parse(
-    const ::std::string& name, E_REDIS_REPLY* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<E_REDIS_REPLY>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, E_REDIS_REPLY* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<E_REDIS_REPLY>(
     E_REDIS_REPLY_descriptor(), name, value);
 }
 // ===================================================================
 
-class RedisReply : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:neb.RedisReply) */ {
+class RedisReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:neb.RedisReply) */ {
  public:
-  RedisReply();
-  virtual ~RedisReply();
+  inline RedisReply() : RedisReply(nullptr) {}
+  ~RedisReply() override;
+  explicit PROTOBUF_CONSTEXPR RedisReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RedisReply(const RedisReply& from);
+  RedisReply(RedisReply&& from) noexcept
+    : RedisReply() {
+    *this = ::std::move(from);
+  }
 
   inline RedisReply& operator=(const RedisReply& from) {
     CopyFrom(from);
     return *this;
   }
+  inline RedisReply& operator=(RedisReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RedisReply& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RedisReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RedisReply* internal_default_instance() {
+    return reinterpret_cast<const RedisReply*>(
+               &_RedisReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(RedisReply* other);
+  friend void swap(RedisReply& a, RedisReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RedisReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RedisReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RedisReply* New() const { return New(NULL); }
-
-  RedisReply* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  RedisReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RedisReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RedisReply& from);
-  void MergeFrom(const RedisReply& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RedisReply& from) {
+    RedisReply::MergeImpl(*this, from);
   }
-  int GetCachedSize() const { return _cached_size_; }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(RedisReply* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "neb.RedisReply";
   }
+  protected:
+  explicit RedisReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional int32 type = 1;
-  void clear_type();
-  static const int kTypeFieldNumber = 1;
-  ::google::protobuf::int32 type() const;
-  void set_type(::google::protobuf::int32 value);
-
-  // optional int64 integer = 2;
-  void clear_integer();
-  static const int kIntegerFieldNumber = 2;
-  ::google::protobuf::int64 integer() const;
-  void set_integer(::google::protobuf::int64 value);
-
-  // optional bytes str = 3;
-  void clear_str();
-  static const int kStrFieldNumber = 3;
-  const ::std::string& str() const;
-  void set_str(const ::std::string& value);
-  void set_str(const char* value);
-  void set_str(const void* value, size_t size);
-  ::std::string* mutable_str();
-  ::std::string* release_str();
-  void set_allocated_str(::std::string* str);
-
+  enum : int {
+    kElementFieldNumber = 4,
+    kStrFieldNumber = 3,
+    kIntegerFieldNumber = 2,
+    kTypeFieldNumber = 1,
+  };
   // repeated .neb.RedisReply element = 4;
   int element_size() const;
+  private:
+  int _internal_element_size() const;
+  public:
   void clear_element();
-  static const int kElementFieldNumber = 4;
-  const ::neb::RedisReply& element(int index) const;
   ::neb::RedisReply* mutable_element(int index);
-  ::neb::RedisReply* add_element();
-  ::google::protobuf::RepeatedPtrField< ::neb::RedisReply >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::neb::RedisReply >*
       mutable_element();
-  const ::google::protobuf::RepeatedPtrField< ::neb::RedisReply >&
+  private:
+  const ::neb::RedisReply& _internal_element(int index) const;
+  ::neb::RedisReply* _internal_add_element();
+  public:
+  const ::neb::RedisReply& element(int index) const;
+  ::neb::RedisReply* add_element();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::neb::RedisReply >&
       element() const;
 
+  // bytes str = 3;
+  void clear_str();
+  const std::string& str() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_str(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_str();
+  PROTOBUF_NODISCARD std::string* release_str();
+  void set_allocated_str(std::string* str);
+  private:
+  const std::string& _internal_str() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_str(const std::string& value);
+  std::string* _internal_mutable_str();
+  public:
+
+  // int64 integer = 2;
+  void clear_integer();
+  int64_t integer() const;
+  void set_integer(int64_t value);
+  private:
+  int64_t _internal_integer() const;
+  void _internal_set_integer(int64_t value);
+  public:
+
+  // int32 type = 1;
+  void clear_type();
+  int32_t type() const;
+  void set_type(int32_t value);
+  private:
+  int32_t _internal_type() const;
+  void _internal_set_type(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:neb.RedisReply)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::int64 integer_;
-  ::google::protobuf::internal::ArenaStringPtr str_;
-  ::google::protobuf::RepeatedPtrField< ::neb::RedisReply > element_;
-  ::google::protobuf::int32 type_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_redis_2eproto();
-  friend void protobuf_AssignDesc_redis_2eproto();
-  friend void protobuf_ShutdownFile_redis_2eproto();
-
-  void InitAsDefaultInstance();
-  static RedisReply* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::neb::RedisReply > element_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr str_;
+    int64_t integer_;
+    int32_t type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_redis_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
-#if !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // RedisReply
 
-// optional int32 type = 1;
+// int32 type = 1;
 inline void RedisReply::clear_type() {
-  type_ = 0;
+  _impl_.type_ = 0;
+}
+inline int32_t RedisReply::_internal_type() const {
+  return _impl_.type_;
 }
-inline ::google::protobuf::int32 RedisReply::type() const {
+inline int32_t RedisReply::type() const {
   // @@protoc_insertion_point(field_get:neb.RedisReply.type)
-  return type_;
+  return _internal_type();
 }
-inline void RedisReply::set_type(::google::protobuf::int32 value) {
+inline void RedisReply::_internal_set_type(int32_t value) {
   
-  type_ = value;
+  _impl_.type_ = value;
+}
+inline void RedisReply::set_type(int32_t value) {
+  _internal_set_type(value);
   // @@protoc_insertion_point(field_set:neb.RedisReply.type)
 }
 
-// optional int64 integer = 2;
+// int64 integer = 2;
 inline void RedisReply::clear_integer() {
-  integer_ = GOOGLE_LONGLONG(0);
+  _impl_.integer_ = int64_t{0};
 }
-inline ::google::protobuf::int64 RedisReply::integer() const {
+inline int64_t RedisReply::_internal_integer() const {
+  return _impl_.integer_;
+}
+inline int64_t RedisReply::integer() const {
   // @@protoc_insertion_point(field_get:neb.RedisReply.integer)
-  return integer_;
+  return _internal_integer();
 }
-inline void RedisReply::set_integer(::google::protobuf::int64 value) {
+inline void RedisReply::_internal_set_integer(int64_t value) {
   
-  integer_ = value;
+  _impl_.integer_ = value;
+}
+inline void RedisReply::set_integer(int64_t value) {
+  _internal_set_integer(value);
   // @@protoc_insertion_point(field_set:neb.RedisReply.integer)
 }
 
-// optional bytes str = 3;
+// bytes str = 3;
 inline void RedisReply::clear_str() {
-  str_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.str_.ClearToEmpty();
 }
-inline const ::std::string& RedisReply::str() const {
+inline const std::string& RedisReply::str() const {
   // @@protoc_insertion_point(field_get:neb.RedisReply.str)
-  return str_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_str();
 }
-inline void RedisReply::set_str(const ::std::string& value) {
-  
-  str_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RedisReply::set_str(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.str_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:neb.RedisReply.str)
 }
-inline void RedisReply::set_str(const char* value) {
-  
-  str_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:neb.RedisReply.str)
+inline std::string* RedisReply::mutable_str() {
+  std::string* _s = _internal_mutable_str();
+  // @@protoc_insertion_point(field_mutable:neb.RedisReply.str)
+  return _s;
 }
-inline void RedisReply::set_str(const void* value, size_t size) {
+inline const std::string& RedisReply::_internal_str() const {
+  return _impl_.str_.Get();
+}
+inline void RedisReply::_internal_set_str(const std::string& value) {
   
-  str_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:neb.RedisReply.str)
+  _impl_.str_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* RedisReply::mutable_str() {
+inline std::string* RedisReply::_internal_mutable_str() {
   
-  // @@protoc_insertion_point(field_mutable:neb.RedisReply.str)
-  return str_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.str_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* RedisReply::release_str() {
+inline std::string* RedisReply::release_str() {
   // @@protoc_insertion_point(field_release:neb.RedisReply.str)
-  
-  return str_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.str_.Release();
 }
-inline void RedisReply::set_allocated_str(::std::string* str) {
-  if (str != NULL) {
+inline void RedisReply::set_allocated_str(std::string* str) {
+  if (str != nullptr) {
     
   } else {
     
   }
-  str_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), str);
+  _impl_.str_.SetAllocated(str, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.str_.IsDefault()) {
+    _impl_.str_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:neb.RedisReply.str)
 }
 
 // repeated .neb.RedisReply element = 4;
+inline int RedisReply::_internal_element_size() const {
+  return _impl_.element_.size();
+}
 inline int RedisReply::element_size() const {
-  return element_.size();
+  return _internal_element_size();
 }
 inline void RedisReply::clear_element() {
-  element_.Clear();
+  _impl_.element_.Clear();
+}
+inline ::neb::RedisReply* RedisReply::mutable_element(int index) {
+  // @@protoc_insertion_point(field_mutable:neb.RedisReply.element)
+  return _impl_.element_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::neb::RedisReply >*
+RedisReply::mutable_element() {
+  // @@protoc_insertion_point(field_mutable_list:neb.RedisReply.element)
+  return &_impl_.element_;
+}
+inline const ::neb::RedisReply& RedisReply::_internal_element(int index) const {
+  return _impl_.element_.Get(index);
 }
 inline const ::neb::RedisReply& RedisReply::element(int index) const {
   // @@protoc_insertion_point(field_get:neb.RedisReply.element)
-  return element_.Get(index);
+  return _internal_element(index);
 }
-inline ::neb::RedisReply* RedisReply::mutable_element(int index) {
-  // @@protoc_insertion_point(field_mutable:neb.RedisReply.element)
-  return element_.Mutable(index);
+inline ::neb::RedisReply* RedisReply::_internal_add_element() {
+  return _impl_.element_.Add();
 }
 inline ::neb::RedisReply* RedisReply::add_element() {
+  ::neb::RedisReply* _add = _internal_add_element();
   // @@protoc_insertion_point(field_add:neb.RedisReply.element)
-  return element_.Add();
-}
-inline ::google::protobuf::RepeatedPtrField< ::neb::RedisReply >*
-RedisReply::mutable_element() {
-  // @@protoc_insertion_point(field_mutable_list:neb.RedisReply.element)
-  return &element_;
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::neb::RedisReply >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::neb::RedisReply >&
 RedisReply::element() const {
   // @@protoc_insertion_point(field_list:neb.RedisReply.element)
-  return element_;
+  return _impl_.element_;
 }
 
-#endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace neb
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
-template <> struct is_proto_enum< ::neb::E_REDIS_ERR> : ::google::protobuf::internal::true_type {};
+template <> struct is_proto_enum< ::neb::E_REDIS_ERR> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::neb::E_REDIS_ERR>() {
   return ::neb::E_REDIS_ERR_descriptor();
 }
-template <> struct is_proto_enum< ::neb::E_REDIS_REPLY> : ::google::protobuf::internal::true_type {};
+template <> struct is_proto_enum< ::neb::E_REDIS_REPLY> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::neb::E_REDIS_REPLY>() {
   return ::neb::E_REDIS_REPLY_descriptor();
 }
 
-}  // namespace protobuf
-}  // namespace google
-#endif  // SWIG
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_redis_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_redis_2eproto
@@ -0,0 +1,284 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     HttpRequestScanner.cpp
+ * @brief    http请求头快速扫描
+ * @author   Bwar
+ * @date:    2026年10月18日
+ * @note
+ * Modify history:
+ ******************************************************************************/
+#ifdef __SSE4_2__
+#include <nmmintrin.h>
+#endif
+#include "HttpRequestScanner.hpp"
+
+namespace neb
+{
+
+struct HttpMethodName
+{
+    const char* szName;
+    size_t uiLen;
+    int iMethod;
+};
+
+static const HttpMethodName s_astHttpMethod[] =
+{
+#define XX(num, name, string) {#string, sizeof(#string) - 1, num},
+    HTTP_METHOD_MAP(XX)
+#undef XX
+};
+
+static inline bool IsTokenChar(unsigned char c)
+{
+    if (((c | 0x20) >= 'a' && (c | 0x20) <= 'z') || (c >= '0' && c <= '9'))
+    {
+        return(true);
+    }
+    switch (c)
+    {
+        case '!': case '#': case '$': case '%': case '&': case '\'': case '*':
+        case '+': case '-': case '.': case '^': case '_': case '`': case '|': case '~':
+            return(true);
+        default:
+            return(false);
+    }
+}
+
+static inline bool IsUrlChar(unsigned char c)
+{
+    return(c > 0x20 && c != 0x7f);
+}
+
+static inline bool IsValueChar(unsigned char c)
+{
+    return((c >= 0x20 || c == '\t') && c != 0x7f);
+}
+
+/**
+ * @brief 跳过行尾
+ * @return 成功返回行尾之后的位置，nullptr表示数据不完整，pBuffEnd + 1表示格式错误
+ */
+static inline const char* SkipEol(const char* p, const char* pBuffEnd)
+{
+    if (p == pBuffEnd)
+    {
+        return(nullptr);
+    }
+    if ('\r' == *p)
+    {
+        ++p;
+        if (p == pBuffEnd)
+        {
+            return(nullptr);
+        }
+        if ('\n' != *p)
+        {
+            return(pBuffEnd + 1);
+        }
+        return(p + 1);
+    }
+    if ('\n' == *p)
+    {
+        return(p + 1);
+    }
+    return(pBuffEnd + 1);
+}
+
+HttpRequestScanner::HttpRequestScanner()
+    : m_iMethod(-1), m_iHttpMinor(0), m_iHeaderNum(0)
+{
+}
+
+HttpRequestScanner::~HttpRequestScanner()
+{
+}
+
+int HttpRequestScanner::Scan(const char* pBuff, size_t uiLen)
+{
+    // 字节范围（成对出现），落在范围内的字节即为要查找的分隔符；补齐16字节以便整块加载
+    static const char szUrlRanges[16] = "\000\040\177\177";
+    static const char szValueRanges[16] = "\000\010\012\037\177\177";
+    const char* p = pBuff;
+    const char* pBuffEnd = pBuff + uiLen;
+    m_iHeaderNum = 0;
+
+    // 请求行 method SP url SP HTTP/1.x CRLF
+    const char* pToken = p;
+    while (p < pBuffEnd && ' ' != *p)
+    {
+        if (!IsTokenChar(*p))
+        {
+            return(SCAN_ERROR);
+        }
+        ++p;
+    }
+    if (p == pBuffEnd)
+    {
+        return(SCAN_INCOMPLETE);
+    }
+    m_iMethod = MatchMethod(pToken, p - pToken);
+    if (m_iMethod < 0)
+    {
+        return(SCAN_ERROR);
+    }
+    ++p;
+    pToken = p;
+    p = FindCharFast(p, pBuffEnd, szUrlRanges, 4);
+    while (p < pBuffEnd && IsUrlChar(*p))
+    {
+        ++p;
+    }
+    if (p == pBuffEnd)
+    {
+        return(SCAN_INCOMPLETE);
+    }
+    if (' ' != *p || p == pToken)
+    {
+        return(SCAN_ERROR);
+    }
+    m_stUrl.pData = pToken;
+    m_stUrl.uiLen = p - pToken;
+    ++p;
+    if (pBuffEnd - p < 8)
+    {
+        return((0 == memcmp(p, "HTTP/1.", (pBuffEnd - p < 7) ? (pBuffEnd - p) : 7))
+                        ? SCAN_INCOMPLETE : SCAN_ERROR);
+    }
+    if (0 != memcmp(p, "HTTP/1.", 7) || p[7] < '0' || p[7] > '9')
+    {
+        return(SCAN_ERROR);
+    }
+    m_iHttpMinor = p[7] - '0';
+    p = SkipEol(p + 8, pBuffEnd);
+    if (nullptr == p)
+    {
+        return(SCAN_INCOMPLETE);
+    }
+    if (p > pBuffEnd)
+    {
+        return(SCAN_ERROR);
+    }
+
+    // header name ":" OWS value OWS CRLF，以空行结束
+    for (;;)
+    {
+        if (p == pBuffEnd)
+        {
+            return(SCAN_INCOMPLETE);
+        }
+        if ('\r' == *p || '\n' == *p)
+        {
+            p = SkipEol(p, pBuffEnd);
+            if (nullptr == p)
+            {
+                return(SCAN_INCOMPLETE);
+            }
+            if (p > pBuffEnd)
+            {
+                return(SCAN_ERROR);
+            }
+            break;
+        }
+        if (m_iHeaderNum == MAX_HEADER_NUM)
+        {
+            return(SCAN_ERROR);
+        }
+        HttpHeaderView& stHeader = m_astHeader[m_iHeaderNum];
+        pToken = p;
+        while (p < pBuffEnd && ':' != *p)
+        {
+            if (!IsTokenChar(*p))
+            {
+                return(SCAN_ERROR);     // 包括不再支持的多行header
+            }
+            ++p;
+        }
+        if (p == pBuffEnd)
+        {
+            return(SCAN_INCOMPLETE);
+        }
+        if (p == pToken)
+        {
+            return(SCAN_ERROR);
+        }
+        stHeader.stName.pData = pToken;
+        stHeader.stName.uiLen = p - pToken;
+        ++p;
+        while (p < pBuffEnd && (' ' == *p || '\t' == *p))
+        {
+            ++p;
+        }
+        pToken = p;
+        p = FindCharFast(p, pBuffEnd, szValueRanges, 6);
+        while (p < pBuffEnd && IsValueChar(*p))
+        {
+            ++p;
+        }
+        const char* pValueEnd = p;
+        p = SkipEol(p, pBuffEnd);
+        if (nullptr == p)
+        {
+            return(SCAN_INCOMPLETE);
+        }
+        if (p > pBuffEnd)
+        {
+            return(SCAN_ERROR);
+        }
+        while (pValueEnd > pToken && (' ' == pValueEnd[-1] || '\t' == pValueEnd[-1]))
+        {
+            --pValueEnd;
+        }
+        stHeader.stValue.pData = pToken;
+        stHeader.stValue.uiLen = pValueEnd - pToken;
+        ++m_iHeaderNum;
+    }
+    return(p - pBuff);
+}
+
+int HttpRequestScanner::MatchMethod(const char* pMethod, size_t uiLen)
+{
+    if (3 == uiLen && 0 == memcmp(pMethod, "GET", 3))
+    {
+        return(HTTP_GET);
+    }
+    if (4 == uiLen && 0 == memcmp(pMethod, "POST", 4))
+    {
+        return(HTTP_POST);
+    }
+    for (size_t i = 0; i < sizeof(s_astHttpMethod) / sizeof(s_astHttpMethod[0]); ++i)
+    {
+        if (uiLen == s_astHttpMethod[i].uiLen && 0 == memcmp(pMethod, s_astHttpMethod[i].szName, uiLen))
+        {
+            return(s_astHttpMethod[i].iMethod);
+        }
+    }
+    return(-1);
+}
+
+const char* HttpRequestScanner::FindCharFast(const char* pBuff, const char* pBuffEnd,
+                const char* szRanges, size_t uiRangesSize)
+{
+#ifdef __SSE4_2__
+    if (pBuffEnd - pBuff >= 16)
+    {
+        __m128i m128Ranges = _mm_loadu_si128((const __m128i*)szRanges);
+        size_t uiLeft = (pBuffEnd - pBuff) & ~15;
+        do
+        {
+            __m128i m128Data = _mm_loadu_si128((const __m128i*)pBuff);
+            int iIndex = _mm_cmpestri(m128Ranges, uiRangesSize, m128Data, 16,
+                            _SIDD_LEAST_SIGNIFICANT | _SIDD_CMP_RANGES | _SIDD_UBYTE_OPS);
+            if (16 != iIndex)
+            {
+                return(pBuff + iIndex);
+            }
+            pBuff += 16;
+            uiLeft -= 16;
+        } while (0 != uiLeft);
+    }
+#endif
+    return(pBuff);  // 剩余不足16字节的部分由调用方逐字节处理
+}
+
+} /* namespace neb */
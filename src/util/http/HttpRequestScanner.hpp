@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Project:  Nebula
+ * @file     HttpRequestScanner.hpp
+ * @brief    http请求头快速扫描
+ * @author   Bwar
+ * @date:    2026年10月18日
+ * @note     参照picohttpparser实现，一次扫描完整的http请求头，请求行和各header只
+ *           记录指向接收缓冲区的指针和长度，不做任何内存分配。编译器开启SSE4.2时
+ *           使用_mm_cmpestri每次比较16字节查找分隔符。
+ * Modify history:
+ ******************************************************************************/
+#ifndef SRC_UTIL_HTTP_HTTPREQUESTSCANNER_HPP_
+#define SRC_UTIL_HTTP_HTTPREQUESTSCANNER_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <strings.h>
+#include "http_parser.h"
+
+namespace neb
+{
+
+struct HttpStringView
+{
+    const char* pData = nullptr;
+    size_t uiLen = 0;
+
+    bool EqualsIgnoreCase(const char* szStr, size_t uiStrLen) const
+    {
+        return(uiLen == uiStrLen && 0 == strncasecmp(pData, szStr, uiLen));
+    }
+};
+
+struct HttpHeaderView
+{
+    HttpStringView stName;
+    HttpStringView stValue;
+};
+
+class HttpRequestScanner
+{
+public:
+    static const int SCAN_ERROR = -1;           ///< 不是合法的http请求头（或超出扫描器处理能力）
+    static const int SCAN_INCOMPLETE = -2;      ///< 请求头不完整
+    static const int MAX_HEADER_NUM = 64;
+
+    HttpRequestScanner();
+    ~HttpRequestScanner();
+
+    /**
+     * @brief 扫描http请求头
+     * @param pBuff 待扫描数据
+     * @param uiLen 待扫描数据长度
+     * @return 成功返回请求头（含结尾空行）长度，失败返回SCAN_ERROR或SCAN_INCOMPLETE
+     * @note 扫描结果指向pBuff，在pBuff数据被移除之前有效。
+     */
+    int Scan(const char* pBuff, size_t uiLen);
+
+    int GetMethod() const
+    {
+        return(m_iMethod);
+    }
+
+    int GetHttpMinor() const
+    {
+        return(m_iHttpMinor);
+    }
+
+    const HttpStringView& GetUrl() const
+    {
+        return(m_stUrl);
+    }
+
+    int GetHeaderNum() const
+    {
+        return(m_iHeaderNum);
+    }
+
+    const HttpHeaderView& GetHeader(int iIndex) const
+    {
+        return(m_astHeader[iIndex]);
+    }
+
+protected:
+    static int MatchMethod(const char* pMethod, size_t uiLen);
+    static const char* FindCharFast(const char* pBuff, const char* pBuffEnd,
+                    const char* szRanges, size_t uiRangesSize);
+
+private:
+    int m_iMethod;
+    int m_iHttpMinor;
+    int m_iHeaderNum;
+    HttpStringView m_stUrl;
+    HttpHeaderView m_astHeader[MAX_HEADER_NUM];
+};
+
+} /* namespace neb */
+
+#endif /* SRC_UTIL_HTTP_HTTPREQUESTSCANNER_HPP_ */